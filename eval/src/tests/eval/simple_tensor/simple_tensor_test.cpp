@@ -150,8 +150,8 @@ TEST("require that simple tensors support dimension reduction") {
 //-----------------------------------------------------------------------------
 
 struct SparseTensorExample {
-    TensorSpec make_spec() const {
-        return TensorSpec("tensor(x{},y{})")
+    TensorSpec make_spec(bool float_cells = false) const {
+        return TensorSpec(float_cells ? "tensor<float>(x{},y{})" : "tensor(x{},y{})")
             .add({{"x","a"},{"y","a"}}, 1)
             .add({{"x","a"},{"y","b"}}, 2)
             .add({{"x","b"},{"y","a"}}, 3);
@@ -200,7 +200,7 @@ TEST_F("require that sparse tensors can be decoded", SparseTensorExample()) {
     f1.encode_with_float(data3);
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data1)), f1.make_spec());
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data2)), f1.make_spec());
-    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec());
+    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec(true));
 }
 
 TEST_F("require that sparse tensors can be encoded", SparseTensorExample()) {
@@ -214,8 +214,8 @@ TEST_F("require that sparse tensors can be encoded", SparseTensorExample()) {
 //-----------------------------------------------------------------------------
 
 struct DenseTensorExample {
-    TensorSpec make_spec() const {
-        return TensorSpec("tensor(x[3],y[2])")
+    TensorSpec make_spec(bool float_cells = false) const {
+        return TensorSpec(float_cells ? "tensor<float>(x[3],y[2])" : "tensor(x[3],y[2])")
             .add({{"x",0},{"y",0}}, 1)
             .add({{"x",0},{"y",1}}, 2)
             .add({{"x",1},{"y",0}}, 3)
@@ -265,7 +265,7 @@ TEST_F("require that dense tensors can be decoded", DenseTensorExample()) {
     f1.encode_with_float(data3);
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data1)), f1.make_spec());
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data2)), f1.make_spec());
-    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec());
+    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec(true));
 }
 
 TEST_F("require that dense tensors can be encoded", DenseTensorExample()) {
@@ -279,8 +279,8 @@ TEST_F("require that dense tensors can be encoded", DenseTensorExample()) {
 //-----------------------------------------------------------------------------
 
 struct MixedTensorExample {
-    TensorSpec make_spec() const {
-        return TensorSpec("tensor(x{},y{},z[2])")
+    TensorSpec make_spec(bool float_cells = false) const {
+        return TensorSpec(float_cells ? "tensor<float>(x{},y{},z[2])" : "tensor(x{},y{},z[2])")
             .add({{"x","a"},{"y","a"},{"z",0}}, 1)
             .add({{"x","a"},{"y","a"},{"z",1}}, 2)
             .add({{"x","a"},{"y","b"},{"z",0}}, 3)
@@ -338,7 +338,7 @@ TEST_F("require that mixed tensors can be decoded", MixedTensorExample()) {
     f1.encode_with_float(data3);
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data1)), f1.make_spec());
     EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data2)), f1.make_spec());
-    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec());
+    EXPECT_EQUAL(to_spec(*SimpleTensor::decode(data3)), f1.make_spec(true));
 }
 
 TEST_F("require that mixed tensors can be encoded", MixedTensorExample()) {
@@ -351,4 +351,27 @@ TEST_F("require that mixed tensors can be encoded", MixedTensorExample()) {
 
 //-----------------------------------------------------------------------------
 
+TEST("require that int8 cells are rounded and clamped when encoded") {
+    auto tensor = SimpleTensor::create(TensorSpec("tensor<int8>(x[4])")
+                                       .add({{"x",0}}, 300.0)
+                                       .add({{"x",1}}, -300.0)
+                                       .add({{"x",2}}, 1.6)
+                                       .add({{"x",3}}, -1.6));
+    nbostream data;
+    nbostream expect;
+    SimpleTensor::encode(*tensor, data);
+    expect.putInt1_4Bytes(6);
+    expect.putInt1_4Bytes(2);
+    expect.putInt1_4Bytes(1);
+    expect.writeSmallString("x");
+    expect.putInt1_4Bytes(4);
+    expect << (int8_t) 127;
+    expect << (int8_t) -128;
+    expect << (int8_t) 2;
+    expect << (int8_t) -2;
+    EXPECT_EQUAL(Memory(data.peek(), data.size()), Memory(expect.peek(), expect.size()));
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -214,6 +214,9 @@ TEST("require that value type can make spec") {
     EXPECT_EQUAL("tensor(x{})", ValueType::tensor_type({{"x"}}).to_spec());
     EXPECT_EQUAL("tensor(y[10])", ValueType::tensor_type({{"y", 10}}).to_spec());
     EXPECT_EQUAL("tensor(x{},y[10],z[5])", ValueType::tensor_type({{"x"}, {"y", 10}, {"z", 5}}).to_spec());
+    EXPECT_EQUAL("tensor(y[10])", ValueType::tensor_type({{"y", 10}}, CellType::DOUBLE).to_spec());
+    EXPECT_EQUAL("tensor<float>(y[10])", ValueType::tensor_type({{"y", 10}}, CellType::FLOAT).to_spec());
+    EXPECT_EQUAL("tensor<int8>(x{},y[10])", ValueType::tensor_type({{"x"}, {"y", 10}}, CellType::INT8).to_spec());
 }
 
 TEST("require that value type spec can be parsed") {
@@ -224,7 +227,8 @@ TEST("require that value type spec can be parsed") {
     EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}), ValueType::from_spec("tensor(y[10])"));
     EXPECT_EQUAL(ValueType::tensor_type({{"x"}, {"y", 10}, {"z", 5}}), ValueType::from_spec("tensor(x{},y[10],z[5])"));
     EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}), ValueType::from_spec("tensor<double>(y[10])"));
-    EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}), ValueType::from_spec("tensor<float>(y[10])"));
+    EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}, CellType::FLOAT), ValueType::from_spec("tensor<float>(y[10])"));
+    EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}, CellType::INT8), ValueType::from_spec("tensor<int8>(y[10])"));
 }
 
 TEST("require that value type spec can be parsed with extra whitespace") {
@@ -236,7 +240,7 @@ TEST("require that value type spec can be parsed with extra whitespace") {
     EXPECT_EQUAL(ValueType::tensor_type({{"x"}, {"y", 10}, {"z", 5}}),
                  ValueType::from_spec(" tensor ( x { } , y [ 10 ] , z [ 5 ] ) "));
     EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}), ValueType::from_spec(" tensor < double > ( y [ 10 ] ) "));
-    EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}), ValueType::from_spec(" tensor < float > ( y [ 10 ] ) "));
+    EXPECT_EQUAL(ValueType::tensor_type({{"y", 10}}, CellType::FLOAT), ValueType::from_spec(" tensor < float > ( y [ 10 ] ) "));
 }
 
 TEST("require that malformed value type spec is parsed as error") {
@@ -349,4 +353,26 @@ TEST("require that types can be concatenated") {
     EXPECT_EQUAL(ValueType::concat(vx_5,   vy_7,   "z"), cxyz_572);
 }
 
+TEST("require that cell type is part of value type identity") {
+    EXPECT_TRUE(ValueType::from_spec("tensor<float>(x[3])").cell_type() == CellType::FLOAT);
+    EXPECT_TRUE(ValueType::from_spec("tensor(x[3])").cell_type() == CellType::DOUBLE);
+    EXPECT_NOT_EQUAL(ValueType::from_spec("tensor<float>(x[3])"), ValueType::from_spec("tensor(x[3])"));
+    EXPECT_NOT_EQUAL(ValueType::from_spec("tensor<float>(x[3])"), ValueType::from_spec("tensor<int8>(x[3])"));
+    EXPECT_TRUE(ValueType::either(ValueType::from_spec("tensor<float>(x[3])"),
+                                  ValueType::from_spec("tensor(x[3])")).is_error());
+}
+
+TEST("require that rename keeps cell type while calculating operations produce double cells") {
+    ValueType fx = ValueType::from_spec("tensor<float>(x[3])");
+    ValueType iy = ValueType::from_spec("tensor<int8>(y[2])");
+    EXPECT_EQUAL(fx.rename({"x"}, {"z"}), ValueType::from_spec("tensor<float>(z[3])"));
+    EXPECT_EQUAL(fx.map(), ValueType::from_spec("tensor(x[3])"));
+    EXPECT_EQUAL(fx.cell_cast(CellType::INT8), ValueType::from_spec("tensor<int8>(x[3])"));
+    EXPECT_EQUAL(ValueType::double_type().cell_cast(CellType::FLOAT), ValueType::double_type());
+    EXPECT_EQUAL(ValueType::join(fx, ValueType::double_type()), ValueType::from_spec("tensor(x[3])"));
+    EXPECT_EQUAL(ValueType::join(fx, iy), ValueType::from_spec("tensor(x[3],y[2])"));
+    EXPECT_EQUAL(ValueType::from_spec("tensor<float>(x[3],y[2])").reduce({"y"}), ValueType::from_spec("tensor(x[3])"));
+    EXPECT_EQUAL(ValueType::concat(fx, fx, "x"), ValueType::from_spec("tensor(x[6])"));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
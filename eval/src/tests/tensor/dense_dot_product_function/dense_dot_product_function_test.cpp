@@ -104,7 +104,10 @@ EvalFixture::ParamRepo make_params() {
         .add("v05_x5", spec({x(5)}, MyVecSeq(6.0)))
         .add("v06_x5", spec({x(5)}, MyVecSeq(7.0)))
         .add("m01_x3y3", spec({x(3),y(3)}, MyVecSeq(1.0)))
-        .add("m02_x3y3", spec({x(3),y(3)}, MyVecSeq(2.0)));
+        .add("m02_x3y3", spec({x(3),y(3)}, MyVecSeq(2.0)))
+        .add("v05_x5f", cell_cast(spec({x(5)}, MyVecSeq(6.0)), CellType::FLOAT))
+        .add("v06_x5f", cell_cast(spec({x(5)}, MyVecSeq(7.0)), CellType::FLOAT))
+        .add("v07_x5i", cell_cast(spec({x(5)}, MyVecSeq(8.0)), CellType::INT8));
 }
 EvalFixture::ParamRepo param_repo = make_params();
 
@@ -136,6 +139,14 @@ TEST("require that dot product with compatible dimensions is optimized") {
     TEST_DO(assertOptimized("reduce(v05_x5*v06_x5,sum)"));
 }
 
+TEST("require that dot product with float and int8 cells is optimized") {
+    TEST_DO(assertOptimized("reduce(v05_x5f*v06_x5f,sum)"));
+    TEST_DO(assertOptimized("reduce(v05_x5*v06_x5f,sum)"));
+    TEST_DO(assertOptimized("reduce(v05_x5f*v06_x5,sum)"));
+    TEST_DO(assertOptimized("reduce(v07_x5i*v06_x5f,sum)"));
+    TEST_DO(assertOptimized("reduce(v07_x5i*v07_x5i,sum)"));
+}
+
 TEST("require that dot product with incompatible dimensions is NOT optimized") {
     TEST_DO(assertNotOptimized("reduce(v02_x3*v04_y3,sum)"));
     TEST_DO(assertNotOptimized("reduce(v04_y3*v02_x3,sum)"));
@@ -188,6 +199,9 @@ TEST("require that type compatibility test is appropriate") {
     TEST_DO(verify_compatible("tensor(x[3],y[7],z[9])", "tensor(x[5],y[7],z[9])"));
     TEST_DO(verify_not_compatible("tensor(x[5],y[7],z[9])", "tensor(x[5],y[5],z[9])"));
     TEST_DO(verify_not_compatible("tensor(x[5],y[7],z[9])", "tensor(x[5],y[7],z[5])"));
+    TEST_DO(verify_compatible("tensor<float>(x[5])", "tensor<float>(x[5])"));
+    TEST_DO(verify_compatible("tensor<float>(x[5])", "tensor(x[5])"));
+    TEST_DO(verify_compatible("tensor<int8>(x[5])", "tensor<float>(x[5])"));
 }
 
 //-----------------------------------------------------------------------------
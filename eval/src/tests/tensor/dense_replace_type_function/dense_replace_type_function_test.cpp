@@ -13,12 +13,12 @@ using namespace vespalib::eval;
 using namespace vespalib::tensor;
 using namespace vespalib;
 
-using CellsRef = DenseTensorView::CellsRef;
+using CellsRef = ConstArrayRef<double>;
 
 const TensorEngine &engine = DefaultTensorEngine::ref();
 
 CellsRef getCellsRef(const eval::Value &value) {
-    return static_cast<const DenseTensorView &>(value).cellsRef();
+    return static_cast<const DenseTensorView &>(value).cellsRef().typify<double>();
 }
 
 struct ChildMock : Leaf {
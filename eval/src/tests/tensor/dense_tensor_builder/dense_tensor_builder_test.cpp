@@ -27,7 +27,7 @@ assertTensor(const std::vector<ValueType::Dimension> &expDims,
 {
     const DenseTensor &realTensor = dynamic_cast<const DenseTensor &>(tensor);
     EXPECT_EQUAL(ValueType::tensor_type(expDims), realTensor.type());
-    EXPECT_EQUAL(expCells, make_vector(realTensor.cellsRef()));
+    EXPECT_EQUAL(expCells, make_vector(realTensor.cellsRef().typify<double>()));
 }
 
 void
@@ -49,7 +49,10 @@ EvalFixture::ParamRepo make_params() {
         .add("x8y5", spec({x(8),y(5)}, MyMatSeq()))
         .add("y5z8", spec({y(5),z(8)}, MyMatSeq()))
         .add("x5y16", spec({x(5),y(16)}, MyMatSeq()))
-        .add("y16z5", spec({y(16),z(5)}, MyMatSeq()));
+        .add("y16z5", spec({y(16),z(5)}, MyMatSeq()))
+        .add("y16f", cell_cast(spec({y(16)}, MyVecSeq()), CellType::FLOAT))
+        .add("x5y16f", cell_cast(spec({x(5),y(16)}, MyMatSeq()), CellType::FLOAT))
+        .add("y16z5f", cell_cast(spec({y(16),z(5)}, MyMatSeq()), CellType::FLOAT));
 }
 EvalFixture::ParamRepo param_repo = make_params();
 
@@ -86,6 +89,13 @@ TEST("require that xw product gives same results as reference join/reduce") {
     TEST_DO(verify_optimized("reduce(y16*y16z5,sum,y)", 16, 5, false));
 }
 
+TEST("require that xw product with float cells gives same results as reference join/reduce") {
+    TEST_DO(verify_optimized("reduce(y16f*x5y16f,sum,y)", 16, 5, true));
+    TEST_DO(verify_optimized("reduce(y16f*y16z5f,sum,y)", 16, 5, false));
+    TEST_DO(verify_optimized("reduce(y16*x5y16f,sum,y)", 16, 5, true));
+    TEST_DO(verify_optimized("reduce(y16f*y16z5,sum,y)", 16, 5, false));
+}
+
 TEST("require that various variants of xw product can be optimized") {
     TEST_DO(verify_optimized("reduce(y3*x2y3,sum,y)", 3, 2, true));
     TEST_DO(verify_optimized("reduce(x2y3*y3,sum,y)", 3, 2, true));
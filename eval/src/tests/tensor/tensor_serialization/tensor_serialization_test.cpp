@@ -12,9 +12,11 @@
 #include <vespa/vespalib/objects/hexdump.h>
 #include <ostream>
 #include <vespa/eval/tensor/dense/dense_tensor_view.h>
+#include <vespa/eval/tensor/dense/typed_dense_tensor.h>
 
 using namespace vespalib::tensor;
 using vespalib::nbostream;
+using vespalib::eval::CellType;
 using ExpBuffer = std::vector<uint8_t>;
 
 namespace std {
@@ -162,6 +164,14 @@ struct DenseFixture
     void assertSerialized(const ExpBuffer &exp, const DenseTensorCells &rhs) {
         assertSerialized(exp, SerializeFormat::DOUBLE, rhs);
     }
+    static CellType toCellType(SerializeFormat format) {
+        switch (format) {
+        case SerializeFormat::FLOAT: return CellType::FLOAT;
+        case SerializeFormat::INT8: return CellType::INT8;
+        case SerializeFormat::DOUBLE: break;
+        }
+        return CellType::DOUBLE;
+    }
     template <typename T>
     void assertCellsOnly(const ExpBuffer &exp, const DenseTensorView & rhs) {
         nbostream a(&exp[0], exp.size());
@@ -169,7 +179,7 @@ struct DenseFixture
         TypedBinaryFormat::deserializeCellsOnlyFromDenseTensors(a, v);
         EXPECT_EQUAL(v.size(), rhs.cellsRef().size());
         for (size_t i(0); i < v.size(); i++) {
-            EXPECT_EQUAL(v[i], rhs.cellsRef()[i]);
+            EXPECT_EQUAL(v[i], T(rhs.cellsRef().get(i)));
         }
     }
     void assertSerialized(const ExpBuffer &exp, SerializeFormat cellType, const DenseTensorCells &rhs) {
@@ -178,7 +188,8 @@ struct DenseFixture
         TypedBinaryFormat::serialize(rhsStream, *rhsTensor, cellType);
         EXPECT_EQUAL(exp, rhsStream);
         auto rhs2 = deserialize(rhsStream);
-        EXPECT_EQUAL(*rhs2, *rhsTensor);
+        auto expTensor = convert_cells(dynamic_cast<const DenseTensorView &>(*rhsTensor), toCellType(cellType));
+        EXPECT_EQUAL(*rhs2, *expTensor);
 
         assertCellsOnly<float>(exp, dynamic_cast<const DenseTensorView &>(*rhs2));
         assertCellsOnly<double>(exp, dynamic_cast<const DenseTensorView &>(*rhs2));
@@ -286,4 +297,51 @@ TEST_F("test 'float' cells", DenseFixture) {
 }
 
 
+TEST_F("test 'int8' cells", DenseFixture) {
+    TEST_DO(f.assertSerialized({0x06, 0x02, 0x02, 0x01, 0x78, 0x03,
+                                0x01, 0x79, 0x05,
+                                0x00, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x03},
+                               SerializeFormat::INT8, { {{{"x",2}, {"y",4}}, 3} }));
+}
+
+TEST_F("require that tensors are serialized using their own cell type", DenseFixture) {
+    Tensor::UP tensor = f.createTensor({ {{{"x",0}}, 1}, {{{"x",1}}, 3} });
+    auto floatTensor = convert_cells(dynamic_cast<const DenseTensorView &>(*tensor), CellType::FLOAT);
+    nbostream stream;
+    f.serialize(stream, *floatTensor);
+    EXPECT_EQUAL(ExpBuffer({0x06, 0x01, 0x01, 0x01, 0x78, 0x02,
+                            0x3f, 0x80, 0x00, 0x00,
+                            0x40, 0x40, 0x00, 0x00}), stream);
+    auto result = f.deserialize(stream);
+    EXPECT_EQUAL(result->type().to_spec(), "tensor<float>(x[2])");
+    EXPECT_EQUAL(*result, *floatTensor);
+}
+
+TEST_F("require that out of range cells are rounded and clamped when serialized as int8", DenseFixture) {
+    Tensor::UP tensor = f.createTensor({ {{{"x",0}}, 300}, {{{"x",1}}, -300}, {{{"x",2}}, 1.6}, {{{"x",3}}, -1.6} });
+    nbostream stream;
+    TypedBinaryFormat::serialize(stream, *tensor, SerializeFormat::INT8);
+    EXPECT_EQUAL(ExpBuffer({0x06, 0x02, 0x01, 0x01, 0x78, 0x04,
+                            0x7f, 0x80, 0x02, 0xfe}), stream);
+}
+
+TEST_F("require that float cells written before cell types existed deserialize to float tensor with same values", DenseFixture) {
+    // Dense tensor with double type serialized with float cells by an earlier version.
+    ExpBuffer oldFormat({0x06, 0x01, 0x01, 0x01, 0x78, 0x02,
+                         0x3f, 0x80, 0x00, 0x00,
+                         0x40, 0x40, 0x00, 0x00});
+    nbostream stream(&oldFormat[0], oldFormat.size());
+    auto result = f.deserialize(stream);
+    EXPECT_EQUAL(result->type().to_spec(), "tensor<float>(x[2])");
+    Tensor::UP expTensor = f.createTensor({ {{{"x",0}}, 1}, {{{"x",1}}, 3} });
+    const auto &cells = dynamic_cast<const DenseTensorView &>(*result).cellsRef();
+    const auto &expCells = dynamic_cast<const DenseTensorView &>(*expTensor).cellsRef();
+    ASSERT_EQUAL(expCells.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        EXPECT_EQUAL(expCells.get(i), cells.get(i));
+    }
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,45 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace vespalib::eval {
+
+/**
+ * The type of the cells stored in a tensor. Cell values are always
+ * exposed as double, the cell type only decides how the cells are
+ * stored and serialized.
+ **/
+enum class CellType : char { DOUBLE, FLOAT, INT8 };
+
+template <typename CT> constexpr CellType get_cell_type();
+template <> constexpr CellType get_cell_type<double>() { return CellType::DOUBLE; }
+template <> constexpr CellType get_cell_type<float>() { return CellType::FLOAT; }
+template <> constexpr CellType get_cell_type<int8_t>() { return CellType::INT8; }
+
+template <typename CT> constexpr bool check_cell_type(CellType type) { return (type == get_cell_type<CT>()); }
+
+/**
+ * Converts a double value to the given cell type. Values converted to
+ * int8 are rounded to nearest and clamped to [-128, 127], since casting
+ * an out-of-range double to an integer type is undefined.
+ **/
+template <typename CT> inline CT convert_cell(double value) { return value; }
+template <> inline int8_t convert_cell<int8_t>(double value) {
+    return std::max(-128.0, std::min(127.0, std::round(value)));
+}
+
+constexpr size_t cell_type_size(CellType type) {
+    switch (type) {
+    case CellType::DOUBLE: return sizeof(double);
+    case CellType::FLOAT: return sizeof(float);
+    case CellType::INT8: return sizeof(int8_t);
+    }
+    return 0;
+}
+
+}
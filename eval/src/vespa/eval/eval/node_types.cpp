@@ -72,7 +72,7 @@ struct TypeResolver : public NodeVisitor, public NodeTraverser {
     }
 
     void resolve_op1(const Node &node) {
-        bind_type(state.peek(0), node);
+        bind_type(state.peek(0).map(), node);
     }
 
     void resolve_op2(const Node &node) {
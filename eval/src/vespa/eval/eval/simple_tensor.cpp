@@ -4,6 +4,8 @@
 #include "simple_tensor_engine.h"
 #include "operation.h"
 #include <vespa/vespalib/objects/nbostream.h>
+#include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <algorithm>
 #include <cassert>
 
@@ -21,6 +23,25 @@ namespace {
 
 constexpr uint32_t DOUBLE_CELL_TYPE = 0;
 constexpr uint32_t FLOAT_CELL_TYPE = 1;
+constexpr uint32_t INT8_CELL_TYPE = 2;
+
+uint32_t cell_type_to_id(CellType cell_type) {
+    switch (cell_type) {
+    case CellType::DOUBLE: return DOUBLE_CELL_TYPE;
+    case CellType::FLOAT: return FLOAT_CELL_TYPE;
+    case CellType::INT8: return INT8_CELL_TYPE;
+    }
+    abort();
+}
+
+CellType id_to_cell_type(uint32_t id) {
+    switch (id) {
+    case DOUBLE_CELL_TYPE: return CellType::DOUBLE;
+    case FLOAT_CELL_TYPE: return CellType::FLOAT;
+    case INT8_CELL_TYPE: return CellType::INT8;
+    }
+    throw IllegalArgumentException(make_string("Received unknown tensor cell type: %u", id));
+}
 
 void assert_type(const ValueType &type) {
     (void) type;
@@ -422,11 +443,11 @@ struct Format {
     bool     is_dense;
     bool     with_cell_type;
     uint32_t tag;
-    explicit Format(const TypeMeta &meta)
+    explicit Format(const TypeMeta &meta, CellType cell_type)
         : is_sparse(meta.mapped.size() > 0),
           is_dense((meta.indexed.size() > 0) || !is_sparse),
-          with_cell_type(false),
-          tag((is_sparse ? 0x1 : 0) | (is_dense ? 0x2 : 0)) {}
+          with_cell_type(cell_type != CellType::DOUBLE),
+          tag((is_sparse ? 0x1 : 0) | (is_dense ? 0x2 : 0) | (with_cell_type ? 0x4 : 0)) {}
     explicit Format(uint32_t tag_in)
         : is_sparse((tag_in & 0x1) != 0),
           is_dense((tag_in & 0x2) != 0),
@@ -463,14 +484,28 @@ void encode_mapped_labels(nbostream &output, const TypeMeta &meta, const Address
     }
 }
 
-uint32_t maybe_decode_cell_type(nbostream &input, const Format &format) {
+void maybe_encode_cell_type(nbostream &output, const Format &format, CellType cell_type) {
     if (format.with_cell_type) {
-        return input.getInt1_4Bytes();
+        output.putInt1_4Bytes(cell_type_to_id(cell_type));
     }
-    return DOUBLE_CELL_TYPE;
 }
 
-ValueType decode_type(nbostream &input, const Format &format) {
+void encode_cell(nbostream &output, CellType cell_type, double value) {
+    switch (cell_type) {
+    case CellType::DOUBLE: output << value; break;
+    case CellType::FLOAT: output << convert_cell<float>(value); break;
+    case CellType::INT8: output << convert_cell<int8_t>(value); break;
+    }
+}
+
+CellType maybe_decode_cell_type(nbostream &input, const Format &format) {
+    if (format.with_cell_type) {
+        return id_to_cell_type(input.getInt1_4Bytes());
+    }
+    return CellType::DOUBLE;
+}
+
+ValueType decode_type(nbostream &input, const Format &format, CellType cell_type) {
     std::vector<ValueType::Dimension> dim_list;
     if (format.is_sparse) {
         size_t cnt = input.getInt1_4Bytes();
@@ -490,7 +525,7 @@ ValueType decode_type(nbostream &input, const Format &format) {
     }
     return (dim_list.empty()
             ? ValueType::double_type()
-            : ValueType::tensor_type(std::move(dim_list)));
+            : ValueType::tensor_type(std::move(dim_list), cell_type));
 }
 
 size_t maybe_decode_num_blocks(nbostream &input, const TypeMeta &meta, const Format &format) {
@@ -508,7 +543,16 @@ void decode_mapped_labels(nbostream &input, const TypeMeta &meta, Address &addr)
     }
 }
 
-void decode_cells(uint32_t cell_type, nbostream &input, const ValueType &type, const TypeMeta meta,
+double decode_cell(nbostream &input, CellType cell_type) {
+    switch (cell_type) {
+    case CellType::DOUBLE: return input.readValue<double>();
+    case CellType::FLOAT: return input.readValue<float>();
+    case CellType::INT8: return input.readValue<int8_t>();
+    }
+    abort();
+}
+
+void decode_cells(CellType cell_type, nbostream &input, const ValueType &type, const TypeMeta meta,
                   Address &address, size_t n, Builder &builder)
 {
     if (n < meta.indexed.size()) {
@@ -518,10 +562,7 @@ void decode_cells(uint32_t cell_type, nbostream &input, const ValueType &type, c
             decode_cells(cell_type, input, type, meta, address, n + 1, builder);
         }
     } else {
-        double value = (cell_type == FLOAT_CELL_TYPE)
-                       ? input.readValue<float>()
-                       : input.readValue<double>();
-        builder.set(address, value);
+        builder.set(address, decode_cell(input, cell_type));
     }
 }
 
@@ -574,7 +615,7 @@ SimpleTensor::map(map_fun_t function) const
     for (auto &cell: cells) {
         cell.value = function(cell.value);
     }
-    return std::make_unique<SimpleTensor>(_type, std::move(cells));
+    return std::make_unique<SimpleTensor>(_type.map(), std::move(cells));
 }
 
 std::unique_ptr<SimpleTensor>
@@ -690,8 +731,10 @@ void
 SimpleTensor::encode(const SimpleTensor &tensor, nbostream &output)
 {
     TypeMeta meta(tensor.type());
-    Format format(meta);
+    CellType cell_type = tensor.type().cell_type();
+    Format format(meta, cell_type);
     output.putInt1_4Bytes(format.tag);
+    maybe_encode_cell_type(output, format, cell_type);
     encode_type(output, format, tensor.type(), meta);
     maybe_encode_num_blocks(output, meta, tensor.cells().size() / meta.block_size);
     View view(tensor, meta.mapped);
@@ -699,7 +742,7 @@ SimpleTensor::encode(const SimpleTensor &tensor, nbostream &output)
         encode_mapped_labels(output, meta, block.begin()->get().address);
         View subview(block, meta.indexed);
         for (auto cell = subview.first_range(); !cell.empty(); cell = subview.next_range(cell)) {
-            output << cell.begin()->get().value;
+            encode_cell(output, cell_type, cell.begin()->get().value);
         }
     }
 }
@@ -708,8 +751,8 @@ std::unique_ptr<SimpleTensor>
 SimpleTensor::decode(nbostream &input)
 {
     Format format(input.getInt1_4Bytes());
-    uint32_t cell_type = maybe_decode_cell_type(input, format);
-    ValueType type = decode_type(input, format);
+    CellType cell_type = maybe_decode_cell_type(input, format);
+    ValueType type = decode_type(input, format, cell_type);
     TypeMeta meta(type);
     Builder builder(type);
     size_t num_blocks = maybe_decode_num_blocks(input, meta, format);
@@ -322,7 +322,7 @@ const Node &reduce(const Node &child, Aggr aggr, const std::vector<vespalib::str
 }
 
 const Node &map(const Node &child, map_fun_t function, Stash &stash) {
-    ValueType result_type = child.result_type();
+    ValueType result_type = child.result_type().map();
     return stash.create<Map>(result_type, child, function);
 }
 
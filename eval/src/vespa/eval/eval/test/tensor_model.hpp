@@ -254,6 +254,15 @@ TensorSpec spec() {
     return spec(Layout({}));
 }
 
+// Make a copy of a tensor spec where the tensor type uses the given cell type
+TensorSpec cell_cast(const TensorSpec &in, CellType cell_type) {
+    TensorSpec out(ValueType::from_spec(in.type()).cell_cast(cell_type).to_spec());
+    for (const auto &cell: in.cells()) {
+        out.add(cell.first, cell.second);
+    }
+    return out;
+}
+
 TensorSpec spec(const vespalib::string &type,
                 const std::vector<std::pair<TensorSpec::Address, TensorSpec::Value>> &cells) {
     TensorSpec spec("tensor(" + type + ")");
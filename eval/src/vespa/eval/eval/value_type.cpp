@@ -164,6 +164,15 @@ ValueType::dimension_names() const
     return result;
 }
 
+ValueType
+ValueType::cell_cast(CellType to_cell_type) const
+{
+    if (!is_tensor()) {
+        return *this;
+    }
+    return ValueType(Type::TENSOR, to_cell_type, std::vector<Dimension>(_dimensions));
+}
+
 ValueType
 ValueType::reduce(const std::vector<vespalib::string> &dimensions_in) const
 {
@@ -202,11 +211,11 @@ ValueType::rename(const std::vector<vespalib::string> &from,
     if (!renamer.matched_all()) {
         return error_type();
     }
-    return tensor_type(dim_list);
+    return tensor_type(dim_list, _cell_type);
 }
 
 ValueType
-ValueType::tensor_type(std::vector<Dimension> dimensions_in)
+ValueType::tensor_type(std::vector<Dimension> dimensions_in, CellType cell_type)
 {
     if (dimensions_in.empty()) {
         return double_type();
@@ -215,7 +224,7 @@ ValueType::tensor_type(std::vector<Dimension> dimensions_in)
     if (!verify_dimensions(dimensions_in)) {
         return error_type();
     }
-    return ValueType(Type::TENSOR, std::move(dimensions_in));
+    return ValueType(Type::TENSOR, cell_type, std::move(dimensions_in));
 }
 
 ValueType
@@ -236,9 +245,9 @@ ValueType::join(const ValueType &lhs, const ValueType &rhs)
     if (lhs.is_error() || rhs.is_error()) {
         return error_type();
     } else if (lhs.is_double()) {
-        return rhs;
+        return rhs.map();
     } else if (rhs.is_double()) {
-        return lhs;
+        return lhs.map();
     }
     MyJoin result(lhs._dimensions, rhs._dimensions);
     if (result.mismatch) {
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "cell_type.h"
 #include <vespa/vespalib/stllike/string.h>
 #include <vector>
 
@@ -11,6 +12,10 @@ namespace vespalib::eval {
  * The type of a Value. This is used for type-resolution during
  * compilation of interpreted functions using boxed polymorphic
  * values.
+ *
+ * Tensor types also have a cell type. Operations calculating new cell
+ * values (map, join, reduce, concat) always produce double cells,
+ * while rename keeps the cell type of its input.
  **/
 class ValueType
 {
@@ -36,13 +41,14 @@ public:
 
 private:
     Type     _type;
+    CellType _cell_type;
     std::vector<Dimension> _dimensions;
 
     ValueType(Type type_in)
-        : _type(type_in), _dimensions() {}
+        : _type(type_in), _cell_type(CellType::DOUBLE), _dimensions() {}
 
-    ValueType(Type type_in, std::vector<Dimension> &&dimensions_in)
-        : _type(type_in), _dimensions(std::move(dimensions_in)) {}
+    ValueType(Type type_in, CellType cell_type_in, std::vector<Dimension> &&dimensions_in)
+        : _type(type_in), _cell_type(cell_type_in), _dimensions(std::move(dimensions_in)) {}
 
 public:
     ValueType(ValueType &&) = default;
@@ -51,6 +57,7 @@ public:
     ValueType &operator=(const ValueType &) = default;
     ~ValueType();
     Type type() const { return _type; }
+    CellType cell_type() const { return _cell_type; }
     bool is_error() const { return (_type == Type::ERROR); }
     bool is_double() const { return (_type == Type::DOUBLE); }
     bool is_tensor() const { return (_type == Type::TENSOR); }
@@ -60,17 +67,21 @@ public:
     size_t dimension_index(const vespalib::string &name) const;
     std::vector<vespalib::string> dimension_names() const;
     bool operator==(const ValueType &rhs) const {
-        return ((_type == rhs._type) && (_dimensions == rhs._dimensions));
+        return ((_type == rhs._type) &&
+                (_cell_type == rhs._cell_type) &&
+                (_dimensions == rhs._dimensions));
     }
     bool operator!=(const ValueType &rhs) const { return !(*this == rhs); }
 
+    ValueType cell_cast(CellType to_cell_type) const;
+    ValueType map() const { return cell_cast(CellType::DOUBLE); }
     ValueType reduce(const std::vector<vespalib::string> &dimensions_in) const;
     ValueType rename(const std::vector<vespalib::string> &from,
                      const std::vector<vespalib::string> &to) const;
 
     static ValueType error_type() { return ValueType(Type::ERROR); }
     static ValueType double_type() { return ValueType(Type::DOUBLE); }
-    static ValueType tensor_type(std::vector<Dimension> dimensions_in);
+    static ValueType tensor_type(std::vector<Dimension> dimensions_in, CellType cell_type = CellType::DOUBLE);
     static ValueType from_spec(const vespalib::string &spec);
     vespalib::string to_spec() const;
     static ValueType join(const ValueType &lhs, const ValueType &rhs);
@@ -146,7 +146,7 @@ std::vector<ValueType::Dimension> parse_dimension_list(ParseContext &ctx) {
     return list;
 }
 
-vespalib::string parse_cell_type(ParseContext &ctx) {
+CellType parse_cell_type(ParseContext &ctx) {
     auto mark = ctx.mark();
     ctx.skip_spaces();
     ctx.eat('<');
@@ -155,9 +155,26 @@ vespalib::string parse_cell_type(ParseContext &ctx) {
     ctx.eat('>');
     if (ctx.failed()) {
         ctx.revert(mark);
-        cell_type = "double";
+        return CellType::DOUBLE;
     }
-    return cell_type;
+    if (cell_type == "double") {
+        return CellType::DOUBLE;
+    } else if (cell_type == "float") {
+        return CellType::FLOAT;
+    } else if (cell_type == "int8") {
+        return CellType::INT8;
+    }
+    ctx.fail();
+    return CellType::DOUBLE;
+}
+
+const char *cell_type_name(CellType cell_type) {
+    switch (cell_type) {
+    case CellType::DOUBLE: return "double";
+    case CellType::FLOAT: return "float";
+    case CellType::INT8: return "int8";
+    }
+    return "double";
 }
 
 } // namespace vespalib::eval::value_type::<anonymous>
@@ -172,13 +189,10 @@ parse_spec(const char *pos_in, const char *end_in, const char *&pos_out)
     } else if (type_name == "double") {
         return ValueType::double_type();
     } else if (type_name == "tensor") {
-        vespalib::string cell_type = parse_cell_type(ctx);
-        if ((cell_type != "double") && (cell_type != "float")) {
-            ctx.fail();
-        }
+        CellType cell_type = parse_cell_type(ctx);
         std::vector<ValueType::Dimension> list = parse_dimension_list(ctx);
         if (!ctx.failed()) {
-            return ValueType::tensor_type(std::move(list));
+            return ValueType::tensor_type(std::move(list), cell_type);
         }
     } else {
         ctx.fail();
@@ -212,6 +226,9 @@ to_spec(const ValueType &type)
         break;
     case ValueType::Type::TENSOR:
         os << "tensor";
+        if (type.cell_type() != CellType::DOUBLE) {
+            os << "<" << cell_type_name(type.cell_type()) << ">";
+        }
         if (!type.dimensions().empty()) {
             os << "(";
             for (const auto &d: type.dimensions()) {            
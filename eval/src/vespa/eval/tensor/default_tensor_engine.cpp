@@ -7,6 +7,7 @@
 #include "serialization/typed_binary_format.h"
 #include "dense/dense_tensor.h"
 #include "dense/dense_tensor_builder.h"
+#include "dense/typed_dense_tensor.h"
 #include "dense/dense_dot_product_function.h"
 #include "dense/dense_xw_product_function.h"
 #include "dense/dense_fast_rename_optimizer.h"
@@ -150,7 +151,11 @@ DefaultTensorEngine::from_spec(const TensorSpec &spec) const
             }
             builder.addCell(cell.second);
         }
-        return builder.build();
+        auto tensor = builder.build();
+        if (type.cell_type() != eval::CellType::DOUBLE) {
+            return convert_cells(*tensor, type.cell_type());
+        }
+        return tensor;
     } else if (is_sparse) {
         DefaultTensor::builder builder;
         std::map<vespalib::string,DefaultTensor::builder::Dimension> dimension_map;
@@ -352,8 +357,9 @@ size_t vector_size(const ValueType &type, const vespalib::string &dimension) {
 void append_vector(double *&pos, const Value &value) {
     if (auto tensor = value.as_tensor()) {
         const DenseTensorView *view = static_cast<const DenseTensorView *>(tensor);
-        for (double cell: view->cellsRef()) {
-            *pos++ = cell;
+        auto cells = view->cellsRef();
+        for (size_t i = 0; i < cells.size(); ++i) {
+            *pos++ = cells.get(i);
         }
     } else {
         *pos++ = value.as_double();
@@ -23,6 +23,10 @@ bool is_concrete_dense_tensor(const ValueType &type) {
     return type.is_dense();
 }
 
+bool same_cell_type(const ValueType &a, const ValueType &b) {
+    return (a.cell_type() == b.cell_type());
+}
+
 bool not_overlapping(const ValueType &a, const ValueType &b) {
     size_t npos = ValueType::Dimension::npos;
     for (const auto &dim: b.dimensions()) {
@@ -58,10 +62,10 @@ DenseAddDimensionOptimizer::optimize(const eval::TensorFunction &expr, Stash &st
             is_concrete_dense_tensor(rhs.result_type()) &&
             not_overlapping(lhs.result_type(), rhs.result_type()))
         {
-            if (is_unit_constant(lhs)) {
+            if (is_unit_constant(lhs) && same_cell_type(rhs.result_type(), expr.result_type())) {
                 return DenseReplaceTypeFunction::create_compact(expr.result_type(), rhs, stash);
             }
-            if (is_unit_constant(rhs)) {
+            if (is_unit_constant(rhs) && same_cell_type(lhs.result_type(), expr.result_type())) {
                 return DenseReplaceTypeFunction::create_compact(expr.result_type(), lhs, stash);
             }
         }
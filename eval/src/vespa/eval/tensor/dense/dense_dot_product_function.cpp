@@ -24,15 +24,21 @@ CellsRef getCellsRef(const eval::Value &value) {
     return denseTensor.cellsRef();
 }
 
+template <typename LCT, typename RCT>
 void my_dot_product_op(eval::InterpretedFunction::State &state, uint64_t param) {
     auto *hw_accelerator = (hwaccelrated::IAccelrated *)(param);
-    DenseTensorView::CellsRef lhsCells = getCellsRef(state.peek(1));
-    DenseTensorView::CellsRef rhsCells = getCellsRef(state.peek(0));
+    auto lhsCells = getCellsRef(state.peek(1)).typify<LCT>();
+    auto rhsCells = getCellsRef(state.peek(0)).typify<RCT>();
     size_t numCells = std::min(lhsCells.size(), rhsCells.size());
-    double result = hw_accelerator->dotProduct(lhsCells.cbegin(), rhsCells.cbegin(), numCells);
+    double result = DotProduct<LCT,RCT>::apply(*hw_accelerator, lhsCells.cbegin(), rhsCells.cbegin(), numCells);
     state.pop_pop_push(state.stash.create<eval::DoubleValue>(result));
 }
 
+struct MyDotProductOp {
+    template <typename LCT, typename RCT>
+    static eval::InterpretedFunction::op_function call() { return my_dot_product_op<LCT,RCT>; }
+};
+
 } // namespace vespalib::tensor::<unnamed>
 
 DenseDotProductFunction::DenseDotProductFunction(const eval::TensorFunction &lhs_in,
@@ -45,7 +51,8 @@ DenseDotProductFunction::DenseDotProductFunction(const eval::TensorFunction &lhs
 eval::InterpretedFunction::Instruction
 DenseDotProductFunction::compile_self(Stash &) const
 {
-    return eval::InterpretedFunction::Instruction(my_dot_product_op, (uint64_t)(_hwAccelerator.get()));
+    auto op = dispatch_2<MyDotProductOp>(lhs().result_type().cell_type(), rhs().result_type().cell_type());
+    return eval::InterpretedFunction::Instruction(op, (uint64_t)(_hwAccelerator.get()));
 }
 
 bool
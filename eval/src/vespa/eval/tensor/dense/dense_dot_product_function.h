@@ -7,6 +7,36 @@
 
 namespace vespalib::tensor {
 
+/**
+ * Dot product of two arrays of cells, possibly of different cell
+ * types. The hardware accelerated implementations are used when both
+ * sides are double or both sides are float.
+ */
+template <typename LCT, typename RCT>
+struct DotProduct {
+    static double apply(const hwaccelrated::IAccelrated &, const LCT *lhs, const RCT *rhs, size_t count) {
+        double result = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            result += lhs[i] * rhs[i];
+        }
+        return result;
+    }
+};
+
+template <>
+struct DotProduct<double,double> {
+    static double apply(const hwaccelrated::IAccelrated &hw, const double *lhs, const double *rhs, size_t count) {
+        return hw.dotProduct(lhs, rhs, count);
+    }
+};
+
+template <>
+struct DotProduct<float,float> {
+    static double apply(const hwaccelrated::IAccelrated &hw, const float *lhs, const float *rhs, size_t count) {
+        return hw.dotProduct(lhs, rhs, count);
+    }
+};
+
 /**
  * Tensor function for a dot product between two 1-dimensional dense tensors.
  */
@@ -9,7 +9,7 @@
 
 namespace vespalib::tensor {
 
-using CellsRef = DenseTensorView::CellsRef;
+using CellsRef = ConstArrayRef<double>;
 using eval::Value;
 using eval::ValueType;
 using eval::TensorFunction;
@@ -20,7 +20,7 @@ namespace {
 
 CellsRef getCellsRef(const eval::Value &value) {
     const DenseTensorView &denseTensor = static_cast<const DenseTensorView &>(value);
-    return denseTensor.cellsRef();
+    return denseTensor.cellsRef().typify<double>();
 }
 
 template <bool write_left>
@@ -41,7 +41,7 @@ void my_inplace_join_op(eval::InterpretedFunction::State &state, uint64_t param)
 }
 
 bool sameShapeConcreteDenseTensors(const ValueType &a, const ValueType &b) {
-    return (a.is_dense() && (a == b));
+    return (a.is_dense() && (a.cell_type() == eval::CellType::DOUBLE) && (a == b));
 }
 
 } // namespace vespalib::tensor::<unnamed>
@@ -19,7 +19,7 @@ namespace {
 
 ArrayRef<double> getMutableCells(const eval::Value &value) {
     const DenseTensorView &denseTensor = static_cast<const DenseTensorView &>(value);
-    return unconstify(denseTensor.cellsRef());
+    return unconstify(denseTensor.cellsRef().typify<double>());
 }
 
 void my_inplace_map_op(eval::InterpretedFunction::State &state, uint64_t param) {
@@ -30,7 +30,7 @@ void my_inplace_map_op(eval::InterpretedFunction::State &state, uint64_t param)
 }
 
 bool isConcreteDenseTensor(const ValueType &type) {
-    return type.is_dense();
+    return (type.is_dense() && (type.cell_type() == eval::CellType::DOUBLE));
 }
 
 } // namespace vespalib::tensor::<unnamed>
@@ -56,7 +56,9 @@ const TensorFunction &
 DenseInplaceMapFunction::optimize(const eval::TensorFunction &expr, Stash &stash)
 {
     if (auto map = as<Map>(expr)) {
-        if (map->child().result_is_mutable() && isConcreteDenseTensor(map->result_type())) {
+        if (map->child().result_is_mutable() && isConcreteDenseTensor(map->result_type()) &&
+            (map->child().result_type() == map->result_type()))
+        {
             return stash.create<DenseInplaceMapFunction>(map->result_type(), map->child(), map->function());
         }
     }
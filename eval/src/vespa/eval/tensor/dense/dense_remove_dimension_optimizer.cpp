@@ -46,6 +46,7 @@ DenseRemoveDimensionOptimizer::optimize(const eval::TensorFunction &expr, Stash
         const TensorFunction &child = reduce->child();
         if (is_concrete_dense_tensor(expr.result_type()) &&
             is_concrete_dense_tensor(child.result_type()) &&
+            (expr.result_type().cell_type() == child.result_type().cell_type()) &&
             is_ident_aggr(reduce->aggr()) &&
             is_trivial_dim_list(child.result_type(), reduce->dimensions()))
         {
@@ -24,6 +24,10 @@ calcCellsSize(const eval::ValueType &type)
 void
 checkCellsSize(const DenseTensor &arg)
 {
+    if (arg.fast_type().cell_type() != eval::CellType::DOUBLE) {
+        throw IllegalStateException(make_string("Wrong cell type for tensor type '%s'",
+                                                arg.fast_type().to_spec().c_str()));
+    }
     auto cellsSize = calcCellsSize(arg.fast_type());
     if (arg.cellsRef().size() != cellsSize) {
         throw IllegalStateException(make_string("Wrong cell size, "
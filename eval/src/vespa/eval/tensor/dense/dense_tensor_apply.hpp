@@ -11,12 +11,12 @@ namespace vespalib::tensor::dense {
 template <typename Function>
 std::unique_ptr<Tensor>
 apply(DenseTensorAddressCombiner & combiner, DirectDenseTensorBuilder & builder,
-      const DenseTensorView &lhs, const DenseTensorView::CellsRef & rhsCells, Function &&func) __attribute__((noinline));
+      const DenseTensorView &lhs, const ConstArrayRef<double> & rhsCells, Function &&func) __attribute__((noinline));
 
 template <typename Function>
 std::unique_ptr<Tensor>
 apply(DenseTensorAddressCombiner & combiner, DirectDenseTensorBuilder & builder,
-      const DenseTensorView &lhs, const DenseTensorView::CellsRef & rhsCells, Function &&func)
+      const DenseTensorView &lhs, const ConstArrayRef<double> & rhsCells, Function &&func)
 {
     for (DenseTensorCellsIterator lhsItr = lhs.cellsIterator(); lhsItr.valid(); lhsItr.next()) {
         combiner.updateLeftAndCommon(lhsItr.address());
@@ -33,13 +33,13 @@ apply(DenseTensorAddressCombiner & combiner, DirectDenseTensorBuilder & builder,
 template <typename Function>
 std::unique_ptr<Tensor>
 apply_no_rightonly_dimensions(DenseTensorAddressCombiner & combiner, DirectDenseTensorBuilder & builder,
-                              const DenseTensorView &lhs, const DenseTensorView::CellsRef & rhsCells,
+                              const DenseTensorView &lhs, const ConstArrayRef<double> & rhsCells,
                               Function &&func)  __attribute__((noinline));
 
 template <typename Function>
 std::unique_ptr<Tensor>
 apply_no_rightonly_dimensions(DenseTensorAddressCombiner & combiner, DirectDenseTensorBuilder & builder,
-                              const DenseTensorView &lhs, const DenseTensorView::CellsRef & rhsCells, Function &&func)
+                              const DenseTensorView &lhs, const ConstArrayRef<double> & rhsCells, Function &&func)
 {
     for (DenseTensorCellsIterator lhsItr = lhs.cellsIterator(); lhsItr.valid(); lhsItr.next()) {
         combiner.updateLeftAndCommon(lhsItr.address());
@@ -58,9 +58,9 @@ apply(const DenseTensorView &lhs, const DenseTensorView &rhs, Function &&func)
     DenseTensorAddressCombiner combiner(resultType, lhs.fast_type(), rhs.fast_type());
     DirectDenseTensorBuilder builder(resultType);
     if (combiner.hasAnyRightOnlyDimensions()) {
-        return apply(combiner, builder, lhs, rhs.cellsRef(), std::move(func));
+        return apply(combiner, builder, lhs, rhs.cellsRef().typify<double>(), std::move(func));
     } else {
-        return apply_no_rightonly_dimensions(combiner, builder, lhs, rhs.cellsRef(), std::move(func));
+        return apply_no_rightonly_dimensions(combiner, builder, lhs, rhs.cellsRef().typify<double>(), std::move(func));
     }
 }
 
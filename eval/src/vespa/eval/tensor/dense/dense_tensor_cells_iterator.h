@@ -2,8 +2,8 @@
 
 #pragma once
 
+#include "typed_cells.h"
 #include <vespa/eval/eval/value_type.h>
-#include <vespa/vespalib/util/arrayref.h>
 
 namespace vespalib::tensor {
 
@@ -16,7 +16,7 @@ public:
     using size_type = eval::ValueType::Dimension::size_type;
     using Address = std::vector<size_type>;
 private:
-    using CellsRef = vespalib::ConstArrayRef<double>;
+    using CellsRef = TypedCells;
     const eval::ValueType &_type;
     CellsRef       _cells;
     size_t         _cellIdx;
@@ -38,7 +38,7 @@ public:
         }
     }
     bool valid() const { return _cellIdx < _cells.size(); }
-    double cell() const { return _cells[_cellIdx]; }
+    double cell() const { return _cells.get(_cellIdx); }
     const Address &address() const { return _address; }
     const eval::ValueType &fast_type() const { return _type; }
 };
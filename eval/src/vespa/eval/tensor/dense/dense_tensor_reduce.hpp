@@ -7,7 +7,7 @@
 namespace vespalib::tensor::dense {
 
 using Cells = DenseTensorView::Cells;
-using CellsRef = DenseTensorView::CellsRef;
+using CellsRef = ConstArrayRef<double>;
 
 class DimensionReducer
 {
@@ -58,7 +58,7 @@ std::unique_ptr<DenseTensorView>
 reduce(const DenseTensorView &tensor, const vespalib::string &dimensionToRemove, Function &&func)
 {
     DimensionReducer reducer(tensor.fast_type(), dimensionToRemove);
-    return reducer.reduceCells(tensor.cellsRef(), func);
+    return reducer.reduceCells(tensor.cellsRef().typify<double>(), func);
 }
 
 }
@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "dense_tensor_view.h"
+#include "typed_dense_tensor.h"
 #include "dense_tensor_apply.hpp"
 #include "dense_tensor_reduce.hpp"
 #include "dense_tensor_modify.h"
@@ -92,14 +93,16 @@ Tensor::UP
 joinDenseTensors(const DenseTensorView &lhs, const DenseTensorView &rhs,
                  Function &&func)
 {
+    auto lhsCells = lhs.cellsRef().typify<double>();
+    auto rhsCells = rhs.cellsRef().typify<double>();
     DenseTensor::Cells cells;
-    cells.reserve(lhs.cellsRef().size());
-    auto rhsCellItr = rhs.cellsRef().cbegin();
-    for (const auto &lhsCell : lhs.cellsRef()) {
+    cells.reserve(lhsCells.size());
+    auto rhsCellItr = rhsCells.cbegin();
+    for (const auto &lhsCell : lhsCells) {
         cells.push_back(func(lhsCell, *rhsCellItr));
         ++rhsCellItr;
     }
-    assert(rhsCellItr == rhs.cellsRef().cend());
+    assert(rhsCellItr == rhsCells.cend());
     return std::make_unique<DenseTensor>(lhs.fast_type(),
                                          std::move(cells));
 }
@@ -119,17 +122,21 @@ joinDenseTensors(const DenseTensorView &lhs, const Tensor &rhs,
     return Tensor::UP();
 }
 
-bool sameCells(DenseTensorView::CellsRef lhs, DenseTensorView::CellsRef rhs)
+/*
+ * Generic operations are calculated with double cells. Tensors with
+ * other cell types are converted before the operation is performed.
+ */
+std::unique_ptr<DenseTensorView>
+toDoubleCells(const DenseTensorView &tensor)
 {
-    if (lhs.size() != rhs.size()) {
-        return false;
-    }
-    for (size_t i = 0; i < lhs.size(); ++i) {
-        if (lhs[i] != rhs[i]) {
-            return false;
-        }
-    }
-    return true;
+    return convert_cells(tensor, eval::CellType::DOUBLE);
+}
+
+bool
+hasDoubleCells(const Tensor &tensor)
+{
+    const DenseTensorView *view = dynamic_cast<const DenseTensorView *>(&tensor);
+    return ((view == nullptr) || view->cellsRef().check_type<double>());
 }
 
 }
@@ -137,7 +144,7 @@ bool sameCells(DenseTensorView::CellsRef lhs, DenseTensorView::CellsRef rhs)
 bool
 DenseTensorView::operator==(const DenseTensorView &rhs) const
 {
-    return (_typeRef == rhs._typeRef) && sameCells(_cellsRef, rhs._cellsRef);
+    return (_typeRef == rhs._typeRef) && (_cellsRef == rhs._cellsRef);
 }
 
 const eval::ValueType &
@@ -150,8 +157,8 @@ double
 DenseTensorView::as_double() const
 {
     double result = 0.0;
-    for (const auto &cell : _cellsRef) {
-        result += cell;
+    for (size_t i = 0; i < _cellsRef.size(); ++i) {
+        result += _cellsRef.get(i);
     }
     return result;
 }
@@ -159,9 +166,12 @@ DenseTensorView::as_double() const
 Tensor::UP
 DenseTensorView::apply(const CellFunction &func) const
 {
+    if (!has_double_cells()) {
+        return toDoubleCells(*this)->apply(func);
+    }
     Cells newCells(_cellsRef.size());
     auto itr = newCells.begin();
-    for (const auto &cell : _cellsRef) {
+    for (const auto &cell : _cellsRef.typify<double>()) {
         *itr = func.apply(cell);
         ++itr;
     }
@@ -182,8 +192,7 @@ DenseTensorView::equals(const Tensor &arg) const
 Tensor::UP
 DenseTensorView::clone() const
 {
-    return std::make_unique<DenseTensor>(_typeRef,
-                                         Cells(_cellsRef.cbegin(), _cellsRef.cend()));
+    return convert_cells(*this, _cellsRef.type());
 }
 
 namespace {
@@ -237,6 +246,12 @@ DenseTensorView::accept(TensorVisitor &visitor) const
 Tensor::UP
 DenseTensorView::join(join_fun_t function, const Tensor &arg) const
 {
+    if (!has_double_cells()) {
+        return toDoubleCells(*this)->join(function, arg);
+    }
+    if (!hasDoubleCells(arg)) {
+        return join(function, *toDoubleCells(static_cast<const DenseTensorView &>(arg)));
+    }
     if (fast_type() == arg.type()) {
         if (function == eval::operation::Mul::f) {
             return joinDenseTensors(*this, arg, "mul",
@@ -272,6 +287,9 @@ DenseTensorView::reduce_all(join_fun_t op, const std::vector<vespalib::string> &
 Tensor::UP
 DenseTensorView::reduce(join_fun_t op, const std::vector<vespalib::string> &dimensions) const
 {
+    if (!has_double_cells()) {
+        return toDoubleCells(*this)->reduce(op, dimensions);
+    }
     return dimensions.empty()
             ? reduce_all(op, _typeRef.dimension_names())
             : reduce_all(op, dimensions);
@@ -280,7 +298,12 @@ DenseTensorView::reduce(join_fun_t op, const std::vector<vespalib::string> &dime
 std::unique_ptr<Tensor>
 DenseTensorView::modify(join_fun_t op, const CellValues &cellValues) const
 {
-    DenseTensorModify modifier(op, _typeRef, Cells(_cellsRef.cbegin(), _cellsRef.cend()));
+    if (!has_double_cells()) {
+        // modify keeps the cell type of the modified tensor
+        auto result = toDoubleCells(*this)->modify(op, cellValues);
+        return convert_cells(static_cast<const DenseTensorView &>(*result), _cellsRef.type());
+    }
+    DenseTensorModify modifier(op, _typeRef, _cellsRef.to_doubles());
     cellValues.accept(modifier);
     return modifier.build();
 }
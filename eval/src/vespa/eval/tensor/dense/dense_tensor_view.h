@@ -10,12 +10,13 @@ namespace vespalib::tensor {
 /**
  * A view to a dense tensor where all dimensions are indexed.
  * Tensor cells are stored in an underlying array according to the order of the dimensions.
+ * The cells may be of any cell type; generic operations produce tensors with double cells.
  */
 class DenseTensorView : public Tensor
 {
 public:
     using Cells = std::vector<double>;
-    using CellsRef = ConstArrayRef<double>;
+    using CellsRef = TypedCells;
     using CellsIterator = DenseTensorCellsIterator;
     using Address = std::vector<eval::ValueType::Dimension::size_type>;
 
@@ -51,6 +52,7 @@ protected:
     }
 private:
     Tensor::UP reduce_all(join_fun_t op, const std::vector<vespalib::string> &dimensions) const;
+    bool has_double_cells() const { return _cellsRef.check_type<double>(); }
 
     const eval::ValueType &_typeRef;
     CellsRef               _cellsRef;
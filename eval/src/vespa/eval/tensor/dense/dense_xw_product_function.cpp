@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "dense_xw_product_function.h"
+#include "dense_dot_product_function.h"
 #include "dense_tensor.h"
 #include "dense_tensor_view.h"
 #include <vespa/vespalib/objects/objectvisitor.h>
@@ -27,14 +28,15 @@ CellsRef getCellsRef(const eval::Value &value) {
     return denseTensor.cellsRef();
 }
 
+template <typename VCT, typename MCT>
 void multiDotProduct(const DenseXWProductFunction::Self &self,
-                     const XWInput &vectorCells, const XWInput &matrixCells, XWOutput &result)
+                     const ConstArrayRef<VCT> &vectorCells, const ConstArrayRef<MCT> &matrixCells, XWOutput &result)
 {
     double *out = result.begin();
-    const double *matrixP = matrixCells.cbegin();
-    const double * const vectorP = vectorCells.cbegin();
+    const MCT *matrixP = matrixCells.cbegin();
+    const VCT * const vectorP = vectorCells.cbegin();
     for (size_t row = 0; row < self._resultSize; ++row) {
-        double cell = self._hwAccelerator->dotProduct(vectorP, matrixP, self._vectorSize);
+        double cell = DotProduct<VCT,MCT>::apply(*self._hwAccelerator, vectorP, matrixP, self._vectorSize);
         *out++ = cell;
         matrixP += self._vectorSize;
     }
@@ -42,12 +44,13 @@ void multiDotProduct(const DenseXWProductFunction::Self &self,
     assert(matrixP == matrixCells.cend());
 }
 
+template <typename VCT, typename MCT>
 void transposedProduct(const DenseXWProductFunction::Self &self,
-                       const XWInput &vectorCells, const XWInput &matrixCells, XWOutput &result)
+                       const ConstArrayRef<VCT> &vectorCells, const ConstArrayRef<MCT> &matrixCells, XWOutput &result)
 {
     double *out = result.begin();
-    const double * const matrixP = matrixCells.cbegin();
-    const double * const vectorP = vectorCells.cbegin();
+    const MCT * const matrixP = matrixCells.cbegin();
+    const VCT * const vectorP = vectorCells.cbegin();
     for (size_t row = 0; row < self._resultSize; ++row) {
         double cell = 0;
         for (size_t col = 0; col < self._vectorSize; ++col) {
@@ -58,12 +61,12 @@ void transposedProduct(const DenseXWProductFunction::Self &self,
     assert(out == result.end());
 }
 
-template <bool commonDimensionInnermost>
+template <typename VCT, typename MCT, bool commonDimensionInnermost>
 void my_xw_product_op(eval::InterpretedFunction::State &state, uint64_t param) {
     DenseXWProductFunction::Self *self = (DenseXWProductFunction::Self *)(param);
 
-    CellsRef vectorCells = getCellsRef(state.peek(1));
-    CellsRef matrixCells = getCellsRef(state.peek(0));
+    auto vectorCells = getCellsRef(state.peek(1)).typify<VCT>();
+    auto matrixCells = getCellsRef(state.peek(0)).typify<MCT>();
 
     ArrayRef<double> outputCells = state.stash.create_array<double>(self->_resultSize);
 
@@ -75,6 +78,12 @@ void my_xw_product_op(eval::InterpretedFunction::State &state, uint64_t param) {
     state.pop_pop_push(state.stash.create<DenseTensorView>(self->_resultType, outputCells));
 }
 
+template <bool commonDimensionInnermost>
+struct MyXWProductOp {
+    template <typename VCT, typename MCT>
+    static eval::InterpretedFunction::op_function call() { return my_xw_product_op<VCT,MCT,commonDimensionInnermost>; }
+};
+
 bool isConcreteDenseTensor(const ValueType &type, size_t d) {
     return (type.is_dense() && (type.dimensions().size() == d));
 }
@@ -130,7 +139,11 @@ eval::InterpretedFunction::Instruction
 DenseXWProductFunction::compile_self(Stash &stash) const
 {
     Self &self = stash.create<Self>(result_type(), _vectorSize, _resultSize);
-    auto op = _commonDimensionInnermost ? my_xw_product_op<true> : my_xw_product_op<false>;
+    auto vector_cell_type = lhs().result_type().cell_type();
+    auto matrix_cell_type = rhs().result_type().cell_type();
+    auto op = _commonDimensionInnermost
+              ? dispatch_2<MyXWProductOp<true>>(vector_cell_type, matrix_cell_type)
+              : dispatch_2<MyXWProductOp<false>>(vector_cell_type, matrix_cell_type);
     return eval::InterpretedFunction::Instruction(op, (uint64_t)(&self));
 }
 
@@ -8,7 +8,6 @@
 
 namespace vespalib::tensor {
 
-using XWInput = DenseTensorView::CellsRef;
 using XWOutput = ArrayRef<double>;
 
 /**
@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "direct_dense_tensor_builder.h"
+#include "typed_dense_tensor.h"
 
 namespace vespalib::tensor {
 
@@ -32,7 +33,7 @@ DirectDenseTensorBuilder::DirectDenseTensorBuilder(const ValueType &type_in)
 Tensor::UP
 DirectDenseTensorBuilder::build()
 {
-    return std::make_unique<DenseTensor>(std::move(_type), std::move(_cells));
+    return create_dense_tensor(std::move(_type), std::move(_cells));
 }
 
 }
@@ -0,0 +1,120 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/eval/cell_type.h>
+#include <vespa/vespalib/util/arrayref.h>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace vespalib::tensor {
+
+/**
+ * Reference to the cells of a dense tensor together with the type of
+ * the cells. Code that needs raw access to the cells must check the
+ * cell type and use typify to get a properly typed array reference,
+ * while code only reading a few values can use 'get'.
+ **/
+class TypedCells {
+private:
+    const void     *_data;
+    eval::CellType  _type;
+    size_t          _size;
+
+public:
+    TypedCells() : _data(nullptr), _type(eval::CellType::DOUBLE), _size(0) {}
+    TypedCells(const void *data_in, eval::CellType type_in, size_t size_in)
+        : _data(data_in), _type(type_in), _size(size_in) {}
+    template <typename CT>
+    TypedCells(ConstArrayRef<CT> cells)
+        : _data(cells.begin()), _type(eval::get_cell_type<CT>()), _size(cells.size()) {}
+    template <typename CT>
+    TypedCells(ArrayRef<CT> cells)
+        : TypedCells(ConstArrayRef<CT>(cells)) {}
+    template <typename CT>
+    TypedCells(const std::vector<CT> &cells)
+        : TypedCells(ConstArrayRef<CT>(cells)) {}
+
+    const void *data() const { return _data; }
+    eval::CellType type() const { return _type; }
+    size_t size() const { return _size; }
+    size_t size_in_bytes() const { return _size * eval::cell_type_size(_type); }
+
+    template <typename CT> bool check_type() const { return eval::check_cell_type<CT>(_type); }
+
+    template <typename CT> ConstArrayRef<CT> typify() const {
+        assert(check_type<CT>());
+        return ConstArrayRef<CT>(static_cast<const CT *>(_data), _size);
+    }
+
+    double get(size_t idx) const {
+        switch (_type) {
+        case eval::CellType::DOUBLE: return static_cast<const double *>(_data)[idx];
+        case eval::CellType::FLOAT: return static_cast<const float *>(_data)[idx];
+        case eval::CellType::INT8: return static_cast<const int8_t *>(_data)[idx];
+        }
+        return 0.0;
+    }
+
+    std::vector<double> to_doubles() const {
+        std::vector<double> result;
+        result.reserve(_size);
+        for (size_t i = 0; i < _size; ++i) {
+            result.push_back(get(i));
+        }
+        return result;
+    }
+
+    bool operator==(const TypedCells &rhs) const {
+        if (_size != rhs._size) {
+            return false;
+        }
+        for (size_t i = 0; i < _size; ++i) {
+            if (get(i) != rhs.get(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * Call 'Fun::template call<CT>(args...)' with CT being the cell
+ * type matching the given run-time cell type.
+ **/
+template <typename Fun, typename... Args>
+decltype(auto) dispatch_1(eval::CellType a, Args &&... args) {
+    switch (a) {
+    case eval::CellType::FLOAT: return Fun::template call<float>(std::forward<Args>(args)...);
+    case eval::CellType::INT8: return Fun::template call<int8_t>(std::forward<Args>(args)...);
+    case eval::CellType::DOUBLE: break;
+    }
+    return Fun::template call<double>(std::forward<Args>(args)...);
+}
+
+template <typename Fun, typename A, typename... Args>
+decltype(auto) dispatch_2_rhs(eval::CellType b, Args &&... args) {
+    switch (b) {
+    case eval::CellType::FLOAT: return Fun::template call<A, float>(std::forward<Args>(args)...);
+    case eval::CellType::INT8: return Fun::template call<A, int8_t>(std::forward<Args>(args)...);
+    case eval::CellType::DOUBLE: break;
+    }
+    return Fun::template call<A, double>(std::forward<Args>(args)...);
+}
+
+/**
+ * Call 'Fun::template call<A,B>(args...)' with A and B being the
+ * cell types matching the given run-time cell types.
+ **/
+template <typename Fun, typename... Args>
+decltype(auto) dispatch_2(eval::CellType a, eval::CellType b, Args &&... args) {
+    switch (a) {
+    case eval::CellType::FLOAT: return dispatch_2_rhs<Fun, float>(b, std::forward<Args>(args)...);
+    case eval::CellType::INT8: return dispatch_2_rhs<Fun, int8_t>(b, std::forward<Args>(args)...);
+    case eval::CellType::DOUBLE: break;
+    }
+    return dispatch_2_rhs<Fun, double>(b, std::forward<Args>(args)...);
+}
+
+}
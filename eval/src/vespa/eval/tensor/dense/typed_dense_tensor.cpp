@@ -0,0 +1,119 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "typed_dense_tensor.h"
+#include "dense_tensor.h"
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vespa/vespalib/util/exceptions.h>
+
+namespace vespalib::tensor {
+
+using eval::CellType;
+using eval::ValueType;
+
+namespace {
+
+size_t
+calcCellsSize(const ValueType &type)
+{
+    size_t cellsSize = 1;
+    for (const auto &dim : type.dimensions()) {
+        cellsSize *= dim.size;
+    }
+    return cellsSize;
+}
+
+template <typename CT>
+void
+checkCells(const ValueType &type, const std::vector<CT> &cells)
+{
+    if (type.cell_type() != eval::get_cell_type<CT>()) {
+        throw IllegalStateException(make_string("Wrong cell type for tensor type '%s'",
+                                                type.to_spec().c_str()));
+    }
+    auto cellsSize = calcCellsSize(type);
+    if (cells.size() != cellsSize) {
+        throw IllegalStateException(make_string("Wrong cell size, "
+                                                "expected=%zu, "
+                                                "actual=%zu",
+                                                cellsSize,
+                                                cells.size()));
+    }
+}
+
+template <typename CT>
+std::vector<CT>
+convert_cells(const TypedCells &cells)
+{
+    std::vector<CT> result;
+    result.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        result.push_back(eval::convert_cell<CT>(cells.get(i)));
+    }
+    return result;
+}
+
+template <typename CT>
+std::vector<CT>
+convert_cells(const std::vector<double> &cells)
+{
+    return convert_cells<CT>(TypedCells(cells));
+}
+
+}
+
+template <typename CT>
+TypedDenseTensor<CT>::TypedDenseTensor(const ValueType &type_in, TypedCellsVector &&cells_in)
+    : DenseTensorView(_type),
+      _type(type_in),
+      _cells(std::move(cells_in))
+{
+    checkCells(_type, _cells);
+    initCellsRef(TypedCells(_cells));
+}
+
+template <typename CT>
+TypedDenseTensor<CT>::TypedDenseTensor(ValueType &&type_in, TypedCellsVector &&cells_in)
+    : DenseTensorView(_type),
+      _type(std::move(type_in)),
+      _cells(std::move(cells_in))
+{
+    checkCells(_type, _cells);
+    initCellsRef(TypedCells(_cells));
+}
+
+template <typename CT>
+TypedDenseTensor<CT>::~TypedDenseTensor() = default;
+
+template class TypedDenseTensor<float>;
+template class TypedDenseTensor<int8_t>;
+
+std::unique_ptr<DenseTensorView>
+create_dense_tensor(ValueType type, std::vector<double> &&cells)
+{
+    switch (type.cell_type()) {
+    case CellType::FLOAT:
+        return std::make_unique<TypedDenseTensor<float>>(std::move(type), convert_cells<float>(cells));
+    case CellType::INT8:
+        return std::make_unique<TypedDenseTensor<int8_t>>(std::move(type), convert_cells<int8_t>(cells));
+    case CellType::DOUBLE:
+        break;
+    }
+    return std::make_unique<DenseTensor>(std::move(type), std::move(cells));
+}
+
+std::unique_ptr<DenseTensorView>
+convert_cells(const DenseTensorView &tensor, CellType cell_type)
+{
+    ValueType type = tensor.fast_type().cell_cast(cell_type);
+    switch (type.cell_type()) {
+    case CellType::FLOAT:
+        return std::make_unique<TypedDenseTensor<float>>(std::move(type), convert_cells<float>(tensor.cellsRef()));
+    case CellType::INT8:
+        return std::make_unique<TypedDenseTensor<int8_t>>(std::move(type), convert_cells<int8_t>(tensor.cellsRef()));
+    case CellType::DOUBLE:
+        break;
+    }
+    return std::make_unique<DenseTensor>(std::move(type), tensor.cellsRef().to_doubles());
+}
+
+}
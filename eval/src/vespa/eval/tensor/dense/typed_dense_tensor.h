@@ -0,0 +1,43 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "dense_tensor_view.h"
+
+namespace vespalib::tensor {
+
+/**
+ * A dense tensor owning cells of a cell type other than double
+ * (see DenseTensor for the double case). The cell type of the tensor
+ * type must match CT.
+ */
+template <typename CT>
+class TypedDenseTensor : public DenseTensorView
+{
+public:
+    using TypedCellsVector = std::vector<CT>;
+
+    TypedDenseTensor(const eval::ValueType &type_in, TypedCellsVector &&cells_in);
+    TypedDenseTensor(eval::ValueType &&type_in, TypedCellsVector &&cells_in);
+    ~TypedDenseTensor() override;
+private:
+    eval::ValueType  _type;
+    TypedCellsVector _cells;
+};
+
+extern template class TypedDenseTensor<float>;
+extern template class TypedDenseTensor<int8_t>;
+
+/**
+ * Create a dense tensor with the given type from double cell
+ * values. The values are converted to the cell type of the tensor
+ * type; int8 values are rounded and clamped to [-128, 127].
+ */
+std::unique_ptr<DenseTensorView> create_dense_tensor(eval::ValueType type, std::vector<double> &&cells);
+
+/**
+ * Create a copy of the given dense tensor with the given cell type.
+ */
+std::unique_ptr<DenseTensorView> convert_cells(const DenseTensorView &tensor, eval::CellType cell_type);
+
+}
@@ -4,6 +4,6 @@
 
 namespace vespalib::tensor {
 
-enum class SerializeFormat {FLOAT, DOUBLE};
+enum class SerializeFormat {FLOAT, DOUBLE, INT8};
 
 }
@@ -2,9 +2,11 @@
 
 #include "dense_binary_format.h"
 #include <vespa/eval/tensor/dense/dense_tensor.h>
+#include <vespa/eval/tensor/dense/typed_dense_tensor.h>
 #include <vespa/vespalib/objects/nbostream.h>
 #include <vespa/vespalib/util/exceptions.h>
 #include <cassert>
+#include <type_traits>
 
 using vespalib::nbostream;
 
@@ -16,10 +18,10 @@ using Dimension = eval::ValueType::Dimension;
 namespace {
 
 eval::ValueType
-makeValueType(std::vector<Dimension> &&dimensions) {
+makeValueType(std::vector<Dimension> &&dimensions, eval::CellType cellType) {
     return (dimensions.empty() ?
             eval::ValueType::double_type() :
-            eval::ValueType::tensor_type(std::move(dimensions)));
+            eval::ValueType::tensor_type(std::move(dimensions), cellType));
 }
 
 size_t
@@ -37,8 +39,14 @@ encodeDimensions(nbostream &stream, const eval::ValueType & type) {
 template<typename T>
 void
 encodeCells(nbostream &stream, DenseTensorView::CellsRef cells) {
-    for (const auto &value : cells) {
-        stream << static_cast<T>(value);
+    if (cells.check_type<T>()) {
+        for (const auto &value : cells.typify<T>()) {
+            stream << value;
+        }
+    } else {
+        for (size_t i = 0; i < cells.size(); ++i) {
+            stream << eval::convert_cell<T>(cells.get(i));
+        }
     }
 }
 
@@ -77,6 +85,27 @@ void decodeCells(SerializeFormat format, nbostream &stream, size_t cellsSize, V
     case SerializeFormat::FLOAT:
         decodeCells<float>(stream, cellsSize, cells);
         break;
+    case SerializeFormat::INT8:
+        decodeCells<int8_t>(stream, cellsSize, cells);
+        break;
+    }
+}
+
+template <typename T>
+std::unique_ptr<DenseTensorView>
+decodeTensor(SerializeFormat format, nbostream &stream, std::vector<Dimension> &&dimensions, size_t cellsSize)
+{
+    std::vector<T> cells;
+    cells.reserve(cellsSize);
+    decodeCells(format, stream, cellsSize, cells);
+    auto type = makeValueType(std::move(dimensions), eval::get_cell_type<T>());
+    if (type.is_double() && !std::is_same_v<T, double>) {
+        return std::make_unique<DenseTensor>(std::move(type), DenseTensor::Cells(cells.begin(), cells.end()));
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        return std::make_unique<DenseTensor>(std::move(type), std::move(cells));
+    } else {
+        return std::make_unique<TypedDenseTensor<T>>(std::move(type), std::move(cells));
     }
 }
 
@@ -96,20 +125,26 @@ DenseBinaryFormat::serialize(nbostream &stream, const DenseTensorView &tensor)
         case SerializeFormat::FLOAT:
             encodeCells<float>(stream, cells);
             break;
+        case SerializeFormat::INT8:
+            encodeCells<int8_t>(stream, cells);
+            break;
     }
 }
 
-std::unique_ptr<DenseTensor>
+std::unique_ptr<DenseTensorView>
 DenseBinaryFormat::deserialize(nbostream &stream)
 {
     std::vector<Dimension> dimensions;
     size_t cellsSize = decodeDimensions(stream,dimensions);
-    DenseTensor::Cells cells;
-    cells.reserve(cellsSize);
-
-    decodeCells(_format, stream, cellsSize, cells);
-
-    return std::make_unique<DenseTensor>(makeValueType(std::move(dimensions)), std::move(cells));
+    switch (_format) {
+    case SerializeFormat::FLOAT:
+        return decodeTensor<float>(_format, stream, std::move(dimensions), cellsSize);
+    case SerializeFormat::INT8:
+        return decodeTensor<int8_t>(_format, stream, std::move(dimensions), cellsSize);
+    case SerializeFormat::DOUBLE:
+        break;
+    }
+    return decodeTensor<double>(_format, stream, std::move(dimensions), cellsSize);
 }
 
 template <typename T>
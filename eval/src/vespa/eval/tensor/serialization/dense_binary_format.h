@@ -21,7 +21,7 @@ class DenseBinaryFormat
 public:
     DenseBinaryFormat(SerializeFormat format) : _format(format) { }
     void serialize(nbostream &stream, const DenseTensorView &tensor);
-    std::unique_ptr<DenseTensor> deserialize(nbostream &stream);
+    std::unique_ptr<DenseTensorView> deserialize(nbostream &stream);
     
     // This is a temporary method untill we get full support for typed tensors
     template <typename T>
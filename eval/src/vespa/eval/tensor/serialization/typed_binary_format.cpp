@@ -27,10 +27,11 @@ constexpr uint32_t DENSE_BINARY_FORMAT_TYPE = 2u;
 constexpr uint32_t MIXED_BINARY_FORMAT_TYPE = 3u;
 constexpr uint32_t SPARSE_BINARY_FORMAT_WITH_CELLTYPE = 5u; //Future
 constexpr uint32_t DENSE_BINARY_FORMAT_WITH_CELLTYPE = 6u;
-constexpr uint32_t MIXED_BINARY_FORMAT_WITH_CELLTYPE = 7u; //Future
+constexpr uint32_t MIXED_BINARY_FORMAT_WITH_CELLTYPE = 7u;
 
 constexpr uint32_t DOUBLE_VALUE_TYPE = 0;
 constexpr uint32_t FLOAT_VALUE_TYPE = 1;
+constexpr uint32_t INT8_VALUE_TYPE = 2;
 
 uint32_t
 format2Encoding(SerializeFormat format) {
@@ -39,6 +40,8 @@ format2Encoding(SerializeFormat format) {
             return DOUBLE_VALUE_TYPE;
         case SerializeFormat::FLOAT:
             return FLOAT_VALUE_TYPE;
+        case SerializeFormat::INT8:
+            return INT8_VALUE_TYPE;
     }
     abort();
 }
@@ -50,11 +53,32 @@ encoding2Format(uint32_t serializedType) {
             return SerializeFormat::DOUBLE;
         case FLOAT_VALUE_TYPE:
             return  SerializeFormat::FLOAT;
+        case INT8_VALUE_TYPE:
+            return  SerializeFormat::INT8;
         default:
-            throw IllegalArgumentException(make_string("Received unknown tensor value type = %u. Only 0(double), or 1(float) are legal.", serializedType));
+            throw IllegalArgumentException(make_string("Received unknown tensor value type = %u. Only 0(double), 1(float) or 2(int8) are legal.", serializedType));
     }
 }
 
+SerializeFormat
+cellType2Format(eval::CellType cellType) {
+    switch (cellType) {
+        case eval::CellType::DOUBLE:
+            return SerializeFormat::DOUBLE;
+        case eval::CellType::FLOAT:
+            return SerializeFormat::FLOAT;
+        case eval::CellType::INT8:
+            return SerializeFormat::INT8;
+    }
+    abort();
+}
+
+}
+
+void
+TypedBinaryFormat::serialize(nbostream &stream, const Tensor &tensor)
+{
+    serialize(stream, tensor, cellType2Format(tensor.type().cell_type()));
 }
 
 void
@@ -94,7 +118,7 @@ TypedBinaryFormat::deserialize(nbostream &stream)
     if (formatId == DENSE_BINARY_FORMAT_WITH_CELLTYPE) {
         return DenseBinaryFormat(encoding2Format(stream.getInt1_4Bytes())).deserialize(stream);
     }
-    if (formatId == MIXED_BINARY_FORMAT_TYPE) {
+    if ((formatId == MIXED_BINARY_FORMAT_TYPE) || (formatId == MIXED_BINARY_FORMAT_WITH_CELLTYPE)) {
         stream.adjustReadPos(read_pos - stream.rp());
         return std::make_unique<WrappedSimpleTensor>(eval::SimpleTensor::decode(stream));
     }
@@ -19,10 +19,12 @@ class TypedBinaryFormat
 {
 public:
     static void serialize(nbostream &stream, const Tensor &tensor, SerializeFormat format);
-    static void serialize(nbostream &stream, const Tensor &tensor) {
-        serialize(stream, tensor, SerializeFormat::DOUBLE);
-    }
+    // serialize using the cell type of the tensor
+    static void serialize(nbostream &stream, const Tensor &tensor);
 
+    // Dense tensors serialized with float or int8 cells deserialize to tensor<float> or tensor<int8>.
+    // Before cell types were added they deserialized to tensor(double) with the same values. Tensor
+    // type assignability ignores cell type, so such tensors can still be assigned to double fields.
     static std::unique_ptr<Tensor> deserialize(nbostream &stream);
     
     // This is a temporary method until we get full support for typed tensors
@@ -14,10 +14,15 @@ Config::Config() :
     _isFilter(false),
     _fastAccess(false),
     _mutable(false),
+    _hashDictionary(false),
+    _paged(false),
+    _bitVectorCacheSize(0),
+    _compressedPostingLists(false),
     _growStrategy(),
     _compactionStrategy(),
     _predicateParams(),
-    _tensorType(vespalib::eval::ValueType::error_type())
+    _tensorType(vespalib::eval::ValueType::error_type()),
+    _hnswIndexParams()
 {
 }
 
@@ -31,10 +36,15 @@ Config::Config(BasicType bt, CollectionType ct, bool fastSearch_, bool huge_)
       _isFilter(false),
       _fastAccess(false),
       _mutable(false),
+      _hashDictionary(false),
+      _paged(false),
+      _bitVectorCacheSize(0),
+      _compressedPostingLists(false),
       _growStrategy(),
       _compactionStrategy(),
       _predicateParams(),
-      _tensorType(vespalib::eval::ValueType::error_type())
+      _tensorType(vespalib::eval::ValueType::error_type()),
+      _hnswIndexParams()
 {
 }
 
@@ -54,11 +64,16 @@ Config::operator==(const Config &b) const
            _isFilter == b._isFilter &&
            _fastAccess == b._fastAccess &&
            _mutable == b._mutable &&
+           _hashDictionary == b._hashDictionary &&
+           _paged == b._paged &&
+           _bitVectorCacheSize == b._bitVectorCacheSize &&
+           _compressedPostingLists == b._compressedPostingLists &&
            _growStrategy == b._growStrategy &&
            _compactionStrategy == b._compactionStrategy &&
            _predicateParams == b._predicateParams &&
            (_basicType.type() != BasicType::Type::TENSOR ||
-            _tensorType == b._tensorType);
+            (_tensorType == b._tensorType &&
+             _hnswIndexParams == b._hnswIndexParams));
 }
 
 }
@@ -4,10 +4,12 @@
 
 #include "basictype.h"
 #include "collectiontype.h"
+#include "hnsw_index_params.h"
 #include "predicate_params.h"
 #include <vespa/searchcommon/common/growstrategy.h>
 #include <vespa/searchcommon/common/compaction_strategy.h>
 #include <vespa/eval/eval/value_type.h>
+#include <optional>
 
 namespace search::attribute {
 
@@ -27,6 +29,7 @@ public:
     bool huge()                           const { return _huge; }
     const PredicateParams &predicateParams() const { return _predicateParams; }
     vespalib::eval::ValueType tensorType() const { return _tensorType; }
+    const std::optional<HnswIndexParams> &hnswIndexParams() const { return _hnswIndexParams; }
 
     /**
      * Check if attribute posting list can consist of a bitvector in
@@ -49,6 +52,36 @@ public:
      */
     bool fastAccess() const { return _fastAccess; }
 
+    /**
+     * Check if enumerated values should also be indexed in a hash
+     * dictionary, giving faster exact lookup of values during feed
+     * and for term search. The btree dictionary is still kept since
+     * the enum values must be ordered.
+     */
+    bool hashDictionary() const { return _hashDictionary; }
+
+    /**
+     * Check if attribute data should be memory mapped copy-on-write from
+     * the saved attribute file when loading, instead of being read into
+     * memory. Only used by single value numeric attributes without fast
+     * search, where the file layout is the in-memory layout.
+     */
+    bool paged() const { return _paged; }
+
+    /**
+     * Max number of bytes used for caching merged posting lists (as
+     * bitvectors) for terms matching multiple values in a fast-search
+     * attribute. Zero disables the cache.
+     */
+    size_t bitVectorCacheSize() const { return _bitVectorCacheSize; }
+
+    /**
+     * Check if btree posting lists that are no longer changing should
+     * be converted to immutable, compressed posting lists. Weighted set
+     * posting lists are never compressed.
+     */
+    bool compressedPostingLists() const { return _compressedPostingLists; }
+
     const GrowStrategy & getGrowStrategy() const { return _growStrategy; }
     const CompactionStrategy &getCompactionStrategy() const { return _compactionStrategy; }
     Config & setHuge(bool v)                         { _huge = v; return *this;}
@@ -58,6 +91,14 @@ public:
         _tensorType = tensorType_in;
         return *this;
     }
+    Config & setHnswIndexParams(const HnswIndexParams &params) {
+        _hnswIndexParams = params;
+        return *this;
+    }
+    Config & clearHnswIndexParams() {
+        _hnswIndexParams.reset();
+        return *this;
+    }
 
     /**
      * Enable attribute posting list to consist of a bitvector in
@@ -86,6 +127,10 @@ public:
 
     Config & setMutable(bool isMutable) { _mutable = isMutable; return *this; }
     Config & setFastAccess(bool v) { _fastAccess = v; return *this; }
+    Config & setHashDictionary(bool v) { _hashDictionary = v; return *this; }
+    Config & setPaged(bool v) { _paged = v; return *this; }
+    Config & setBitVectorCacheSize(size_t v) { _bitVectorCacheSize = v; return *this; }
+    Config & setCompressedPostingLists(bool v) { _compressedPostingLists = v; return *this; }
     Config & setGrowStrategy(const GrowStrategy &gs) { _growStrategy = gs; return *this; }
     Config &setCompactionStrategy(const CompactionStrategy &compactionStrategy) { _compactionStrategy = compactionStrategy; return *this; }
     bool operator!=(const Config &b) const { return !(operator==(b)); }
@@ -101,10 +146,15 @@ private:
     bool           _isFilter;
     bool           _fastAccess;
     bool           _mutable;
+    bool           _hashDictionary;
+    bool           _paged;
+    size_t         _bitVectorCacheSize;
+    bool           _compressedPostingLists;
     GrowStrategy   _growStrategy;
     CompactionStrategy _compactionStrategy;
     PredicateParams    _predicateParams;
     vespalib::eval::ValueType _tensorType;
+    std::optional<HnswIndexParams> _hnswIndexParams;
 };
 
 }
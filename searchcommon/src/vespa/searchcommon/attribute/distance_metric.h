@@ -0,0 +1,12 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+namespace search::attribute {
+
+/*
+ * Distance metric used when searching for nearest neighbors in a tensor attribute.
+ */
+enum class DistanceMetric { Euclidean, Angular };
+
+}
@@ -0,0 +1,39 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "distance_metric.h"
+#include <cstdint>
+
+namespace search::attribute {
+
+/*
+ * Parameters for a hnsw index used together with a tensor attribute
+ * for approximate nearest neighbor search.
+ */
+class HnswIndexParams
+{
+    uint32_t       _max_links_per_node;
+    uint32_t       _neighbors_to_explore_at_insert;
+    DistanceMetric _distance_metric;
+public:
+    HnswIndexParams(uint32_t max_links_per_node_in,
+                    uint32_t neighbors_to_explore_at_insert_in,
+                    DistanceMetric distance_metric_in)
+        : _max_links_per_node(max_links_per_node_in),
+          _neighbors_to_explore_at_insert(neighbors_to_explore_at_insert_in),
+          _distance_metric(distance_metric_in)
+    {
+    }
+
+    uint32_t max_links_per_node() const { return _max_links_per_node; }
+    uint32_t neighbors_to_explore_at_insert() const { return _neighbors_to_explore_at_insert; }
+    DistanceMetric distance_metric() const { return _distance_metric; }
+    bool operator==(const HnswIndexParams &rhs) const {
+        return (_max_links_per_node == rhs._max_links_per_node &&
+                _neighbors_to_explore_at_insert == rhs._neighbors_to_explore_at_insert &&
+                _distance_metric == rhs._distance_metric);
+    }
+};
+
+}
@@ -16,7 +16,10 @@ Status::Status()
       _lastSyncToken        (0),
       _updates              (0),
       _nonIdempotentUpdates (0),
-      _bitVectors(0)
+      _bitVectors(0),
+      _compressedPostingLists(0),
+      _compactions(0),
+      _pendingCompactionDocs(0)
 {
 }
 
@@ -26,6 +26,9 @@ public:
     uint64_t getUpdateCount()              const { return _updates; }
     uint64_t getNonIdempotentUpdateCount() const { return _nonIdempotentUpdates; }
     uint32_t getBitVectors() const { return _bitVectors; }
+    uint32_t getCompressedPostingLists() const { return _compressedPostingLists; }
+    uint64_t getCompactions() const { return _compactions; }
+    uint32_t getPendingCompactionDocs() const { return _pendingCompactionDocs; }
 
     void setNumDocs(uint64_t v)                  { _numDocs = v; }
     void incNumDocs()                            { ++_numDocs; }
@@ -34,6 +37,12 @@ public:
     void incNonIdempotentUpdates(uint64_t v = 1) { _nonIdempotentUpdates += v; }
     void incBitVectors() { ++_bitVectors; }
     void decBitVectors() { --_bitVectors; }
+    void incCompressedPostingLists() { ++_compressedPostingLists; }
+    void decCompressedPostingLists() { --_compressedPostingLists; }
+    void setCompactionProgress(uint64_t compactions, uint32_t pendingDocs) {
+        _compactions = compactions;
+        _pendingCompactionDocs = pendingDocs;
+    }
 
     static vespalib::string
     createName(vespalib::stringref index, vespalib::stringref attr);
@@ -51,6 +60,9 @@ private:
     uint64_t _updates;
     uint64_t _nonIdempotentUpdates;
     uint32_t _bitVectors;
+    uint32_t _compressedPostingLists;
+    uint64_t _compactions;
+    uint32_t _pendingCompactionDocs; // Documents not yet visited by compaction in progress
 };
 
 }
@@ -14,22 +14,33 @@ class CompactionStrategy
 private:
     double _maxDeadBytesRatio; // Max ratio of dead bytes before compaction
     double _maxDeadAddressSpaceRatio; // Max ratio of dead address space before compaction
+    uint32_t _maxCompactDocsPerCommit; // Max documents moved per commit when compacting, 0 means no limit
 public:
     CompactionStrategy()
         : _maxDeadBytesRatio(0.2),
-          _maxDeadAddressSpaceRatio(0.2)
+          _maxDeadAddressSpaceRatio(0.2),
+          _maxCompactDocsPerCommit(0)
     {
     }
     CompactionStrategy(double maxDeadBytesRatio, double maxDeadAddressSpaceRatio)
         : _maxDeadBytesRatio(maxDeadBytesRatio),
-          _maxDeadAddressSpaceRatio(maxDeadAddressSpaceRatio)
+          _maxDeadAddressSpaceRatio(maxDeadAddressSpaceRatio),
+          _maxCompactDocsPerCommit(0)
+    {
+    }
+    CompactionStrategy(double maxDeadBytesRatio, double maxDeadAddressSpaceRatio, uint32_t maxCompactDocsPerCommit)
+        : _maxDeadBytesRatio(maxDeadBytesRatio),
+          _maxDeadAddressSpaceRatio(maxDeadAddressSpaceRatio),
+          _maxCompactDocsPerCommit(maxCompactDocsPerCommit)
     {
     }
     double getMaxDeadBytesRatio() const { return _maxDeadBytesRatio; }
     double getMaxDeadAddressSpaceRatio() const { return _maxDeadAddressSpaceRatio; }
+    uint32_t getMaxCompactDocsPerCommit() const { return _maxCompactDocsPerCommit; }
     bool operator==(const CompactionStrategy & rhs) const {
         return _maxDeadBytesRatio == rhs._maxDeadBytesRatio &&
-            _maxDeadAddressSpaceRatio == rhs._maxDeadAddressSpaceRatio;
+            _maxDeadAddressSpaceRatio == rhs._maxDeadAddressSpaceRatio &&
+            _maxCompactDocsPerCommit == rhs._maxCompactDocsPerCommit;
     }
     bool operator!=(const CompactionStrategy & rhs) const { return !(operator==(rhs)); }
 };
@@ -134,7 +134,8 @@ Schema::IndexField::IndexField(vespalib::stringref name, DataType dt)
       _prefix(false),
       _phrases(false),
       _positions(true),
-      _avgElemLen(512)
+      _avgElemLen(512),
+      _blockDocIds(false)
 {
 }
 
@@ -144,7 +145,8 @@ Schema::IndexField::IndexField(vespalib::stringref name, DataType dt,
       _prefix(false),
       _phrases(false),
       _positions(true),
-      _avgElemLen(512)
+      _avgElemLen(512),
+      _blockDocIds(false)
 {
 }
 
@@ -153,7 +155,8 @@ Schema::IndexField::IndexField(const std::vector<vespalib::string> &lines)
       _prefix(ConfigParser::parse<bool>("prefix", lines)),
       _phrases(ConfigParser::parse<bool>("phrases", lines)),
       _positions(ConfigParser::parse<bool>("positions", lines)),
-      _avgElemLen(ConfigParser::parse<int32_t>("averageelementlen", lines))
+      _avgElemLen(ConfigParser::parse<int32_t>("averageelementlen", lines)),
+      _blockDocIds(ConfigParser::parse<bool>("blockdocids", lines, false))
 {
 }
 
@@ -165,6 +168,9 @@ Schema::IndexField::write(vespalib::asciistream & os, vespalib::stringref prefix
     os << prefix << "phrases " << (_phrases ? "true" : "false") << "\n";
     os << prefix << "positions " << (_positions ? "true" : "false") << "\n";
     os << prefix << "averageelementlen " << static_cast<int32_t>(_avgElemLen) << "\n";
+    if (_blockDocIds) {
+        os << prefix << "blockdocids true\n";
+    }
 }
 
 bool
@@ -174,7 +180,8 @@ Schema::IndexField::operator==(const IndexField &rhs) const
                   _prefix == rhs._prefix &&
                  _phrases == rhs._phrases &&
                _positions == rhs._positions &&
-              _avgElemLen == rhs._avgElemLen;
+              _avgElemLen == rhs._avgElemLen &&
+             _blockDocIds == rhs._blockDocIds;
 }
 
 bool
@@ -184,7 +191,8 @@ Schema::IndexField::operator!=(const IndexField &rhs) const
                   _prefix != rhs._prefix ||
                  _phrases != rhs._phrases ||
                _positions != rhs._positions ||
-              _avgElemLen != rhs._avgElemLen;
+              _avgElemLen != rhs._avgElemLen ||
+             _blockDocIds != rhs._blockDocIds;
 }
 
 Schema::FieldSet::FieldSet(const std::vector<vespalib::string> & lines) :
@@ -340,7 +348,8 @@ cloneIndexField(const Schema::IndexField &field,
         setPrefix(field.hasPrefix()).
         setPhrases(field.hasPhrases()).
         setPositions(field.hasPositions()).
-        setAvgElemLen(field.getAvgElemLen());
+        setAvgElemLen(field.getAvgElemLen()).
+        setBlockDocIds(field.useBlockDocIds());
 }
 
 template <typename T, typename M>
@@ -80,6 +80,7 @@ public:
         bool _phrases;
         bool _positions;
         uint32_t _avgElemLen;
+        bool _blockDocIds;
 
     public:
         IndexField(vespalib::stringref name, DataType dt);
@@ -95,6 +96,8 @@ public:
         { _positions = value; return *this; }
         IndexField &setAvgElemLen(uint32_t avgElemLen)
         { _avgElemLen = avgElemLen; return *this; }
+        IndexField &setBlockDocIds(bool value)
+        { _blockDocIds = value; return *this; }
 
         void
         write(vespalib::asciistream &os,
@@ -104,6 +107,7 @@ public:
         bool hasPhrases() const { return _phrases; }
         bool hasPositions() const { return _positions; }
         uint32_t getAvgElemLen() const { return _avgElemLen; }
+        bool useBlockDocIds() const { return _blockDocIds; }
 
         bool operator==(const IndexField &rhs) const;
         bool operator!=(const IndexField &rhs) const;
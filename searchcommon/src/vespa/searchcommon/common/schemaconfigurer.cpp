@@ -147,7 +147,8 @@ SchemaBuilder::build(const IndexschemaConfig &cfg, Schema &schema)
                 setPrefix(f.prefix).
                 setPhrases(f.phrases).
                 setPositions(f.positions).
-                setAvgElemLen(f.averageelementlen));
+                setAvgElemLen(f.averageelementlen).
+                setBlockDocIds(f.blockdocids));
     }
     for (size_t i = 0; i < cfg.fieldset.size(); ++i) {
         const IndexschemaConfig::Fieldset &fs = cfg.fieldset[i];
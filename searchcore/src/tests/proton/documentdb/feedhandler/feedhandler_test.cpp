@@ -444,6 +444,8 @@ struct MyTlsWriter : TlsWriter {
 
     MyTlsWriter() : store_count(0), erase_count(0), erase_return(true) {}
     void storeOperation(const FeedOperation &, DoneCallback) override { ++store_count; }
+    void beginBatch() override { }
+    void endBatch() override { }
     bool erase(SerialNum) override { ++erase_count; return erase_return; }
 
     SerialNum sync(SerialNum syncTo) override {
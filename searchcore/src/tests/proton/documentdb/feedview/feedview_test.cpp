@@ -1317,6 +1317,29 @@ TEST_F("require that forceCommit updates docid limit during shrink", SearchableF
     EXPECT_EQUAL(3u, f._docIdLimit.get());
 }
 
+TEST_F("require that commit is called once for a batch of operations",
+       SearchableFeedViewFixture)
+{
+    DocumentContext::List docs = f.makeDummyDocs(1, 2, 10);
+    f.runInMaster([&]() {
+        f.getFeedView().beginBatch();
+        for (const auto &docCtx : docs) {
+            PutOperation op(docCtx.bid, docCtx.ts, docCtx.doc);
+            f.performPut(FeedToken(), op);
+        }
+        f.getFeedView().endBatch(f.serial, IDestructorCallback::SP());
+    });
+    EXPECT_EQUAL(1u, f.miw._commitCount);
+    EXPECT_EQUAL(1u, f.maw._commitCount);
+    EXPECT_EQUAL(3u, f._docIdLimit.get());
+    f.assertTrace("put(adapter=attribute,serialNum=1,lid=1,commit=0),"
+                  "put(adapter=index,serialNum=1,lid=1,commit=0),"
+                  "put(adapter=attribute,serialNum=2,lid=2,commit=0),"
+                  "put(adapter=index,serialNum=2,lid=2,commit=0),"
+                  "commit(adapter=attribute,serialNum=2),"
+                  "commit(adapter=index,serialNum=2)");
+}
+
 TEST_F("require that move() notifies gid to lid change handler", SearchableFeedViewFixture)
 {
     DocumentContext dc1 = f.doc("id::searchdocument::1", 10);
@@ -82,6 +82,21 @@ struct SpikeWork : public Work {
     }
 };
 
+// sparse hits among old documents and dense hits among recent ones
+struct SkewedWork : public Work {
+    uint32_t dense_begin;
+    size_t sparse_step;
+    size_t cost;
+    SkewedWork(uint32_t dense_begin_in, size_t sparse_step_in, size_t cost_in)
+        : dense_begin(dense_begin_in), sparse_step(sparse_step_in), cost(cost_in) {}
+    vespalib::string desc() const override { return make_string("skewed(%u,%zu,%zu)", dense_begin, sparse_step, cost); }
+    void perform(uint32_t docid) const override {
+        if ((docid >= dense_begin) || ((docid % sparse_step) == 0)) {
+            (void) do_work(cost);
+        }
+    }
+};
+
 struct WorkList {
     std::vector<Work::UP> work_list;
     WorkList() : work_list() {
@@ -95,6 +110,8 @@ struct WorkList {
         work_list.push_back(std::make_unique<SpikeWork>(99001, 100001, 1000));
         work_list.push_back(std::make_unique<SpikeWork>(99901, 100001, 10000));
         work_list.push_back(std::make_unique<SpikeWork>(99991, 100001, 100000));
+        work_list.push_back(std::make_unique<SkewedWork>(80001, 100, 100));
+        work_list.push_back(std::make_unique<SkewedWork>(95001, 1000, 1000));
     }
 };
 
@@ -138,6 +155,17 @@ struct AdaptiveSchedulerFactory : public SchedulerFactory {
     }
 };
 
+struct WorkStealingSchedulerFactory : public SchedulerFactory {
+    size_t num_threads;
+    size_t num_tasks;
+    WorkStealingSchedulerFactory(size_t num_threads_in, size_t num_tasks_in)
+        : num_threads(num_threads_in), num_tasks(num_tasks_in) {}
+    vespalib::string desc() const override { return make_string("work_stealing(threads:%zu,num_tasks:%zu)", num_threads, num_tasks); }
+    DocidRangeScheduler::UP create(uint32_t docid_limit) const override {
+        return std::make_unique<WorkStealingDocidRangeScheduler>(num_threads, num_tasks, docid_limit);
+    }
+};
+
 struct SchedulerList {
     std::vector<SchedulerFactory::UP> factory_list;
     SchedulerList(size_t num_threads) : factory_list() {
@@ -151,6 +179,10 @@ struct SchedulerList {
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 100));
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 10));
         factory_list.push_back(std::make_unique<AdaptiveSchedulerFactory>(num_threads, 1));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 64));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 256));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 1024));
+        factory_list.push_back(std::make_unique<WorkStealingSchedulerFactory>(num_threads, 4096));
     }
 };
 
@@ -305,4 +305,82 @@ TEST_MT_FF("require that the adaptive scheduler handles fewer documents than thr
 
 //-----------------------------------------------------------------------------
 
+TEST("require that the work stealing scheduler acts as expected") {
+    WorkStealingDocidRangeScheduler scheduler(2, 4, 17);
+    EXPECT_EQUAL(scheduler.unassigned_size(), 16u);
+    TEST_DO(verify_range(scheduler.total_span(0), DocidRange(1, 17)));
+    TEST_DO(verify_range(scheduler.total_span(1), DocidRange(1, 17)));
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1, 5)));
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(9, 13)));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 8u);
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(5, 9)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(13, 17)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange()));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange()));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 0u);
+    EXPECT_EQUAL(scheduler.total_size(0), 12u);
+    EXPECT_EQUAL(scheduler.total_size(1), 4u);
+}
+
+TEST("require that the work stealing scheduler steals the back half of other deques") {
+    WorkStealingDocidRangeScheduler scheduler(2, 8, 33);
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(17, 21)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(21, 25)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(25, 29)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(29, 33)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(9, 13)));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 12u);
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange(1, 5)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(5, 9)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange(13, 17)));
+    TEST_DO(verify_range(scheduler.next_range(0), DocidRange()));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange()));
+    EXPECT_EQUAL(scheduler.total_size(0), 12u);
+    EXPECT_EQUAL(scheduler.total_size(1), 20u);
+}
+
+TEST("require that the work stealing scheduler protects against documents underflow") {
+    WorkStealingDocidRangeScheduler scheduler(2, 4, 0);
+    TEST_DO(verify_range(scheduler.total_span(0), DocidRange(1,1)));
+    EXPECT_EQUAL(scheduler.unassigned_size(), 0u);
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange()));
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange()));
+    EXPECT_EQUAL(scheduler.total_size(0), 0u);
+    EXPECT_EQUAL(scheduler.total_size(1), 0u);
+}
+
+TEST("require that the work stealing scheduler skips empty tasks") {
+    WorkStealingDocidRangeScheduler scheduler(2, 8, 4);
+    TEST_DO(verify_range(scheduler.first_range(1), DocidRange(3, 4)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(2, 3)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange(1, 2)));
+    TEST_DO(verify_range(scheduler.next_range(1), DocidRange()));
+    TEST_DO(verify_range(scheduler.first_range(0), DocidRange()));
+}
+
+TEST_MT_FFF("require that the work stealing scheduler assigns each docid to exactly one thread",
+            8, WorkStealingDocidRangeScheduler(num_threads, 64, 10001), std::vector<uint32_t>(10001, 0), TimeBomb(60))
+{
+    for (DocidRange docid_range = f1.first_range(thread_id);
+         !docid_range.empty();
+         docid_range = f1.next_range(thread_id))
+    {
+        for (uint32_t docid = docid_range.begin; docid < docid_range.end; ++docid) {
+            ++f2[docid];
+        }
+    }
+    TEST_BARRIER();
+    if (thread_id == 0) {
+        size_t total = 0;
+        for (size_t i = 0; i < num_threads; ++i) {
+            total += f1.total_size(i);
+        }
+        EXPECT_EQUAL(total, 10000u);
+        EXPECT_EQUAL(f1.unassigned_size(), 0u);
+        EXPECT_EQUAL(std::count(f2.begin() + 1, f2.end(), 1u), 10000);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 TEST_MAIN() { TEST_RUN_ALL(); }
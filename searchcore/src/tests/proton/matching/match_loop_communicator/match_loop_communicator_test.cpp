@@ -26,12 +26,12 @@ Hits makeScores(size_t id) {
     return Box<Hit>();
 }
 
-Hits selectBest(MatchLoopCommunicator &com, const Hits &hits) {
+Hits selectBest(MatchLoopCommunicator &com, size_t thread_id, const Hits &hits) {
     std::vector<uint32_t> refs;
     for (size_t i = 0; i < hits.size(); ++i) {
         refs.push_back(i);
     }
-    return com.selectBest(SortedHitSequence(&hits[0], &refs[0], refs.size()));
+    return com.selectBest(thread_id, SortedHitSequence(&hits[0], &refs[0], refs.size()));
 }
 
 RangePair makeRanges(size_t id) {
@@ -66,50 +66,67 @@ struct EveryOdd : public search::queryeval::IDiversifier {
 };
 
 TEST_F("require that selectBest gives appropriate results for single thread", MatchLoopCommunicator(num_threads, 3)) {
-    TEST_DO(equal(2u, make_box<Hit>({1, 5}, {2, 4}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}))));
-    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {2, 4}, {3, 3}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}, {3, 3}))));
-    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {2, 4}, {3, 3}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}))));
+    TEST_DO(equal(2u, make_box<Hit>({1, 5}, {2, 4}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}))));
+    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {2, 4}, {3, 3}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}, {3, 3}))));
+    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {2, 4}, {3, 3}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}))));
 }
 
 TEST_F("require that selectBest gives appropriate results for single thread with filter",
        MatchLoopCommunicator(num_threads, 3, std::make_unique<EveryOdd>()))
 {
-    TEST_DO(equal(1u, make_box<Hit>({1, 5}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}))));
-    TEST_DO(equal(2u, make_box<Hit>({1, 5}, {3, 3}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}, {3, 3}))));
-    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {3, 3}, {5, 1}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}, {5, 1}, {6, 0}))));
+    TEST_DO(equal(1u, make_box<Hit>({1, 5}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}))));
+    TEST_DO(equal(2u, make_box<Hit>({1, 5}, {3, 3}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}, {3, 3}))));
+    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {3, 3}, {5, 1}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}, {5, 1}, {6, 0}))));
 }
 
 TEST_MT_F("require that selectBest works with no hits", 10, MatchLoopCommunicator(num_threads, 10)) {
-    EXPECT_TRUE(selectBest(f1, Box<Hit>()).empty());
+    EXPECT_TRUE(selectBest(f1, thread_id, Box<Hit>()).empty());
 }
 
 TEST_MT_F("require that selectBest works with too many hits from all threads", 5, MatchLoopCommunicator(num_threads, 13)) {
     if (thread_id < 3) {
-        TEST_DO(equal(3u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(3u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     } else {
-        TEST_DO(equal(2u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(2u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     }
 }
 
 TEST_MT_F("require that selectBest works with some exhausted threads", 5, MatchLoopCommunicator(num_threads, 22)) {
     if (thread_id < 2) {
-        TEST_DO(equal(5u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(5u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     } else {
-        TEST_DO(equal(4u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(4u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     }
 }
 
 TEST_MT_F("require that selectBest can select all hits from all threads", 5, MatchLoopCommunicator(num_threads, 100)) {
-    EXPECT_EQUAL(5u, selectBest(f1, makeScores(thread_id)).size());
+    EXPECT_EQUAL(5u, selectBest(f1, thread_id, makeScores(thread_id)).size());
 }
 
 TEST_MT_F("require that selectBest works with some empty threads", 10, MatchLoopCommunicator(num_threads, 7)) {
     if (thread_id < 2) {
-        TEST_DO(equal(2u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(2u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     } else if (thread_id < 5) {
-        TEST_DO(equal(1u, makeScores(thread_id), selectBest(f1, makeScores(thread_id))));
+        TEST_DO(equal(1u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     } else {
-        EXPECT_TRUE(selectBest(f1, makeScores(thread_id)).empty());
+        EXPECT_TRUE(selectBest(f1, thread_id, makeScores(thread_id)).empty());
+    }
+}
+
+TEST_MT_F("require that selectBest merges hits from uneven number of threads", 7, MatchLoopCommunicator(num_threads, 9)) {
+    if (thread_id < 4) {
+        TEST_DO(equal(2u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
+    } else if (thread_id < 5) {
+        TEST_DO(equal(1u, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
+    } else {
+        EXPECT_TRUE(selectBest(f1, thread_id, makeScores(thread_id)).empty());
+    }
+}
+
+TEST_MT_F("require that selectBest can be used for several queries", 5, MatchLoopCommunicator(num_threads, 13)) {
+    for (size_t i = 0; i < 3; ++i) {
+        size_t expect = (thread_id < 3) ? 3 : 2;
+        TEST_DO(equal(expect, makeScores(thread_id), selectBest(f1, thread_id, makeScores(thread_id))));
     }
 }
 
@@ -141,7 +158,7 @@ TEST_MT_F("require that only invalid ranges produce default invalid range", 3, M
 TEST_F("require that hits dropped due to lack of diversity affects range cover result",
        MatchLoopCommunicator(num_threads, 3, std::make_unique<EveryOdd>()))
 {
-    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {3, 3}, {5, 1}), selectBest(f1, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}, {5, 1}))));
+    TEST_DO(equal(3u, make_box<Hit>({1, 5}, {3, 3}, {5, 1}), selectBest(f1, thread_id, make_box<Hit>({1, 5}, {2, 4}, {3, 3}, {4, 2}, {5, 1}))));
     // best dropped: 4
     std::vector<RangePair> input = {
         std::make_pair(Range(), Range()),
@@ -144,6 +144,37 @@ TEST("requireThatMinMaxTimesAreRecorded") {
     EXPECT_APPROX(5.0, stats.queryLatencyMax(), 0.00001);
 }
 
+TEST("requireThatSelectBestTimeIsRecorded") {
+    MatchingStats stats;
+    EXPECT_EQUAL(0u, stats.selectBestTimeCount());
+    stats.selectBestTime(0.5);
+    stats.add(MatchingStats().selectBestTime(1.5));
+    EXPECT_EQUAL(2u, stats.selectBestTimeCount());
+    EXPECT_APPROX(1.0, stats.selectBestTimeAvg(), 0.00001);
+    EXPECT_APPROX(0.5, stats.selectBestTimeMin(), 0.00001);
+    EXPECT_APPROX(1.5, stats.selectBestTimeMax(), 0.00001);
+}
+
+TEST("requireThatPartitionPhaseTimesAreRecorded") {
+    MatchingStats::Partition part;
+    part.first_phase_time(1.0).select_best_time(0.2).second_phase_time(0.5);
+    MatchingStats::Partition other;
+    other.first_phase_time(3.0).select_best_time(0.4).second_phase_time(1.5);
+    MatchingStats stats;
+    stats.merge_partition(part, 0);
+    stats.add(MatchingStats().merge_partition(other, 0));
+    const MatchingStats::Partition &merged = stats.getPartition(0);
+    EXPECT_EQUAL(2u, merged.first_phase_time_count());
+    EXPECT_EQUAL(2u, merged.select_best_time_count());
+    EXPECT_EQUAL(2u, merged.second_phase_time_count());
+    EXPECT_APPROX(2.0, merged.first_phase_time_avg(), 0.00001);
+    EXPECT_APPROX(0.3, merged.select_best_time_avg(), 0.00001);
+    EXPECT_APPROX(1.0, merged.second_phase_time_avg(), 0.00001);
+    EXPECT_APPROX(1.0, merged.first_phase_time_min(), 0.00001);
+    EXPECT_APPROX(0.4, merged.select_best_time_max(), 0.00001);
+    EXPECT_APPROX(1.5, merged.second_phase_time_max(), 0.00001);
+}
+
 TEST("requireThatPartitionsAreAddedCorrectly") {
     MatchingStats all1;
     EXPECT_EQUAL(0u, all1.docidSpaceCovered());
@@ -588,6 +588,42 @@ TEST("require that sortspec can be used (multi-threaded)") {
     }
 }
 
+TEST("require that matching stops after the first hits when requested") {
+    MyWorld world;
+    world.basicSetup();
+    world.basicResults();
+    SearchRequest::SP request = world.createSimpleRequest("f1", "spread");
+    request->offset = 1;
+    request->maxhits = 2;
+    request->propertiesMap.lookupCreate(MapNames::RANK).add(indexproperties::matching::FirstHitsOnly::NAME, "true");
+    SearchReply::UP reply = world.performSearch(request, 1);
+    EXPECT_EQUAL(3u, world.matchingStats.docsMatched());
+    EXPECT_EQUAL(0u, world.matchingStats.docsRanked());
+    EXPECT_EQUAL(3u, reply->totalHitCount);
+    ASSERT_EQUAL(2u, reply->hits.size());
+    EXPECT_EQUAL(document::DocumentId("doc::200").getGlobalId(),  reply->hits[0].gid);
+    EXPECT_EQUAL(zero_rank_value, reply->hits[0].metric);
+    EXPECT_EQUAL(document::DocumentId("doc::300").getGlobalId(),  reply->hits[1].gid);
+    EXPECT_TRUE(reply->coverage.wasDegradedByMatchPhase());
+    EXPECT_LESS(reply->coverage.getCovered(), reply->coverage.getActive());
+}
+
+TEST("require that first hits only is ignored when sorting") {
+    MyWorld world;
+    world.basicSetup();
+    world.basicResults();
+    world.set_property(indexproperties::matching::FirstHitsOnly::NAME, "true");
+    SearchRequest::SP request = world.createSimpleRequest("f1", "spread");
+    request->maxhits = 2;
+    request->sortSpec = "-a1";
+    SearchReply::UP reply = world.performSearch(request, 1);
+    EXPECT_EQUAL(9u, world.matchingStats.docsMatched());
+    EXPECT_EQUAL(9u, reply->totalHitCount);
+    ASSERT_EQUAL(2u, reply->hits.size());
+    EXPECT_EQUAL(document::DocumentId("doc::900").getGlobalId(),  reply->hits[0].gid);
+    EXPECT_FALSE(reply->coverage.wasDegradedByMatchPhase());
+}
+
 ExpressionNode::UP createAttr() { return std::make_unique<AttributeNode>("a1"); }
 TEST("require that grouping is performed (multi-threaded)") {
     for (size_t threads = 1; threads <= 16; ++threads) {
@@ -0,0 +1,177 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchcore/proton/matching/fakesearchcontext.h>
+#include <vespa/searchcore/proton/matching/matchdatareservevisitor.h>
+#include <vespa/searchcore/proton/matching/query.h>
+#include <vespa/searchcore/proton/matching/querynodes.h>
+#include <vespa/searchcore/proton/matching/resolved_views.h>
+#include <vespa/searchcore/proton/matching/resolveviewvisitor.h>
+#include <vespa/searchcore/proton/matching/viewresolver.h>
+#include <vespa/searchlib/fef/matchdata.h>
+#include <vespa/searchlib/fef/matchdatalayout.h>
+#include <vespa/searchlib/fef/test/indexenvironment.h>
+#include <vespa/searchlib/parsequery/stackdumpiterator.h>
+#include <vespa/searchlib/query/tree/querybuilder.h>
+#include <vespa/searchlib/query/tree/stackdumpcreator.h>
+#include <vespa/searchlib/queryeval/fake_requestcontext.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/vespalib/util/benchmark_timer.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vespa/log/log.h>
+LOG_SETUP("query_setup_bench");
+#include <vespa/searchlib/query/tree/querytreecreator.h>
+
+using namespace proton::matching;
+using search::SimpleQueryStackDumpIterator;
+using search::fef::FieldInfo;
+using search::fef::FieldType;
+using search::fef::MatchDataLayout;
+using search::query::Node;
+using search::query::QueryBuilder;
+using search::query::QueryTreeCreator;
+using search::query::Range;
+using search::query::StackDumpCreator;
+using search::query::Weight;
+using search::queryeval::FakeRequestContext;
+using search::queryeval::FakeResult;
+using vespalib::BenchmarkTimer;
+using vespalib::make_string;
+using CollectionType = FieldInfo::CollectionType;
+
+//-----------------------------------------------------------------------------
+
+// Measures how much of query setup a plan cache keyed on query shape
+// could skip. Only view resolution and match data handle reservation
+// depend on the shape alone; parsing, blueprint building, optimize and
+// fetchPostings depend on the term values. Fake sources make blueprint
+// building cheaper than with real dictionaries, and rank program setup
+// is left out, so the share reported here is an upper bound.
+
+constexpr size_t num_queries = 100;
+constexpr double budget = 2.0;
+
+struct Fixture {
+    search::fef::test::IndexEnvironment index_env;
+    ViewResolver resolver;
+    ResolvedViews views;
+    FakeRequestContext request_context;
+    FakeSearchContext search_context;
+    std::vector<vespalib::string> stacks;
+
+    static const search::fef::test::IndexEnvironment &setup_index_env(search::fef::test::IndexEnvironment &env) {
+        env.getFields().emplace_back(FieldType::INDEX, CollectionType::SINGLE, "title", 0);
+        env.getFields().emplace_back(FieldType::INDEX, CollectionType::SINGLE, "body", 1);
+        env.getFields().emplace_back(FieldType::ATTRIBUTE, CollectionType::SINGLE, "category", 2);
+        env.getFields().emplace_back(FieldType::ATTRIBUTE, CollectionType::SINGLE, "price", 3);
+        return env;
+    }
+    static ViewResolver make_resolver() {
+        ViewResolver resolver;
+        resolver.add("default", "title").add("default", "body");
+        return resolver;
+    }
+    static vespalib::string make_stack(size_t i) {
+        QueryBuilder<ProtonNodeTypes> builder;
+        builder.addRank(2);
+        builder.addAnd(4);
+        builder.addStringTerm(make_string("word%zu", i), "default", 0, Weight(100));
+        builder.addStringTerm(make_string("word%zu", (i * 7) % num_queries), "title", 1, Weight(100));
+        builder.addOr(2);
+        builder.addStringTerm(make_string("cat%zu", i % 10), "category", 2, Weight(100));
+        builder.addStringTerm(make_string("cat%zu", (i + 3) % 10), "category", 3, Weight(100));
+        builder.addRangeTerm(Range(i, i + 100), "price", 4, Weight(100));
+        builder.addStringTerm(make_string("word%zu", (i * 13) % num_queries), "body", 5, Weight(100));
+        return StackDumpCreator::create(*builder.build());
+    }
+
+    Fixture()
+        : index_env(),
+          resolver(make_resolver()),
+          views(resolver, setup_index_env(index_env)),
+          request_context(),
+          search_context(1000000),
+          stacks()
+    {
+        search_context.addIdx(0);
+        for (size_t i = 0; i < num_queries; ++i) {
+            vespalib::string word = make_string("word%zu", i);
+            search_context.idx(0).getFake().addResult("title", word, FakeResult().doc(i + 1).doc(i + 1000));
+            search_context.idx(0).getFake().addResult("body", word, FakeResult().doc(i + 2).doc(i + 2000));
+            stacks.push_back(make_stack(i));
+        }
+        for (size_t i = 0; i < 10; ++i) {
+            search_context.attr().addResult("category", make_string("cat%zu", i), FakeResult().doc(i + 5));
+        }
+    }
+};
+
+/**
+ * The least a plan cache lookup has to do: walk the stack dump and
+ * hash everything except the term values.
+ **/
+uint64_t shape_key(const vespalib::string &stack) {
+    SimpleQueryStackDumpIterator itr(stack);
+    uint64_t key = 0;
+    while (itr.next()) {
+        vespalib::stringref index = itr.getIndexName();
+        key = key * 31 + itr.getType();
+        key = key * 31 + itr.getArity();
+        key = key * 31 + vespalib::hashValue(index.data(), index.size());
+    }
+    return key;
+}
+
+double measure(const char *name, const Fixture &f, std::function<void(const vespalib::string &)> fun) {
+    size_t i = 0;
+    BenchmarkTimer timer(budget);
+    while (timer.has_budget()) {
+        const vespalib::string &stack = f.stacks[i++ % num_queries];
+        timer.before();
+        fun(stack);
+        timer.after();
+    }
+    double us = timer.min_time() * 1000.0 * 1000.0;
+    fprintf(stderr, "%s: %g us\n", name, us);
+    return us;
+}
+
+TEST_F("measure share of query setup that depends only on query shape", Fixture) {
+    Fixture &fx = f;
+    double full = measure("full setup", fx, [&fx](const vespalib::string &stack) {
+                Query query;
+                query.buildTree(stack, "", fx.views);
+                MatchDataLayout mdl;
+                query.reserveHandles(fx.request_context, fx.search_context, mdl);
+                query.optimize();
+                query.fetchPostings();
+                auto md = mdl.createMatchData();
+            });
+    double parse = measure("parse only", fx, [](const vespalib::string &stack) {
+                SimpleQueryStackDumpIterator itr(stack);
+                Node::UP tree = QueryTreeCreator<ProtonNodeTypes>::create(itr);
+            });
+    double shape = measure("parse, resolve views and reserve handles", fx, [&fx](const vespalib::string &stack) {
+                SimpleQueryStackDumpIterator itr(stack);
+                Node::UP tree = QueryTreeCreator<ProtonNodeTypes>::create(itr);
+                ResolveViewVisitor resolve_visitor(fx.views);
+                tree->accept(resolve_visitor);
+                MatchDataLayout mdl;
+                MatchDataReserveVisitor reserve_visitor(mdl);
+                tree->accept(reserve_visitor);
+            });
+    vespalib::hash_map<uint64_t, uint32_t> plans;
+    plans[shape_key(fx.stacks[0])] = 0;
+    size_t hits = 0;
+    double lookup = measure("shape key and lookup", fx, [&plans, &hits](const vespalib::string &stack) {
+                hits += (plans.find(shape_key(stack)) != plans.end()) ? 1 : 0;
+            });
+    EXPECT_GREATER(hits, 0u);
+    double cacheable = std::max(0.0, shape - parse);
+    fprintf(stderr, "shape dependent work: %g us (%.1f%% of full setup), lookup cost: %g us\n",
+            cacheable, 100.0 * cacheable / full, lookup);
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_MAIN() { TEST_RUN_ALL(); }
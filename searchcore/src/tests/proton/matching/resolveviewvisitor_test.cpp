@@ -6,6 +6,7 @@ LOG_SETUP("resolveviewvisitor_test");
 
 #include <vespa/searchlib/fef/test/indexenvironment.h>
 #include <vespa/searchcore/proton/matching/querynodes.h>
+#include <vespa/searchcore/proton/matching/resolved_views.h>
 #include <vespa/searchcore/proton/matching/resolveviewvisitor.h>
 #include <vespa/searchcore/proton/matching/viewresolver.h>
 #include <vespa/searchlib/query/tree/node.h>
@@ -153,6 +154,42 @@ TEST_F("require that view is resolved for SameElement children", Fixture) {
     EXPECT_EQUAL(field1, my_term.field(0).field_name);
 }
 
+TEST_F("require that resolved views give the same fields as the view resolver", Fixture) {
+    ViewResolver resolver = getResolver(view);
+    resolver.add("default", field2);
+    resolver.add("unknown", "nosuchfield");
+    f.index_environment.getFields().back().setFilter(true);
+    ResolvedViews views(resolver, f.index_environment);
+    EXPECT_EQUAL(5u, views.numViews());
+
+    for (const string &test_view : {view, field1, field2, string(""), string("unknown"), string("nosuchview")}) {
+        for (bool force_filter : {false, true}) {
+            QueryBuilder<ProtonNodeTypes> expected_builder;
+            ProtonStringTerm &expected = expected_builder.addStringTerm(term, test_view, id, weight);
+            expected.setPositionData(!force_filter);
+            Node::UP expected_node = expected_builder.build();
+            ResolveViewVisitor expected_visitor(resolver, f.index_environment);
+            expected_node->accept(expected_visitor);
+
+            QueryBuilder<ProtonNodeTypes> builder;
+            ProtonStringTerm &actual = builder.addStringTerm(term, test_view, id, weight);
+            actual.setPositionData(!force_filter);
+            Node::UP node = builder.build();
+            ResolveViewVisitor visitor(views);
+            node->accept(visitor);
+
+            TEST_STATE(test_view.c_str());
+            ASSERT_EQUAL(expected.numFields(), actual.numFields());
+            for (size_t i = 0; i < actual.numFields(); ++i) {
+                EXPECT_EQUAL(expected.field(i).field_name, actual.field(i).field_name);
+                EXPECT_EQUAL(expected.field(i).getFieldId(), actual.field(i).getFieldId());
+                EXPECT_EQUAL(expected.field(i).filter_field, actual.field(i).filter_field);
+                EXPECT_EQUAL(expected.field(i).attribute_field, actual.field(i).attribute_field);
+            }
+        }
+    }
+}
+
 }  // namespace
 
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -37,15 +37,21 @@ struct MyFeedView : public test::DummyFeedView {
     TestDocRepo repo;
     std::shared_ptr<const DocumentTypeRepo> repo_sp;
     int remove_handled;
+    bool fail_remove;
 
     MyFeedView();
     ~MyFeedView();
 
     const std::shared_ptr<const DocumentTypeRepo> &getDocumentTypeRepo() const override { return repo_sp; }
-    void handleRemove(FeedToken , const RemoveOperation &) override { ++remove_handled; }
+    void handleRemove(FeedToken , const RemoveOperation &) override {
+        if (fail_remove) {
+            throw std::runtime_error("remove failed");
+        }
+        ++remove_handled;
+    }
 };
 
-MyFeedView::MyFeedView() : repo_sp(repo.getTypeRepoSp()), remove_handled(0) {}
+MyFeedView::MyFeedView() : repo_sp(repo.getTypeRepoSp()), remove_handled(0), fail_remove(false) {}
 MyFeedView::~MyFeedView() {}
 
 struct MyReplayConfig : IReplayConfig {
@@ -59,6 +65,22 @@ struct InstantExecutor : vespalib::Executor {
     }
 };
 
+struct QueuedExecutor : vespalib::Executor {
+    std::vector<Task::UP> tasks;
+    virtual Task::UP execute(Task::UP task) override {
+        tasks.push_back(std::move(task));
+        return Task::UP();
+    }
+    void run() {
+        std::vector<Task::UP> to_run;
+        to_run.swap(tasks);
+        for (auto &task : to_run) {
+            Task::UP run_task(std::move(task));
+            run_task->run();
+        }
+    }
+};
+
 struct Fixture
 {
     MyFeedView feed_view1;
@@ -139,6 +161,35 @@ TEST_F("require that replay progress is tracked", Fixture)
     EXPECT_EQUAL(0.5, progress.getProgress());
 }
 
+TEST_F("require that packet is deserialized before it is replayed by executor", Fixture)
+{
+    RemoveOperationContext opCtx(10);
+    PacketWrapper::SP wrap(new PacketWrapper(*opCtx.packet, NULL));
+    QueuedExecutor executor;
+
+    f.state.receive(wrap, executor);
+    EXPECT_EQUAL(1u, wrap->gate.getCount());
+    EXPECT_EQUAL(1u, executor.tasks.size());
+    EXPECT_EQUAL(0, f.feed_view1.remove_handled);
+    executor.run();
+    EXPECT_EQUAL(0u, wrap->gate.getCount());
+    EXPECT_EQUAL(search::transactionlog::RPC::OK, wrap->result);
+    EXPECT_EQUAL(1, f.feed_view1.remove_handled);
+}
+
+TEST_F("require that packet is done with error result when replay fails", Fixture)
+{
+    RemoveOperationContext opCtx(10);
+    PacketWrapper::SP wrap(new PacketWrapper(*opCtx.packet, NULL));
+    QueuedExecutor executor;
+
+    f.feed_view1.fail_remove = true;
+    f.state.receive(wrap, executor);
+    EXPECT_EXCEPTION(executor.run(), std::runtime_error, "remove failed");
+    EXPECT_EQUAL(0u, wrap->gate.getCount());
+    EXPECT_EQUAL(search::transactionlog::RPC::ERROR, wrap->result);
+}
+
 }  // namespace
 
 TEST_MAIN() { TEST_RUN_ALL(); }
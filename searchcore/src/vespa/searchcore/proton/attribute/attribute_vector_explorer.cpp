@@ -31,6 +31,7 @@ convertStatusToSlime(const Status &status, Cursor &object)
     object.setLong("updateCount", status.getUpdateCount());
     object.setLong("nonIdempotentUpdateCount", status.getNonIdempotentUpdateCount());
     object.setLong("bitVectors", status.getBitVectors());
+    object.setLong("compressedPostingLists", status.getCompressedPostingLists());
     {
         Cursor &memory = object.setObject("memoryUsage");
         memory.setLong("allocatedBytes", status.getAllocated());
@@ -39,6 +40,11 @@ convertStatusToSlime(const Status &status, Cursor &object)
         memory.setLong("onHoldBytes", status.getOnHold());
         memory.setLong("onHoldBytesMax", status.getOnHoldMax());
     }
+    {
+        Cursor &compaction = object.setObject("compaction");
+        compaction.setLong("completed", status.getCompactions());
+        compaction.setLong("pendingDocs", status.getPendingCompactionDocs());
+    }
 }
 
 void
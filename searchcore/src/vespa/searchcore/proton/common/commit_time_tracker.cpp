@@ -1,19 +1,34 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "commit_time_tracker.h"
+#include <cassert>
 
 namespace proton {
 
 CommitTimeTracker::CommitTimeTracker(fastos::TimeStamp visibilityDelay)
     : _visibilityDelay(visibilityDelay),
       _nextCommit(fastos::ClockSystem::now()),
-      _replayDone(false)
+      _replayDone(false),
+      _inBatch(false),
+      _batchNeedCommit(false)
 {
     _nextCommit += visibilityDelay;
 }
 
 bool
 CommitTimeTracker::needCommit() const
+{
+    if (_inBatch) {
+        if (!_batchNeedCommit) {
+            _batchNeedCommit = needCommitNow();
+        }
+        return false;
+    }
+    return needCommitNow();
+}
+
+bool
+CommitTimeTracker::needCommitNow() const
 {
     if (_visibilityDelay > 0) {
         if (_replayDone) {
@@ -40,5 +55,23 @@ CommitTimeTracker::setVisibilityDelay(fastos::TimeStamp visibilityDelay)
     _visibilityDelay = visibilityDelay;
 }
 
+void
+CommitTimeTracker::beginBatch()
+{
+    assert(!_inBatch);
+    _inBatch = true;
+    _batchNeedCommit = false;
+}
+
+bool
+CommitTimeTracker::endBatch()
+{
+    assert(_inBatch);
+    _inBatch = false;
+    bool result = _batchNeedCommit;
+    _batchNeedCommit = false;
+    return result;
+}
+
 
 } // namespace proton
@@ -7,6 +7,10 @@ namespace proton {
 
 /**
  * Class used to track when commit is needed based on wanted visibility delay.
+ *
+ * While a batch of feed operations is open, commits are not requested per
+ * operation. Instead it is recorded that a commit was wanted, and a single
+ * commit is performed when the batch is ended.
  */
 class CommitTimeTracker
 {
@@ -14,6 +18,10 @@ private:
     fastos::TimeStamp           _visibilityDelay;
     mutable fastos::TimeStamp   _nextCommit;
     bool                        _replayDone;
+    bool                        _inBatch;
+    mutable bool                _batchNeedCommit;
+
+    bool needCommitNow() const;
 
 public:
     CommitTimeTracker(fastos::TimeStamp visibilityDelay);
@@ -25,6 +33,14 @@ public:
     bool hasVisibilityDelay() const { return _visibilityDelay != 0; }
 
     void setReplayDone() { _replayDone = true; }
+
+    void beginBatch();
+
+    /**
+     * Ends the current batch. Returns true if a commit was wanted by any
+     * of the operations in the batch.
+     */
+    bool endBatch();
 };
 
 } // namespace proton
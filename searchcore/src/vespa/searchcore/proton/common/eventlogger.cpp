@@ -54,7 +54,7 @@ EventLogger::transactionLogReplayStart(const string &domainName, SerialNum first
 
 void
 EventLogger::transactionLogReplayProgress(const string &domainName, float progress,
-                                          SerialNum first, SerialNum last, SerialNum current)
+                                          SerialNum first, SerialNum last, SerialNum current, double rate)
 {
     JSONStringer jstr;
     jstr.beginObject();
@@ -66,6 +66,7 @@ EventLogger::transactionLogReplayProgress(const string &domainName, float progre
         .appendKey("last").appendInt64(last)
         .appendKey("current").appendInt64(current)
         .endObject();
+    jstr.appendKey("rate").appendDouble(rate);
     jstr.endObject();
     EV_STATE("transactionlog.replay.progress", jstr.toString().data());
 }
@@ -31,7 +31,8 @@ public:
                                              float progress,
                                              SerialNum first,
                                              SerialNum last,
-                                             SerialNum current);
+                                             SerialNum current,
+                                             double rate);
     static void flushInit(const string &name);
     static void flushStart(const string &name,
                            int64_t beforeMemory,
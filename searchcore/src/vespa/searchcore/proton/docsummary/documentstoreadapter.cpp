@@ -6,6 +6,7 @@
 #include <vespa/eval/tensor/tensor.h>
 #include <vespa/eval/tensor/serialization/typed_binary_format.h>
 #include <vespa/vespalib/objects/nbostream.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/document/fieldvalue/tensorfieldvalue.h>
 
 #include <vespa/log/log.h>
@@ -157,7 +158,9 @@ DocumentStoreAdapter(const search::IDocumentStore & docStore,
                    LookupResultClass(resultConfig.LookupResultClassId(resultClassName.c_str()))),
       _resultPacker(&_resultConfig),
       _fieldCache(fieldCache),
-      _markupFields(markupFields)
+      _markupFields(markupFields),
+      _readCache(),
+      _prefetched()
 {
 }
 
@@ -170,7 +173,14 @@ DocumentStoreAdapter::getMappedDocsum(uint32_t docId)
         LOG(warning, "Error during init of result class '%s' with class id %u", _resultClass->GetClassName(), getSummaryClassId());
         return DocsumStoreValue();
     }
-    Document::UP document = _docStore.read(docId, _repo);
+    Document::UP document;
+    auto found = _prefetched.find(docId);
+    if (found != _prefetched.end()) {
+        document = std::move(found->second);
+        _prefetched.erase(found);
+    } else {
+        document = _docStore.read(docId, _repo, _readCache);
+    }
     if ( ! document) {
         LOG(debug, "Did not find summary document for docId %u. Returning empty docsum", docId);
         return DocsumStoreValue();
@@ -186,4 +196,13 @@ DocumentStoreAdapter::getMappedDocsum(uint32_t docId)
     return DocsumStoreValue(buf, buflen);
 }
 
+void
+DocumentStoreAdapter::prefetch(const std::vector<uint32_t> &docIds)
+{
+    std::vector<Document::UP> documents = _docStore.read(docIds, _repo);
+    for (size_t i = 0; i < docIds.size(); ++i) {
+        _prefetched[docIds[i]] = std::move(documents[i]);
+    }
+}
+
 } // namespace proton
@@ -5,6 +5,7 @@
 #include "memoryindexwrapper.h"
 #include <vespa/searchlib/common/serialnumfileheadercontext.h>
 #include <vespa/searchlib/diskindex/fusion.h>
+#include <algorithm>
 
 using search::diskindex::Fusion;
 using search::common::FileHeaderContext;
@@ -24,23 +25,36 @@ using searchcorespi::index::IThreadingService;
 
 namespace proton::index {
 
+namespace {
+
+VESPA_THREAD_STACK_TAG(index_fusion_executor)
+
+}
+
 IndexManager::MaintainerOperations::MaintainerOperations(const FileHeaderContext &fileHeaderContext,
                                                          const TuneFileIndexManager &tuneFileIndexManager,
                                                          size_t cacheSize,
+                                                         uint32_t fusionThreads,
+                                                         uint32_t memoryIndexWordShards,
                                                          IThreadingService &threadingService)
     : _cacheSize(cacheSize),
+      _memoryIndexWordShards(std::max(memoryIndexWordShards, 1u)),
       _fileHeaderContext(fileHeaderContext),
       _tuneFileIndexing(tuneFileIndexManager._indexing),
       _tuneFileSearch(tuneFileIndexManager._search),
-      _threadingService(threadingService)
+      _threadingService(threadingService),
+      _fusionExecutor(std::max(fusionThreads, 1u), 128 * 1024, index_fusion_executor),
+      _fusionProgress()
 {
 }
 
+IndexManager::MaintainerOperations::~MaintainerOperations() = default;
+
 IMemoryIndex::SP
 IndexManager::MaintainerOperations::createMemoryIndex(const Schema &schema, SerialNum serialNum)
 {
     return std::make_shared<MemoryIndexWrapper>(schema, _fileHeaderContext, _tuneFileIndexing,
-                                                _threadingService, serialNum);
+                                                _threadingService, serialNum, _memoryIndexWordShards);
 }
 
 IDiskIndex::SP
@@ -66,7 +80,7 @@ IndexManager::MaintainerOperations::runFusion(const Schema &schema,
     SerialNumFileHeaderContext fileHeaderContext(_fileHeaderContext, serialNum);
     const bool dynamic_k_doc_pos_occ_format = false;
     return Fusion::merge(schema, outputDir, sources, selectorArray, dynamic_k_doc_pos_occ_format,
-                         _tuneFileIndexing, fileHeaderContext);
+                         _tuneFileIndexing, fileHeaderContext, _fusionExecutor, &_fusionProgress);
 }
 
 
@@ -80,7 +94,8 @@ IndexManager::IndexManager(const vespalib::string &baseDir,
                            const search::TuneFileIndexManager &tuneFileIndexManager,
                            const search::TuneFileAttributes &tuneFileAttributes,
                            const FileHeaderContext &fileHeaderContext) :
-    _operations(fileHeaderContext, tuneFileIndexManager, indexConfig.cacheSize, threadingService),
+    _operations(fileHeaderContext, tuneFileIndexManager, indexConfig.cacheSize, indexConfig.fusionThreads,
+                indexConfig.memoryIndexWordShards, threadingService),
     _maintainer(IndexMaintainerConfig(baseDir, indexConfig.warmup, indexConfig.maxFlushed, schema, serialNum, tuneFileAttributes),
                 IndexMaintainerContext(threadingService, reconfigurer, fileHeaderContext, warmupExecutor),
                 _operations)
@@ -6,21 +6,28 @@
 #include <vespa/searchcorespi/index/indexmaintainer.h>
 #include <vespa/searchcorespi/index/ithreadingservice.h>
 #include <vespa/searchcorespi/index/warmupconfig.h>
+#include <vespa/searchlib/diskindex/fusion_progress.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
 
 namespace proton::index {
 
 struct IndexConfig {
     using WarmupConfig = searchcorespi::index::WarmupConfig;
     IndexConfig() : IndexConfig(WarmupConfig(), 2, 0) { }
-    IndexConfig(WarmupConfig warmup_, size_t maxFlushed_, size_t cacheSize_)
+    IndexConfig(WarmupConfig warmup_, size_t maxFlushed_, size_t cacheSize_, uint32_t fusionThreads_ = 1,
+                uint32_t memoryIndexWordShards_ = 1)
         : warmup(warmup_),
           maxFlushed(maxFlushed_),
-          cacheSize(cacheSize_)
+          cacheSize(cacheSize_),
+          fusionThreads(fusionThreads_),
+          memoryIndexWordShards(memoryIndexWordShards_)
     { }
 
     const WarmupConfig warmup;
     const size_t       maxFlushed;
     const size_t       cacheSize;
+    const uint32_t     fusionThreads;
+    const uint32_t     memoryIndexWordShards;
 };
 
 /**
@@ -37,16 +44,22 @@ public:
         using IDiskIndex = searchcorespi::index::IDiskIndex;
         using IMemoryIndex = searchcorespi::index::IMemoryIndex;
         const size_t _cacheSize;
+        const uint32_t _memoryIndexWordShards;
         const search::common::FileHeaderContext &_fileHeaderContext;
         const search::TuneFileIndexing _tuneFileIndexing;
         const search::TuneFileSearch _tuneFileSearch;
         searchcorespi::index::IThreadingService &_threadingService;
+        vespalib::ThreadStackExecutor _fusionExecutor;
+        search::diskindex::FusionProgress _fusionProgress;
 
     public:
         MaintainerOperations(const search::common::FileHeaderContext &fileHeaderContext,
                              const search::TuneFileIndexManager &tuneFileIndexManager,
                              size_t cacheSize,
+                             uint32_t fusionThreads,
+                             uint32_t memoryIndexWordShards,
                              searchcorespi::index::IThreadingService &threadingService);
+        ~MaintainerOperations();
 
         IMemoryIndex::SP createMemoryIndex(const Schema &schema, SerialNum serialNum) override;
         IDiskIndex::SP loadDiskIndex(const vespalib::string &indexDir) override;
@@ -55,6 +68,7 @@ public:
                        const std::vector<vespalib::string> &sources,
                        const SelectorArray &docIdSelector,
                        search::SerialNum lastSerialNum) override;
+        const search::diskindex::FusionProgress &getFusionProgress() const { return _fusionProgress; }
     };
 
 private:
@@ -126,6 +140,10 @@ public:
     void setMaxFlushed(uint32_t maxFlushed) override {
         _maintainer.setMaxFlushed(maxFlushed);
     }
+
+    const search::diskindex::FusionProgress *getFusionProgress() const override {
+        return &_operations.getFusionProgress();
+    }
 };
 
 } // namespace proton
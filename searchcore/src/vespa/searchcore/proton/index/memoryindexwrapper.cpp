@@ -21,9 +21,10 @@ MemoryIndexWrapper::MemoryIndexWrapper(const search::index::Schema &schema,
                                        const TuneFileIndexing &tuneFileIndexing,
                                        searchcorespi::index::IThreadingService &
                                        threadingService,
-                                       search::SerialNum serialNum)
+                                       search::SerialNum serialNum,
+                                       uint32_t numWordShards)
     : _index(schema, threadingService.indexFieldInverter(),
-             threadingService.indexFieldWriter()),
+             threadingService.indexFieldWriter(), numWordShards),
       _serialNum(serialNum),
       _fileHeaderContext(fileHeaderContext),
       _tuneFileIndexing(tuneFileIndexing)
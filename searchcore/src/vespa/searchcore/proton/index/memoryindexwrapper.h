@@ -29,7 +29,8 @@ public:
                        const search::TuneFileIndexing &tuneFileIndexing,
                        searchcorespi::index::IThreadingService &
                        threadingService,
-                       SerialNum serialNum);
+                       SerialNum serialNum,
+                       uint32_t numWordShards = 1);
 
     /**
      * Implements searchcorespi::IndexSearchable
@@ -160,4 +160,81 @@ AdaptiveDocidRangeScheduler::share_range(size_t thread_id, DocidRange todo)
 
 //-----------------------------------------------------------------------------
 
+bool
+WorkStealingDocidRangeScheduler::take_front(size_t thread_id, uint32_t &task)
+{
+    std::atomic<uint64_t> &tasks = _deques[thread_id].tasks;
+    uint64_t old_tasks = tasks.load(std::memory_order::memory_order_relaxed);
+    while (front(old_tasks) < back(old_tasks)) {
+        uint64_t new_tasks = pack(front(old_tasks) + 1, back(old_tasks));
+        if (tasks.compare_exchange_weak(old_tasks, new_tasks, std::memory_order::memory_order_relaxed)) {
+            task = front(old_tasks);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+WorkStealingDocidRangeScheduler::steal_back(size_t thread_id, uint32_t &task)
+{
+    for (size_t i = 1; i < _deques.size(); ++i) {
+        std::atomic<uint64_t> &victim = _deques[(thread_id + i) % _deques.size()].tasks;
+        uint64_t old_tasks = victim.load(std::memory_order::memory_order_relaxed);
+        while (front(old_tasks) < back(old_tasks)) {
+            uint32_t mid = front(old_tasks) + ((back(old_tasks) - front(old_tasks)) / 2);
+            if (victim.compare_exchange_weak(old_tasks, pack(front(old_tasks), mid), std::memory_order::memory_order_relaxed)) {
+                // work on the first stolen task directly and make the rest available for others
+                _deques[thread_id].tasks.store(pack(mid + 1, back(old_tasks)), std::memory_order::memory_order_relaxed);
+                task = mid;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+DocidRange
+WorkStealingDocidRangeScheduler::next_task(size_t thread_id)
+{
+    uint32_t task;
+    while (take_front(thread_id, task) || steal_back(thread_id, task)) {
+        DocidRange work = _splitter.get(task);
+        if (!work.empty()) {
+            _assigned[thread_id] += work.size();
+            return work;
+        }
+    }
+    return DocidRange();
+}
+
+WorkStealingDocidRangeScheduler::WorkStealingDocidRangeScheduler(size_t num_threads, size_t num_tasks, uint32_t docid_limit)
+    : _splitter(DocidRange(1, docid_limit), std::max(num_tasks, num_threads)),
+      _deques(num_threads),
+      _assigned(num_threads, 0)
+{
+    DocidRangeSplitter task_splitter(DocidRange(0, std::max(num_tasks, num_threads)), num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        DocidRange my_tasks = task_splitter.get(i);
+        _deques[i].tasks.store(pack(my_tasks.begin, my_tasks.end), std::memory_order::memory_order_relaxed);
+    }
+}
+
+WorkStealingDocidRangeScheduler::~WorkStealingDocidRangeScheduler() = default;
+
+size_t
+WorkStealingDocidRangeScheduler::unassigned_size() const
+{
+    size_t sum = 0;
+    for (const Deque &deque: _deques) {
+        uint64_t tasks = deque.tasks.load(std::memory_order::memory_order_relaxed);
+        if (front(tasks) < back(tasks)) {
+            sum += span(front(tasks), back(tasks)).size();
+        }
+    }
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+
 }
@@ -204,4 +204,46 @@ public:
     DocidRange share_range(size_t, DocidRange todo) override;
 };
 
+/**
+ * A scheduler dividing the total docid space into tasks of equal
+ * size. Each thread starts out owning an equal number of consecutive
+ * tasks, kept in a per-thread deque. A thread takes tasks from the
+ * front of its own deque, and when it runs out of work it steals the
+ * back half of the deque of another thread. Each deque is a pair of
+ * task indexes packed into a single atomic word, making both taking
+ * and stealing tasks lock-free.
+ **/
+class WorkStealingDocidRangeScheduler : public DocidRangeScheduler
+{
+private:
+    struct alignas(64) Deque {
+        std::atomic<uint64_t> tasks;
+        Deque() : tasks(0) {}
+    };
+    static uint64_t pack(uint32_t front, uint32_t back) { return ((uint64_t(front) << 32) | back); }
+    static uint32_t front(uint64_t tasks) { return (tasks >> 32); }
+    static uint32_t back(uint64_t tasks) { return (tasks & 0xffffffff); }
+
+    DocidRangeSplitter  _splitter;
+    std::vector<Deque>  _deques;
+    std::vector<size_t> _assigned;
+
+    DocidRange span(uint32_t first_task, uint32_t end_task) const {
+        return DocidRange(_splitter.get(first_task).begin, _splitter.get(end_task - 1).end);
+    }
+    VESPA_DLL_LOCAL bool take_front(size_t thread_id, uint32_t &task);
+    VESPA_DLL_LOCAL bool steal_back(size_t thread_id, uint32_t &task);
+    VESPA_DLL_LOCAL DocidRange next_task(size_t thread_id);
+public:
+    WorkStealingDocidRangeScheduler(size_t num_threads, size_t num_tasks, uint32_t docid_limit);
+    ~WorkStealingDocidRangeScheduler();
+    DocidRange first_range(size_t thread_id) override { return next_task(thread_id); }
+    DocidRange next_range(size_t thread_id) override { return next_task(thread_id); }
+    DocidRange total_span(size_t) const override { return _splitter.full_range(); }
+    size_t total_size(size_t thread_id) const override { return _assigned[thread_id]; }
+    size_t unassigned_size() const override;
+    IdleObserver make_idle_observer() const override { return IdleObserver(); }
+    DocidRange share_range(size_t, DocidRange todo) override { return todo; }
+};
+
 }
@@ -28,7 +28,7 @@ struct IMatchLoopCommunicator {
         }
     };
     virtual double estimate_match_frequency(const Matches &matches) = 0;
-    virtual Hits selectBest(SortedHitSequence sortedHits) = 0;
+    virtual Hits selectBest(size_t thread_id, SortedHitSequence sortedHits) = 0;
     virtual RangePair rangeCover(const RangePair &ranges) = 0;
     virtual ~IMatchLoopCommunicator() {}
 };
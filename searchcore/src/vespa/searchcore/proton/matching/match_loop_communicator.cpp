@@ -2,6 +2,8 @@
 
 #include "match_loop_communicator.h"
 #include <vespa/vespalib/util/priority_queue.h>
+#include <algorithm>
+#include <cassert>
 
 namespace proton:: matching {
 
@@ -12,8 +14,18 @@ MatchLoopCommunicator::MatchLoopCommunicator(size_t threads, size_t topN, std::u
     : _best_dropped(),
       _estimate_match_frequency(threads),
       _selectBest(threads, topN, _best_dropped, std::move(diversifier)),
+      _topN(topN),
+      _top_scores(threads),
+      _merge_nodes(),
+      _kept_hits(threads, 0),
+      _kept_hits_ready(threads),
       _rangeCover(threads, _best_dropped)
-{}
+{
+    _merge_nodes.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        _merge_nodes.push_back(std::make_unique<MergeTopScores>(topN, _top_scores));
+    }
+}
 MatchLoopCommunicator::~MatchLoopCommunicator() = default;
 
 void
@@ -83,6 +95,64 @@ MatchLoopCommunicator::SelectBest::mingle()
     }
 }
 
+void
+MatchLoopCommunicator::MergeTopScores::mingle()
+{
+    TopScores &dst = top_scores[std::min(in(0), in(1))];
+    TopScores &src = top_scores[std::max(in(0), in(1))];
+    TopScores merged;
+    merged.reserve(std::min(topN, dst.size() + src.size()));
+    std::merge(dst.begin(), dst.end(), src.begin(), src.end(), std::back_inserter(merged));
+    if (merged.size() > topN) {
+        merged.erase(merged.begin() + topN, merged.end());
+    }
+    dst.swap(merged);
+    src.clear();
+}
+
+// Each thread contributes its own topN best scores. These lists are
+// merged pairwise in a binary tree where thread 'i' merges with
+// thread 'i + step' for increasing powers of two, letting early
+// threads start merging while stragglers are still matching. Thread
+// 0 ends up with the global topN and publishes how many hits each
+// thread gets to keep. Since each thread keeps a prefix of its own
+// sorted hits, only scores and owners need to be exchanged.
+MatchLoopCommunicator::Hits
+MatchLoopCommunicator::tree_select_best(size_t thread_id, SortedHitSequence sortedHits)
+{
+    const size_t num_threads = _top_scores.size();
+    assert(thread_id < num_threads);
+    SortedHitSequence seq = sortedHits;
+    TopScores &mine = _top_scores[thread_id];
+    mine.clear();
+    for (; mine.size() < _topN && seq.valid(); seq.next()) {
+        mine.emplace_back(seq.get().second, thread_id);
+    }
+    for (size_t step = 1; step < num_threads; step *= 2) {
+        if ((thread_id % (2 * step)) != 0) {
+            _merge_nodes[thread_id]->rendezvous(thread_id);
+            break;
+        }
+        if ((thread_id + step) < num_threads) {
+            _merge_nodes[thread_id + step]->rendezvous(thread_id);
+        }
+    }
+    if (thread_id == 0) {
+        std::fill(_kept_hits.begin(), _kept_hits.end(), 0);
+        for (const TopScore &top: mine) {
+            ++_kept_hits[top.thread_id];
+        }
+        _best_dropped.valid = false;
+    }
+    _kept_hits_ready.rendezvous(true);
+    Hits result;
+    result.reserve(_kept_hits[thread_id]);
+    for (; result.size() < _kept_hits[thread_id]; sortedHits.next()) {
+        result.push_back(sortedHits.get());
+    }
+    return result;
+}
+
 void
 MatchLoopCommunicator::RangeCover::mingle()
 {
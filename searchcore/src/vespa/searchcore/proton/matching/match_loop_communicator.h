@@ -40,6 +40,32 @@ private:
             return (sb.cmp(a, b));
         }
     };
+    struct TopScore {
+        search::feature_t score;
+        uint32_t thread_id;
+        TopScore(search::feature_t score_in, uint32_t thread_id_in)
+            : score(score_in), thread_id(thread_id_in) {}
+        bool operator<(const TopScore &rhs) const {
+            return (score > rhs.score) || ((score == rhs.score) && (thread_id < rhs.thread_id));
+        }
+    };
+    using TopScores = std::vector<TopScore>;
+    /**
+     * Merges the top scores of two threads into the list owned by the
+     * thread with the lowest id. Used as a node in the tree reduction
+     * performed by selectBest when there is no diversity filter.
+     **/
+    struct MergeTopScores : vespalib::Rendezvous<size_t, bool> {
+        size_t topN;
+        std::vector<TopScores> &top_scores;
+        MergeTopScores(size_t topN_in, std::vector<TopScores> &top_scores_in)
+            : vespalib::Rendezvous<size_t, bool>(2), topN(topN_in), top_scores(top_scores_in) {}
+        void mingle() override;
+    };
+    struct Barrier : vespalib::Rendezvous<bool, bool> {
+        Barrier(size_t n) : vespalib::Rendezvous<bool, bool>(n) {}
+        void mingle() override {}
+    };
     struct RangeCover : vespalib::Rendezvous<RangePair, RangePair> {
         BestDropped &best_dropped;
         RangeCover(size_t n, BestDropped &best_dropped_in)
@@ -50,8 +76,15 @@ private:
     BestDropped                   _best_dropped;
     EstimateMatchFrequency        _estimate_match_frequency;
     SelectBest                    _selectBest;
+    size_t                        _topN;
+    std::vector<TopScores>        _top_scores;
+    std::vector<std::unique_ptr<MergeTopScores>> _merge_nodes;
+    std::vector<size_t>           _kept_hits;
+    Barrier                       _kept_hits_ready;
     RangeCover                    _rangeCover;
 
+    Hits tree_select_best(size_t thread_id, SortedHitSequence sortedHits);
+
 public:
     MatchLoopCommunicator(size_t threads, size_t topN);
     MatchLoopCommunicator(size_t threads, size_t topN, std::unique_ptr<IDiversifier>);
@@ -60,8 +93,11 @@ public:
     double estimate_match_frequency(const Matches &matches) override {
         return _estimate_match_frequency.rendezvous(matches);
     }
-    Hits selectBest(SortedHitSequence sortedHits) override {
-        return _selectBest.rendezvous(sortedHits);
+    Hits selectBest(size_t thread_id, SortedHitSequence sortedHits) override {
+        if (_selectBest._diversifier) {
+            return _selectBest.rendezvous(sortedHits);
+        }
+        return tree_select_best(thread_id, sortedHits);
     }
     RangePair rangeCover(const RangePair &ranges) override {
         return _rangeCover.rendezvous(ranges);
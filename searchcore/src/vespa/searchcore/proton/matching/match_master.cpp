@@ -26,13 +26,16 @@ namespace {
 
 struct TimedMatchLoopCommunicator : IMatchLoopCommunicator {
     IMatchLoopCommunicator &communicator;
+    fastos::StopWatch select_best_time;
     fastos::StopWatch rerank_time;
     TimedMatchLoopCommunicator(IMatchLoopCommunicator &com) : communicator(com) {}
     double estimate_match_frequency(const Matches &matches) override {
         return communicator.estimate_match_frequency(matches);
     }
-    Hits selectBest(SortedHitSequence sortedHits) override {
-        auto result = communicator.selectBest(sortedHits);
+    Hits selectBest(size_t thread_id, SortedHitSequence sortedHits) override {
+        select_best_time.start();
+        auto result = communicator.selectBest(thread_id, sortedHits);
+        select_best_time.stop();
         rerank_time.start();
         return result;
     }
@@ -44,8 +47,13 @@ struct TimedMatchLoopCommunicator : IMatchLoopCommunicator {
 };
 
 DocidRangeScheduler::UP
-createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, uint32_t numDocs)
+createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, bool workStealing, uint32_t numDocs)
 {
+    if (workStealing) {
+        // make sure there is enough tasks to steal from each thread
+        uint32_t numTasks = std::max(numSearchPartitions, numThreads * 16);
+        return std::make_unique<WorkStealingDocidRangeScheduler>(numThreads, numTasks, numDocs);
+    }
     if (numSearchPartitions == 0) {
         return std::make_unique<AdaptiveDocidRangeScheduler>(numThreads, 1, numDocs);
     }
@@ -64,14 +72,15 @@ MatchMaster::match(search::engine::Trace & trace,
                    const MatchToolsFactory &mtf,
                    ResultProcessor &resultProcessor,
                    uint32_t distributionKey,
-                   uint32_t numSearchPartitions)
+                   uint32_t numSearchPartitions,
+                   bool workStealing)
 {
     fastos::StopWatch query_latency_time;
     query_latency_time.start();
     vespalib::DualMergeDirector mergeDirector(threadBundle.size());
     MatchLoopCommunicator communicator(threadBundle.size(), params.heapSize, mtf.createDiversifier(params.heapSize));
     TimedMatchLoopCommunicator timedCommunicator(communicator);
-    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions, params.numDocs);
+    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions, workStealing, params.numDocs);
 
     std::vector<MatchThread::UP> threadState;
     std::vector<vespalib::Runnable*> targets;
@@ -89,6 +98,7 @@ MatchMaster::match(search::engine::Trace & trace,
     ResultProcessor::Result::UP reply = resultProcessor.makeReply(threadState[0]->extract_result());
     query_latency_time.stop();
     double query_time_s = query_latency_time.elapsed().sec();
+    double select_best_time_s = timedCommunicator.select_best_time.elapsed().sec();
     double rerank_time_s = timedCommunicator.rerank_time.elapsed().sec();
     double match_time_s = 0.0;
     std::unique_ptr<vespalib::slime::Inserter> inserter;
@@ -104,7 +114,8 @@ MatchMaster::match(search::engine::Trace & trace,
         }
     }
     _stats.queryLatency(query_time_s);
-    _stats.matchTime(match_time_s - rerank_time_s);
+    _stats.matchTime(match_time_s - rerank_time_s - select_best_time_s);
+    _stats.selectBestTime(select_best_time_s);
     _stats.rerankTime(rerank_time_s);
     _stats.groupingTime(query_time_s - match_time_s);
     _stats.queries(1);
@@ -20,14 +20,16 @@ MatchParams::MatchParams(uint32_t          numDocs_in,
                          uint32_t          offset_in,
                          uint32_t          hits_in,
                          bool              hasFinalRank,
-                         bool              needRanking)
+                         bool              needRanking,
+                         bool              firstHitsOnly)
     : numDocs(numDocs_in),
-      heapSize((hasFinalRank && needRanking) ? heapSize_in : 0),
-      arraySize((needRanking && ((heapSize_in + arraySize_in) > 0))
+      heapSize((hasFinalRank && needRanking && !firstHitsOnly) ? heapSize_in : 0),
+      arraySize((needRanking && !firstHitsOnly && ((heapSize_in + arraySize_in) > 0))
                 ? computeArraySize(hits_in + offset_in, heapSize, arraySize_in)
                 : 0),
       offset(offset_in),
       hits(hits_in),
+      firstHits(firstHitsOnly ? (offset_in + hits_in) : 0),
       rankDropLimit(rankDropLimit_in)
 { }
 
@@ -16,6 +16,7 @@ struct MatchParams {
     const uint32_t          arraySize;
     const uint32_t          offset;
     const uint32_t          hits;
+    const uint32_t          firstHits; // stop matching after this many hits, 0 means no limit
     const search::feature_t rankDropLimit;
 
     MatchParams(uint32_t          numDocs_in,
@@ -25,7 +26,8 @@ struct MatchParams {
                 uint32_t          offset_in,
                 uint32_t          hits_in,
                 bool              hasFinalRank,
-                bool              needRanking=true);
+                bool              needRanking=true,
+                bool              firstHitsOnly=false);
     bool save_rank_scores() const { return ((heapSize + arraySize) != 0); }
 };
 
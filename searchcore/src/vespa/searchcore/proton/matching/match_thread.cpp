@@ -16,6 +16,7 @@
 #include <vespa/vespalib/util/thread_bundle.h>
 #include <vespa/vespalib/data/slime/cursor.h>
 #include <vespa/vespalib/data/slime/inserter.h>
+#include <limits>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".proton.matching.match_thread");
@@ -76,10 +77,11 @@ LazyValue get_score_feature(const RankProgram &rankProgram) {
 
 //-----------------------------------------------------------------------------
 
-MatchThread::Context::Context(double rankDropLimit, MatchTools &tools, HitCollector &hits,
+MatchThread::Context::Context(double rankDropLimit, uint32_t firstHits, MatchTools &tools, HitCollector &hits,
                               uint32_t num_threads)
     : matches(0),
       _matches_limit(tools.match_limiter().sample_hits_per_thread(num_threads)),
+      _first_hits((firstHits != 0) ? firstHits : std::numeric_limits<uint32_t>::max()),
       _score_feature(get_score_feature(tools.rank_program())),
       _ranking(tools.rank_program()),
       _rankDropLimit(rankDropLimit),
@@ -167,6 +169,9 @@ MatchThread::inner_match_loop(Context &context, MatchTools &tools, DocidRange &d
             context.addHit(docId);
         }
         context.matches++;
+        if (!do_rank && context.hasFirstHits()) {
+            return docId + 1;
+        }
         if (do_limit && context.isAtLimit()) {
             search = maybe_limit(tools, context.matches, docId, docid_range.end);
             docId = search->seekFirst(docId + 1);
@@ -185,16 +190,18 @@ void
 MatchThread::match_loop(MatchTools &tools, HitCollector &hits)
 {
     bool softDoomed = false;
+    bool hasFirstHits = false;
     uint32_t docsCovered = 0;
     fastos::TimeStamp overtime(0);
-    Context context(matchParams.rankDropLimit, tools, hits, num_threads);
+    Context context(matchParams.rankDropLimit, matchParams.firstHits, tools, hits, num_threads);
     for (DocidRange docid_range = scheduler.first_range(thread_id);
          !docid_range.empty();
          docid_range = scheduler.next_range(thread_id))
     {
-        if (!softDoomed) {
+        if (!softDoomed && !hasFirstHits) {
             uint32_t lastCovered = inner_match_loop<Strategy, do_rank, do_limit, do_share_work>(context, tools, docid_range);
-            softDoomed = (lastCovered < docid_range.end);
+            hasFirstHits = (!do_rank && context.hasFirstHits());
+            softDoomed = (!hasFirstHits && (lastCovered < docid_range.end));
             if (softDoomed) {
                 overtime = - context.timeLeft();
             }
@@ -282,7 +289,11 @@ MatchThread::findMatches(MatchTools &tools)
     }
     HitCollector hits(matchParams.numDocs, matchParams.arraySize);
     trace->addEvent(4, "Start match and first phase rank");
+    fastos::StopWatch phase_time;
+    phase_time.start();
     match_loop_helper(tools, hits);
+    phase_time.stop();
+    thread_stats.first_phase_time(phase_time.elapsed().sec());
     if (tools.has_second_phase_rank()) {
         { // 2nd phase ranking
             trace->addEvent(4, "Start second phase rerank");
@@ -294,13 +305,19 @@ MatchThread::findMatches(MatchTools &tools)
                                   : hits.getSortedHitSequence(matchParams.heapSize);
             trace->addEvent(5, "Synchronize before second phase rerank");
             WaitTimer select_best_timer(wait_time_s);
-            auto kept_hits = communicator.selectBest(sorted_hit_seq);
+            phase_time.start();
+            auto kept_hits = communicator.selectBest(thread_id, sorted_hit_seq);
+            phase_time.stop();
             select_best_timer.done();
+            thread_stats.select_best_time(phase_time.elapsed().sec());
             DocumentScorer scorer(tools.rank_program(), tools.search());
             if (tools.getHardDoom().doom()) {
                 kept_hits.clear();
             }
+            phase_time.start();
             uint32_t reRanked = hits.reRank(scorer, std::move(kept_hits));
+            phase_time.stop();
+            thread_stats.second_phase_time(phase_time.elapsed().sec());
             if (auto onReRankTask = matchToolsFactory.createOnReRankTask()) {
                 onReRankTask->run(hits.getReRankedHits());
             }
@@ -59,17 +59,19 @@ private:
 
     class Context {
     public:
-        Context(double rankDropLimit, MatchTools &tools, HitCollector &hits,
+        Context(double rankDropLimit, uint32_t firstHits, MatchTools &tools, HitCollector &hits,
                 uint32_t num_threads) __attribute__((noinline));
         void rankHit(uint32_t docId);
         void addHit(uint32_t docId) { _hits.addHit(docId, search::zero_rank_value); }
         bool isBelowLimit() const { return matches < _matches_limit; }
         bool    isAtLimit() const { return matches == _matches_limit; }
+        bool hasFirstHits() const { return matches >= _first_hits; }
         bool   atSoftDoom() const { return _softDoom.doom(); }
         fastos::TimeStamp timeLeft() const { return _softDoom.left(); }
         uint32_t                 matches;
     private:
         uint32_t                 _matches_limit;
+        uint32_t                 _first_hits;
         LazyValue                _score_feature;
         RankProgram             &_ranking;
         double                   _rankDropLimit;
@@ -153,14 +153,14 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
                   IAttributeContext          & attributeContext,
                   vespalib::stringref          queryStack,
                   const vespalib::string     & location,
-                  const ViewResolver         & viewResolver,
+                  const ResolvedViews        & resolvedViews,
                   const IDocumentMetaStore   & metaStore,
                   const IIndexEnvironment    & indexEnv,
                   const RankSetup            & rankSetup,
                   const Properties           & rankProperties,
                   const Properties           & featureOverrides)
     : _queryLimiter(queryLimiter),
-      _requestContext(softDoom, attributeContext),
+      _requestContext(softDoom, attributeContext, rankProperties),
       _hardDoom(hardDoom),
       _query(),
       _match_limiter(),
@@ -169,7 +169,7 @@ MatchToolsFactory(QueryLimiter               & queryLimiter,
       _rankSetup(rankSetup),
       _featureOverrides(featureOverrides),
       _diversityParams(),
-      _valid(_query.buildTree(queryStack, location, viewResolver, indexEnv))
+      _valid(_query.buildTree(queryStack, location, resolvedViews))
 {
     if (_valid) {
         _query.extractTerms(_queryEnv.terms());
@@ -5,6 +5,7 @@
 #include "queryenvironment.h"
 #include "isearchcontext.h"
 #include "query.h"
+#include "resolved_views.h"
 #include "viewresolver.h"
 #include "querylimiter.h"
 #include "match_phase_limiter.h"
@@ -113,7 +114,7 @@ public:
                       search::attribute::IAttributeContext &attributeContext,
                       vespalib::stringref queryStack,
                       const vespalib::string &location,
-                      const ViewResolver &viewResolver,
+                      const ResolvedViews &resolvedViews,
                       const search::IDocumentMetaStore &metaStore,
                       const search::fef::IIndexEnvironment &indexEnv,
                       const search::fef::RankSetup &rankSetup,
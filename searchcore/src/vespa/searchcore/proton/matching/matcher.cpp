@@ -88,6 +88,10 @@ private:
     const uint32_t          _maxThreads;
 };
 
+bool canUseFirstHits(const SearchRequest & request, const GroupingContext & groupingContext) {
+    return (request.sortSpec.empty() && groupingContext.empty());
+}
+
 bool willNotNeedRanking(const SearchRequest & request, const GroupingContext & groupingContext) {
     return (!groupingContext.needRanking() && (request.maxhits == 0))
            || (!request.sortSpec.empty() && (request.sortSpec.find("[rank]") == vespalib::string::npos));
@@ -133,6 +137,7 @@ Matcher::Matcher(const search::index::Schema &schema, const Properties &props, c
       _blueprintFactory(),
       _rankSetup(),
       _viewResolver(ViewResolver::createFromSchema(schema)),
+      _resolvedViews(_viewResolver, _indexEnv),
       _statsLock(),
       _stats(),
       _clock(clock),
@@ -179,7 +184,7 @@ Matcher::create_match_tools_factory(const search::engine::Request &request, ISea
     }
     return std::make_unique<MatchToolsFactory>(_queryLimiter, vespalib::Doom(_clock, safeDoom),
                                                vespalib::Doom(_clock, request.getTimeOfDoom()), searchContext,
-                                               attrContext, request.getStackRef(), request.location, _viewResolver,
+                                               attrContext, request.getStackRef(), request.location, _resolvedViews,
                                                metaStore, _indexEnv, *_rankSetup, rankProperties, feature_overrides);
 }
 
@@ -261,9 +266,12 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         const Properties & rankProperties = request.propertiesMap.rankProperties();
         uint32_t heapSize = HeapSize::lookup(rankProperties, _rankSetup->getHeapSize());
 
+        bool firstHitsOnly = FirstHitsOnly::lookup(rankProperties, _rankSetup->getFirstHitsOnly()) &&
+                             canUseFirstHits(request, groupingContext);
         MatchParams params(searchContext.getDocIdLimit(), heapSize, _rankSetup->getArraySize(),
                            _rankSetup->getRankScoreDropLimit(), request.offset, request.maxhits,
-                           !_rankSetup->getSecondPhaseRank().empty(), !willNotNeedRanking(request, groupingContext));
+                           !_rankSetup->getSecondPhaseRank().empty(), !willNotNeedRanking(request, groupingContext),
+                           firstHitsOnly);
 
         ResultProcessor rp(attrContext, metaStore, sessionMgr, groupingContext, sessionId,
                            request.sortSpec, params.offset, params.hits, request.should_drop_sort_data());
@@ -272,12 +280,16 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         LimitedThreadBundleWrapper limitedThreadBundle(threadBundle, numThreadsPerSearch);
         MatchMaster master;
         uint32_t numParts = NumSearchPartitions::lookup(rankProperties, _rankSetup->getNumSearchPartitions());
+        bool workStealing = WorkStealing::lookup(rankProperties, _rankSetup->getWorkStealing());
         ResultProcessor::Result::UP result = master.match(request.trace(), params, limitedThreadBundle, *mtf, rp,
-                                                          _distributionKey, numParts);
+                                                          _distributionKey, numParts, workStealing);
         my_stats = MatchMaster::getStats(std::move(master));
 
-        bool wasLimited = mtf->match_limiter().was_limited();
-        size_t spaceEstimate = (my_stats.softDoomed())
+        // matching stopped before the whole docid space was searched
+        bool stoppedAtFirstHits = (params.firstHits != 0) && !my_stats.softDoomed() &&
+                                  ((my_stats.docidSpaceCovered() + 1) < params.numDocs);
+        bool wasLimited = mtf->match_limiter().was_limited() || stoppedAtFirstHits;
+        size_t spaceEstimate = (my_stats.softDoomed() || stoppedAtFirstHits)
                                ? my_stats.docidSpaceCovered()
                                : mtf->match_limiter().getDocIdSpaceEstimate();
         uint32_t estHits = mtf->estimate().estHits;
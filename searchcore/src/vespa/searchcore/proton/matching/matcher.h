@@ -5,6 +5,7 @@
 #include "i_constant_value_repo.h"
 #include "indexenvironment.h"
 #include "matching_stats.h"
+#include "resolved_views.h"
 #include "search_session.h"
 #include "viewresolver.h"
 #include <vespa/searchcore/proton/matching/querylimiter.h>
@@ -52,6 +53,7 @@ private:
     search::fef::BlueprintFactory _blueprintFactory;
     search::fef::RankSetup::SP    _rankSetup;
     ViewResolver                  _viewResolver;
+    ResolvedViews                 _resolvedViews;
     std::mutex                    _statsLock;
     MatchingStats                 _stats;
     const vespalib::Clock        &_clock;
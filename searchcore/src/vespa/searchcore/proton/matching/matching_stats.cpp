@@ -33,6 +33,7 @@ MatchingStats::MatchingStats()
       _queryLatency(),
       _matchTime(),
       _groupingTime(),
+      _selectBestTime(),
       _rerankTime(),
       _partitions()
 { }
@@ -74,6 +75,7 @@ MatchingStats::add(const MatchingStats &rhs)
     _queryLatency.add(rhs._queryLatency);
     _matchTime.add(rhs._matchTime);
     _groupingTime.add(rhs._groupingTime);
+    _selectBestTime.add(rhs._selectBestTime);
     _rerankTime.add(rhs._rerankTime);
     for (size_t id = 0; id < rhs.getNumPartitions(); ++id) {
         get_writable_partition(_partitions, id).add(rhs.getPartition(id));
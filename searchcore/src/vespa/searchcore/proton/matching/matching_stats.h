@@ -65,6 +65,9 @@ public:
         Avg    _doomOvertime;
         Avg    _active_time;
         Avg    _wait_time;
+        Avg    _first_phase_time;
+        Avg    _select_best_time;
+        Avg    _second_phase_time;
         friend MatchingStats;
     public:
         Partition()
@@ -75,7 +78,10 @@ public:
               _softDoomed(0),
               _doomOvertime(),
               _active_time(),
-              _wait_time() { }
+              _wait_time(),
+              _first_phase_time(),
+              _select_best_time(),
+              _second_phase_time() { }
 
         Partition &docsCovered(size_t value) { _docsCovered = value; return *this; }
         size_t docsCovered() const { return _docsCovered; }
@@ -100,6 +106,21 @@ public:
         size_t wait_time_count() const { return _wait_time.count(); }
         double wait_time_min() const { return _wait_time.min(); }
         double wait_time_max() const { return _wait_time.max(); }
+        Partition &first_phase_time(double time_s) { _first_phase_time.set(time_s); return *this; }
+        double first_phase_time_avg() const { return _first_phase_time.avg(); }
+        size_t first_phase_time_count() const { return _first_phase_time.count(); }
+        double first_phase_time_min() const { return _first_phase_time.min(); }
+        double first_phase_time_max() const { return _first_phase_time.max(); }
+        Partition &select_best_time(double time_s) { _select_best_time.set(time_s); return *this; }
+        double select_best_time_avg() const { return _select_best_time.avg(); }
+        size_t select_best_time_count() const { return _select_best_time.count(); }
+        double select_best_time_min() const { return _select_best_time.min(); }
+        double select_best_time_max() const { return _select_best_time.max(); }
+        Partition &second_phase_time(double time_s) { _second_phase_time.set(time_s); return *this; }
+        double second_phase_time_avg() const { return _second_phase_time.avg(); }
+        size_t second_phase_time_count() const { return _second_phase_time.count(); }
+        double second_phase_time_min() const { return _second_phase_time.min(); }
+        double second_phase_time_max() const { return _second_phase_time.max(); }
 
         Partition &add(const Partition &rhs) {
             _docsCovered += rhs.docsCovered();
@@ -111,6 +132,9 @@ public:
 
             _active_time.add(rhs._active_time);
             _wait_time.add(rhs._wait_time);
+            _first_phase_time.add(rhs._first_phase_time);
+            _select_best_time.add(rhs._select_best_time);
+            _second_phase_time.add(rhs._second_phase_time);
             return *this;
         }
     };
@@ -129,6 +153,7 @@ private:
     Avg                    _queryLatency;
     Avg                    _matchTime;
     Avg                    _groupingTime;
+    Avg                    _selectBestTime;
     Avg                    _rerankTime;
     std::vector<Partition> _partitions;
 
@@ -191,6 +216,12 @@ public:
     double groupingTimeMin() const { return _groupingTime.min(); }
     double groupingTimeMax() const { return _groupingTime.max(); }
 
+    MatchingStats &selectBestTime(double time_s) { _selectBestTime.set(time_s); return *this; }
+    double selectBestTimeAvg() const { return _selectBestTime.avg(); }
+    size_t selectBestTimeCount() const { return _selectBestTime.count(); }
+    double selectBestTimeMin() const { return _selectBestTime.min(); }
+    double selectBestTimeMax() const { return _selectBestTime.max(); }
+
     MatchingStats &rerankTime(double time_s) { _rerankTime.set(time_s); return *this; }
     double rerankTimeAvg() const { return _rerankTime.avg(); }
     size_t rerankTimeCount() const { return _rerankTime.count(); }
@@ -119,6 +119,20 @@ Query::~Query() = default;
 bool
 Query::buildTree(vespalib::stringref stack, const string &location,
                  const ViewResolver &resolver, const IIndexEnvironment &indexEnv)
+{
+    ResolveViewVisitor resolve_visitor(resolver, indexEnv);
+    return buildTree(stack, location, resolve_visitor);
+}
+
+bool
+Query::buildTree(vespalib::stringref stack, const string &location, const ResolvedViews &views)
+{
+    ResolveViewVisitor resolve_visitor(views);
+    return buildTree(stack, location, resolve_visitor);
+}
+
+bool
+Query::buildTree(vespalib::stringref stack, const string &location, ResolveViewVisitor &resolve_visitor)
 {
     SimpleQueryStackDumpIterator stack_dump_iterator(stack);
     _query_tree = QueryTreeCreator<ProtonNodeTypes>::create(stack_dump_iterator);
@@ -126,7 +140,6 @@ Query::buildTree(vespalib::stringref stack, const string &location,
         SameElementModifier prefixSameElementSubIndexes;
         _query_tree->accept(prefixSameElementSubIndexes);
         addLocationNode(location, _query_tree, _location);
-        ResolveViewVisitor resolve_visitor(resolver, indexEnv);
         _query_tree->accept(resolve_visitor);
         return true;
     } else {
@@ -12,6 +12,8 @@
 
 namespace proton::matching {
 
+class ResolveViewVisitor;
+class ResolvedViews;
 class ViewResolver;
 class ISearchContext;
 
@@ -24,6 +26,10 @@ private:
     search::fef::Location   _location;
     Blueprint::UP           _whiteListBlueprint;
 
+    bool buildTree(vespalib::stringref stack,
+                   const vespalib::string &location,
+                   ResolveViewVisitor &resolve_visitor);
+
 public:
     Query();
     ~Query();
@@ -37,6 +43,16 @@ public:
                    const ViewResolver &resolver,
                    const search::fef::IIndexEnvironment &idxEnv);
 
+    /**
+     * Build query tree from a stack dump, using views that have
+     * already been resolved into fields.
+     *
+     * @return success(true)/failure(false)
+     **/
+    bool buildTree(vespalib::stringref stack,
+                   const vespalib::string &location,
+                   const ResolvedViews &views);
+
     /**
      * Extract query terms from the query tree; to be used to build
      * the query environment.
@@ -4,6 +4,7 @@
 #include "termdatafromnode.h"
 #include "viewresolver.h"
 #include "handlerecorder.h"
+#include "resolved_views.h"
 #include <vespa/searchlib/query/tree/templatetermvisitor.h>
 #include <vespa/searchlib/queryeval/orsearch.h>
 
@@ -64,6 +65,19 @@ ProtonTermData::resolve(const ViewResolver &resolver,
     }
 }
 
+void
+ProtonTermData::resolve(const ResolvedViews &views, const string &view, bool forceFilter)
+{
+    const ResolvedViews::FieldList &fields = views.lookup(view);
+    _fields.clear();
+    _fields.reserve(fields.size());
+    for (const auto &field : fields) {
+        _fields.push_back(FieldEntry(field.name, field.field_id));
+        _fields.back().attribute_field = field.attribute_field;
+        _fields.back().filter_field = forceFilter ? true : field.filter_field;
+    }
+}
+
 void
 ProtonTermData::resolveFromChildren(const std::vector<Node *> &subterms)
 {
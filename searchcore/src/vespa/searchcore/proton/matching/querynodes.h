@@ -18,6 +18,7 @@
 
 namespace proton::matching {
 
+class ResolvedViews;
 class ViewResolver;
 
 class ProtonTermData : public search::fef::ITermData
@@ -53,6 +54,7 @@ protected:
                  const search::fef::IIndexEnvironment &idxEnv,
                  const vespalib::string &view,
                  bool forceFilter);
+    void resolve(const ResolvedViews &views, const vespalib::string &view, bool forceFilter);
 
 public:
     ProtonTermData();
@@ -90,6 +92,12 @@ struct ProtonTermBase : public Base,
         ProtonTermData::resolve(resolver, idxEnv, Base::getView(), forceFilter);
     }
 
+    void resolve(const ResolvedViews &views)
+    {
+        bool forceFilter = !Base::usePositionData();
+        ProtonTermData::resolve(views, Base::getView(), forceFilter);
+    }
+
     // ITermData interface
     uint32_t getPhraseLength() const override final { return numTerms<Base>(*this); }
     uint32_t getTermIndex() const override final { return -1; }
@@ -136,6 +144,7 @@ typedef ProtonTerm<search::query::DotProduct>      ProtonDotProduct;
 typedef ProtonTerm<search::query::WandTerm>        ProtonWandTerm;
 typedef ProtonTerm<search::query::PredicateQuery>  ProtonPredicateQuery;
 typedef ProtonTerm<search::query::RegExpTerm>      ProtonRegExpTerm;
+typedef ProtonTerm<search::query::NearestNeighborTerm> ProtonNearestNeighborTerm;
 
 struct ProtonNodeTypes {
     typedef ProtonAnd             And;
@@ -160,6 +169,7 @@ struct ProtonNodeTypes {
     typedef ProtonWandTerm        WandTerm;
     typedef ProtonPredicateQuery  PredicateQuery;
     typedef ProtonRegExpTerm      RegExpTerm;
+    typedef ProtonNearestNeighborTerm NearestNeighborTerm;
 };
 
 }
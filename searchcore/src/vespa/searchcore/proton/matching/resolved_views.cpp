@@ -0,0 +1,61 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "resolved_views.h"
+#include "viewresolver.h"
+#include <vespa/searchlib/fef/fieldinfo.h>
+#include <vespa/searchlib/fef/iindexenvironment.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
+
+using search::fef::FieldInfo;
+using search::fef::FieldType;
+using search::fef::IIndexEnvironment;
+
+namespace proton::matching {
+
+namespace {
+
+ResolvedViews::FieldList
+resolveView(const ViewResolver &resolver, const IIndexEnvironment &indexEnv, const vespalib::string &view)
+{
+    std::vector<vespalib::string> names;
+    resolver.resolve(view, names);
+    ResolvedViews::FieldList fields;
+    fields.reserve(names.size());
+    for (const auto &name : names) {
+        const FieldInfo *info = indexEnv.getFieldByName(name);
+        if (info != nullptr) {
+            bool attribute_field = (info->type() == FieldType::ATTRIBUTE) ||
+                                   (info->type() == FieldType::HIDDEN_ATTRIBUTE);
+            fields.push_back({name, info->id(), attribute_field, info->isFilter()});
+        }
+    }
+    return fields;
+}
+
+}
+
+ResolvedViews::ResolvedViews(const ViewResolver &resolver, const IIndexEnvironment &indexEnv)
+    : _views(),
+      _empty()
+{
+    resolver.for_each_view([&](const vespalib::string &view) {
+        _views[view] = resolveView(resolver, indexEnv, view);
+    });
+    for (uint32_t i = 0; i < indexEnv.getNumFields(); ++i) {
+        const vespalib::string &name = indexEnv.getField(i)->name();
+        if (_views.find(name) == _views.end()) {
+            _views[name] = resolveView(resolver, indexEnv, name);
+        }
+    }
+}
+
+ResolvedViews::~ResolvedViews() = default;
+
+const ResolvedViews::FieldList &
+ResolvedViews::lookup(const vespalib::string &view) const
+{
+    auto itr = _views.find(view.empty() ? vespalib::string("default") : view);
+    return (itr != _views.end()) ? itr->second : _empty;
+}
+
+}
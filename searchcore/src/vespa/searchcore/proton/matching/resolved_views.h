@@ -0,0 +1,49 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/stllike/hash_map.h>
+#include <vespa/vespalib/stllike/string.h>
+#include <vector>
+
+namespace search::fef { class IIndexEnvironment; }
+
+namespace proton::matching {
+
+class ViewResolver;
+
+/**
+ * The result of resolving all known views into fields of an index
+ * environment. Views and fields only change when the matcher is
+ * reconfigured, so this is computed once per matcher and shared by
+ * all queries instead of resolving the view of every query term
+ * against the view resolver and the index environment.
+ **/
+class ResolvedViews
+{
+public:
+    struct Field {
+        vespalib::string name;
+        uint32_t         field_id;
+        bool             attribute_field;
+        bool             filter_field;
+    };
+    using FieldList = std::vector<Field>;
+
+private:
+    vespalib::hash_map<vespalib::string, FieldList> _views;
+    FieldList                                       _empty;
+
+public:
+    ResolvedViews(const ViewResolver &resolver, const search::fef::IIndexEnvironment &indexEnv);
+    ~ResolvedViews();
+
+    /**
+     * Look up the fields searched by the given view. The empty view
+     * is the default view. Unknown views resolve to no fields.
+     **/
+    const FieldList &lookup(const vespalib::string &view) const;
+    size_t numViews() const { return _views.size(); }
+};
+
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "querynodes.h"
+#include "resolved_views.h"
 #include "viewresolver.h"
 #include <vespa/searchlib/query/tree/templatetermvisitor.h>
 #include <vespa/searchlib/fef/iindexenvironment.h>
@@ -11,16 +12,25 @@ namespace proton::matching {
 
 class ResolveViewVisitor : public search::query::TemplateTermVisitor<ResolveViewVisitor, ProtonNodeTypes>
 {
-    const ViewResolver &_resolver;
-    const search::fef::IIndexEnvironment &_indexEnv;
+    const ViewResolver *_resolver;
+    const search::fef::IIndexEnvironment *_indexEnv;
+    const ResolvedViews *_views;
 
 public:
     ResolveViewVisitor(const matching::ViewResolver &resolver,
                        const search::fef::IIndexEnvironment &indexEnv)
-        : _resolver(resolver), _indexEnv(indexEnv) {}
+        : _resolver(&resolver), _indexEnv(&indexEnv), _views(nullptr) {}
+    ResolveViewVisitor(const ResolvedViews &views)
+        : _resolver(nullptr), _indexEnv(nullptr), _views(&views) {}
 
     template <class TermNode>
-    void visitTerm(TermNode &n) { n.resolve(_resolver, _indexEnv); }
+    void visitTerm(TermNode &n) {
+        if (_views != nullptr) {
+            n.resolve(*_views);
+        } else {
+            n.resolve(*_resolver, *_indexEnv);
+        }
+    }
 
     void visit(ProtonNodeTypes::Equiv &n) override {
         visitChildren(n);
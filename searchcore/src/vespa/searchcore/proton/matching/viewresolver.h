@@ -50,6 +50,16 @@ public:
     bool resolve(vespalib::stringref view,
                  std::vector<vespalib::string> &fields) const;
 
+    /**
+     * Call the given function with the name of each defined view.
+     **/
+    template <typename Func>
+    void for_each_view(Func func) const {
+        for (const auto &entry : _map) {
+            func(entry.first);
+        }
+    }
+
     /**
      * Create a view resolver based on the field collections defined
      * in the given schema. View definitions should be completely
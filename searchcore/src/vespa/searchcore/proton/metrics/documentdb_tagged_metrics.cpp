@@ -81,7 +81,8 @@ DocumentDBTaggedMetrics::SubDBMetrics::DocumentStoreMetrics::~DocumentStoreMetri
 DocumentDBTaggedMetrics::AttributeMetrics::AttributeMetrics(MetricSet *parent)
     : MetricSet("attribute", {}, "Attribute vector metrics for this document db", parent),
       resourceUsage(this),
-      totalMemoryUsage(this)
+      totalMemoryUsage(this),
+      bitVectorCache(this)
 {
 }
 
@@ -99,6 +100,18 @@ DocumentDBTaggedMetrics::AttributeMetrics::ResourceUsageMetrics::ResourceUsageMe
 
 DocumentDBTaggedMetrics::AttributeMetrics::ResourceUsageMetrics::~ResourceUsageMetrics() = default;
 
+DocumentDBTaggedMetrics::AttributeMetrics::BitVectorCacheMetrics::BitVectorCacheMetrics(MetricSet *parent)
+    : MetricSet("bitvector_cache", {}, "Cache of bitvectors for attribute terms matching multiple values", parent),
+      memoryUsage("memory_usage", {}, "Memory usage of the cache (in bytes)", this),
+      elements("elements", {}, "Number of elements in the cache", this),
+      hitRate("hit_rate", {}, "Rate of hits in the cache compared to number of lookups", this),
+      lookups("lookups", {}, "Number of lookups in the cache (hits + misses)", this),
+      invalidations("invalidations", {}, "Number of elements invalidated by attribute changes", this)
+{
+}
+
+DocumentDBTaggedMetrics::AttributeMetrics::BitVectorCacheMetrics::~BitVectorCacheMetrics() = default;
+
 DocumentDBTaggedMetrics::IndexMetrics::IndexMetrics(MetricSet *parent)
     : MetricSet("index", {}, "Index metrics (memory and disk) for this document db", parent),
       diskUsage("disk_usage", {}, "Disk space usage in bytes", this),
@@ -151,6 +164,7 @@ DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::RankProfileMetrics
       softDoomedQueries("soft_doomed_queries", {}, "Number of queries hitting the soft timeout", this),
       matchTime("match_time", {}, "Average time (sec) for matching a query (1st phase)", this),
       groupingTime("grouping_time", {}, "Average time (sec) spent on grouping", this),
+      selectBestTime("select_best_time", {}, "Average time (sec) spent selecting the best hits across match threads", this),
       rerankTime("rerank_time", {}, "Average time (sec) spent on 2nd phase ranking", this),
       queryCollateralTime("query_collateral_time", {}, "Average time (sec) spent setting up and tearing down queries", this),
       queryLatency("query_latency", {}, "Total average latency (sec) when matching and ranking a query", this)
@@ -169,7 +183,10 @@ DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::DocIdPartition::Do
     docsRanked("docs_ranked", {}, "Number of documents ranked (first phase)", this),
     docsReRanked("docs_reranked", {}, "Number of documents re-ranked (second phase)", this),
     activeTime("active_time", {}, "Time (sec) spent doing actual work", this),
-    waitTime("wait_time", {}, "Time (sec) spent waiting for other external threads and resources", this)
+    waitTime("wait_time", {}, "Time (sec) spent waiting for other external threads and resources", this),
+    firstPhaseTime("first_phase_time", {}, "Time (sec) spent matching and doing 1st phase ranking", this),
+    selectBestTime("select_best_time", {}, "Time (sec) spent merging hits with other threads before 2nd phase ranking", this),
+    secondPhaseTime("second_phase_time", {}, "Time (sec) spent doing 2nd phase ranking", this)
 { }
 
 DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::DocIdPartition::~DocIdPartition() = default;
@@ -184,6 +201,12 @@ DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::DocIdPartition::up
                              stats.active_time_min(), stats.active_time_max());
     waitTime.addValueBatch(stats.wait_time_avg(), stats.wait_time_count(),
                            stats.wait_time_min(), stats.wait_time_max());
+    firstPhaseTime.addValueBatch(stats.first_phase_time_avg(), stats.first_phase_time_count(),
+                                 stats.first_phase_time_min(), stats.first_phase_time_max());
+    selectBestTime.addValueBatch(stats.select_best_time_avg(), stats.select_best_time_count(),
+                                 stats.select_best_time_min(), stats.select_best_time_max());
+    secondPhaseTime.addValueBatch(stats.second_phase_time_avg(), stats.second_phase_time_count(),
+                                  stats.second_phase_time_min(), stats.second_phase_time_max());
 }
 
 void
@@ -199,6 +222,8 @@ DocumentDBTaggedMetrics::MatchingMetrics::RankProfileMetrics::update(const Match
                             stats.matchTimeMin(), stats.matchTimeMax());
     groupingTime.addValueBatch(stats.groupingTimeAvg(), stats.groupingTimeCount(),
                                stats.groupingTimeMin(), stats.groupingTimeMax());
+    selectBestTime.addValueBatch(stats.selectBestTimeAvg(), stats.selectBestTimeCount(),
+                                 stats.selectBestTimeMin(), stats.selectBestTimeMax());
     rerankTime.addValueBatch(stats.rerankTimeAvg(), stats.rerankTimeCount(),
                              stats.rerankTimeMin(), stats.rerankTimeMax());
     queryCollateralTime.addValueBatch(stats.queryCollateralTimeAvg(), stats.queryCollateralTimeCount(),
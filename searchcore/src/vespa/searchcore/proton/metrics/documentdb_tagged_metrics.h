@@ -92,8 +92,21 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
             ~ResourceUsageMetrics();
         };
 
+        struct BitVectorCacheMetrics : metrics::MetricSet
+        {
+            metrics::LongValueMetric memoryUsage;
+            metrics::LongValueMetric elements;
+            metrics::LongAverageMetric hitRate;
+            metrics::LongCountMetric lookups;
+            metrics::LongCountMetric invalidations;
+
+            BitVectorCacheMetrics(metrics::MetricSet *parent);
+            ~BitVectorCacheMetrics();
+        };
+
         ResourceUsageMetrics resourceUsage;
         MemoryUsageMetrics totalMemoryUsage;
+        BitVectorCacheMetrics bitVectorCache;
 
         AttributeMetrics(metrics::MetricSet *parent);
         ~AttributeMetrics();
@@ -126,6 +139,9 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
                 metrics::LongCountMetric docsReRanked;
                 metrics::DoubleAverageMetric activeTime;
                 metrics::DoubleAverageMetric waitTime;
+                metrics::DoubleAverageMetric firstPhaseTime;
+                metrics::DoubleAverageMetric selectBestTime;
+                metrics::DoubleAverageMetric secondPhaseTime;
 
                 using UP = std::unique_ptr<DocIdPartition>;
                 DocIdPartition(const vespalib::string &name, metrics::MetricSet *parent);
@@ -143,6 +159,7 @@ struct DocumentDBTaggedMetrics : metrics::MetricSet
             metrics::LongCountMetric     softDoomedQueries;
             metrics::DoubleAverageMetric matchTime;
             metrics::DoubleAverageMetric groupingTime;
+            metrics::DoubleAverageMetric selectBestTime;
             metrics::DoubleAverageMetric rerankTime;
             metrics::DoubleAverageMetric queryCollateralTime;
             metrics::DoubleAverageMetric queryLatency;
@@ -238,6 +238,22 @@ CombiningFeedView::forceCommit(search::SerialNum serialNum)
     }
 }
 
+void
+CombiningFeedView::beginBatch()
+{
+    for (const auto &view : _views) {
+        view->beginBatch();
+    }
+}
+
+void
+CombiningFeedView::endBatch(search::SerialNum serialNum, std::shared_ptr<search::IDestructorCallback> onDone)
+{
+    for (const auto &view : _views) {
+        view->endBatch(serialNum, onDone);
+    }
+}
+
 void
 CombiningFeedView::
 handlePruneRemovedDocuments(const PruneRemovedDocumentsOperation &pruneOp)
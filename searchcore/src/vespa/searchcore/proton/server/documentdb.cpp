@@ -86,7 +86,8 @@ makeSubDBConfig(const ProtonConfig::Distribution & distCfg, const Allocation & a
 
 index::IndexConfig
 makeIndexConfig(const ProtonConfig::Index & cfg) {
-    return index::IndexConfig(WarmupConfig(cfg.warmup.time, cfg.warmup.unpack), cfg.maxflushed, cfg.cache.size);
+    return index::IndexConfig(WarmupConfig(cfg.warmup.time, cfg.warmup.unpack), cfg.maxflushed, cfg.cache.size,
+                              cfg.fusion.threads, cfg.memory.wordshards);
 }
 
 ProtonConfig::Documentdb _G_defaultProtonDocumentDBConfig;
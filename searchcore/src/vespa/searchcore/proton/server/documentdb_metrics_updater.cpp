@@ -15,6 +15,7 @@
 #include <vespa/searchcore/proton/metrics/documentdb_job_trackers.h>
 #include <vespa/searchcore/proton/metrics/executor_threading_service_stats.h>
 #include <vespa/searchlib/attribute/attributevector.h>
+#include <vespa/searchlib/attribute/ipostinglistattributebase.h>
 #include <vespa/searchlib/docstore/cachestats.h>
 #include <vespa/searchlib/util/memoryusage.h>
 #include <vespa/searchlib/util/searchable_stats.h>
@@ -235,6 +236,51 @@ updateCountMetric(uint64_t currVal, uint64_t lastVal, metrics::LongCountMetric &
     metric.inc(delta);
 }
 
+CacheStats
+getAttributeBitVectorCacheStats(const DocumentSubDBCollection &subDbs)
+{
+    CacheStats result;
+    for (const auto subDb : subDbs) {
+        proton::IAttributeManager::SP attrMgr(subDb->getAttributeManager());
+        if (attrMgr) {
+            std::vector<search::AttributeGuard> list;
+            attrMgr->getAttributeListAll(list);
+            for (const auto &attr : list) {
+                const search::attribute::IPostingListAttributeBase *postings = attr->getIPostingListAttributeBase();
+                if (postings != nullptr) {
+                    result += postings->getBitVectorCacheStats();
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void
+updateAttributeBitVectorCacheMetrics(DocumentDBTaggedMetrics::AttributeMetrics::BitVectorCacheMetrics &metrics,
+                                     const DocumentSubDBCollection &subDbs,
+                                     CacheStats &lastCacheStats,
+                                     TotalStats &totalStats)
+{
+    CacheStats cacheStats = getAttributeBitVectorCacheStats(subDbs);
+    totalStats.memoryUsage.incAllocatedBytes(cacheStats.memory_used);
+    metrics.memoryUsage.set(cacheStats.memory_used);
+    metrics.elements.set(cacheStats.elements);
+    if (cacheStats.hits < lastCacheStats.hits || cacheStats.lookups() < lastCacheStats.lookups() ||
+        cacheStats.invalidations < lastCacheStats.invalidations)
+    {
+        // Caches are recreated when attributes are reconfigured or reloaded
+        lastCacheStats = CacheStats();
+    }
+    if (cacheStats.lookups() > lastCacheStats.lookups()) {
+        metrics.hitRate.addTotalValueWithCount(cacheStats.hits - lastCacheStats.hits,
+                                               cacheStats.lookups() - lastCacheStats.lookups());
+    }
+    updateCountMetric(cacheStats.lookups(), lastCacheStats.lookups(), metrics.lookups);
+    updateCountMetric(cacheStats.invalidations, lastCacheStats.invalidations, metrics.invalidations);
+    lastCacheStats = cacheStats;
+}
+
 void
 updateDocumentStoreMetrics(DocumentDBTaggedMetrics::SubDBMetrics::DocumentStoreMetrics &metrics,
                            const IDocumentSubDB *subDb,
@@ -290,6 +336,7 @@ DocumentDBMetricsUpdater::updateMetrics(DocumentDBTaggedMetrics &metrics)
     ExecutorThreadingServiceStats threadingServiceStats = _writeService.getStats();
     updateIndexMetrics(metrics, _subDBs.getReadySubDB()->getSearchableStats(), totalStats);
     updateAttributeMetrics(metrics, _subDBs, totalStats);
+    updateAttributeBitVectorCacheMetrics(metrics.attribute.bitVectorCache, _subDBs, _lastAttributeBitVectorCacheStats, totalStats);
     updateMatchingMetrics(metrics, *_subDBs.getReadySubDB());
     updateSessionCacheMetrics(metrics, _sessionManager);
     updateDocumentsMetrics(metrics, _subDBs);
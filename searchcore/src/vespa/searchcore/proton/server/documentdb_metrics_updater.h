@@ -36,6 +36,7 @@ private:
     const AttributeUsageFilter &_writeFilter;
     // Last updated document store cache statistics. Necessary due to metrics implementation is upside down.
     DocumentStoreCacheStats _lastDocStoreCacheStats;
+    search::CacheStats _lastAttributeBitVectorCacheStats;
 
     void updateMiscMetrics(DocumentDBTaggedMetrics &metrics, const ExecutorThreadingServiceStats &threadingServiceStats);
     void updateAttributeResourceUsageMetrics(DocumentDBTaggedMetrics::AttributeMetrics &metrics);
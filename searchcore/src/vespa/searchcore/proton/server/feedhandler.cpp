@@ -45,6 +45,9 @@ namespace proton {
 
 namespace {
 
+// Max operations committed and acked together, bounds how long acks are delayed
+constexpr size_t MAX_BATCH_SIZE = 256;
+
 bool
 ignoreOperation(const DocumentOperation &op) {
     return (op.getPrevTimestamp() != 0) && (op.getTimestamp() < op.getPrevTimestamp());
@@ -52,8 +55,68 @@ ignoreOperation(const DocumentOperation &op) {
 
 }  // namespace
 
+/**
+ * Keeps the feed tokens or done callbacks for a batch of operations alive
+ * until the commit or transaction log write for the batch is done, delaying
+ * the acks until then.
+ */
+class FeedHandler::BatchDoneContext : public search::IDestructorCallback
+{
+    std::vector<std::shared_ptr<search::IDestructorCallback>> _callbacks;
+public:
+    BatchDoneContext() : _callbacks() { }
+    ~BatchDoneContext() override;
+    void hold(std::shared_ptr<search::IDestructorCallback> callback) {
+        if (callback) {
+            _callbacks.push_back(std::move(callback));
+        }
+    }
+};
+
+FeedHandler::BatchDoneContext::~BatchDoneContext() = default;
+
+FeedHandler::TlsMgrWriter::TlsMgrWriter(TransactionLogManager &tls_mgr,
+                                        search::transactionlog::Writer * tlsDirectWriter)
+    : _tls_mgr(tls_mgr),
+      _tlsDirectWriter(tlsDirectWriter),
+      _batch(),
+      _batchDone()
+{ }
+
+FeedHandler::TlsMgrWriter::~TlsMgrWriter() = default;
+
 void FeedHandler::TlsMgrWriter::storeOperation(const FeedOperation &op, DoneCallback onDone) {
-    TlcProxy(_tls_mgr.getDomainName(), *_tlsDirectWriter).storeOperation(op, std::move(onDone));
+    TlcProxy proxy(_tls_mgr.getDomainName(), *_tlsDirectWriter);
+    if (!_batch) {
+        proxy.storeOperation(op, std::move(onDone));
+        return;
+    }
+    if (!proxy.addOperation(*_batch, op)) {
+        commitBatch();
+        bool added = proxy.addOperation(*_batch, op);
+        assert(added);
+        (void) added;
+    }
+    _batchDone->hold(std::move(onDone));
+}
+
+void FeedHandler::TlsMgrWriter::commitBatch() {
+    if (!_batch->empty()) {
+        TlcProxy(_tls_mgr.getDomainName(), *_tlsDirectWriter).commit(*_batch, std::move(_batchDone));
+        _batch->clear();
+        _batchDone = std::make_shared<BatchDoneContext>();
+    }
+}
+
+void FeedHandler::TlsMgrWriter::beginBatch() {
+    _batch = std::make_unique<Packet>();
+    _batchDone = std::make_shared<BatchDoneContext>();
+}
+
+void FeedHandler::TlsMgrWriter::endBatch() {
+    commitBatch();
+    _batch.reset();
+    _batchDone.reset();
 }
 bool FeedHandler::TlsMgrWriter::erase(SerialNum oldest_to_keep) {
     return _tls_mgr.getSession()->erase(oldest_to_keep);
@@ -81,11 +144,34 @@ FeedHandler::TlsMgrWriter::sync(SerialNum syncTo)
 }
 
 void
-FeedHandler::doHandleOperation(FeedToken token, FeedOperation::UP op)
+FeedHandler::handlePendingOperations()
 {
     assert(_writeService.master().isCurrentThread());
+    PendingOperations operations;
+    {
+        std::lock_guard<std::mutex> guard(_pendingOperationsLock);
+        operations.swap(_pendingOperations);
+    }
     std::lock_guard<std::mutex> guard(_feedLock);
-    _feedState->handleOperation(std::move(token), std::move(op));
+    for (auto batchBegin = operations.begin(); batchBegin != operations.end(); ) {
+        auto batchEnd = batchBegin + std::min(MAX_BATCH_SIZE, size_t(operations.end() - batchBegin));
+        if (batchEnd - batchBegin == 1 || _feedState->getType() != FeedState::NORMAL) {
+            for (auto itr = batchBegin; itr != batchEnd; ++itr) {
+                _feedState->handleOperation(std::move(itr->first), std::move(itr->second));
+            }
+        } else {
+            auto batchDone = std::make_shared<BatchDoneContext>();
+            _activeFeedView->beginBatch();
+            _tlsWriter.beginBatch();
+            for (auto itr = batchBegin; itr != batchEnd; ++itr) {
+                batchDone->hold(itr->first);
+                _feedState->handleOperation(std::move(itr->first), std::move(itr->second));
+            }
+            _tlsWriter.endBatch();
+            _activeFeedView->endBatch(_serialNum, std::move(batchDone));
+        }
+        batchBegin = batchEnd;
+    }
 }
 
 void FeedHandler::performPut(FeedToken token, PutOperation &op) {
@@ -359,7 +445,9 @@ FeedHandler::FeedHandler(IThreadingService &writeService,
       _bucketDBHandler(nullptr),
       _syncLock(),
       _syncedSerialNum(0),
-      _allowSync(false)
+      _allowSync(false),
+      _pendingOperationsLock(),
+      _pendingOperations()
 { }
 
 
@@ -593,9 +681,15 @@ FeedHandler::performOperation(FeedToken token, FeedOperation::UP op)
 void
 FeedHandler::handleOperation(FeedToken token, FeedOperation::UP op)
 {
-    _writeService.master().execute(makeLambdaTask([this, token = std::move(token), op = std::move(op)]() mutable {
-        doHandleOperation(std::move(token), std::move(op));
-    }));
+    bool firstPending;
+    {
+        std::lock_guard<std::mutex> guard(_pendingOperationsLock);
+        firstPending = _pendingOperations.empty();
+        _pendingOperations.emplace_back(std::move(token), std::move(op));
+    }
+    if (firstPending) {
+        _writeService.master().execute(makeLambdaTask([this]() { handlePendingOperations(); }));
+    }
 }
 
 void
@@ -14,6 +14,7 @@
 #include <vespa/searchcore/proton/common/feedtoken.h>
 #include <vespa/searchlib/transactionlog/translogclient.h>
 #include <mutex>
+#include <vector>
 
 namespace searchcorespi { namespace index { struct IThreadingService; } }
 
@@ -56,17 +57,23 @@ private:
     typedef document::BucketId              BucketId;
     using FeedStateSP = std::shared_ptr<FeedState>;
     using FeedOperationUP = std::unique_ptr<FeedOperation>;
+    using PendingOperations = std::vector<std::pair<FeedToken, FeedOperationUP>>;
+    class BatchDoneContext;
 
     class TlsMgrWriter : public TlsWriter {
         TransactionLogManager &_tls_mgr;
         search::transactionlog::Writer *_tlsDirectWriter;
+        std::unique_ptr<Packet> _batch;
+        std::shared_ptr<BatchDoneContext> _batchDone;
+
+        void commitBatch();
     public:
         TlsMgrWriter(TransactionLogManager &tls_mgr,
-                     search::transactionlog::Writer * tlsDirectWriter) :
-            _tls_mgr(tls_mgr),
-            _tlsDirectWriter(tlsDirectWriter)
-        { }
+                     search::transactionlog::Writer * tlsDirectWriter);
+        ~TlsMgrWriter() override;
         void storeOperation(const FeedOperation &op, DoneCallback onDone) override;
+        void beginBatch() override;
+        void endBatch() override;
         bool erase(SerialNum oldest_to_keep) override;
         SerialNum sync(SerialNum syncTo) override;
     };
@@ -95,12 +102,17 @@ private:
     std::mutex                             _syncLock;
     SerialNum                              _syncedSerialNum; 
     bool                                   _allowSync; // Sanity check
+    std::mutex                             _pendingOperationsLock;
+    PendingOperations                      _pendingOperations;
 
     /**
      * Delayed handling of feed operations, in master write thread.
-     * The current feed state is sampled here.
+     * The current feed state is sampled here. All operations queued
+     * since the last call are handled, in normal feed state as batches of
+     * at most MAX_BATCH_SIZE operations against the feed view, giving one
+     * commit and one transaction log packet per batch.
      */
-    void doHandleOperation(FeedToken token, FeedOperationUP op);
+    void handlePendingOperations();
 
     bool considerWriteOperationForRejection(FeedToken & token, const FeedOperation &op);
     bool considerUpdateOperationForRejection(FeedToken &token, UpdateOperation &op);
@@ -9,8 +9,8 @@
 #include <vespa/searchcore/proton/feedoperation/operations.h>
 #include <vespa/searchcore/proton/common/eventlogger.h>
 #include <vespa/searchlib/common/idestructorcallback.h>
-#include <vespa/vespalib/util/closuretask.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/lambdatask.h>
 
 
 #include <vespa/log/log.h>
@@ -21,17 +21,16 @@ using search::transactionlog::RPC;
 using search::SerialNum;
 using vespalib::Executor;
 using vespalib::IllegalStateException;
-using vespalib::makeClosure;
-using vespalib::makeTask;
+using vespalib::makeLambdaTask;
 using vespalib::make_string;
 using proton::bucketdb::IBucketDBHandler;
 
 namespace proton {
 
 namespace {
-typedef vespalib::Closure1<const Packet::Entry &>::UP EntryHandler;
-
 const search::SerialNum REPLAY_PROGRESS_INTERVAL = 50000;
+// Number of deserialized operations handed to the executor thread in each task.
+const size_t REPLAY_BATCH_SIZE = 64;
 
 void
 handleProgress(TlsReplayProgress &progress, SerialNum currentSerial)
@@ -44,25 +43,45 @@ handleProgress(TlsReplayProgress &progress, SerialNum currentSerial)
                                                   progress.getProgress(),
                                                   progress.getFirst(),
                                                   progress.getLast(),
-                                                  progress.getCurrent());
+                                                  progress.getCurrent(),
+                                                  progress.getReplayRate());
     }
 }
 
-void
-handlePacket(PacketWrapper::SP wrap, EntryHandler entryHandler)
-{
-    vespalib::nbostream_longlivedbuf handle(wrap->packet.getHandle().c_str(), wrap->packet.getHandle().size());
-    while (handle.size() > 0) {
-        Packet::Entry entry;
-        entry.deserialize(handle);
-        entryHandler->call(entry);
-        if (wrap->progress != NULL) {
-            handleProgress(*wrap->progress, entry.serial());
+/**
+ * Tracks the replay of one packet, which may be split into several
+ * executor tasks. The packet is reported as done when the last task
+ * holding the context is destroyed, also when replay throws. The result
+ * is only set to OK when all tasks have completed.
+ */
+class ReplayPacketContext {
+    PacketWrapper::SP _wrap;
+    uint32_t          _submittedTasks; // Updated by the receiving thread.
+    uint32_t          _completedTasks; // Updated by the executor thread.
+    bool              _allSubmitted;
+
+public:
+    ReplayPacketContext(PacketWrapper::SP wrap)
+        : _wrap(std::move(wrap)),
+          _submittedTasks(0),
+          _completedTasks(0),
+          _allSubmitted(false)
+    {
+    }
+    ~ReplayPacketContext() {
+        if (_allSubmitted && _completedTasks == _submittedTasks) {
+            _wrap->result = RPC::OK;
         }
+        _wrap->gate.countDown();
     }
-    wrap->result = RPC::OK;
-    wrap->gate.countDown();
-}
+    void taskSubmitted(bool last) {
+        ++_submittedTasks;
+        _allSubmitted = last;
+    }
+    void taskCompleted() { ++_completedTasks; }
+    const Packet &getPacket() const { return _wrap->packet; }
+    TlsReplayProgress *getProgress() const { return _wrap->progress; }
+};
 
 class TransactionLogReplayPacketHandler : public IReplayPacketHandler {
     IFeedView *& _feed_view_ptr;  // Pointer can be changed in executor thread.
@@ -128,15 +147,18 @@ public:
     }
 };
 
-void startDispatch(IReplayPacketHandler *packet_handler,
-                   const Packet::Entry &entry) {
-    // Called by handlePacket() in executor thread.
-    LOG(spam,
-        "replay packet entry: entrySerial(%" PRIu64 "), entryType(%u)",
-        entry.serial(), entry.type());
-
-    ReplayPacketDispatcher dispatcher(*packet_handler);
-    dispatcher.replayEntry(entry);
+bool
+containsNewConfig(const Packet &packet)
+{
+    vespalib::nbostream_longlivedbuf handle(packet.getHandle().c_str(), packet.getHandle().size());
+    while (handle.size() > 0) {
+        Packet::Entry entry;
+        entry.deserialize(handle);
+        if (entry.type() == FeedOperation::NEW_CONFIG) {
+            return true;
+        }
+    }
+    return false;
 }
 
 }  // namespace
@@ -149,15 +171,89 @@ ReplayTransactionLogState::ReplayTransactionLogState(
         FeedConfigStore &config_store)
     : FeedState(REPLAY_TRANSACTION_LOG),
       _doc_type_name(name),
+      _feed_view_ptr(feed_view_ptr),
       _packet_handler(new TransactionLogReplayPacketHandler(
                       feed_view_ptr, bucketDBHandler,
-                      replay_config, config_store)) {
+                      replay_config, config_store)),
+      _repo_lock(),
+      _repo(feed_view_ptr->getDocumentTypeRepo()) {
+}
+
+std::shared_ptr<const document::DocumentTypeRepo>
+ReplayTransactionLogState::getRepo()
+{
+    std::lock_guard<std::mutex> guard(_repo_lock);
+    return _repo;
+}
+
+void
+ReplayTransactionLogState::updateRepo()
+{
+    // Called by the executor thread, which owns the active feed view pointer.
+    std::shared_ptr<const document::DocumentTypeRepo> repo = _feed_view_ptr->getDocumentTypeRepo();
+    std::lock_guard<std::mutex> guard(_repo_lock);
+    _repo = std::move(repo);
 }
 
 void ReplayTransactionLogState::receive(const PacketWrapper::SP &wrap,
                                         Executor &executor) {
-    EntryHandler closure = makeClosure(&startDispatch, _packet_handler.get());
-    executor.execute(makeTask(makeClosure(&handlePacket, wrap, std::move(closure))));
+    auto context = std::make_shared<ReplayPacketContext>(wrap);
+    if (containsNewConfig(wrap->packet)) {
+        // Config changes may change the document type repo used to
+        // deserialize later entries, so the whole packet is deserialized
+        // and replayed by the executor thread.
+        context->taskSubmitted(true);
+        executor.execute(makeLambdaTask([this, context]() {
+            ReplayPacketDispatcher dispatcher(*_packet_handler);
+            vespalib::nbostream_longlivedbuf handle(context->getPacket().getHandle().c_str(),
+                                                    context->getPacket().getHandle().size());
+            while (handle.size() > 0) {
+                Packet::Entry entry;
+                entry.deserialize(handle);
+                LOG(spam, "replay packet entry: entrySerial(%" PRIu64 "), entryType(%u)",
+                    entry.serial(), entry.type());
+                dispatcher.replayEntry(entry);
+                if (context->getProgress() != nullptr) {
+                    handleProgress(*context->getProgress(), entry.serial());
+                }
+            }
+            updateRepo();
+            context->taskCompleted();
+        }));
+        return;
+    }
+    // Deserialize in the receiving thread while the executor thread
+    // replays the operations deserialized so far.
+    auto repo = getRepo();
+    ReplayPacketDispatcher dispatcher(*_packet_handler);
+    std::vector<FeedOperation::UP> ops;
+    auto submit = [this, &executor, &context, &ops](bool last) {
+        context->taskSubmitted(last);
+        executor.execute(makeLambdaTask([this, context, last, ops = std::move(ops)]() {
+            ReplayPacketDispatcher executorDispatcher(*_packet_handler);
+            for (const auto &op : ops) {
+                executorDispatcher.replayOperation(*op);
+                if (context->getProgress() != nullptr) {
+                    handleProgress(*context->getProgress(), op->getSerialNum());
+                }
+            }
+            if (last) {
+                updateRepo();
+            }
+            context->taskCompleted();
+        }));
+        ops.clear();
+    };
+    vespalib::nbostream_longlivedbuf handle(wrap->packet.getHandle().c_str(), wrap->packet.getHandle().size());
+    while (handle.size() > 0) {
+        Packet::Entry entry;
+        entry.deserialize(handle);
+        ops.push_back(dispatcher.deserializeEntry(entry, *repo));
+        if (ops.size() >= REPLAY_BATCH_SIZE && handle.size() > 0) {
+            submit(false);
+        }
+    }
+    submit(true);
 }
 
 }  // namespace proton
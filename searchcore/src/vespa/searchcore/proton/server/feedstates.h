@@ -5,6 +5,7 @@
 #include <vespa/searchcore/proton/server/feedhandler.h>
 #include <vespa/searchcore/proton/server/feedstate.h>
 #include <vespa/searchcore/proton/server/ireplaypackethandler.h>
+#include <mutex>
 
 namespace proton {
 
@@ -45,7 +46,15 @@ public:
  */
 class ReplayTransactionLogState : public FeedState {
     vespalib::string _doc_type_name;
+    IFeedView *& _feed_view_ptr;  // Pointer can be changed in executor thread.
     std::unique_ptr<IReplayPacketHandler> _packet_handler;
+    // Snapshot of the active feed view's document type repo, taken in the
+    // executor thread, used to deserialize packets in the receiving thread.
+    std::mutex _repo_lock;
+    std::shared_ptr<const document::DocumentTypeRepo> _repo;
+
+    std::shared_ptr<const document::DocumentTypeRepo> getRepo();
+    void updateRepo();
 
 public:
     ReplayTransactionLogState(const vespalib::string &name,
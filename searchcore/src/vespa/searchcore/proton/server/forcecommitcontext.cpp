@@ -9,10 +9,18 @@ namespace proton {
 
 ForceCommitContext::ForceCommitContext(vespalib::Executor &executor,
                                        IDocumentMetaStore &documentMetaStore)
+    : ForceCommitContext(executor, documentMetaStore, std::shared_ptr<search::IDestructorCallback>())
+{
+}
+
+ForceCommitContext::ForceCommitContext(vespalib::Executor &executor,
+                                       IDocumentMetaStore &documentMetaStore,
+                                       std::shared_ptr<search::IDestructorCallback> onDone)
     : _executor(executor),
       _task(std::make_unique<ForceCommitDoneTask>(documentMetaStore)),
       _committedDocIdLimit(0u),
-      _docIdLimit(nullptr)
+      _docIdLimit(nullptr),
+      _onDone(std::move(onDone))
 {
 }
 
@@ -59,6 +59,15 @@ public:
     virtual void heartBeat(search::SerialNum serialNum) = 0;
     virtual void sync() = 0;
     virtual void forceCommit(search::SerialNum serialNum) = 0;
+
+    /**
+     * Called by the feed handler around a batch of feed operations
+     * handled in one master thread task. Commits wanted by the operations
+     * in the batch are deferred to a single commit when the batch ends,
+     * and onDone is kept alive until that commit has completed.
+     */
+    virtual void beginBatch() = 0;
+    virtual void endBatch(search::SerialNum serialNum, std::shared_ptr<search::IDestructorCallback> onDone) = 0;
     virtual void handlePruneRemovedDocuments(const PruneRemovedDocumentsOperation & pruneOp) = 0;
     virtual void handleCompactLidSpace(const CompactLidSpaceOperation &op) = 0;
 };
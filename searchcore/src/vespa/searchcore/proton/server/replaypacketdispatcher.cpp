@@ -12,10 +12,8 @@ namespace proton {
 
 template <typename OperationType>
 void
-ReplayPacketDispatcher::replay(OperationType &op, vespalib::nbostream &is, const Packet::Entry &entry)
+ReplayPacketDispatcher::replay(const OperationType &op)
 {
-    op.deserialize(is, _handler.getDeserializeRepo());
-    op.setSerialNum(entry.serial());
     store(op);
     _handler.replay(op);
 }
@@ -30,72 +28,126 @@ ReplayPacketDispatcher::ReplayPacketDispatcher(IReplayPacketHandler &handler)
 void
 ReplayPacketDispatcher::replayEntry(const Packet::Entry &entry)
 {
-    vespalib::nbostream is(entry.data().c_str(), entry.data().size());
+    if (entry.type() == FeedOperation::NEW_CONFIG) {
+        vespalib::nbostream is(entry.data().c_str(), entry.data().size());
+        NewConfigOperation op(entry.serial(), _handler.getNewConfigStreamHandler());
+        op.deserialize(is, _handler.getDeserializeRepo());
+        _handler.replay(op);
+        if (is.size() > 0) {
+            throw document::DeserializeException
+                (make_string("Too much data in packet entry (type id '%u', %ld bytes)",
+                             entry.type(), is.size()));
+        }
+    } else {
+        replayOperation(*deserializeEntry(entry, _handler.getDeserializeRepo()));
+    }
+}
+
+
+FeedOperation::UP
+ReplayPacketDispatcher::deserializeEntry(const Packet::Entry &entry, const document::DocumentTypeRepo &repo)
+{
+    FeedOperation::UP op;
     switch (entry.type()) {
-    case FeedOperation::PUT: {
-        PutOperation op;
-        replay(op, is, entry);
+    case FeedOperation::PUT:
+        op = std::make_unique<PutOperation>();
         break;
-    } case FeedOperation::REMOVE: {
-        RemoveOperation op;
-        replay(op, is, entry);
+    case FeedOperation::REMOVE:
+        op = std::make_unique<RemoveOperation>();
         break;
-    } case FeedOperation::UPDATE_42:
-      case FeedOperation::UPDATE: {
-        UpdateOperation op(static_cast<FeedOperation::Type>(entry.type()));
-        replay(op, is, entry);
+    case FeedOperation::UPDATE_42:
+    case FeedOperation::UPDATE:
+        op = std::make_unique<UpdateOperation>(static_cast<FeedOperation::Type>(entry.type()));
         break;
-    } case FeedOperation::NOOP: {
-        NoopOperation op;
-        replay(op, is, entry);
+    case FeedOperation::NOOP:
+        op = std::make_unique<NoopOperation>();
         break;
-    } case FeedOperation::NEW_CONFIG: {
-        NewConfigOperation op(entry.serial(), _handler.getNewConfigStreamHandler());
-        op.deserialize(is, _handler.getDeserializeRepo());
-        _handler.replay(op);
-        break;
-    } case FeedOperation::WIPE_HISTORY: {
-        WipeHistoryOperation op;
-        replay(op, is, entry);
+    case FeedOperation::WIPE_HISTORY:
+        op = std::make_unique<WipeHistoryOperation>();
         break;
-    } case FeedOperation::DELETE_BUCKET: {
-        DeleteBucketOperation op;
-        replay(op, is, entry);
+    case FeedOperation::DELETE_BUCKET:
+        op = std::make_unique<DeleteBucketOperation>();
         break;
-    } case FeedOperation::SPLIT_BUCKET: {
-        SplitBucketOperation op;
-        replay(op, is, entry);
+    case FeedOperation::SPLIT_BUCKET:
+        op = std::make_unique<SplitBucketOperation>();
         break;
-    } case FeedOperation::JOIN_BUCKETS: {
-        JoinBucketsOperation op;
-        replay(op, is, entry);
+    case FeedOperation::JOIN_BUCKETS:
+        op = std::make_unique<JoinBucketsOperation>();
         break;
-    } case FeedOperation::PRUNE_REMOVED_DOCUMENTS: {
-        PruneRemovedDocumentsOperation op;
-        replay(op, is, entry);
+    case FeedOperation::PRUNE_REMOVED_DOCUMENTS:
+        op = std::make_unique<PruneRemovedDocumentsOperation>();
         break;
-    } case FeedOperation::MOVE: {
-        MoveOperation op;
-        replay(op, is, entry);
+    case FeedOperation::MOVE:
+        op = std::make_unique<MoveOperation>();
         break;
-    } case FeedOperation::CREATE_BUCKET: {
-        CreateBucketOperation op;
-        replay(op, is, entry);
+    case FeedOperation::CREATE_BUCKET:
+        op = std::make_unique<CreateBucketOperation>();
         break;
-    } case FeedOperation::COMPACT_LID_SPACE: {
-        CompactLidSpaceOperation op;
-        replay(op, is, entry);
+    case FeedOperation::COMPACT_LID_SPACE:
+        op = std::make_unique<CompactLidSpaceOperation>();
         break;
-    } default:
+    default:
         throw IllegalStateException
             (make_string("Got packet entry with unknown type id '%u' from TLS",
                          entry.type()));
     }
+    vespalib::nbostream is(entry.data().c_str(), entry.data().size());
+    op->deserialize(is, repo);
+    op->setSerialNum(entry.serial());
     if (is.size() > 0) {
         throw document::DeserializeException
             (make_string("Too much data in packet entry (type id '%u', %ld bytes)",
                          entry.type(), is.size()));
     }
+    return op;
+}
+
+
+void
+ReplayPacketDispatcher::replayOperation(const FeedOperation &op)
+{
+    switch (op.getType()) {
+    case FeedOperation::PUT:
+        replay(static_cast<const PutOperation &>(op));
+        break;
+    case FeedOperation::REMOVE:
+        replay(static_cast<const RemoveOperation &>(op));
+        break;
+    case FeedOperation::UPDATE_42:
+    case FeedOperation::UPDATE:
+        replay(static_cast<const UpdateOperation &>(op));
+        break;
+    case FeedOperation::NOOP:
+        replay(static_cast<const NoopOperation &>(op));
+        break;
+    case FeedOperation::WIPE_HISTORY:
+        replay(static_cast<const WipeHistoryOperation &>(op));
+        break;
+    case FeedOperation::DELETE_BUCKET:
+        replay(static_cast<const DeleteBucketOperation &>(op));
+        break;
+    case FeedOperation::SPLIT_BUCKET:
+        replay(static_cast<const SplitBucketOperation &>(op));
+        break;
+    case FeedOperation::JOIN_BUCKETS:
+        replay(static_cast<const JoinBucketsOperation &>(op));
+        break;
+    case FeedOperation::PRUNE_REMOVED_DOCUMENTS:
+        replay(static_cast<const PruneRemovedDocumentsOperation &>(op));
+        break;
+    case FeedOperation::MOVE:
+        replay(static_cast<const MoveOperation &>(op));
+        break;
+    case FeedOperation::CREATE_BUCKET:
+        replay(static_cast<const CreateBucketOperation &>(op));
+        break;
+    case FeedOperation::COMPACT_LID_SPACE:
+        replay(static_cast<const CompactLidSpaceOperation &>(op));
+        break;
+    default:
+        throw IllegalStateException
+            (make_string("Cannot replay feed operation of type '%u'", op.getType()));
+    }
 }
 
 
@@ -4,6 +4,9 @@
 
 #include "ireplaypackethandler.h"
 #include <vespa/searchlib/transactionlog/common.h>
+#include <memory>
+
+namespace document { class DocumentTypeRepo; }
 
 namespace proton {
 
@@ -20,7 +23,7 @@ private:
     IReplayPacketHandler &_handler;
 
     template <typename OperationType>
-    void replay(OperationType &op, vespalib::nbostream &is, const Packet::Entry &entry);
+    void replay(const OperationType &op);
 
 protected:
     virtual void store(const FeedOperation &op);
@@ -30,6 +33,14 @@ public:
     virtual ~ReplayPacketDispatcher();
 
     void replayEntry(const Packet::Entry &entry);
+
+    /**
+     * Deserializes a packet entry into a feed operation without replaying it,
+     * using the given document type repo.
+     * Not supported for new config entries, which must be replayed directly.
+     */
+    std::unique_ptr<FeedOperation> deserializeEntry(const Packet::Entry &entry, const document::DocumentTypeRepo &repo);
+    void replayOperation(const FeedOperation &op);
 };
 
 } // namespace proton
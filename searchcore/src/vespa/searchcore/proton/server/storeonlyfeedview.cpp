@@ -198,6 +198,7 @@ StoreOnlyFeedView::StoreOnlyFeedView(const Context &ctx, const PersistentParams
       _lidReuseDelayer(ctx._lidReuseDelayer),
       _commitTimeTracker(ctx._commitTimeTracker),
       _pendingLidTracker(),
+      _batchDelaysLidReuse(false),
       _schema(ctx._schema),
       _writeService(ctx._writeService),
       _params(params),
@@ -232,6 +233,36 @@ StoreOnlyFeedView::forceCommit(SerialNum serialNum, OnForceCommitDoneType onComm
     }
 }
 
+void
+StoreOnlyFeedView::beginBatch()
+{
+    assert(_writeService.master().isCurrentThread());
+    _commitTimeTracker.beginBatch();
+    /*
+     * Lids freed by removes in the batch cannot be reused before the
+     * batch commit is done, since later operations in the same batch
+     * could otherwise get a lid that still has uncommitted old content.
+     */
+    _batchDelaysLidReuse = _lidReuseDelayer.getImmediateCommit();
+    if (_batchDelaysLidReuse) {
+        _lidReuseDelayer.setImmediateCommit(false);
+    }
+}
+
+void
+StoreOnlyFeedView::endBatch(SerialNum serialNum, IDestructorCallback::SP onDone)
+{
+    assert(_writeService.master().isCurrentThread());
+    if (_commitTimeTracker.endBatch()) {
+        forceCommit(serialNum, std::make_shared<ForceCommitContext>(_writeService.master(), _metaStore,
+                                                                    std::move(onDone)));
+    }
+    if (_batchDelaysLidReuse) {
+        _lidReuseDelayer.setImmediateCommit(true);
+        _batchDelaysLidReuse = false;
+    }
+}
+
 void
 StoreOnlyFeedView::considerEarlyAck(FeedToken & token)
 {
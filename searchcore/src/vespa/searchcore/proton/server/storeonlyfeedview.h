@@ -146,6 +146,7 @@ private:
     documentmetastore::ILidReuseDelayer     &_lidReuseDelayer;
     CommitTimeTracker                       &_commitTimeTracker;
     PendingLidTracker                        _pendingLidTracker;
+    bool                                     _batchDelaysLidReuse;
 
 protected:
     const search::index::Schema::SP          _schema;
@@ -254,6 +255,8 @@ public:
     void sync() override;
     void forceCommit(SerialNum serialNum) override;
     virtual void forceCommit(SerialNum serialNum, OnForceCommitDoneType onCommitDone);
+    void beginBatch() override;
+    void endBatch(SerialNum serialNum, std::shared_ptr<search::IDestructorCallback> onDone) override;
 
     /**
      * Prune lids present in operation.  Caller must call doneSegment()
@@ -15,7 +15,7 @@ void TlcProxy::commit(search::SerialNum serialNum, search::transactionlog::Type
                       const vespalib::nbostream &buf, DoneCallback onDone)
 {
     Packet::Entry entry(serialNum, type, vespalib::ConstBufferRef(buf.c_str(), buf.size()));
-    Packet packet;
+    Packet packet(entry.serializedSize());
     packet.add(entry);
     packet.close();
     _tlsDirectWriter.commit(_domain, packet, std::move(onDone));
@@ -31,4 +31,21 @@ TlcProxy::storeOperation(const FeedOperation &op, DoneCallback onDone)
     commit(op.getSerialNum(), (uint32_t)op.getType(), stream, std::move(onDone));
 }
 
+bool
+TlcProxy::addOperation(Packet &packet, const FeedOperation &op)
+{
+    nbostream stream;
+    op.serialize(stream);
+    LOG(debug, "addOperation(): serialNum(%" PRIu64 "), type(%u), size(%zu)",
+        op.getSerialNum(), (uint32_t)op.getType(), stream.size());
+    return packet.add(Packet::Entry(op.getSerialNum(), (uint32_t)op.getType(),
+                                    vespalib::ConstBufferRef(stream.c_str(), stream.size())));
+}
+
+void
+TlcProxy::commit(const Packet &packet, DoneCallback onDone)
+{
+    _tlsDirectWriter.commit(_domain, packet, std::move(onDone));
+}
+
 }  // namespace proton
@@ -22,6 +22,13 @@ public:
         : _domain(domain), _tlsDirectWriter(writer) {}
 
     void storeOperation(const FeedOperation &op, DoneCallback onDone);
+
+    /**
+     * Add the given operation to the packet instead of committing it.
+     * Returns false if the packet is full.
+     */
+    static bool addOperation(search::transactionlog::Packet &packet, const FeedOperation &op);
+    void commit(const search::transactionlog::Packet &packet, DoneCallback onDone);
 };
 
 } // namespace proton
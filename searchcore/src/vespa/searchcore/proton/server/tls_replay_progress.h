@@ -4,6 +4,7 @@
 
 #include <vespa/searchlib/common/serialnum.h>
 #include <vespa/vespalib/stllike/string.h>
+#include <chrono>
 
 namespace proton {
 
@@ -14,6 +15,7 @@ private:
     const search::SerialNum _first;
     const search::SerialNum _last;
     search::SerialNum       _current;
+    const std::chrono::steady_clock::time_point _startTime;
 
 public:
     typedef std::unique_ptr<TlsReplayProgress> UP;
@@ -24,7 +26,8 @@ public:
         : _domainName(domainName),
           _first(first),
           _last(last),
-          _current(first)
+          _current(first),
+          _startTime(std::chrono::steady_clock::now())
     {
     }
     const vespalib::string &getDomainName() const { return _domainName; }
@@ -38,6 +41,13 @@ public:
             return ((float)(_current - _first)/float(_last - _first));
         }
     }
+    /**
+     * Returns the number of serial numbers replayed per second since replay started.
+     */
+    double getReplayRate() const {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _startTime;
+        return (elapsed.count() > 0) ? (_current - _first) / elapsed.count() : 0.0;
+    }
     void updateCurrent(search::SerialNum current) { _current = current; }
 };
 
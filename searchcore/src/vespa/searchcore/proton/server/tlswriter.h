@@ -13,6 +13,13 @@ namespace proton {
 struct TlsWriter : public IOperationStorer {
     virtual ~TlsWriter() = default;
 
+    /**
+     * Operations stored between beginBatch() and endBatch() are written
+     * to the transaction log as one packet, split only when the packet
+     * is full. The done callbacks are kept until the packet is written.
+     */
+    virtual void beginBatch() = 0;
+    virtual void endBatch() = 0;
     virtual bool erase(search::SerialNum oldest_to_keep) = 0;
     virtual search::SerialNum sync(search::SerialNum syncTo) = 0;
 };
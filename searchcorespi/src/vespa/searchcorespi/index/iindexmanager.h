@@ -9,6 +9,7 @@
 #include <vespa/vespalib/util/closure.h>
 
 namespace search { class IDestructorCallback; }
+namespace search::diskindex { class FusionProgress; }
 namespace document { class Document; }
 
 namespace searchcorespi {
@@ -167,6 +168,12 @@ public:
      * @param maxFlushed   The max number of flushed indexes before fusion is urgent.
      */
     virtual void setMaxFlushed(uint32_t maxFlushed) = 0;
+
+    /**
+     * Returns progress of the ongoing or last fusion, or nullptr if
+     * this index manager does not track fusion progress.
+     */
+    virtual const search::diskindex::FusionProgress *getFusionProgress() const { return nullptr; }
 };
 
 } // namespace searchcorespi
@@ -3,11 +3,13 @@
 #include "index_manager_explorer.h"
 #include "index_manager_stats.h"
 
+#include <vespa/searchlib/diskindex/fusion_progress.h>
 #include <vespa/vespalib/data/slime/cursor.h>
 
 using vespalib::slime::Cursor;
 using vespalib::slime::Inserter;
 using search::SearchableStats;
+using search::diskindex::FusionProgress;
 using searchcorespi::index::DiskIndexStats;
 using searchcorespi::index::MemoryIndexStats;
 
@@ -45,6 +47,33 @@ insertMemoryIndex(Cursor &arrayCursor, const MemoryIndexStats &memoryIndex)
     insertMemoryUsage(memoryIndexCursor, sstats.memoryUsage());
 }
 
+void
+insertFusion(Cursor &object, const FusionProgress &progress)
+{
+    auto fields = progress.getFields();
+    if (fields.empty()) {
+        return;
+    }
+    Cursor &fusion = object.setObject("fusion");
+    uint32_t fieldsDone = 0;
+    Cursor &fieldArrayCursor = fusion.setArray("fields");
+    for (const auto &field : fields) {
+        if (field.state == FusionProgress::State::DONE) {
+            ++fieldsDone;
+        }
+        Cursor &fieldCursor = fieldArrayCursor.addObject();
+        fieldCursor.setString("name", field.name);
+        fieldCursor.setString("state", FusionProgress::stateName(field.state));
+        fieldCursor.setLong("words", field.numWords);
+        fieldCursor.setLong("sizeOnDisk", field.sizeOnDisk);
+        fieldCursor.setDouble("elapsedSeconds", field.elapsedSeconds);
+        fieldCursor.setDouble("wordsPerSecond", field.wordsPerSecond());
+        fieldCursor.setDouble("bytesPerSecond", field.bytesPerSecond());
+    }
+    fusion.setLong("fieldsTotal", fields.size());
+    fusion.setLong("fieldsDone", fieldsDone);
+}
+
 }
 
 
@@ -68,6 +97,10 @@ IndexManagerExplorer::get_state(const Inserter &inserter, bool full) const
         for (const auto &memoryIndex : stats.getMemoryIndexes()) {
             insertMemoryIndex(memoryIndexArrayCursor, memoryIndex);
         }
+        const FusionProgress *fusionProgress = _mgr->getFusionProgress();
+        if (fusionProgress != nullptr) {
+            insertFusion(object, *fusionProgress);
+        }
     }
 }
 
@@ -245,6 +245,10 @@ private:
 
     void testPendingCompaction();
 
+    template <typename VectorType, typename BufferType>
+    void testPagedLoad(const Config &config);
+    void testPagedLoad();
+
 public:
     AttributeTest();
     int Main() override;
@@ -2234,6 +2238,44 @@ AttributeTest::testPendingCompaction()
     populateSimple(iv, 1, 2);  // should not trigger new compaction
 }
 
+template <typename VectorType, typename BufferType>
+void
+AttributeTest::testPagedLoad(const Config &config)
+{
+    vespalib::string name = vespalib::make_string("paged_%s", config.basicType().asString());
+    AttributePtr a = createAttribute(name + "_a", config);
+    addDocs(a, 5000);
+    populate(static_cast<VectorType &>(*a), 17);
+    EXPECT_TRUE(a->save(baseFileName(name)));
+
+    Config pagedConfig(config);
+    pagedConfig.setPaged(true);
+    AttributePtr b = createAttribute(name, pagedConfig);
+    EXPECT_TRUE(b->load());
+    compare<VectorType, BufferType>(static_cast<VectorType &>(*a), static_cast<VectorType &>(*b));
+
+    // Updates and growth must not touch the mapped file
+    populate(static_cast<VectorType &>(*b), 18);
+    AttributeVector::DocId docId;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        EXPECT_TRUE(b->addDoc(docId));
+    }
+    populate(static_cast<VectorType &>(*b), 19);
+    EXPECT_EQUAL(10000u, b->getNumDocs());
+
+    AttributePtr c = createAttribute(name, pagedConfig);
+    EXPECT_TRUE(c->load());
+    compare<VectorType, BufferType>(static_cast<VectorType &>(*a), static_cast<VectorType &>(*c));
+}
+
+void
+AttributeTest::testPagedLoad()
+{
+    TEST_DO((testPagedLoad<IntegerAttribute, AttributeVector::largeint_t>(Config(BasicType::INT64, CollectionType::SINGLE))));
+    TEST_DO((testPagedLoad<IntegerAttribute, AttributeVector::largeint_t>(Config(BasicType::INT32, CollectionType::SINGLE))));
+    TEST_DO((testPagedLoad<FloatingPointAttribute, double>(Config(BasicType::DOUBLE, CollectionType::SINGLE))));
+}
+
 void testNamePrefix() {
     Config cfg(BasicType::INT32, CollectionType::SINGLE);
     AttributeVector::SP vFlat = createAttribute("sfsint32_pc", cfg);
@@ -2298,6 +2340,7 @@ int AttributeTest::Main()
     testReaderDuringLastUpdate();
     TEST_DO(testPendingCompaction());
     TEST_DO(testNamePrefix());
+    TEST_DO(testPagedLoad());
 
     deleteDataDirs();
     TEST_DONE();
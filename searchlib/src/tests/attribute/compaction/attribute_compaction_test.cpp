@@ -124,6 +124,13 @@ Config compactAddressSpaceAttributeConfig(bool enableAddressSpaceCompact)
     return cfg;
 }
 
+Config compactInStepsAttributeConfig()
+{
+    Config cfg(BasicType::INT64, CollectionType::ARRAY);
+    cfg.setCompactionStrategy({ 0.2, 0.2, 500 });
+    return cfg;
+}
+
 }
 
 class Fixture {
@@ -190,4 +197,26 @@ TEST_F("Test that compaction of int8 array attribute limits address space usage"
     EXPECT_GREATER(65536u, afterSpace.dead());
 }
 
+TEST_F("Test that compaction of integer array attribute can be spread over several commits", Fixture(compactInStepsAttributeConfig()))
+{
+    DocIdRange range1 = f.addDocs(2000);
+    DocIdRange range2 = f.addDocs(1000);
+    f.populate(range1, 40);
+    f.populate(range2, 40);
+    AttributeStatus beforeStatus = f.getStatus("before");
+    f.clean(range1);
+    uint32_t maxPendingDocs = 0;
+    uint32_t commits = 0;
+    AttributeStatus status = f.getStatus();
+    while (status.getCompactions() == 0 || status.getPendingCompactionDocs() != 0) {
+        maxPendingDocs = std::max(maxPendingDocs, status.getPendingCompactionDocs());
+        ASSERT_LESS(++commits, 100u);
+        status = f.getStatus();
+    }
+    AttributeStatus afterStatus = f.getStatus("after");
+    EXPECT_LESS(0u, maxPendingDocs);
+    EXPECT_LESS(2u, commits); // 3000 docs, 500 docs per commit
+    EXPECT_LESS(afterStatus.getUsed(), beforeStatus.getUsed());
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,232 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/searchlib/attribute/attributefactory.h>
+#include <vespa/searchlib/attribute/compressed_posting_list.h>
+#include <vespa/searchlib/attribute/integerbase.h>
+#include <vespa/searchlib/common/bitvector.h>
+#include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <vespa/searchlib/query/queryterm.h>
+#include <vespa/searchlib/queryeval/searchiterator.h>
+#include <vespa/searchcommon/attribute/search_context_params.h>
+#include <algorithm>
+
+using namespace search;
+using namespace search::attribute;
+
+using DocIds = std::vector<uint32_t>;
+
+DocIds
+makeDocIds(uint32_t count, uint32_t first, uint32_t stride)
+{
+    DocIds docIds;
+    for (uint32_t i = 0; i < count; ++i) {
+        docIds.push_back(first + i * stride);
+    }
+    return docIds;
+}
+
+DocIds
+decode(const CompressedPostingList &list)
+{
+    DocIds docIds;
+    list.foreach_key([&docIds](uint32_t docId) { docIds.push_back(docId); });
+    return docIds;
+}
+
+DocIds
+iterate(const CompressedPostingList &list)
+{
+    DocIds docIds;
+    for (CompressedPostingListIterator itr(list); itr.valid(); ++itr) {
+        docIds.push_back(itr.getKey());
+    }
+    return docIds;
+}
+
+void
+assertRoundTrip(const DocIds &docIds)
+{
+    CompressedPostingList list(docIds);
+    EXPECT_EQUAL(docIds.size(), list.size());
+    EXPECT_EQUAL((docIds.size() + 127) / 128, list.numBlocks());
+    EXPECT_TRUE(docIds == decode(list));
+    EXPECT_TRUE(docIds == iterate(list));
+}
+
+TEST("require that document ids survive compression")
+{
+    TEST_DO(assertRoundTrip({0}));
+    TEST_DO(assertRoundTrip({0, 1, 2, 3}));
+    TEST_DO(assertRoundTrip({7, 4000000000u}));
+    TEST_DO(assertRoundTrip({1, 2, 4294967295u}));
+    TEST_DO(assertRoundTrip(makeDocIds(128, 1, 1)));
+    TEST_DO(assertRoundTrip(makeDocIds(129, 5, 3)));
+    TEST_DO(assertRoundTrip(makeDocIds(1000, 3, 1000)));
+    DocIds mixed;
+    uint32_t docId = 0;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        docId += 1 + ((i * 7919) % 97) * ((i % 300 == 0) ? 100000 : 1);
+        mixed.push_back(docId);
+    }
+    TEST_DO(assertRoundTrip(mixed));
+}
+
+TEST("require that dense lists use few bits per document")
+{
+    CompressedPostingList dense(makeDocIds(100000, 1, 1));
+    EXPECT_EQUAL(0u, dense.getSkipEntry(1)._bitWidth);
+    CompressedPostingList sparse(makeDocIds(100000, 1, 10));
+    EXPECT_EQUAL(4u, sparse.getSkipEntry(1)._bitWidth);
+    EXPECT_LESS(sparse.extraByteSize(), 100000u * sizeof(uint32_t) / 6);
+}
+
+TEST("require that iterator seeks to first document id not below target")
+{
+    DocIds docIds = makeDocIds(1000, 10, 7);
+    CompressedPostingList list(docIds);
+    for (uint32_t target : {0u, 10u, 11u, 900u, 903u, 904u, 5000u, 7000u, 7003u, 7004u}) {
+        auto exp = std::lower_bound(docIds.begin(), docIds.end(), target);
+        CompressedPostingListIterator itr(list);
+        itr.lower_bound(target);
+        EXPECT_EQUAL(exp != docIds.end(), itr.valid());
+        if (itr.valid()) {
+            EXPECT_EQUAL(*exp, itr.getKey());
+        }
+    }
+    CompressedPostingListIterator itr(list);
+    uint32_t target = 0;
+    for (auto exp = docIds.begin(); exp != docIds.end(); exp = std::lower_bound(docIds.begin(), docIds.end(), target)) {
+        itr.linearSeek(target);
+        ASSERT_TRUE(itr.valid());
+        EXPECT_EQUAL(*exp, itr.getKey());
+        target = itr.getKey() + 1 + (target % 1500);
+    }
+    itr.linearSeek(target);
+    EXPECT_FALSE(itr.valid());
+    itr.lower_bound(10);
+    EXPECT_EQUAL(10u, itr.getKey());
+}
+
+class AttributeFixture {
+public:
+    AttributeVector::SP attr;
+    IntegerAttribute &intAttr;
+
+    AttributeFixture(bool compressed)
+        : attr(AttributeFactory::createAttribute("a", Config(BasicType::INT32).setFastSearch(true).setCompressedPostingLists(compressed))),
+          intAttr(dynamic_cast<IntegerAttribute &>(*attr))
+    {
+        attr->addReservedDoc();
+        attr->addDocs(10000);
+        for (uint32_t docId = 1; docId < 10000; ++docId) {
+            intAttr.update(docId, (docId < 9000) ? (docId % 10) : docId);
+        }
+        attr->commit(true);
+    }
+    uint32_t compressedLists() const { return attr->getStatus().getCompressedPostingLists(); }
+    uint64_t usedBytes() {
+        attr->commit(true); // Let nodes replaced by compressed posting lists become dead
+        return attr->getStatus().getUsed() - attr->getStatus().getDead();
+    }
+    SearchContextParams params() const { return SearchContextParams(); }
+    std::unique_ptr<AttributeVector::SearchContext> searchContext(const vespalib::string &term) {
+        return attr->getSearch(std::make_unique<QueryTermSimple>(term, QueryTermSimple::WORD), params());
+    }
+    DocIds search(const vespalib::string &term) {
+        auto ctx = searchContext(term);
+        fef::TermFieldMatchData md;
+        ctx->fetchPostings(true);
+        auto itr = ctx->createIterator(&md, true);
+        itr->initFullRange();
+        DocIds hits;
+        for (itr->seek(1); !itr->isAtEnd(); itr->seek(itr->getDocId() + 1)) {
+            itr->unpack(itr->getDocId());
+            EXPECT_EQUAL(1, md.begin()->getElementWeight());
+            hits.push_back(itr->getDocId());
+        }
+        return hits;
+    }
+    void update(uint32_t docId, int32_t value) {
+        intAttr.update(docId, value);
+        attr->commit();
+    }
+};
+
+DocIds
+expectedHits(uint32_t value)
+{
+    return (value == 0) ? makeDocIds(899, 10, 10) : makeDocIds(900, value, 10);
+}
+
+TEST_F("require that large posting lists are compressed on commit and still searchable", AttributeFixture(true))
+{
+    EXPECT_EQUAL(10u, f.compressedLists());
+    EXPECT_TRUE(expectedHits(3) == f.search("3"));
+    EXPECT_TRUE(expectedHits(0) == f.search("0"));
+    EXPECT_TRUE(DocIds({9500}) == f.search("9500"));
+    EXPECT_TRUE(DocIds() == f.search("10"));
+}
+
+TEST_F("require that compressed posting lists are changed back to btrees when updated", AttributeFixture(true))
+{
+    f.update(11, 3);
+    f.update(13, 4);
+    EXPECT_EQUAL(7u, f.compressedLists());
+    DocIds exp = expectedHits(3);
+    exp.erase(std::find(exp.begin(), exp.end(), 13));
+    exp.insert(exp.begin() + 1, 11);
+    EXPECT_TRUE(exp == f.search("3"));
+    EXPECT_EQUAL(899u, f.search("1").size());
+    EXPECT_EQUAL(901u, f.search("4").size());
+}
+
+TEST_F("require that posting lists updated since last compression pass are left as btrees", AttributeFixture(true))
+{
+    f.update(11, 3);
+    EXPECT_EQUAL(8u, f.compressedLists());
+    for (uint32_t docId = 9000; docId < 9600; ++docId) {
+        f.update(docId, docId + 10000);
+        if (docId == 9300) {
+            f.update(21, 3);
+        }
+    }
+    EXPECT_EQUAL(8u, f.compressedLists());
+    for (uint32_t docId = 9000; docId < 9600; ++docId) {
+        f.update(docId, docId + 20000);
+    }
+    EXPECT_EQUAL(10u, f.compressedLists());
+    DocIds exp = expectedHits(3);
+    exp.insert(exp.begin() + 1, 11);
+    exp.insert(exp.begin() + 3, 21);
+    EXPECT_TRUE(exp == f.search("3"));
+    EXPECT_EQUAL(898u, f.search("1").size());
+}
+
+TEST_F("require that compressed posting lists use less memory", AttributeFixture(true))
+{
+    AttributeFixture uncompressed(false);
+    EXPECT_EQUAL(0u, uncompressed.compressedLists());
+    EXPECT_LESS(f.usedBytes() + 20000, uncompressed.usedBytes());
+}
+
+TEST_F("require that compressed posting list iterator supports and_hits_into", AttributeFixture(true))
+{
+    auto ctx = f.searchContext("5");
+    fef::TermFieldMatchData md;
+    ctx->fetchPostings(true);
+    auto itr = ctx->createIterator(&md, true);
+    itr->initRange(100, 10000);
+    auto bv = BitVector::create(100, 10000);
+    bv->setInterval(100, 10000);
+    bv->clearBit(505);
+    itr->and_hits_into(*bv, 100);
+    EXPECT_EQUAL(889u, bv->countTrueBits());
+    EXPECT_TRUE(bv->testBit(105));
+    EXPECT_FALSE(bv->testBit(106));
+    EXPECT_FALSE(bv->testBit(505));
+    EXPECT_TRUE(bv->testBit(8995));
+    EXPECT_FALSE(bv->testBit(9500));
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
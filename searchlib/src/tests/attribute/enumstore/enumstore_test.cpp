@@ -63,6 +63,8 @@ private:
     void testHoldListAndGeneration();
     void testMemoryUsage();
     void requireThatAddressSpaceUsageIsReported();
+    void requireThatHashIndexFollowsDictionary();
+    void requireThatHashIndexRebuildKeepsOldEntriesVisible();
     void testBufferLimit();
 
     // helper methods
@@ -260,6 +262,11 @@ EnumStoreTest::testFloatEnumStore(EnumStoreType & es)
         EXPECT_TRUE(es.findIndex(a[i], idx));
         EXPECT_TRUE(!es.findIndex(b[i], idx));
     }
+
+    es.addEnum(-0.0, idx);
+    EnumIndex zeroIdx;
+    EXPECT_TRUE(es.findIndex(0.0, zeroIdx));
+    EXPECT_TRUE(idx == zeroIdx);
 }
 
 void
@@ -273,6 +280,14 @@ EnumStoreTest::testFloatEnumStore()
         DoubleEnumStore des(1000, false);
         testFloatEnumStore<DoubleEnumStore, double>(des);
     }
+    {
+        FloatEnumStore fes(1000, false, true);
+        testFloatEnumStore<FloatEnumStore, float>(fes);
+    }
+    {
+        DoubleEnumStore des(1000, false, true);
+        testFloatEnumStore<DoubleEnumStore, double>(des);
+    }
 }
 
 void
@@ -801,6 +816,91 @@ EnumStoreTest::requireThatAddressSpaceUsageIsReported()
     EXPECT_EQUAL(AddressSpace(48, 48, ADDRESS_LIMIT), store.getAddressSpaceUsage());
 }
 
+void
+EnumStoreTest::requireThatHashIndexFollowsDictionary()
+{
+    const uint32_t num = 1000;
+    NumericEnumStore store(num * 16, false, true);
+    EXPECT_TRUE(store.hasHashIndex());
+    std::vector<NumericEnumStore::Index> indices;
+    for (uint32_t i = 0; i < num; ++i) {
+        indices.push_back(addEnum(store, i * 7));
+    }
+    store.freezeTree();
+    EnumIndex idx;
+    for (uint32_t i = 0; i < num; ++i) {
+        EXPECT_TRUE(store.findIndex(i * 7, idx));
+        EXPECT_TRUE(idx == indices[i]);
+        EnumStoreBase::EnumHandle e;
+        EXPECT_TRUE(store.findEnum(i * 7, e));
+        EXPECT_EQUAL(indices[i].ref(), e);
+    }
+    EXPECT_TRUE(!store.findIndex(3, idx));
+
+    // remove every other value
+    for (uint32_t i = 0; i < num; i += 2) {
+        store.decRefCount(indices[i]);
+    }
+    store.freeUnusedEnums(false);
+    EXPECT_EQUAL(num / 2, store.getNumUniques());
+    for (uint32_t i = 0; i < num; ++i) {
+        EXPECT_EQUAL(i % 2 != 0, store.findIndex(i * 7, idx));
+    }
+
+    // compaction moves all entries, hash index must follow
+    EnumStoreBase::EnumIndexMap old2New;
+    EXPECT_TRUE(store.performCompaction(16, old2New));
+    for (uint32_t i = 1; i < num; i += 2) {
+        EXPECT_TRUE(store.findIndex(i * 7, idx));
+        EXPECT_TRUE(idx == old2New[indices[i]]);
+        EXPECT_EQUAL(i * 7, store.getValue(idx));
+    }
+    store.transferHoldLists(0);
+    MemoryUsage usage = store.getTreeMemoryUsage();
+    EXPECT_LESS_EQUAL(1024 * sizeof(uint64_t), usage.allocatedBytesOnHold());
+    store.trimHoldLists(1);
+
+    // values removed earlier can be added back
+    NumericEnumStore::Index newIdx = addEnum(store, 0);
+    EXPECT_TRUE(store.findIndex(0, idx));
+    EXPECT_TRUE(idx == newIdx);
+    EXPECT_EQUAL(num / 2 + 1, store.getNumUniques());
+}
+
+void
+EnumStoreTest::requireThatHashIndexRebuildKeepsOldEntriesVisible()
+{
+    const uint32_t num = 100;
+    using datastore::EntryRef;
+    EnumStoreHashIndex index;
+    for (uint32_t i = 1; i <= num; ++i) {
+        index.insert(i, EntryRef(i));
+    }
+    auto lookup = [&index](uint32_t hash, uint32_t wanted) {
+                      return index.find(hash, [wanted](EntryRef ref) { return ref.ref() == wanted; }).ref();
+                  };
+    uint32_t added = 0;
+    index.rebuild(num, [&](auto add) {
+        for (uint32_t i = 1; i <= num; ++i) {
+            add(i, EntryRef(i + num));
+            ++added;
+            // old entries stay visible until the new table is published
+            EXPECT_EQUAL(i, lookup(i, i));
+            EXPECT_EQUAL(0u, lookup(i, i + num));
+        }
+    });
+    EXPECT_EQUAL(num, added);
+    EXPECT_EQUAL(num, index.size());
+    for (uint32_t i = 1; i <= num; ++i) {
+        EXPECT_EQUAL(0u, lookup(i, i));
+        EXPECT_EQUAL(i + num, lookup(i, i + num));
+    }
+    index.transferHoldLists(0);
+    EXPECT_LESS(0u, index.getMemoryUsage().allocatedBytesOnHold());
+    index.trimHoldLists(1);
+    EXPECT_EQUAL(0u, index.getMemoryUsage().allocatedBytesOnHold());
+}
+
 size_t
 digits(size_t num)
 {
@@ -923,6 +1023,8 @@ EnumStoreTest::Main()
     testHoldListAndGeneration();
     testMemoryUsage();
     TEST_DO(requireThatAddressSpaceUsageIsReported());
+    TEST_DO(requireThatHashIndexFollowsDictionary());
+    TEST_DO(requireThatHashIndexRebuildKeepsOldEntriesVisible());
     if (_argc > 1) {
         testBufferLimit(); // large test with 8 GB buffer
     }
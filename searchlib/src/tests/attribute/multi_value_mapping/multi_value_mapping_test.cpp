@@ -137,6 +137,15 @@ public:
         _attr.commit();
         _attr.incGeneration();
     }
+    void startCompactWorst() { _mvMapping.startCompactWorst(true, false); }
+    void continueCompact(uint32_t maxDocs) {
+        _mvMapping.continueCompact(maxDocs);
+        _attr.commit();
+        _attr.incGeneration();
+    }
+    bool compactionInProgress() const { return _mvMapping.compactionInProgress(); }
+    uint32_t getPendingCompactionDocs() const { return _mvMapping.getPendingCompactionDocs(); }
+    uint64_t getCompactions() const { return _mvMapping.getCompactions(); }
 };
 
 class IntFixture : public Fixture<int>
@@ -329,4 +338,38 @@ TEST_F("Test that compaction works", IntFixture(3, 64, 512, 129))
     EXPECT_LESS(bufferCountAfter, bufferCountBefore);
 }
 
+TEST_F("Test that compaction can be spread over several commits", IntFixture(3, 64, 512, 129))
+{
+    uint32_t addDocs = 10;
+    uint32_t bufferCountBefore = 0;
+    do {
+        f.addRandomDocs(addDocs);
+        addDocs *= 2;
+        bufferCountBefore = f.countBuffers();
+    } while (bufferCountBefore < 10);
+    uint32_t docIdLimit = f.size();
+    for (uint32_t docId = 0; docId < docIdLimit; docId += 2) {
+        f.clearDoc(docId);
+    }
+    for (uint32_t compactIter = 0; compactIter < 10; ++compactIter) {
+        f.startCompactWorst();
+        EXPECT_TRUE(f.compactionInProgress());
+        EXPECT_EQUAL(f.size(), f.getPendingCompactionDocs());
+        uint32_t expCommits = (f.size() + 499) / 500;
+        uint32_t commits = 0;
+        while (f.compactionInProgress()) {
+            f.continueCompact(500);
+            ++commits;
+            // Changes while compacting must neither be lost nor moved back
+            f.clearDoc(commits * 3);
+            f.addRandomDoc();
+            TEST_DO(f.checkRefMapping());
+        }
+        EXPECT_EQUAL(expCommits, commits);
+        EXPECT_EQUAL(0u, f.getPendingCompactionDocs());
+        EXPECT_EQUAL(compactIter + 1, f.getCompactions());
+    }
+    EXPECT_LESS(f.countBuffers(), bufferCountBefore);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,204 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/searchlib/attribute/attributefactory.h>
+#include <vespa/searchlib/attribute/enumcomparator.h>
+#include <vespa/searchlib/attribute/integerbase.h>
+#include <vespa/searchlib/attribute/posting_bitvector_cache.h>
+#include <vespa/searchlib/attribute/ipostinglistattributebase.h>
+#include <vespa/searchlib/common/bitvector.h>
+#include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <vespa/searchlib/query/queryterm.h>
+#include <vespa/searchlib/queryeval/searchiterator.h>
+#include <vespa/searchcommon/attribute/search_context_params.h>
+
+using namespace search;
+using namespace search::attribute;
+
+using BitVectorSP = PostingBitVectorCache::BitVectorSP;
+using EntryRef = PostingBitVectorCache::EntryRef;
+using NumericEnumStore = EnumStoreT<NumericEntryType<int32_t>>;
+using Comparator = EnumStoreComparatorT<NumericEntryType<int32_t>>;
+
+BitVectorSP
+makeBitVector(uint32_t size)
+{
+    return BitVectorSP(BitVector::create(size).release());
+}
+
+struct Fixture {
+    NumericEnumStore       store;
+    Comparator             cmp;
+    std::vector<EntryRef>  refs; // for values 10, 20, 30, 40, 50
+    PostingBitVectorCache  cache;
+
+    Fixture(size_t maxBytes = 1024 * 1024)
+        : store(1024, false),
+          cmp(store),
+          refs(),
+          cache(maxBytes)
+    {
+        for (int32_t value = 10; value <= 50; value += 10) {
+            EnumStoreBase::Index idx;
+            store.addEnum(value, idx);
+            refs.push_back(idx);
+        }
+    }
+    EntryRef ref(int32_t value) const { return refs[value / 10 - 1]; }
+    void insert(const vespalib::string &key, EntryRef lowBound, EntryRef highBound, uint32_t generation = 1) {
+        cache.insert(key, makeBitVector(100), 100, lowBound, highBound, generation);
+    }
+    bool has(const vespalib::string &key) { return static_cast<bool>(cache.find(key, 10, 100)); }
+    void invalidate(std::vector<EntryRef> changes, uint32_t generation = 2) {
+        cache.invalidate(changes, cmp, generation);
+    }
+};
+
+TEST_F("require that bitvectors can be inserted and found", Fixture)
+{
+    BitVectorSP bv = makeBitVector(100);
+    f.cache.insert("foo", bv, 100, f.ref(10), f.ref(40), 3);
+    EXPECT_EQUAL(1u, f.cache.size());
+    EXPECT_EQUAL(bv.get(), f.cache.find("foo", 3, 100).get());
+    EXPECT_EQUAL(bv.get(), f.cache.find("foo", 4, 200).get());
+    EXPECT_TRUE(f.cache.find("foo", 2, 100).get() == nullptr);
+    EXPECT_TRUE(f.cache.find("foo", 3, 99).get() == nullptr);
+    EXPECT_TRUE(f.cache.find("bar", 3, 100).get() == nullptr);
+    CacheStats stats = f.cache.getStats();
+    EXPECT_EQUAL(2u, stats.hits);
+    EXPECT_EQUAL(3u, stats.misses);
+    EXPECT_EQUAL(1u, stats.elements);
+    EXPECT_LESS(bv->sizeBytes(), stats.memory_used);
+}
+
+TEST_F("require that only entries covering changed values are invalidated", Fixture)
+{
+    f.insert("low", EntryRef(), f.ref(20));
+    f.insert("mid", f.ref(20), f.ref(40));
+    f.insert("high", f.ref(40), EntryRef());
+    f.invalidate({f.ref(30)});
+    EXPECT_TRUE(f.has("low"));
+    EXPECT_FALSE(f.has("mid"));
+    EXPECT_TRUE(f.has("high"));
+    f.invalidate({f.ref(10)});
+    EXPECT_FALSE(f.has("low"));
+    EXPECT_TRUE(f.has("high"));
+    f.invalidate({f.ref(40), f.ref(50)});
+    EXPECT_FALSE(f.has("high"));
+    EXPECT_EQUAL(3u, f.cache.getStats().invalidations);
+    EXPECT_EQUAL(0u, f.cache.size());
+}
+
+TEST_F("require that changes outside bounding range keep entry", Fixture)
+{
+    f.insert("mid", f.ref(10), f.ref(30));
+    f.invalidate({});
+    f.invalidate({f.ref(40), f.ref(50)});
+    EXPECT_TRUE(f.has("mid"));
+    f.invalidate({f.ref(20), f.ref(50)});
+    EXPECT_FALSE(f.has("mid"));
+}
+
+TEST_F("require that readers started before invalidation can not insert", Fixture)
+{
+    f.invalidate({f.ref(50)}, 5);
+    f.insert("stale", f.ref(10), f.ref(30), 4);
+    EXPECT_EQUAL(0u, f.cache.size());
+    f.insert("fresh", f.ref(10), f.ref(30), 5);
+    EXPECT_EQUAL(1u, f.cache.size());
+    f.cache.clear(6);
+    EXPECT_EQUAL(0u, f.cache.size());
+    f.insert("stale", f.ref(10), f.ref(30), 5);
+    EXPECT_EQUAL(0u, f.cache.size());
+}
+
+TEST_F("require that memory usage is bounded and frequently used terms are admitted", Fixture(25000))
+{
+    for (const char *key : {"a", "b", "c"}) {
+        EXPECT_FALSE(f.has(key));
+        f.cache.insert(key, makeBitVector(80000), 100, EntryRef(), EntryRef(), 1);
+    }
+    EXPECT_TRUE(f.has("b"));
+    EXPECT_TRUE(f.has("a"));
+    EXPECT_FALSE(f.has("c"));
+    // "c" has now been looked up more often than "b", the least recently used entry
+    EXPECT_FALSE(f.has("c"));
+    f.cache.insert("c", makeBitVector(80000), 100, EntryRef(), EntryRef(), 1);
+    EXPECT_TRUE(f.has("a"));
+    EXPECT_FALSE(f.has("b"));
+    EXPECT_TRUE(f.has("c"));
+    EXPECT_LESS_EQUAL(f.cache.getStats().memory_used, 25000u);
+    f.cache.insert("huge", makeBitVector(800000), 100, EntryRef(), EntryRef(), 1);
+    EXPECT_FALSE(f.has("huge"));
+}
+
+class AttributeFixture {
+public:
+    AttributeVector::SP attr;
+    IntegerAttribute &intAttr;
+
+    AttributeFixture()
+        : attr(AttributeFactory::createAttribute("a", Config(BasicType::INT32).setFastSearch(true).setBitVectorCacheSize(1024 * 1024))),
+          intAttr(dynamic_cast<IntegerAttribute &>(*attr))
+    {
+        attr->addReservedDoc();
+        attr->addDocs(1000);
+        for (uint32_t docId = 1; docId < 1000; ++docId) {
+            intAttr.update(docId, docId % 10);
+        }
+        attr->commit();
+    }
+    CacheStats stats() const {
+        return attr->getIPostingListAttributeBase()->getBitVectorCacheStats();
+    }
+    uint32_t search(const vespalib::string &term) {
+        auto ctx = attr->getSearch(std::make_unique<QueryTermSimple>(term, QueryTermSimple::WORD), SearchContextParams());
+        fef::TermFieldMatchData md;
+        ctx->fetchPostings(true);
+        auto itr = ctx->createIterator(&md, true);
+        itr->initFullRange();
+        uint32_t hits = 0;
+        for (itr->seek(1); !itr->isAtEnd(); itr->seek(itr->getDocId() + 1)) {
+            ++hits;
+        }
+        return hits;
+    }
+    void update(uint32_t docId, int32_t value) {
+        intAttr.update(docId, value);
+        attr->commit();
+    }
+};
+
+TEST_F("require that range search results are cached and invalidated by attribute commits", AttributeFixture)
+{
+    EXPECT_EQUAL(400u, f.search("[2;5]"));
+    EXPECT_EQUAL(400u, f.search("[2;5]"));
+    EXPECT_EQUAL(1u, f.stats().hits);
+    EXPECT_EQUAL(1u, f.stats().elements);
+    f.update(10, 9);  // 0 -> 9, outside range
+    EXPECT_EQUAL(400u, f.search("[2;5]"));
+    EXPECT_EQUAL(2u, f.stats().hits);
+    f.update(11, 3);  // 1 -> 3, into range
+    EXPECT_EQUAL(401u, f.search("[2;5]"));
+    EXPECT_EQUAL(2u, f.stats().hits);
+    EXPECT_EQUAL(1u, f.stats().invalidations);
+    EXPECT_EQUAL(401u, f.search("[2;5]"));
+    EXPECT_EQUAL(3u, f.stats().hits);
+}
+
+TEST_F("require that new values in range invalidate cached result", AttributeFixture)
+{
+    for (uint32_t docId = 1; docId < 100; ++docId) {
+        f.intAttr.update(docId, 100 + (docId % 2) * 100);
+    }
+    f.attr->commit();
+    EXPECT_EQUAL(99u, f.search("[50;500]"));
+    EXPECT_EQUAL(1u, f.stats().elements);
+    f.update(150, 300);
+    EXPECT_EQUAL(100u, f.search("[50;500]"));
+    EXPECT_EQUAL(0u, f.stats().hits);
+    EXPECT_EQUAL(100u, f.search("[50;500]"));
+    EXPECT_EQUAL(1u, f.stats().hits);
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
@@ -170,6 +170,7 @@ private:
     void testStringFold();
     void testDupValuesInIntArray();
     void testDupValuesInStringArray();
+    void testPrintCompressedPostingListContent();
 public:
     int Main() override;
 };
@@ -1127,6 +1128,27 @@ PostingListAttributeTest::testDupValuesInStringArray()
     EXPECT_TRUE(assertSearch("3[w=1],4[w=2]", sa, "bar"));
 }
 
+void
+PostingListAttributeTest::testPrintCompressedPostingListContent()
+{
+    Config cfg(Config(BasicType::INT32, CollectionType::SINGLE));
+    cfg.setFastSearch(true);
+    cfg.setCompressedPostingLists(true);
+    AttributePtr ptr = AttributeFactory::createAttribute("aint32_4", cfg);
+    addDocs(ptr, 2000);
+    Int32PostingListAttribute &vec = static_cast<Int32PostingListAttribute &>(*ptr);
+    for (uint32_t doc = 1; doc < 2000; ++doc) {
+        ASSERT_TRUE(vec.update(doc, 7));
+    }
+    ptr->commit();
+    EXPECT_EQUAL(1u, ptr->getStatus().getCompressedPostingLists());
+
+    vespalib::asciistream ss;
+    vec.printPostingListContent(ss);
+    vespalib::string content = ss.str();
+    EXPECT_EQUAL(0u, content.find("PostingList[7]: {1, 2, 3, "));
+    EXPECT_NOT_EQUAL(vespalib::string::npos, content.find(", 1998, 1999, }"));
+}
 
 int
 PostingListAttributeTest::Main()
@@ -1140,6 +1162,7 @@ PostingListAttributeTest::Main()
     testStringFold();
     testDupValuesInIntArray();
     testDupValuesInStringArray();
+    testPrintCompressedPostingListContent();
 
     TEST_DONE();
 }
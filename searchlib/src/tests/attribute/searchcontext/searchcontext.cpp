@@ -271,6 +271,10 @@ private:
     void requireThatSearchIteratorExposesSearchContext(const ConfigMap &cfg, ValueType value, const vespalib::string &searchTerm);
     void requireThatSearchIteratorExposesSearchContext();
 
+    template <typename AttributeType>
+    void requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch(const vespalib::string &name, const Config &cfg);
+    void requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch();
+
     // init maps with config objects
     void initIntegerConfig();
     void initFloatConfig();
@@ -1863,6 +1867,80 @@ SearchContextTest::requireThatSearchIteratorExposesSearchContext()
     requireThatSearchIteratorExposesSearchContext<StringAttribute, vespalib::string>(_stringCfg, "foo", "foo");
 }
 
+template <typename AttributeType>
+void
+SearchContextTest::requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch(const vespalib::string &name,
+                                                                          const Config &cfg)
+{
+    const uint32_t numDocs = 2000;
+    AttributePtr attr = AttributeFactory::createAttribute(name, cfg);
+    addDocs(*attr, numDocs - 1);
+    auto &concreteAttr = dynamic_cast<AttributeType &>(*attr);
+    DocSet expected;
+    for (uint32_t docId = 1; docId < numDocs; ++docId) {
+        uint32_t value = (docId < 1100) ? (docId % 13) : 0;
+        concreteAttr.update(docId, value);
+        if (value >= 3 && value <= 5) {
+            expected.insert(docId);
+        }
+    }
+    attr->commit(true);
+    SearchContextPtr sc = getSearch(*attr, "[3;5]");
+    sc->fetchPostings(true);
+    TermFieldMatchData md;
+    SearchBasePtr sb = sc->createIterator(&md, true);
+    EXPECT_TRUE(sb->is_strict() == vespalib::Trinary::True);
+
+    DocSet actual;
+    sb->initRange(1, numDocs);
+    for (sb->seek(1u); !sb->isAtEnd(); sb->seek(sb->getDocId() + 1)) {
+        sb->unpack(sb->getDocId());
+        EXPECT_EQUAL(sb->getDocId(), md.getDocId());
+        actual.insert(sb->getDocId());
+    }
+    EXPECT_TRUE(expected == actual);
+    sb->initRange(1, numDocs);
+    EXPECT_FALSE(sb->seek(1090));
+    EXPECT_EQUAL(1095u, sb->getDocId());
+    EXPECT_TRUE(sb->seek(1096));
+    EXPECT_FALSE(sb->seek(1098));
+    EXPECT_TRUE(sb->isAtEnd());
+
+    sb->initRange(1, numDocs);
+    BitVector::UP hits = sb->get_hits(1);
+    EXPECT_EQUAL(expected.size(), hits->countTrueBits());
+    for (uint32_t docId : expected) {
+        EXPECT_TRUE(hits->testBit(docId));
+    }
+
+    const uint32_t beginId = 100;
+    BitVector::UP andResult = BitVector::create(beginId, numDocs);
+    andResult->setInterval(beginId, numDocs);
+    sb->initRange(beginId, numDocs);
+    sb->and_hits_into(*andResult, beginId);
+    BitVector::UP orResult = BitVector::create(beginId, numDocs);
+    sb->initRange(beginId, numDocs);
+    sb->or_hits_into(*orResult, beginId);
+    size_t expectedHits = std::count_if(expected.begin(), expected.end(), [](uint32_t docId) { return docId >= beginId; });
+    EXPECT_EQUAL(expectedHits, andResult->countTrueBits());
+    EXPECT_EQUAL(expectedHits, orResult->countTrueBits());
+    for (uint32_t docId = beginId; docId < numDocs; ++docId) {
+        EXPECT_EQUAL(expected.count(docId) != 0, andResult->testBit(docId));
+        EXPECT_EQUAL(expected.count(docId) != 0, orResult->testBit(docId));
+    }
+}
+
+void
+SearchContextTest::requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch()
+{
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<IntegerAttribute>("s-int8-scan", Config(BasicType::INT8)));
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<IntegerAttribute>("s-int16-scan", Config(BasicType::INT16)));
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<IntegerAttribute>("s-int32-scan", Config(BasicType::INT32)));
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<IntegerAttribute>("s-int64-scan", Config(BasicType::INT64)));
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<FloatingPointAttribute>("s-float-scan", Config(BasicType::FLOAT)));
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch<FloatingPointAttribute>("s-double-scan", Config(BasicType::DOUBLE)));
+}
+
 void
 SearchContextTest::initIntegerConfig()
 {
@@ -1994,6 +2072,7 @@ SearchContextTest::Main()
     TEST_DO(requireThatFlagAttributeHandlesTheByteRange());
     TEST_DO(requireThatOutOfBoundsSearchTermGivesZeroHits());
     TEST_DO(requireThatSearchIteratorExposesSearchContext());
+    TEST_DO(requireThatRangeScanGivesSameHitsAsDocumentAtATimeSearch());
 
     TEST_DONE();
 }
@@ -56,6 +56,7 @@ namespace fieldwriter {
 
 uint32_t minSkipDocs = 64;
 uint32_t minChunkDocs = 262144;
+bool blockDocIds = false;
 
 vespalib::string dirprefix = "index/";
 
@@ -177,7 +178,7 @@ WrappedFieldWriter::WrappedFieldWriter(const vespalib::string &namepref,
       _indexId()
 {
     schema::CollectionType ct(CollectionType::SINGLE);
-    _schema.addIndexField(Schema::IndexField("field1", DataType::STRING, ct));
+    _schema.addIndexField(Schema::IndexField("field1", DataType::STRING, ct).setBlockDocIds(blockDocIds));
     _indexId = _schema.getIndexFieldId("field1");
 }
 
@@ -625,6 +626,57 @@ testFieldWriterVariants(FakeWordSet &wordSet,
                 true, false);
     randReadField(wordSet, "newchunk4", true, verbose);
     randReadField(wordSet, "newchunk5", false, verbose);
+    enableSkip();
+    blockDocIds = true;
+    writeField(wordSet, docIdLimit, "newblock4", true);
+    readField(wordSet, docIdLimit, "newblock4", true, verbose);
+    writeField(wordSet, docIdLimit, "newblock5", false);
+    readField(wordSet, docIdLimit, "newblock5", false, verbose);
+    randReadField(wordSet, "newblock4", true, verbose);
+    randReadField(wordSet, "newblock5", false, verbose);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock4", "newblock4x",
+                false, true);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock4", "newblock4xx",
+                true, true);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock5", "newblock5x",
+                false, false);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock5", "newblock5xx",
+                true, false);
+    // Convert between plain and block docids during fusion
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newskip4", "newblock4y",
+                false, true);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newskip5", "newblock5y",
+                false, false);
+    blockDocIds = false;
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock4", "newskip4y",
+                false, true);
+    fusionField(wordSet.getNumWords(),
+                docIdLimit,
+                "newblock5", "newskip5y",
+                false, false);
+    enableSkipChunks();
+    blockDocIds = true;
+    writeField(wordSet, docIdLimit, "newblockchunk4", true);
+    readField(wordSet, docIdLimit, "newblockchunk4", true, verbose);
+    writeField(wordSet, docIdLimit, "newblockchunk5", false);
+    readField(wordSet, docIdLimit, "newblockchunk5", false, verbose);
+    randReadField(wordSet, "newblockchunk4", true, verbose);
+    randReadField(wordSet, "newblockchunk5", false, verbose);
+    blockDocIds = false;
 }
 
 
@@ -653,6 +705,15 @@ testFieldWriterVariantsWithHighLids(FakeWordSet &wordSet, uint32_t docIdLimit,
     readField(wordSet, docIdLimit, "hlidchunk5", false, verbose);
     randReadField(wordSet, "hlidchunk4", true, verbose);
     randReadField(wordSet, "hlidchunk5", false, verbose);
+    enableSkip();
+    blockDocIds = true;
+    writeField(wordSet, docIdLimit, "hlidblock4", true);
+    readField(wordSet, docIdLimit, "hlidblock4", true, verbose);
+    writeField(wordSet, docIdLimit, "hlidblock5", false);
+    readField(wordSet, docIdLimit, "hlidblock5", false, verbose);
+    randReadField(wordSet, "hlidblock4", true, verbose);
+    randReadField(wordSet, "hlidblock5", false, verbose);
+    blockDocIds = false;
 }
 
 int
@@ -50,14 +50,22 @@ newpcntfiles5c=index/newskip[57]*dictionary.pdat
 newpcntfiles6=index/newchunk[57]*dictionary.pdat
 newpcntfiles6b=index/newchunk[57]*dictionary.pdat
 newpcntfiles6c=index/newchunk[57]*dictionary.pdat
+newpcntfiles7=index/newblock[46]*dictionary.pdat
+newpcntfiles7b=index/newblock[46]*dictionary.spdat
+newpcntfiles7c=index/newblock[46]*dictionary.ssdat
+newpcntfiles8=index/newblock[57]*dictionary.pdat
+newpcntfiles8b=index/newblock[57]*dictionary.spdat
+newpcntfiles8c=index/newblock[57]*dictionary.ssdat
 newpfiles1=index/new[46]*posocc.dat.compressed
 newpfiles2=index/newskip[46]*posocc.dat.compressed
 newpfiles3=index/newchunk[46]*posocc.dat.compressed
 newpfiles4=index/new[57]*posocc.dat.compressed
 newpfiles5=index/newskip[57]*posocc.dat.compressed
 newpfiles6=index/newchunk[57]*posocc.dat.compressed
+newpfiles7=index/newblock[46]*posocc.dat.compressed
+newpfiles8=index/newblock[57]*posocc.dat.compressed
 
-if checksame $newpcntfiles1 && checksame $newpcntfiles1b && checksame $newpcntfiles1c && checksame $newpfiles1 && checksame $newpcntfiles2 && checksame $newpcntfiles2b && checksame $newpcntfiles2c && checksame $newpfiles2 && checksame $newpcntfiles3 && checksame $newpcntfiles3b && checksame $newpcntfiles3c && checksame $newpfiles3 && checksame $newpcntfiles4 && checksame $newpcntfiles4b && checksame $newpcntfiles4c && checksame $newpfiles4 && checksame $newpcntfiles5 && checksame $newpcntfiles5b && checksame $newpcntfiles5c && checksame $newpfiles5 && checksame $newpcntfiles6 && checksame $newpcntfiles6b && checksame $newpcntfiles6c && checksame $newpfiles6
+if checksame $newpcntfiles1 && checksame $newpcntfiles1b && checksame $newpcntfiles1c && checksame $newpfiles1 && checksame $newpcntfiles2 && checksame $newpcntfiles2b && checksame $newpcntfiles2c && checksame $newpfiles2 && checksame $newpcntfiles3 && checksame $newpcntfiles3b && checksame $newpcntfiles3c && checksame $newpfiles3 && checksame $newpcntfiles4 && checksame $newpcntfiles4b && checksame $newpcntfiles4c && checksame $newpfiles4 && checksame $newpcntfiles5 && checksame $newpcntfiles5b && checksame $newpcntfiles5c && checksame $newpfiles5 && checksame $newpcntfiles6 && checksame $newpcntfiles6b && checksame $newpcntfiles6c && checksame $newpfiles6 && checksame $newpcntfiles7 && checksame $newpcntfiles7b && checksame $newpcntfiles7c && checksame $newpfiles7 && checksame $newpcntfiles8 && checksame $newpcntfiles8b && checksame $newpcntfiles8c && checksame $newpfiles8
 then
   echo SUCCESS: Files match up
   exit 0
@@ -6,6 +6,7 @@
 #include <vespa/searchlib/common/sequencedtaskexecutor.h>
 #include <vespa/searchlib/diskindex/diskindex.h>
 #include <vespa/searchlib/diskindex/fusion.h>
+#include <vespa/searchlib/diskindex/fusion_progress.h>
 #include <vespa/searchlib/diskindex/indexbuilder.h>
 #include <vespa/searchlib/diskindex/zcposoccrandread.h>
 #include <vespa/searchlib/fef/fieldpositionsiterator.h>
@@ -17,6 +18,7 @@
 #include <vespa/searchlib/memoryindex/posting_iterator.h>
 #include <vespa/searchlib/util/filekit.h>
 #include <vespa/vespalib/testkit/testapp.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP("fusion_test");
@@ -333,6 +335,8 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
     TuneFileIndexing tuneFileIndexing;
     TuneFileSearch tuneFileSearch;
     DummyFileHeaderContext fileHeaderContext;
+    vespalib::ThreadStackExecutor fusionExecutor(4, 0x10000);
+    FusionProgress fusionProgress;
     if (directio) {
         tuneFileIndexing._read.setWantDirectIO();
         tuneFileIndexing._write.setWantDirectIO();
@@ -367,7 +371,9 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
                                        sources, selector,
                                        dynamicKPosOcc,
                                        tuneFileIndexing,
-                                       fileHeaderContext)))
+                                       fileHeaderContext,
+                                       fusionExecutor,
+                                       &fusionProgress)))
             return;
     } while (0);
     do {
@@ -376,6 +382,16 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
             break;
         TEST_DO(validateDiskIndex(dw3, true, true));
     } while (0);
+    {
+        auto fields = fusionProgress.getFields();
+        ASSERT_EQUAL(4u, fields.size());
+        for (uint32_t i = 0; i < fields.size(); ++i) {
+            EXPECT_EQUAL(schema.getIndexField(i).getName(), fields[i].name);
+            EXPECT_TRUE(fields[i].state == FusionProgress::State::DONE);
+            EXPECT_LESS(0u, fields[i].numWords);
+            EXPECT_LESS(0u, fields[i].sizeOnDisk);
+        }
+    }
     do {
         std::vector<vespalib::string> sources;
         SelectorArray selector(numDocs, 0);
@@ -385,7 +401,8 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
                                        sources, selector,
                                        dynamicKPosOcc,
                                        tuneFileIndexing,
-                                       fileHeaderContext)))
+                                       fileHeaderContext,
+                                       fusionExecutor)))
             return;
     } while (0);
     do {
@@ -403,7 +420,8 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
                                        sources, selector,
                                        dynamicKPosOcc,
                                        tuneFileIndexing,
-                                       fileHeaderContext)))
+                                       fileHeaderContext,
+                                       fusionExecutor)))
             return;
     } while (0);
     do {
@@ -421,7 +439,8 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
                                        sources, selector,
                                        !dynamicKPosOcc,
                                        tuneFileIndexing,
-                                       fileHeaderContext)))
+                                       fileHeaderContext,
+                                       fusionExecutor)))
             return;
     } while (0);
     do {
@@ -439,7 +458,8 @@ Test::requireThatFusionIsWorking(const vespalib::string &prefix,
                                        sources, selector,
                                        dynamicKPosOcc,
                                        tuneFileIndexing,
-                                       fileHeaderContext)))
+                                       fileHeaderContext,
+                                       fusionExecutor)))
             return;
     } while (0);
     do {
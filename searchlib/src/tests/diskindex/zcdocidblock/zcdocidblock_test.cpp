@@ -0,0 +1,111 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/searchlib/diskindex/zcdocidblock.h>
+#include <vespa/searchlib/diskindex/zcbuf.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vector>
+
+using search::diskindex::ZcBuf;
+using search::diskindex::ZcDocIdBlock;
+
+namespace {
+
+constexpr uint32_t block_size = ZcDocIdBlock::block_size;
+
+std::vector<uint32_t>
+make_deltas(uint32_t bits, uint32_t seed)
+{
+    std::vector<uint32_t> deltas(block_size);
+    uint32_t max_delta = (bits == 32) ? ~0u : ((1u << bits) - 1);
+    uint32_t state = seed;
+    for (uint32_t i = 0; i < block_size; ++i) {
+        state = state * 1103515245u + 12345u;
+        deltas[i] = (bits == 0) ? 0 : (state & max_delta);
+    }
+    if (bits != 0) {
+        deltas[seed % block_size] = max_delta; // ensure all bits are needed
+    }
+    return deltas;
+}
+
+std::vector<uint32_t>
+make_doc_ids(uint32_t prev_doc_id, const std::vector<uint32_t> &deltas)
+{
+    std::vector<uint32_t> doc_ids;
+    for (auto delta : deltas) {
+        prev_doc_id += 1 + delta;
+        doc_ids.push_back(prev_doc_id);
+    }
+    return doc_ids;
+}
+
+}
+
+TEST("require that full blocks can be encoded and decoded for all bit widths")
+{
+    for (uint32_t bits = 0; bits <= 32; ++bits) {
+        TEST_STATE(vespalib::make_string("bits=%u", bits).c_str());
+        // Wide deltas wrap docids, which is fine when only checking the encoding
+        auto deltas = make_deltas(bits, bits + 7);
+        ZcBuf buf;
+        buf.clearReserve(4);
+        ZcDocIdBlock::encode(buf, &deltas[0]);
+        EXPECT_EQUAL(ZcDocIdBlock::encoded_size(bits), buf.size());
+        const uint8_t *valI = buf._mallocStart;
+        const uint8_t *valE = buf._valI;
+        std::vector<uint32_t> doc_ids(block_size);
+        EXPECT_EQUAL(block_size, ZcDocIdBlock::decode(valI, valE, 5, &doc_ids[0]));
+        EXPECT_EQUAL(valE, valI);
+        EXPECT_TRUE(make_doc_ids(5, deltas) == doc_ids);
+    }
+}
+
+TEST("require that consecutive blocks and tail can be decoded")
+{
+    auto deltas1 = make_deltas(3, 1);
+    auto deltas2 = make_deltas(11, 2);
+    std::vector<uint32_t> tail_deltas = { 0, 127, 128, 16383, 16384, 1000000 };
+    ZcBuf buf;
+    buf.clearReserve(4);
+    ZcDocIdBlock::encode(buf, &deltas1[0]);
+    ZcDocIdBlock::encode(buf, &deltas2[0]);
+    ZcDocIdBlock::encode_tail_marker(buf);
+    for (auto delta : tail_deltas) {
+        buf.encode(delta);
+    }
+    std::vector<uint32_t> all_deltas(deltas1);
+    all_deltas.insert(all_deltas.end(), deltas2.begin(), deltas2.end());
+    all_deltas.insert(all_deltas.end(), tail_deltas.begin(), tail_deltas.end());
+    auto exp_doc_ids = make_doc_ids(0, all_deltas);
+
+    const uint8_t *valI = buf._mallocStart;
+    const uint8_t *valE = buf._valI;
+    std::vector<uint32_t> doc_ids;
+    std::vector<uint32_t> block(block_size);
+    std::vector<uint32_t> counts;
+    uint32_t prev_doc_id = 0;
+    while (valI < valE) {
+        uint32_t num = ZcDocIdBlock::decode(valI, valE, prev_doc_id, &block[0]);
+        counts.push_back(num);
+        doc_ids.insert(doc_ids.end(), block.begin(), block.begin() + num);
+        prev_doc_id = doc_ids.back();
+    }
+    EXPECT_EQUAL(valE, valI);
+    EXPECT_TRUE(std::vector<uint32_t>({block_size, block_size, 6}) == counts);
+    EXPECT_TRUE(exp_doc_ids == doc_ids);
+}
+
+TEST("require that posting list file formats are checked")
+{
+    std::vector<vespalib::string> formats = { "Zc.4", "EG2PosOcc.3.native" };
+    EXPECT_TRUE(ZcDocIdBlock::checkFormats(formats));
+    formats.push_back(ZcDocIdBlock::getIdentifier());
+    EXPECT_TRUE(ZcDocIdBlock::checkFormats(formats));
+    formats.back() = "DocIdBlock.64";
+    EXPECT_FALSE(ZcDocIdBlock::checkFormats(formats));
+    formats.resize(1);
+    EXPECT_FALSE(ZcDocIdBlock::checkFormats(formats));
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
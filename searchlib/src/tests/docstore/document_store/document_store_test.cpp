@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/searchlib/docstore/logdocumentstore.h>
+#include <vespa/searchlib/docstore/chunk_read_cache.h>
 #include <vespa/searchlib/docstore/value.h>
 #include <vespa/searchlib/docstore/cachestats.h>
 #include <vespa/document/repo/documenttyperepo.h>
@@ -63,6 +64,25 @@ TEST_FFF("require that cached docstore lookups are counted",
     EXPECT_EQUAL(1u, f3.getCacheStats().misses);
 }
 
+TEST_FFF("require that uncached docstore lookups using chunk read cache are counted",
+         DocumentStore::Config(CompressionConfig::NONE, 0, 0),
+         NullDataStore(), DocumentStore(f1, f2))
+{
+    ChunkReadCache cache;
+    EXPECT_EQUAL(0u, f3.getCacheStats().misses);
+    EXPECT_TRUE(f3.read(1, repo, cache).get() == nullptr);
+    EXPECT_EQUAL(1u, f3.getCacheStats().misses);
+}
+
+TEST_FFF("require that uncached docstore batch lookups are counted",
+         DocumentStore::Config(CompressionConfig::NONE, 0, 0),
+         NullDataStore(), DocumentStore(f1, f2))
+{
+    std::vector<IDocumentStore::DocumentUP> docs = f3.read(IDocumentStore::LidVector({1, 2, 1}), repo);
+    EXPECT_EQUAL(3u, docs.size());
+    EXPECT_EQUAL(3u, f3.getCacheStats().misses);
+}
+
 TEST("require that DocumentStore::Config equality operator detects inequality") {
     using C = DocumentStore::Config;
     EXPECT_TRUE(C() == C());
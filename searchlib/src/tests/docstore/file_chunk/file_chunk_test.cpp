@@ -29,10 +29,18 @@ struct MyFileHeaderContext : public FileHeaderContext {
 
 struct SetLidObserver : public ISetLid {
     std::vector<uint32_t> lids;
+    LidInfoWithLidV lidInfos;
     virtual void setLid(const vespalib::LockGuard &guard, uint32_t lid, const LidInfo &lidInfo) override {
         (void) guard;
-        (void) lidInfo;
         lids.push_back(lid);
+        lidInfos.emplace_back(lidInfo, lid);
+    }
+};
+
+struct BufferCollector : public IBufferVisitor {
+    std::vector<std::pair<uint32_t, vespalib::string>> buffers;
+    void visit(uint32_t lid, vespalib::ConstBufferRef buffer) override {
+        buffers.emplace_back(lid, vespalib::string(buffer.c_str(), buffer.size()));
     }
 };
 
@@ -71,7 +79,8 @@ struct FixtureBase {
     };
 
     FixtureBase(const vespalib::string &baseName,
-                bool dirCleanup = true)
+                bool dirCleanup = true,
+                bool asyncRead = false)
         : dir(baseName),
           executor(1, 0x10000),
           serialNum(1),
@@ -82,6 +91,9 @@ struct FixtureBase {
           bucketizer()
     {
         dir.cleanup(dirCleanup);
+        if (asyncRead) {
+            tuneFile._randRead.setWantAsync();
+        }
     }
     ~FixtureBase() {}
     void assertLidMap(const std::vector<uint32_t> &expLids) {
@@ -96,8 +108,9 @@ struct ReadFixture : public FixtureBase {
     FileChunk chunk;
 
     ReadFixture(const vespalib::string &baseName,
-                 bool dirCleanup = true)
-        : FixtureBase(baseName, dirCleanup),
+                 bool dirCleanup = true,
+                 bool asyncRead = false)
+        : FixtureBase(baseName, dirCleanup, asyncRead),
           chunk(FileChunk::FileId(0),
                 FileChunk::NameId(1234),
                 baseName,
@@ -212,6 +225,30 @@ TEST("require that entries with lid >= docIdLimit are skipped in updateLidMap()"
     }
 }
 
+TEST("require that lids spread over many chunks can be read with async reads")
+{
+    {
+        WriteFixture f("tmp", 0, false);
+        for (uint32_t lid = 1; lid <= 100; ++lid) {
+            f.append(lid);
+            if ((lid % 2) == 0) {
+                f.flush();
+            }
+        }
+    }
+    ReadFixture f("tmp", true, true);
+    f.updateLidMap(1000);
+    f.chunk.enableRead(&f.executor);
+    EXPECT_EQUAL(50u, f.chunk.getNumChunks());
+    BufferCollector collector;
+    f.chunk.read(f.lidObserver.lidInfos.begin(), f.lidObserver.lidInfos.size(), collector);
+    ASSERT_EQUAL(100u, collector.buffers.size());
+    for (uint32_t i = 0; i < collector.buffers.size(); ++i) {
+        EXPECT_EQUAL(i + 1, collector.buffers[i].first);
+        EXPECT_EQUAL(getData(i + 1), collector.buffers[i].second);
+    }
+}
+
 using vespalib::compression::CompressionConfig;
 
 TEST("require that operator == detects inequality") {
@@ -5,6 +5,7 @@
 #include <vespa/document/repo/documenttyperepo.h>
 #include <vespa/document/datatype/documenttype.h>
 #include <vespa/document/fieldvalue/document.h>
+#include <vespa/searchlib/docstore/chunk_read_cache.h>
 #include <vespa/searchlib/docstore/chunkformats.h>
 #include <vespa/searchlib/docstore/logdocumentstore.h>
 #include <vespa/searchlib/docstore/storebybucket.h>
@@ -440,7 +441,7 @@ makeDoc(const DocumentTypeRepo &repo, uint32_t i, bool extra_field, size_t numRe
 class VisitCacheStore {
 public:
     using UpdateStrategy=DocumentStore::Config::UpdateStrategy;
-    VisitCacheStore(UpdateStrategy strategy);
+    VisitCacheStore(UpdateStrategy strategy, size_t maxCacheBytes = 1000000);
     ~VisitCacheStore();
     IDocumentStore & getStore() { return *_datastore; }
     void write(uint32_t id) {
@@ -476,6 +477,18 @@ public:
         VerifyVisitor vv(*this, expected, allowCaching);
         _datastore->visit(lids, _repo, vv);
     }
+    void verifyBatchRead(const std::vector<uint32_t> & lids) {
+        std::vector<Document::UP> docs = _datastore->read(lids, _repo);
+        ASSERT_EQUAL(lids.size(), docs.size());
+        for (size_t i = 0; i < lids.size(); ++i) {
+            if (_inserted.find(lids[i]) != _inserted.end()) {
+                ASSERT_TRUE(docs[i]);
+                verifyDoc(*docs[i], lids[i]);
+            } else {
+                EXPECT_FALSE(docs[i]);
+            }
+        }
+    }
     void recreate();
 
 private:
@@ -519,10 +532,10 @@ VisitCacheStore::VerifyVisitor::~VerifyVisitor() {
 }
 
 
-VisitCacheStore::VisitCacheStore(UpdateStrategy strategy) :
+VisitCacheStore::VisitCacheStore(UpdateStrategy strategy, size_t maxCacheBytes) :
     _myDir("visitcache"),
     _repo(makeDocTypeRepoConfig()),
-    _config(DocumentStore::Config(CompressionConfig::LZ4, 1000000, 0)
+    _config(DocumentStore::Config(CompressionConfig::LZ4, maxCacheBytes, 0)
                     .allowVisitCaching(true).updateStrategy(strategy),
             LogDataStore::Config().setMaxFileSize(50000).setMaxBucketSpread(3.0)
                     .setFileConfig(WriteableFileChunk::Config(CompressionConfig(), 16384))),
@@ -555,6 +568,28 @@ verifyCacheStats(CacheStats cs, size_t hits, size_t misses, size_t elements, siz
     EXPECT_GREATER_EQUAL(memory_used+20,  cs.memory_used);
 }
 
+void
+verifyBatchRead(size_t maxCacheBytes) {
+    VisitCacheStore vcs(DocumentStore::Config::UpdateStrategy::INVALIDATE, maxCacheBytes);
+    for (uint32_t lid(1); lid <= 100; lid++) {
+        vcs.write(lid);
+    }
+    vcs.remove(7);
+    vcs.recreate();
+    TEST_DO(vcs.verifyBatchRead({}));
+    TEST_DO(vcs.verifyBatchRead({9, 3, 7, 101, 3, 50, 1}));
+    vcs.rewrite(50);
+    TEST_DO(vcs.verifyBatchRead({50, 100, 2, 99, 3}));
+}
+
+TEST("require that documents can be read in batch with document cache") {
+    verifyBatchRead(1000000);
+}
+
+TEST("require that documents can be read in batch without document cache") {
+    verifyBatchRead(0);
+}
+
 TEST("test the update cache strategy") {
     VisitCacheStore vcs(DocumentStore::Config::UpdateStrategy::UPDATE);
     IDocumentStore & ds = vcs.getStore();
@@ -1029,6 +1064,45 @@ LogDataStore::NameIdSet create(std::vector<size_t> list) {
     return l;
 }
 
+vespalib::string
+asString(vespalib::ConstBufferRef buf)
+{
+    return vespalib::string(buf.c_str(), buf.size());
+}
+
+TEST_F("require that reads through chunk read cache reuse decompressed chunks", Fixture)
+{
+    f.write(1).write(2).write(3);
+    f.flush();
+    f.write(4);
+    ChunkReadCache cache;
+    EXPECT_EQUAL(genData(2, 1024), asString(f.store.read(2, cache)));
+    EXPECT_EQUAL(genData(1, 1024), asString(f.store.read(1, cache)));
+    EXPECT_EQUAL(genData(3, 1024), asString(f.store.read(3, cache)));
+    EXPECT_EQUAL(1u, cache.getNumChunks());
+    EXPECT_EQUAL(1u, cache.getMisses());
+    EXPECT_EQUAL(2u, cache.getHits());
+    EXPECT_EQUAL(genData(4, 1024), asString(f.store.read(4, cache)));
+    EXPECT_EQUAL(0u, f.store.read(5, cache).size());
+    EXPECT_EQUAL(1u, cache.getNumChunks());
+    EXPECT_EQUAL(1u, cache.getMisses());
+}
+
+TEST_F("require that chunk read cache evicts oldest chunks when full", Fixture)
+{
+    f.write(1);
+    f.flush();
+    f.write(2);
+    f.flush();
+    ChunkReadCache cache(1500);
+    EXPECT_EQUAL(genData(1, 1024), asString(f.store.read(1, cache)));
+    EXPECT_EQUAL(genData(2, 1024), asString(f.store.read(2, cache)));
+    EXPECT_EQUAL(1u, cache.getNumChunks());
+    EXPECT_EQUAL(genData(1, 1024), asString(f.store.read(1, cache)));
+    EXPECT_EQUAL(3u, cache.getMisses());
+    EXPECT_EQUAL(0u, cache.getHits());
+}
+
 TEST("require that findIncompleteCompactedFiles does expected filtering") {
     EXPECT_TRUE(LogDataStore::findIncompleteCompactedFiles(create({1,3,100,200,202,204})).empty());
     LogDataStore::NameIdSet toRemove = LogDataStore::findIncompleteCompactedFiles(create({1,3,100,200,201,204}));
@@ -295,6 +295,22 @@ TEST("test stuff") {
             p.add("vespa.matching.numsearchpartitions", "50");
             EXPECT_EQUAL(matching::NumSearchPartitions::lookup(p), 50u);
         }
+        { // vespa.matching.workstealing
+            EXPECT_EQUAL(matching::WorkStealing::NAME, vespalib::string("vespa.matching.workstealing"));
+            EXPECT_EQUAL(matching::WorkStealing::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_EQUAL(matching::WorkStealing::lookup(p), false);
+            p.add("vespa.matching.workstealing", "true");
+            EXPECT_EQUAL(matching::WorkStealing::lookup(p), true);
+        }
+        { // vespa.matching.firsthitsonly
+            EXPECT_EQUAL(matching::FirstHitsOnly::NAME, vespalib::string("vespa.matching.firsthitsonly"));
+            EXPECT_EQUAL(matching::FirstHitsOnly::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_EQUAL(matching::FirstHitsOnly::lookup(p), false);
+            p.add("vespa.matching.firsthitsonly", "true");
+            EXPECT_EQUAL(matching::FirstHitsOnly::lookup(p), true);
+        }
         { // vespa.matchphase.degradation.attribute
             EXPECT_EQUAL(matchphase::DegradationAttribute::NAME, vespalib::string("vespa.matchphase.degradation.attribute"));
             EXPECT_EQUAL(matchphase::DegradationAttribute::DEFAULT_VALUE, "");
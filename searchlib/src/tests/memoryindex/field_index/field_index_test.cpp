@@ -779,9 +779,9 @@ public:
     SequencedTaskExecutor _pushThreads;
     DocumentInverter _inv;
 
-    InverterTest(const Schema& schema)
+    InverterTest(const Schema& schema, uint32_t numWordShards = 1)
         : _schema(schema),
-          _fic(_schema),
+          _fic(_schema, numWordShards),
           _b(_schema),
           _invertThreads(2),
           _pushThreads(2),
@@ -1034,6 +1034,76 @@ TEST_F(BasicInverterTest, require_that_inverter_handles_remove_via_document_remo
     EXPECT_TRUE(assertPostingList("[]", _fic.find("c", 1)));
 }
 
+class ShardedInverterTest : public InverterTest {
+public:
+    FieldIndexCollection _unshardedFic;
+    DocumentInverter _unshardedInv;
+
+    ShardedInverterTest()
+        : InverterTest(make_multi_field_schema(), 3),
+          _unshardedFic(_schema),
+          _unshardedInv(_schema, _invertThreads, _pushThreads)
+    {
+    }
+    void push() {
+        _invertThreads.sync();
+        myPushDocument(_inv, _fic);
+        myPushDocument(_unshardedInv, _unshardedFic);
+        _pushThreads.sync();
+        _inv.waitForPushDone();
+    }
+    void invert(uint32_t docId, const Document &doc) {
+        _inv.invertDocument(docId, doc);
+        _unshardedInv.invertDocument(docId, doc);
+        push();
+    }
+    void remove(uint32_t docId) {
+        _inv.removeDocument(docId);
+        _unshardedInv.removeDocument(docId);
+        push();
+    }
+    std::string dump(FieldIndexCollection &fic) {
+        MyBuilder b(_schema);
+        fic.dump(b);
+        return b.toStr();
+    }
+    uint32_t numShardsWithWords(uint32_t fieldId) const {
+        uint32_t result = 0;
+        for (uint32_t shard = 0; shard < _fic.getNumWordShards(); ++shard) {
+            if (_fic.getFieldIndex(fieldId, shard)->getNumUniqueWords() != 0) {
+                ++result;
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(ShardedInverterTest, require_that_word_shards_are_searchable_and_dumped_as_one_field)
+{
+    _b.startDocument("doc::1");
+    _b.startIndexField("f0").addStr("a").addStr("b").addStr("c").addStr("d").
+        addStr("e").addStr("f").addStr("g").addStr("h").endField();
+    _b.startIndexField("f1").addStr("a").addStr("c").endField();
+    invert(1, *_b.endDocument());
+    _b.startDocument("doc::2");
+    _b.startIndexField("f0").addStr("b").addStr("c").addStr("x").addStr("y").endField();
+    invert(2, *_b.endDocument());
+
+    EXPECT_LT(1u, numShardsWithWords(0));
+    EXPECT_EQ(_unshardedFic.getNumUniqueWords(), _fic.getNumUniqueWords());
+    EXPECT_TRUE(assertPostingList("[1]", _fic.findFrozen("a", 0)));
+    EXPECT_TRUE(assertPostingList("[1,2]", _fic.findFrozen("b", 0)));
+    EXPECT_TRUE(assertPostingList("[2]", _fic.findFrozen("y", 0)));
+    EXPECT_TRUE(assertPostingList("[1]", _fic.findFrozen("c", 1)));
+    EXPECT_EQ(dump(_unshardedFic), dump(_fic));
+
+    remove(1);
+    EXPECT_TRUE(assertPostingList("[]", _fic.findFrozen("a", 0)));
+    EXPECT_TRUE(assertPostingList("[2]", _fic.findFrozen("b", 0)));
+    EXPECT_TRUE(assertPostingList("[]", _fic.findFrozen("c", 1)));
+    EXPECT_EQ(dump(_unshardedFic), dump(_fic));
+}
+
 Schema
 make_uri_schema()
 {
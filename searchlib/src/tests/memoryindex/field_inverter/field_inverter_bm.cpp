@@ -0,0 +1,108 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/document/fieldvalue/document.h>
+#include <vespa/searchlib/index/docbuilder.h>
+#include <vespa/searchlib/memoryindex/field_inverter.h>
+#include <vespa/searchlib/memoryindex/i_ordered_field_index_inserter.h>
+#include <vespa/vespalib/testkit/testapp.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vespa/fastos/timestamp.h>
+#include <iostream>
+
+using document::Document;
+using search::index::DocBuilder;
+using search::index::DocIdAndFeatures;
+using search::index::Schema;
+using search::index::schema::DataType;
+using search::memoryindex::FieldInverter;
+using search::memoryindex::IOrderedFieldIndexInserter;
+
+namespace {
+
+double getTime() { return fastos::TimeStamp(fastos::ClockSystem::now()).sec(); }
+
+constexpr uint32_t numDocs = 10000;
+constexpr uint32_t wordsPerDoc = 50;
+constexpr uint32_t numUniqueWords = 5000;
+constexpr uint32_t docsPerPush = 100;
+constexpr uint32_t numRounds = 10;
+
+/*
+ * Inserter that only counts calls, so the benchmark measures the inverter itself.
+ */
+class CountingInserter : public IOrderedFieldIndexInserter {
+public:
+    uint64_t _calls;
+
+    CountingInserter() : _calls(0) {}
+    void setNextWord(const vespalib::stringref) override { ++_calls; }
+    void add(uint32_t, const DocIdAndFeatures &) override { ++_calls; }
+    void remove(uint32_t) override { ++_calls; }
+    void flush() override { }
+    void rewind() override { }
+};
+
+Schema
+makeSchema()
+{
+    Schema schema;
+    schema.addIndexField(Schema::IndexField("f0", DataType::STRING));
+    return schema;
+}
+
+std::vector<Document::UP>
+makeDocs(DocBuilder &b)
+{
+    std::vector<Document::UP> docs;
+    docs.reserve(docsPerPush);
+    uint32_t wordId = 0;
+    for (uint32_t docId = 1; docId <= docsPerPush; ++docId) {
+        b.startDocument(vespalib::make_string("doc::%u", docId));
+        b.startIndexField("f0");
+        for (uint32_t i = 0; i < wordsPerDoc; ++i) {
+            b.addStr(vespalib::make_string("word%u", wordId));
+            wordId = (wordId * 31 + 7) % numUniqueWords;
+        }
+        b.endField();
+        docs.push_back(b.endDocument());
+    }
+    return docs;
+}
+
+}
+
+TEST("field inverter speed test")
+{
+    Schema schema(makeSchema());
+    DocBuilder b(schema);
+    auto docs = makeDocs(b);
+    FieldInverter inverter(schema, 0);
+    CountingInserter inserter;
+    uint64_t callsPerRound = 0;
+    for (uint32_t round = 0; round < numRounds; ++round) {
+        uint64_t callsBefore = inserter._calls;
+        double before = getTime();
+        for (uint32_t pushed = 0; pushed < numDocs; pushed += docsPerPush) {
+            for (uint32_t i = 0; i < docsPerPush; ++i) {
+                inverter.invertField(i + 1, docs[i]->getValue("f0"));
+            }
+            inverter.pushDocuments(inserter);
+        }
+        double delta = getTime() - before;
+        double docsPerSec = numDocs / delta;
+        uint64_t calls = inserter._calls - callsBefore;
+        if (round == 0) {
+            callsPerRound = calls;
+        }
+        // Every round pushes the same documents, the inserter must see the same calls.
+        EXPECT_EQUAL(callsPerRound, calls);
+        std::cout << "round " << round << ": inverted " << numDocs << " docs in " <<
+            (delta * 1000.0) << " ms, " << docsPerSec << " docs/s" << std::endl;
+    }
+    EXPECT_GREATER(callsPerRound, 0u);
+}
+
+TEST_MAIN()
+{
+    TEST_RUN_ALL();
+}
@@ -65,6 +65,7 @@ public:
     void visit(WandTerm &) override { isVisited<WandTerm>() = true; }
     void visit(PredicateQuery &) override { isVisited<PredicateQuery>() = true; }
     void visit(RegExpTerm &) override { isVisited<RegExpTerm>() = true; }
+    void visit(NearestNeighborTerm &) override { isVisited<NearestNeighborTerm>() = true; }
 };
 
 template <class T>
@@ -98,6 +99,7 @@ void Test::requireThatAllNodesCanBeVisited() {
     checkVisit<SuffixTerm>(new SimpleSuffixTerm("t", "field", 0, Weight(0)));
     checkVisit<PredicateQuery>(new SimplePredicateQuery(PredicateQueryTerm::UP(), "field", 0, Weight(0)));
     checkVisit<RegExpTerm>(new SimpleRegExpTerm("t", "field", 0, Weight(0)));
+    checkVisit<NearestNeighborTerm>(new SimpleNearestNeighborTerm("query_tensor", "doc_tensor", 0, Weight(0), 123, true, 321));
 }
 
 }  // namespace
@@ -674,6 +674,7 @@ getExpectedBlueprint()
            "        estHits: 9\n"
            "        tree_size: 2\n"
            "        allow_termwise_eval: 0\n"
+           "        cost_tier: 1\n"
            "    }\n"
            "    sourceId: 4294967295\n"
            "    docid_limit: 0\n"
@@ -692,6 +693,7 @@ getExpectedBlueprint()
            "                estHits: 9\n"
            "                tree_size: 1\n"
            "                allow_termwise_eval: 1\n"
+           "                cost_tier: 1\n"
            "            }\n"
            "            sourceId: 4294967295\n"
            "            docid_limit: 0\n"
@@ -719,7 +721,8 @@ getExpectedSlimeBlueprint() {
            "        empty: false,"
            "        estHits: 9,"
            "        tree_size: 2,"
-           "        allow_termwise_eval: 0"
+           "        allow_termwise_eval: 0,"
+           "        cost_tier: 1"
            "    },"
            "    sourceId: 4294967295,"
            "    docid_limit: 0,"
@@ -742,7 +745,8 @@ getExpectedSlimeBlueprint() {
            "                empty: false,"
            "                estHits: 9,"
            "                tree_size: 1,"
-           "                allow_termwise_eval: 1"
+           "                allow_termwise_eval: 1,"
+           "                cost_tier: 1"
            "            },"
            "            sourceId: 4294967295,"
            "            docid_limit: 0"
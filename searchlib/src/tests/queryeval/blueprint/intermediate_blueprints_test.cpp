@@ -1328,6 +1328,59 @@ TEST("require that children of onear are not optimized") {
     EXPECT_EQUAL(expect_up->asString(), top_up->asString());
 }
 
+TEST("require that AND children are sorted by cost tier before estimate") {
+    AndBlueprint b;
+    std::vector<Blueprint *> children;
+    Blueprint::UP c1 = ap(MyLeafSpec(20).create());
+    Blueprint::UP c2 = ap(MyLeafSpec(5).cost_tier(Blueprint::State::COST_TIER_EXPENSIVE).create());
+    Blueprint::UP c3 = ap(MyLeafSpec(10).create());
+    Blueprint::UP c4 = ap(MyLeafSpec(1).cost_tier(Blueprint::State::COST_TIER_EXPENSIVE).create());
+    children.push_back(c1.get());
+    children.push_back(c2.get());
+    children.push_back(c3.get());
+    children.push_back(c4.get());
+    b.sort(children);
+    EXPECT_EQUAL(c3.get(), children[0]);
+    EXPECT_EQUAL(c1.get(), children[1]);
+    EXPECT_EQUAL(c4.get(), children[2]);
+    EXPECT_EQUAL(c2.get(), children[3]);
+}
+
+TEST("require that AND_NOT negative children are sorted by cost tier before estimate") {
+    AndNotBlueprint b;
+    std::vector<Blueprint *> children;
+    Blueprint::UP c1 = ap(MyLeafSpec(1).cost_tier(Blueprint::State::COST_TIER_EXPENSIVE).create());
+    Blueprint::UP c2 = ap(MyLeafSpec(40).cost_tier(Blueprint::State::COST_TIER_EXPENSIVE).create());
+    Blueprint::UP c3 = ap(MyLeafSpec(10).create());
+    Blueprint::UP c4 = ap(MyLeafSpec(30).create());
+    children.push_back(c1.get());
+    children.push_back(c2.get());
+    children.push_back(c3.get());
+    children.push_back(c4.get());
+    b.sort(children);
+    EXPECT_EQUAL(c1.get(), children[0]);
+    EXPECT_EQUAL(c4.get(), children[1]);
+    EXPECT_EQUAL(c3.get(), children[2]);
+    EXPECT_EQUAL(c2.get(), children[3]);
+}
+
+TEST("require that cost tier is inferred from children") {
+    auto cheap = []() { return ap(MyLeafSpec(10).create()); };
+    auto expensive = []() { return ap(MyLeafSpec(10).cost_tier(Blueprint::State::COST_TIER_EXPENSIVE).create()); };
+    AndBlueprint a;
+    a.addChild(expensive()).addChild(cheap());
+    EXPECT_EQUAL(Blueprint::State::COST_TIER_NORMAL, a.getState().cost_tier());
+    OrBlueprint o;
+    o.addChild(cheap()).addChild(expensive());
+    EXPECT_EQUAL(Blueprint::State::COST_TIER_EXPENSIVE, o.getState().cost_tier());
+    AndNotBlueprint n;
+    n.addChild(expensive()).addChild(cheap());
+    EXPECT_EQUAL(Blueprint::State::COST_TIER_EXPENSIVE, n.getState().cost_tier());
+    RankBlueprint r;
+    r.addChild(cheap()).addChild(expensive());
+    EXPECT_EQUAL(Blueprint::State::COST_TIER_NORMAL, r.getState().cost_tier());
+}
+
 TEST("require that ANDNOT without children is optimized to empty search") {
     Blueprint::UP top_up(new AndNotBlueprint());
     Blueprint::UP expect_up(new EmptyBlueprint());
@@ -124,6 +124,10 @@ public:
         setEstimate(HitEstimate(hits, empty));
         return *this;
     }
+    MyLeaf &cost_tier(uint8_t value) {
+        set_cost_tier(value);
+        return *this;
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -133,18 +137,24 @@ class MyLeafSpec
 private:
     FieldSpecBaseList      _fields;
     Blueprint::HitEstimate _estimate;
+    uint8_t                _cost_tier;
 
 public:
     explicit MyLeafSpec(uint32_t estHits, bool empty = false)
-        : _fields(), _estimate(estHits, empty) {}
+        : _fields(), _estimate(estHits, empty), _cost_tier(Blueprint::State::COST_TIER_NORMAL) {}
 
     MyLeafSpec &addField(uint32_t fieldId, uint32_t handle) {
         _fields.add(FieldSpecBase(fieldId, handle));
         return *this;
     }
+    MyLeafSpec &cost_tier(uint8_t value) {
+        _cost_tier = value;
+        return *this;
+    }
     MyLeaf *create() const {
         MyLeaf *leaf = new MyLeaf(_fields);
         leaf->estimate(_estimate.estHits, _estimate.empty);
+        leaf->cost_tier(_cost_tier);
         return leaf;
     }
 };
@@ -593,6 +593,7 @@ TEST_F("require that asString() on blueprint works", BlueprintAsStringFixture)
                               "        estHits: 2\n"
                               "        tree_size: 2\n"
                               "        allow_termwise_eval: 0\n"
+                              "        cost_tier: 1\n"
                               "    }\n"
                               "    sourceId: 4294967295\n"
                               "    docid_limit: 0\n"
@@ -614,6 +615,7 @@ TEST_F("require that asString() on blueprint works", BlueprintAsStringFixture)
                               "                estHits: 2\n"
                               "                tree_size: 1\n"
                               "                allow_termwise_eval: 1\n"
+                              "                cost_tier: 1\n"
                               "            }\n"
                               "            sourceId: 4294967295\n"
                               "            docid_limit: 0\n"
@@ -677,6 +679,36 @@ private:
     mutable DummyHeap _dummy_heap;
 };
 
+FakeResult
+search_wand(bool use_dwa, const DocumentWeightAttributeHelper &helper, const std::vector<int32_t> &weights)
+{
+    SharedWeakAndPriorityQueue heap(10);
+    TermFieldMatchData tfmd;
+    MatchParams match_params(heap, 0, 1.0, 1);
+    std::vector<IDocumentWeightAttribute::LookupResult> dict_entries;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        dict_entries.push_back(helper.dwa().lookup(vespalib::make_string("%zu", i).c_str()));
+    }
+    SearchIterator::UP search = create_wand(use_dwa, tfmd, match_params, weights, dict_entries, helper.dwa(), true);
+    return doSearch(*search, tfmd);
+}
+
+TEST("require that block-max pruning does not change the result") {
+    DocumentWeightAttributeHelper helper;
+    uint32_t docid_limit = 5000;
+    helper.add_docs(docid_limit);
+    for (uint32_t docid = 1; docid < docid_limit; ++docid) {
+        // a few heavy documents among many light ones
+        int32_t weight = ((docid % 397) == 0) ? (1000 + docid) : (1 + (docid % 5));
+        helper.set_doc(docid, docid % 3, weight);
+    }
+    std::vector<int32_t> weights({1, 2, 3});
+    FakeResult exp = search_wand(false, helper, weights);
+    FakeResult act = search_wand(true, helper, weights);
+    EXPECT_LESS(10u, exp.inspect().size());
+    EXPECT_EQUAL(exp, act);
+}
+
 TEST("verify search iterator conformance") {
     for (bool use_dwa: {false, true}) {
         Verifier verifier(use_dwa);
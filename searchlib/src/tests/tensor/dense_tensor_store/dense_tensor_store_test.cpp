@@ -60,6 +60,36 @@ TEST_F("require that we can store 1d bound tensor", Fixture("tensor(x[3])"))
                                        add({{"x", 2}}, 5));
 }
 
+TEST_F("require that we can store 1d bound tensor with float cells", Fixture("tensor<float>(x[3])"))
+{
+    f.assertSetAndGetTensor(TensorSpec("tensor<float>(x[3])").
+                                       add({{"x", 0}}, 2).
+                                       add({{"x", 1}}, 3).
+                                       add({{"x", 2}}, 5));
+}
+
+TEST_F("require that we can store 1d bound tensor with int8 cells", Fixture("tensor<int8>(x[3])"))
+{
+    f.assertSetAndGetTensor(TensorSpec("tensor<int8>(x[3])").
+                                       add({{"x", 0}}, -2).
+                                       add({{"x", 1}}, 3).
+                                       add({{"x", 2}}, 127));
+}
+
+TEST_F("require that tensor with double cells is converted when stored with float cells", Fixture("tensor<float>(x[3])"))
+{
+    Tensor::UP tensor = makeTensor(TensorSpec("tensor(x[3])").
+                                              add({{"x", 0}}, 2).
+                                              add({{"x", 1}}, 3).
+                                              add({{"x", 2}}, 5));
+    EntryRef ref = f.store.setTensor(*tensor);
+    Tensor::UP actTensor = f.store.getTensor(ref);
+    EXPECT_EQUAL(TensorSpec("tensor<float>(x[3])").
+                            add({{"x", 0}}, 2).
+                            add({{"x", 1}}, 3).
+                            add({{"x", 2}}, 5), actTensor->toSpec());
+}
+
 TEST_F("require that correct empty tensor is returned for 1d bound tensor", Fixture("tensor(x[3])"))
 {
     f.assertEmptyTensor(TensorSpec("tensor(x[3])").
@@ -80,6 +110,9 @@ TEST("require that array size is calculated correctly")
     TEST_DO(assertArraySize("tensor(x[10])", 96));
     TEST_DO(assertArraySize("tensor(x[3])", 32));
     TEST_DO(assertArraySize("tensor(x[10],y[10])", 800));
+    TEST_DO(assertArraySize("tensor<float>(x[10])", 64));
+    TEST_DO(assertArraySize("tensor<float>(x[10],y[10])", 416));
+    TEST_DO(assertArraySize("tensor<int8>(x[10])", 32));
 }
 
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -0,0 +1,180 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include <vespa/log/log.h>
+LOG_SETUP("hnsw_index_test");
+#include <vespa/vespalib/testkit/test_kit.h>
+#include <vespa/searchlib/tensor/distance_functions.h>
+#include <vespa/searchlib/tensor/doc_vector_access.h>
+#include <vespa/searchlib/tensor/hnsw_index.h>
+#include <vespa/searchlib/tensor/random_level_generator.h>
+#include <vespa/vespalib/test/insertion_operators.h>
+#include <vespa/vespalib/util/generationhandler.h>
+#include <algorithm>
+#include <vector>
+
+using namespace search::tensor;
+using vespalib::GenerationHandler;
+using vespalib::GenerationHolder;
+
+class MyDocVectorAccess : public DocVectorAccess {
+private:
+    std::vector<std::vector<double>> _vectors;
+
+public:
+    MyDocVectorAccess() : _vectors() {}
+    MyDocVectorAccess &set(uint32_t docid, const std::vector<double> &vec) {
+        if (docid >= _vectors.size()) {
+            _vectors.resize(docid + 1);
+        }
+        _vectors[docid] = vec;
+        return *this;
+    }
+    vespalib::tensor::TypedCells get_vector(uint32_t docid) const override {
+        if (docid >= _vectors.size()) {
+            return vespalib::tensor::TypedCells();
+        }
+        return vespalib::tensor::TypedCells(_vectors[docid]);
+    }
+};
+
+struct LevelGenerator : public RandomLevelGenerator {
+    uint32_t level;
+    LevelGenerator() : level(0) {}
+    uint32_t max_level() override { return level; }
+};
+
+using LinkVector = std::vector<uint32_t>;
+
+struct Fixture {
+    MyDocVectorAccess vectors;
+    GenerationHandler gen_handler;
+    GenerationHolder gen_holder;
+    LevelGenerator *level_generator;
+    std::unique_ptr<HnswIndex> index;
+
+    Fixture(bool heuristic_select_neighbors = false)
+        : vectors(),
+          gen_handler(),
+          gen_holder(),
+          level_generator(),
+          index()
+    {
+        vectors.set(1, {2, 2}).set(2, {3, 2}).set(3, {2, 3})
+               .set(4, {1, 2}).set(5, {8, 3}).set(6, {7, 2})
+               .set(7, {3, 5}).set(8, {0, 3}).set(9, {4, 5});
+        auto generator = std::make_unique<LevelGenerator>();
+        level_generator = generator.get();
+        index = std::make_unique<HnswIndex>(vectors, std::make_unique<SquaredEuclideanDistance>(),
+                                            std::move(generator),
+                                            HnswIndex::Config(5, 2, 10, heuristic_select_neighbors),
+                                            gen_holder);
+    }
+    void add_document(uint32_t docid, uint32_t max_level = 0) {
+        level_generator->level = max_level;
+        index->add_document(docid);
+        commit();
+    }
+    void remove_document(uint32_t docid) {
+        index->remove_document(docid);
+        commit();
+    }
+    void commit() {
+        index->transfer_hold_lists(gen_handler.getCurrentGeneration());
+        gen_holder.transferHoldLists(gen_handler.getCurrentGeneration());
+        gen_handler.incGeneration();
+        gen_handler.updateFirstUsedGeneration();
+        index->trim_hold_lists(gen_handler.getFirstUsedGeneration());
+        gen_holder.trimHoldLists(gen_handler.getFirstUsedGeneration());
+    }
+    void expect_entry_point(uint32_t exp_docid, int32_t exp_level) {
+        EXPECT_EQUAL(exp_docid, index->get_entry_docid());
+        EXPECT_EQUAL(exp_level, index->get_entry_level());
+    }
+    void expect_level_0(uint32_t docid, const LinkVector &exp_links) {
+        auto links = index->get_graph().get_link_array(docid, 0);
+        LinkVector act_links(links.begin(), links.end());
+        std::sort(act_links.begin(), act_links.end());
+        EXPECT_EQUAL(exp_links, act_links);
+    }
+    void expect_top_k(uint32_t k, const std::vector<double> &query, const LinkVector &exp_docids) {
+        auto hits = index->find_top_k(k, vespalib::tensor::TypedCells(query), 100);
+        LinkVector act_docids;
+        for (const auto &hit : hits) {
+            act_docids.push_back(hit.docid);
+        }
+        EXPECT_EQUAL(exp_docids, act_docids);
+    }
+};
+
+TEST_F("2d vectors inserted in level 0 graph with simple neighbor selection", Fixture)
+{
+    f.add_document(1);
+    f.expect_level_0(1, {});
+
+    f.add_document(2);
+    f.expect_level_0(1, {2});
+    f.expect_level_0(2, {1});
+
+    f.add_document(3);
+    f.expect_level_0(1, {2, 3});
+    f.expect_level_0(2, {1, 3});
+    f.expect_level_0(3, {1, 2});
+
+    f.add_document(4);
+    f.expect_level_0(1, {2, 3, 4});
+    f.expect_level_0(2, {1, 3});
+    f.expect_level_0(3, {1, 2, 4});
+    f.expect_level_0(4, {1, 3});
+    f.expect_entry_point(1, 0);
+}
+
+TEST_F("entry point is moved to a higher level node when it is added", Fixture)
+{
+    f.add_document(1);
+    f.expect_entry_point(1, 0);
+    f.add_document(2, 1);
+    f.expect_entry_point(2, 1);
+    f.add_document(3);
+    f.expect_entry_point(2, 1);
+}
+
+TEST_F("entry point is replaced when the current entry point is removed", Fixture)
+{
+    f.add_document(1);
+    f.add_document(2, 1);
+    f.add_document(3);
+    f.expect_entry_point(2, 1);
+    f.remove_document(2);
+    f.expect_level_0(1, {3});
+    f.expect_level_0(3, {1});
+    EXPECT_NOT_EQUAL(2u, f.index->get_entry_docid());
+    f.expect_entry_point(f.index->get_entry_docid(), 0);
+    f.remove_document(1);
+    f.remove_document(3);
+    f.expect_entry_point(0, -1);
+}
+
+TEST_F("find_top_k returns nearest neighbors sorted by increasing distance", Fixture)
+{
+    for (uint32_t docid = 1; docid <= 9; ++docid) {
+        f.add_document(docid);
+    }
+    f.expect_top_k(1, {2, 2}, {1});
+    f.expect_top_k(3, {7.2, 3}, {5, 6, 9});
+    f.expect_top_k(2, {3, 6}, {7, 9});
+}
+
+TEST_F("find_top_k on empty index returns no hits", Fixture)
+{
+    f.expect_top_k(5, {2, 2}, {});
+}
+
+TEST_F("removed documents are not returned by find_top_k", Fixture(true))
+{
+    for (uint32_t docid = 1; docid <= 9; ++docid) {
+        f.add_document(docid, docid % 3);
+    }
+    f.remove_document(6);
+    f.expect_top_k(2, {7.2, 3}, {5, 9});
+}
+
+TEST_MAIN() { TEST_RUN_ALL(); }
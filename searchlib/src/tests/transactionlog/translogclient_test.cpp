@@ -1,9 +1,13 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+#include <vespa/searchlib/transactionlog/domain.h>
 #include <vespa/searchlib/transactionlog/translogclient.h>
 #include <vespa/searchlib/transactionlog/translogserver.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
 #include <vespa/vespalib/testkit/testapp.h>
 #include <vespa/vespalib/objects/identifiable.h>
 #include <vespa/searchlib/index/dummyfileheadercontext.h>
+#include <vespa/searchlib/common/gatecallback.h>
+#include <vespa/vespalib/util/sync.h>
 #include <vespa/fastos/file.h>
 #include <map>
 
@@ -54,10 +58,35 @@ private:
     void testSync();
     void testTruncateOnShortRead();
     void testTruncateOnVersionMismatch();
+    void testCompression();
+    void testSyncedWithPendingCloses();
+    void testGroupCommit();
+    void testGroupCommitLimits();
 };
 
 TEST_APPHOOK(Test);
 
+/*
+ * Executor that queues tasks until the test explicitly runs them, in any order.
+ */
+class ManualExecutor : public vespalib::ThreadExecutor
+{
+    std::vector<Task::UP> _tasks;
+public:
+    ManualExecutor() : _tasks() { }
+    Task::UP execute(Task::UP task) override {
+        _tasks.push_back(std::move(task));
+        return Task::UP();
+    }
+    vespalib::Syncable &sync() override { return *this; }
+    size_t getNumThreads() const override { return 1; }
+    size_t numTasks() const { return _tasks.size(); }
+    void runTask(size_t idx) {
+        Task::UP task(std::move(_tasks[idx]));
+        task->run();
+    }
+};
+
 class CallBackTest : public TransLogClient::Visitor::Callback
 {
 private:
@@ -507,7 +536,8 @@ bool Test::testVisitOverGeneratedDomain()
 void Test::createAndFillDomain(const vespalib::string & name, DomainPart::Crc crcMethod, size_t preExistingDomains)
 {
     DummyFileHeaderContext fileHeaderContext;
-    TransLogServer tlss("test13", 18377, ".", fileHeaderContext, 0x10000, 4, crcMethod);
+    TransLogServer tlss("test13", 18377, ".", fileHeaderContext, 0x10000, 4, crcMethod,
+                        DomainPart::CompressionConfig(), CommitConfig());
     TransLogClient tls("tcp/localhost:18377");
 
     createDomainTest(tls, name, preExistingDomains);
@@ -842,7 +872,7 @@ Test::testTruncateOnShortRead()
         EXPECT_EQUAL(syncedTo, TOTAL_NUM_ENTRIES);
     }
     {
-        EXPECT_EQUAL(2u, countFiles(dir));
+        EXPECT_EQUAL(3u, countFiles(dir)); // Two parts and the preallocated next part
     }
     {
         TransLogServer tlss(topdir, 18377, ".", fileHeaderContext, 0x10000);
@@ -851,7 +881,7 @@ Test::testTruncateOnShortRead()
         checkFilledDomainTest(s1, TOTAL_NUM_ENTRIES);
     }
     {
-        EXPECT_EQUAL(2u, countFiles(dir));
+        EXPECT_EQUAL(3u, countFiles(dir)); // Two parts and the preallocated next part
     }
     {
         vespalib::string filename(dir + "/truncate-0000000000000017");
@@ -867,10 +897,168 @@ Test::testTruncateOnShortRead()
         checkFilledDomainTest(s1, TOTAL_NUM_ENTRIES - 1);
     }
     {
-        EXPECT_EQUAL(2u, countFiles(dir));
+        EXPECT_EQUAL(3u, countFiles(dir)); // Two parts and the preallocated next part
+    }
+}
+
+void
+Test::testCompression()
+{
+    const unsigned int NUM_PACKETS = 17;
+    const unsigned int NUM_ENTRIES = 10;
+    const unsigned int TOTAL_NUM_ENTRIES = NUM_PACKETS * NUM_ENTRIES;
+    const unsigned int ENTRYSIZE = 4080;
+    vespalib::string topdir("test14");
+    vespalib::string domain("compressed");
+    vespalib::string tlsspec("tcp/localhost:18377");
+
+    DummyFileHeaderContext fileHeaderContext;
+    {
+        TransLogServer tlss(topdir, 18377, ".", fileHeaderContext, 0x10000, 4, DomainPart::xxh64,
+                            DomainPart::CompressionConfig(DomainPart::CompressionConfig::LZ4), CommitConfig());
+        TransLogClient tls(tlsspec);
+
+        createDomainTest(tls, domain, 0);
+        TransLogClient::Session::UP s1 = openDomainTest(tls, domain);
+        fillDomainTest(s1.get(), NUM_PACKETS, NUM_ENTRIES, ENTRYSIZE);
+        EXPECT_LESS(tlss.getDomainStats()[domain].byteSize, TOTAL_NUM_ENTRIES * ENTRYSIZE / 10);
+    }
+    {
+        TransLogServer tlss(topdir, 18377, ".", fileHeaderContext, 0x10000);
+        TransLogClient tls(tlsspec);
+        TransLogClient::Session::UP s1 = openDomainTest(tls, domain);
+        checkFilledDomainTest(s1, TOTAL_NUM_ENTRIES);
+        TEST_DO(assertVisitStats(tls, domain, 0, TOTAL_NUM_ENTRIES,
+                                 1, TOTAL_NUM_ENTRIES,
+                                 TOTAL_NUM_ENTRIES, TOTAL_NUM_ENTRIES));
+    }
+}
+
+void
+Test::testSyncedWithPendingCloses()
+{
+    DummyFileHeaderContext fileHeaderContext;
+    ManualExecutor commitExecutor;
+    vespalib::ThreadStackExecutor sessionExecutor(1, 128 * 1024);
+    Domain domain("synced", "test15", commitExecutor, sessionExecutor, 0x1000,
+                  DomainPart::xxh64, DomainPart::CompressionConfig(), CommitConfig(), fileHeaderContext);
+    ASSERT_EQUAL(1u, commitExecutor.numTasks());
+    commitExecutor.runTask(0);
+    vespalib::string preallocated(DomainPart::preallocatedFileName("synced", "test15/synced"));
+    FastOS_StatInfo statInfo;
+    EXPECT_TRUE(FastOS_File::Stat(preallocated.c_str(), &statInfo));
+    vespalib::string payload(0x1000, 'x');
+    for (SerialNum serial(1); serial <= 3; ++serial) {
+        Packet packet;
+        ASSERT_TRUE(packet.add(Packet::Entry(serial, 1, vespalib::ConstBufferRef(payload.c_str(), payload.size()))));
+        domain.commit(packet, Writer::DoneCallback());
+        commitExecutor.runTask(commitExecutor.numTasks() - 1);
     }
+    // Each commit after the first rolls over, queueing a close of the previous part.
+    // The first rollover takes over the preallocated file and queues preallocation of the next one.
+    EXPECT_EQUAL(3u, domain.getDomainInfo().parts.size());
+    ASSERT_EQUAL(7u, commitExecutor.numTasks());
+    EXPECT_EQUAL(0u, domain.getSynced());
+    EXPECT_FALSE(FastOS_File::Stat(preallocated.c_str(), &statInfo));
+
+    // The close of the second part and a sync of the last part complete before the close of the first part.
+    commitExecutor.runTask(6);
+    domain.triggerSyncNow();
+    ASSERT_EQUAL(8u, commitExecutor.numTasks());
+    commitExecutor.runTask(7);
+    EXPECT_EQUAL(0u, domain.getSynced());
+
+    commitExecutor.runTask(3);
+    EXPECT_EQUAL(3u, domain.getSynced());
+
+    commitExecutor.runTask(4);
+    EXPECT_TRUE(FastOS_File::Stat(preallocated.c_str(), &statInfo));
+}
+
+namespace {
+
+class CountingCallback : public IDestructorCallback
+{
+    std::atomic<size_t> &_count;
+public:
+    CountingCallback(std::atomic<size_t> &count) : _count(count) { }
+    ~CountingCallback() override { ++_count; }
+};
+
+Packet
+makePacket(SerialNum serial, size_t payloadSize)
+{
+    vespalib::string payload(payloadSize, 'x');
+    Packet packet(payloadSize + 0x100);
+    packet.add(Packet::Entry(serial, 1, vespalib::ConstBufferRef(payload.c_str(), payload.size())));
+    return packet;
+}
+
+}
+
+void
+Test::testGroupCommit()
+{
+    DummyFileHeaderContext fileHeaderContext;
+    ManualExecutor commitExecutor;
+    vespalib::ThreadStackExecutor sessionExecutor(1, 128 * 1024);
+    Domain domain("group", "test16", commitExecutor, sessionExecutor, 0x100000,
+                  DomainPart::xxh64, DomainPart::CompressionConfig(), CommitConfig(), fileHeaderContext);
+    commitExecutor.runTask(0);
+    std::atomic<size_t> done(0);
+    domain.commit(makePacket(1, 100), std::make_shared<CountingCallback>(done));
+    ASSERT_EQUAL(2u, commitExecutor.numTasks());
+    // Commits arriving before the pending write has run are written with it.
+    domain.commit(makePacket(2, 100), std::make_shared<CountingCallback>(done));
+    domain.commit(makePacket(3, 100), std::make_shared<CountingCallback>(done));
+    EXPECT_EQUAL(2u, commitExecutor.numTasks());
+    EXPECT_EQUAL(0u, done.load());
+    EXPECT_EQUAL(0u, domain.size());
+
+    commitExecutor.runTask(1);
+    EXPECT_EQUAL(3u, done.load());
+    EXPECT_EQUAL(3u, domain.size());
+    EXPECT_EQUAL(3u, domain.end());
+
+    EXPECT_EXCEPTION(domain.commit(makePacket(3, 100), Writer::DoneCallback()), std::runtime_error,
+                     "Incomming serial number(3) must be bigger than the last one (3).");
+    domain.commit(makePacket(4, 100), std::make_shared<CountingCallback>(done));
+    ASSERT_EQUAL(3u, commitExecutor.numTasks());
+    commitExecutor.runTask(2);
+    EXPECT_EQUAL(4u, done.load());
+    EXPECT_EQUAL(4u, domain.size());
 }
 
+void
+Test::testGroupCommitLimits()
+{
+    DummyFileHeaderContext fileHeaderContext;
+    vespalib::ThreadStackExecutor commitExecutor(1, 128 * 1024);
+    vespalib::ThreadStackExecutor sessionExecutor(1, 128 * 1024);
+    Domain domain("limits", "test17", commitExecutor, sessionExecutor, 0x100000, DomainPart::xxh64,
+                  DomainPart::CompressionConfig(), CommitConfig(0x1000, CommitConfig::DurationSeconds(0.05), true),
+                  fileHeaderContext);
+    {
+        // A small commit waits for the age limit before it is written and synced.
+        vespalib::Gate gate;
+        auto start = std::chrono::steady_clock::now();
+        domain.commit(makePacket(1, 100), std::make_shared<GateCallback>(gate));
+        EXPECT_TRUE(gate.await(60000));
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        EXPECT_GREATER_EQUAL(elapsed.count(), int64_t(50));
+        EXPECT_EQUAL(1u, domain.getSynced());
+    }
+    {
+        // A commit filling up the chunk is written without waiting for the age limit.
+        CommitConfig noWait(0x1000, CommitConfig::DurationSeconds(3600), false);
+        Domain bigDomain("limits_big", "test17", commitExecutor, sessionExecutor, 0x100000, DomainPart::xxh64,
+                         DomainPart::CompressionConfig(), noWait, fileHeaderContext);
+        vespalib::Gate gate;
+        bigDomain.commit(makePacket(1, 0x2000), std::make_shared<GateCallback>(gate));
+        EXPECT_TRUE(gate.await(60000));
+        EXPECT_EQUAL(1u, bigDomain.size());
+    }
+}
 
 int Test::Main()
 {
@@ -893,6 +1081,13 @@ int Test::Main()
     testTruncateOnVersionMismatch();
 
     testCrcVersions();
-    
+
+    testCompression();
+
+    testSyncedWithPendingCloses();
+
+    testGroupCommit();
+    testGroupCommitLimits();
+
     TEST_DONE();
 }
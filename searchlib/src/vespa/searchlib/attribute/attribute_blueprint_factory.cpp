@@ -5,6 +5,7 @@
 #include "i_document_weight_attribute.h"
 #include "iterator_pack.h"
 #include "predicate_attribute.h"
+#include <vespa/eval/tensor/dense/dense_tensor_view.h>
 #include <vespa/searchlib/common/location.h>
 #include <vespa/searchlib/common/locationiterators.h>
 #include <vespa/searchlib/query/queryterm.h>
@@ -17,6 +18,7 @@
 #include <vespa/searchlib/queryeval/emptysearch.h>
 #include <vespa/searchlib/queryeval/intermediate_blueprints.h>
 #include <vespa/searchlib/queryeval/leaf_blueprints.h>
+#include <vespa/searchlib/queryeval/nearest_neighbor_blueprint.h>
 #include <vespa/searchlib/queryeval/orlikesearch.h>
 #include <vespa/searchlib/queryeval/dot_product_blueprint.h>
 #include <vespa/searchlib/queryeval/wand/parallel_weak_and_blueprint.h>
@@ -25,7 +27,9 @@
 #include <vespa/searchlib/queryeval/weighted_set_term_search.h>
 #include <vespa/searchlib/queryeval/weighted_set_term_blueprint.h>
 #include <vespa/searchlib/queryeval/get_weight_from_node.h>
+#include <vespa/searchlib/tensor/dense_tensor_attribute.h>
 #include <vespa/vespalib/util/regexp.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <sstream>
 
 #include <vespa/log/log.h>
@@ -66,6 +70,8 @@ using search::queryeval::Searchable;
 using search::queryeval::SimpleLeafBlueprint;
 using search::queryeval::ComplexLeafBlueprint;
 using search::queryeval::WeightedSetTermBlueprint;
+using search::tensor::DenseTensorAttribute;
+using search::tensor::ITensorAttribute;
 using vespalib::geo::ZCurve;
 using vespalib::string;
 
@@ -90,6 +96,10 @@ private:
         uint32_t estHits = _search_context->approximateHits();
         HitEstimate estimate(estHits, estHits == 0);
         setEstimate(estimate);
+        if (!attribute.getIsFastSearch()) {
+            // strict iteration scans all documents
+            set_cost_tier(State::COST_TIER_EXPENSIVE);
+        }
     }
 
     AttributeFieldBlueprint(const FieldSpec &field, const IAttributeVector &attribute,
@@ -588,6 +598,41 @@ public:
             createShallowWeightedSet(bp, n, _field, _attr.isIntegerType());
         }
     }
+
+    void fail_nearest_neighbor_term(query::NearestNeighborTerm &n, const vespalib::string &error_msg) {
+        LOG(warning, "NearestNeighborTerm(%s, %s): %s. Returning empty blueprint",
+            _field.getName().c_str(), n.get_query_tensor_name().c_str(), error_msg.c_str());
+        setResult(std::make_unique<queryeval::EmptyBlueprint>(_field));
+    }
+
+    void visit(query::NearestNeighborTerm &n) override {
+        const ITensorAttribute *tensor_attr = _attr.asTensorAttribute();
+        const auto *dense_attr = dynamic_cast<const DenseTensorAttribute *>(tensor_attr);
+        if (dense_attr == nullptr) {
+            return fail_nearest_neighbor_term(n, "Attribute is not a dense tensor attribute");
+        }
+        auto query_tensor = getRequestContext().get_query_tensor(n.get_query_tensor_name());
+        if (!query_tensor) {
+            return fail_nearest_neighbor_term(n, "Query tensor was not found");
+        }
+        auto *dense_view = dynamic_cast<vespalib::tensor::DenseTensorView *>(query_tensor.get());
+        if (dense_view == nullptr) {
+            return fail_nearest_neighbor_term(n, "Query tensor is not a dense tensor");
+        }
+        const auto &attr_type = dense_attr->getTensorType();
+        // Distance calculations handle different cell types, so only the dimensions must match.
+        if (dense_view->fast_type().dimensions() != attr_type.dimensions()) {
+            return fail_nearest_neighbor_term(n, vespalib::make_string("Query tensor type (%s) does not match attribute tensor type (%s)",
+                                                                       dense_view->fast_type().to_spec().c_str(),
+                                                                       attr_type.to_spec().c_str()));
+        }
+        query_tensor.release();
+        setResult(std::make_unique<queryeval::NearestNeighborBlueprint>(_field, *dense_attr,
+                                                                        std::unique_ptr<vespalib::tensor::DenseTensorView>(dense_view),
+                                                                        n.get_target_num_hits(),
+                                                                        n.get_allow_approximate(),
+                                                                        n.get_explore_additional_hits()));
+    }
 };
 
 } // namespace
@@ -7,6 +7,7 @@ namespace search {
 
 using queryeval::MinMaxPostingInfo;
 using fef::TermFieldMatchData;
+using attribute::CompressedPostingListIterator;
 
 void
 AttributeIteratorBase::visitMembers(vespalib::ObjectVisitor &visitor) const
@@ -166,4 +167,26 @@ setupPostingInfo()
     }
 }
 
+template <>
+void
+AttributePostingListIteratorT<CompressedPostingListIterator>::
+setupPostingInfo()
+{
+    if (_iterator.valid()) {
+        _postingInfo = MinMaxPostingInfo(1, 1);
+        _postingInfoValid = true;
+    }
+}
+
+template <>
+void
+FilterAttributePostingListIteratorT<CompressedPostingListIterator>::
+setupPostingInfo()
+{
+    if (_iterator.valid()) {
+        _postingInfo = MinMaxPostingInfo(1, 1);
+        _postingInfoValid = true;
+    }
+}
+
 } // namespace search
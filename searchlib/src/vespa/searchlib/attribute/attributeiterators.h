@@ -3,6 +3,7 @@
 #pragma once
 
 #include "dociditerator.h"
+#include "compressed_posting_list.h"
 #include "postinglisttraits.h"
 #include <vespa/searchlib/queryeval/searchiterator.h>
 #include <vespa/searchlib/fef/termfieldmatchdata.h>
@@ -29,6 +30,11 @@ protected:
     void or_hits_into(const SC & sc, BitVector & result, uint32_t begin_id) const;
     template <typename SC>
     std::unique_ptr<BitVector> get_hits(const SC & sc, uint32_t begin_id) const;
+    // Clears the bits between postings directly instead of and'ing with a temporary bitvector
+    template <typename PL>
+    static void and_posting_list_hits_into(PL & iterator, BitVector & result, uint32_t begin_id);
+    template <typename PL>
+    static void or_posting_list_hits_into(PL & iterator, BitVector & result, uint32_t end_id);
     void visitMembers(vespalib::ObjectVisitor &visitor) const override;
     const attribute::ISearchContext & _baseSearchCtx;
     fef::TermFieldMatchData         * _matchData;
@@ -162,6 +168,46 @@ public:
     { }
 };
 
+/**
+ * This class acts as a strict iterator over documents that are
+ * results for a range term searched in a single value attribute vector
+ * that does not use posting lists.  Instead of matching one document at
+ * a time, the range is evaluated for a block of documents at a time
+ * into a bitmap that is used to serve seeks and to combine with
+ * bitvectors.
+ *
+ * @param SC the specialized search context type associated with this
+ *           iterator, providing scanRange() and getDocIdLimit()
+ */
+template <typename SC>
+class AttributeRangeScanIteratorStrict : public AttributeIteratorBase
+{
+private:
+    static constexpr uint32_t BLOCK_WORDS = 8;
+    static constexpr uint32_t BLOCK_SIZE = BLOCK_WORDS * 64;
+
+    const SC &_concreteSearchCtx;
+    uint32_t  _blockStart;
+    uint64_t  _bits[BLOCK_WORDS];
+
+    uint32_t getScanLimit() const { return std::min(getEndId(), _concreteSearchCtx.getDocIdLimit()); }
+    void scanBlock(uint32_t blockStart, uint32_t numDocs, uint64_t *bits) const;
+    template <typename Func>
+    void foreachWord(uint32_t begin_id, uint32_t end_id, Func func) const;
+
+    void initRange(uint32_t begin, uint32_t end) override;
+    void doSeek(uint32_t docId) override;
+    void doUnpack(uint32_t docId) override;
+    void visitMembers(vespalib::ObjectVisitor &visitor) const override;
+    void and_hits_into(BitVector & result, uint32_t begin_id) override;
+    void or_hits_into(BitVector & result, uint32_t begin_id) override;
+    std::unique_ptr<BitVector> get_hits(uint32_t begin_id) override;
+    Trinary is_strict() const override { return Trinary::True; }
+
+public:
+    AttributeRangeScanIteratorStrict(const SC &concreteSearchCtx, fef::TermFieldMatchData *matchData);
+};
+
 /**
  * This class acts as an iterator over documents that are results for
  * the subquery represented by the search context object associated
@@ -313,6 +359,17 @@ template <>
 void
 FilterAttributePostingListIteratorT<DocIdMinMaxIterator<AttributePosting> >::setupPostingInfo();
 
+
+template <>
+void
+AttributePostingListIteratorT<attribute::CompressedPostingListIterator>::setupPostingInfo();
+
+
+template <>
+void
+FilterAttributePostingListIteratorT<attribute::CompressedPostingListIterator>::setupPostingInfo();
+
+
 /**
  * This class acts as an iterator over a flag attribute.
  */
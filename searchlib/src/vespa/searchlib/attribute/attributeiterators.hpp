@@ -40,6 +40,28 @@ AttributeIteratorBase::get_hits(const SC & sc, uint32_t begin_id) const {
     return result;
 }
 
+template <typename PL>
+void
+AttributeIteratorBase::and_posting_list_hits_into(PL & iterator, BitVector & result, uint32_t begin_id) {
+    if (iterator.valid() && iterator.getKey() < begin_id) {
+        iterator.linearSeek(begin_id);
+    }
+    uint32_t next = begin_id;
+    for (; iterator.valid() && iterator.getKey() < result.size(); ++iterator) {
+        result.clearInterval(next, iterator.getKey());
+        next = iterator.getKey() + 1;
+    }
+    result.clearInterval(next, result.size());
+}
+
+template <typename PL>
+void
+AttributeIteratorBase::or_posting_list_hits_into(PL & iterator, BitVector & result, uint32_t end_id) {
+    for (; iterator.valid() && iterator.getKey() < end_id; ++iterator) {
+        result.setBit(iterator.getKey());
+    }
+    result.invalidateCachedCount();
+}
 
 template <typename PL>
 template <typename... Args>
@@ -117,18 +139,13 @@ template <typename PL>
 void
 AttributePostingListIteratorT<PL>::or_hits_into(BitVector & result, uint32_t begin_id) {
     (void) begin_id;
-    for (; _iterator.valid() && _iterator.getKey() < getEndId(); ++_iterator) {
-        if ( ! result.testBit(_iterator.getKey()) ) {
-            result.setBit(_iterator.getKey());
-        }
-    }
-    result.invalidateCachedCount();
+    or_posting_list_hits_into(_iterator, result, getEndId());
 }
 
 template <typename PL>
 void
 AttributePostingListIteratorT<PL>::and_hits_into(BitVector &result, uint32_t begin_id) {
-    result.andWith(*get_hits(begin_id));
+    and_posting_list_hits_into(_iterator, result, begin_id);
 }
 
 template <typename PL>
@@ -146,19 +163,14 @@ template <typename PL>
 void
 FilterAttributePostingListIteratorT<PL>::or_hits_into(BitVector & result, uint32_t begin_id) {
     (void) begin_id;
-    for (; _iterator.valid() && _iterator.getKey() < getEndId(); ++_iterator) {
-        if ( ! result.testBit(_iterator.getKey()) ) {
-            result.setBit(_iterator.getKey());
-        }
-    }
-    result.invalidateCachedCount();
+    or_posting_list_hits_into(_iterator, result, getEndId());
 }
 
 
 template <typename PL>
 void
 FilterAttributePostingListIteratorT<PL>::and_hits_into(BitVector &result, uint32_t begin_id) {
-    result.andWith(*get_hits(begin_id));
+    and_posting_list_hits_into(_iterator, result, begin_id);
 }
 
 template <typename PL>
@@ -417,4 +429,130 @@ FilterAttributeIteratorT<SC>::and_hits_into(BitVector & result, uint32_t begin_i
     AttributeIteratorBase::and_hits_into(_concreteSearchCtx, result, begin_id);
 }
 
+template <typename SC>
+AttributeRangeScanIteratorStrict<SC>::AttributeRangeScanIteratorStrict(const SC &concreteSearchCtx,
+                                                                       fef::TermFieldMatchData *matchData)
+    : AttributeIteratorBase(concreteSearchCtx, matchData),
+      _concreteSearchCtx(concreteSearchCtx),
+      _blockStart(search::endDocId),
+      _bits()
+{
+    _matchPosition->setElementWeight(1);
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::scanBlock(uint32_t blockStart, uint32_t numDocs, uint64_t *bits) const
+{
+    uint32_t scanLimit = getScanLimit();
+    uint32_t numScanned = (blockStart < scanLimit) ? std::min(numDocs, scanLimit - blockStart) : 0u;
+    if (numScanned != 0) {
+        _concreteSearchCtx.scanRange(blockStart, numScanned, bits);
+    }
+    for (uint32_t i = (numScanned + 63) / 64; i < BLOCK_WORDS; ++i) {
+        bits[i] = 0;
+    }
+}
+
+template <typename SC>
+template <typename Func>
+void
+AttributeRangeScanIteratorStrict<SC>::foreachWord(uint32_t begin_id, uint32_t end_id, Func func) const
+{
+    uint64_t bits[BLOCK_WORDS];
+    for (uint32_t blockStart = begin_id & ~63u; blockStart < end_id; blockStart += BLOCK_SIZE) {
+        uint32_t numDocs = std::min(BLOCK_SIZE, end_id - blockStart);
+        scanBlock(blockStart, numDocs, bits);
+        for (uint32_t i = 0; i < (numDocs + 63) / 64; ++i) {
+            uint32_t wordStart = blockStart + i * 64;
+            uint64_t mask = std::numeric_limits<uint64_t>::max();
+            if (wordStart < begin_id) {
+                mask <<= (begin_id - wordStart);
+            }
+            if (end_id - wordStart < 64) {
+                mask &= (uint64_t(1) << (end_id - wordStart)) - 1;
+            }
+            func(wordStart / 64, bits[i], mask);
+        }
+    }
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::initRange(uint32_t begin, uint32_t end)
+{
+    AttributeIteratorBase::initRange(begin, end);
+    _blockStart = search::endDocId;
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::doSeek(uint32_t docId)
+{
+    while (!isAtEnd(docId)) {
+        uint32_t blockStart = docId & ~(BLOCK_SIZE - 1);
+        if (blockStart != _blockStart) {
+            scanBlock(blockStart, std::min(BLOCK_SIZE, getEndId() - blockStart), _bits);
+            _blockStart = blockStart;
+        }
+        for (uint32_t i = (docId - blockStart) / 64; i < BLOCK_WORDS; ++i) {
+            uint64_t word = _bits[i];
+            if (i == (docId - blockStart) / 64) {
+                word &= std::numeric_limits<uint64_t>::max() << (docId % 64);
+            }
+            if (word != 0) {
+                setDocId(blockStart + i * 64 + vespalib::Optimized::lsbIdx(word));
+                return;
+            }
+        }
+        docId = blockStart + BLOCK_SIZE;
+    }
+    setAtEnd();
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::doUnpack(uint32_t docId)
+{
+    _matchData->resetOnlyDocId(docId);
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::visitMembers(vespalib::ObjectVisitor &visitor) const
+{
+    AttributeIteratorBase::visitMembers(visitor);
+    visit(visitor, "searchcontext.attribute", _concreteSearchCtx.attribute().getName());
+    visit(visitor, "searchcontext.queryterm", _concreteSearchCtx.queryTerm());
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::and_hits_into(BitVector & result, uint32_t begin_id) {
+    uint64_t *words = static_cast<uint64_t *>(result.getStart());
+    foreachWord(std::max(begin_id, result.getStartIndex()), result.size(),
+                [words](uint32_t wordIdx, uint64_t bits, uint64_t mask) { words[wordIdx] &= (bits | ~mask); });
+    result.invalidateCachedCount();
+}
+
+template <typename SC>
+void
+AttributeRangeScanIteratorStrict<SC>::or_hits_into(BitVector & result, uint32_t begin_id) {
+    uint64_t *words = static_cast<uint64_t *>(result.getStart());
+    foreachWord(std::max(begin_id, result.getStartIndex()), std::min(result.size(), getEndId()),
+                [words](uint32_t wordIdx, uint64_t bits, uint64_t mask) { words[wordIdx] |= (bits & mask); });
+    result.invalidateCachedCount();
+}
+
+template <typename SC>
+BitVector::UP
+AttributeRangeScanIteratorStrict<SC>::get_hits(uint32_t begin_id) {
+    BitVector::UP result = BitVector::create(begin_id, getEndId());
+    uint64_t *words = static_cast<uint64_t *>(result->getStart());
+    foreachWord(std::max(begin_id, getDocId()), getEndId(),
+                [words](uint32_t wordIdx, uint64_t bits, uint64_t mask) { words[wordIdx] |= (bits & mask); });
+    result->invalidateCachedCount();
+    return result;
+}
+
 } // namespace search
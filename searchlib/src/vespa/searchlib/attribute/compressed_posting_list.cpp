@@ -0,0 +1,154 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "compressed_posting_list.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace search::attribute {
+
+namespace {
+
+uint32_t
+bitWidth(uint32_t value)
+{
+    return (value == 0) ? 0 : (32 - __builtin_clz(value));
+}
+
+uint32_t
+blockStartPrev(const std::vector<CompressedPostingList::SkipEntry> &skip, uint32_t block)
+{
+    // Deltas are stored minus one, docid 0 in the first block is encoded as delta 0
+    return (block == 0) ? std::numeric_limits<uint32_t>::max() : skip[block - 1]._lastDocId;
+}
+
+}
+
+CompressedPostingList::CompressedPostingList(const std::vector<uint32_t> &docIds)
+    : _skip(),
+      _words(),
+      _size(docIds.size())
+{
+    assert(!docIds.empty());
+    uint32_t numBlocks = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    _skip.reserve(numBlocks);
+    uint32_t prev = std::numeric_limits<uint32_t>::max();
+    for (uint32_t block = 0; block < numBlocks; ++block) {
+        auto begin = docIds.begin() + block * BLOCK_SIZE;
+        auto end = docIds.begin() + std::min(_size, (block + 1) * BLOCK_SIZE);
+        uint32_t maxDelta = 0;
+        uint32_t p = prev;
+        for (auto itr = begin; itr != end; ++itr) {
+            maxDelta = std::max(maxDelta, *itr - p - 1);
+            p = *itr;
+        }
+        uint32_t width = bitWidth(maxDelta);
+        size_t wordOffset = _words.size();
+        if (width != 0) {
+            _words.resize(wordOffset + ((end - begin) * width + 63) / 64, 0);
+            uint64_t bitPos = 0;
+            p = prev;
+            for (auto itr = begin; itr != end; ++itr, bitPos += width) {
+                uint64_t delta = *itr - p - 1;
+                uint64_t *word = &_words[wordOffset + (bitPos >> 6)];
+                uint32_t shift = bitPos & 63;
+                word[0] |= delta << shift;
+                if (shift + width > 64) {
+                    word[1] |= delta >> (64 - shift);
+                }
+                p = *itr;
+            }
+        }
+        prev = *(end - 1);
+        _skip.push_back(SkipEntry{prev, static_cast<uint32_t>(wordOffset), width});
+    }
+    _words.shrink_to_fit();
+}
+
+CompressedPostingList::~CompressedPostingList() = default;
+
+uint32_t
+CompressedPostingList::decodeBlock(uint32_t block, uint32_t *dst) const
+{
+    const SkipEntry &entry = _skip[block];
+    uint32_t count = blockSize(block);
+    uint32_t prev = blockStartPrev(_skip, block);
+    uint32_t width = entry._bitWidth;
+    if (width == 0) {
+        for (uint32_t i = 0; i < count; ++i) {
+            dst[i] = ++prev;
+        }
+        return count;
+    }
+    const uint64_t *words = &_words[entry._wordOffset];
+    uint64_t mask = (uint64_t(1) << width) - 1;
+    uint64_t bitPos = 0;
+    for (uint32_t i = 0; i < count; ++i, bitPos += width) {
+        const uint64_t *word = words + (bitPos >> 6);
+        uint32_t shift = bitPos & 63;
+        uint64_t value = word[0] >> shift;
+        if (shift + width > 64) {
+            value |= word[1] << (64 - shift);
+        }
+        prev += static_cast<uint32_t>(value & mask) + 1;
+        dst[i] = prev;
+    }
+    return count;
+}
+
+size_t
+CompressedPostingList::extraByteSize() const
+{
+    return sizeof(CompressedPostingList) +
+        _skip.capacity() * sizeof(SkipEntry) +
+        _words.capacity() * sizeof(uint64_t);
+}
+
+CompressedPostingListIterator::CompressedPostingListIterator()
+    : _list(nullptr),
+      _block(0),
+      _pos(0),
+      _blockSize(0)
+{
+}
+
+CompressedPostingListIterator::CompressedPostingListIterator(const CompressedPostingList &list)
+    : _list(&list),
+      _block(0),
+      _pos(0),
+      _blockSize(0)
+{
+    loadBlock(0);
+}
+
+void
+CompressedPostingListIterator::loadBlock(uint32_t block)
+{
+    _block = block;
+    _pos = 0;
+    _blockSize = (block < _list->numBlocks()) ? _list->decodeBlock(block, _docIds) : 0u;
+}
+
+void
+CompressedPostingListIterator::seekBlock(uint32_t firstBlock, uint32_t docId)
+{
+    if (_list == nullptr) {
+        return;
+    }
+    const SkipEntry *skip = _list->skipBegin();
+    const SkipEntry *found = std::lower_bound(skip + std::min(firstBlock, _list->numBlocks()), _list->skipEnd(), docId,
+                                              [](const SkipEntry &entry, uint32_t key) { return entry._lastDocId < key; });
+    uint32_t block = found - skip;
+    if (block != _block || !valid()) {
+        loadBlock(block);
+    } else {
+        _pos = 0;
+    }
+    if (valid()) {
+        while (_docIds[_pos] < docId) {
+            ++_pos;
+        }
+    }
+}
+
+}
@@ -0,0 +1,119 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchlib/btree/minmaxaggregated.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace search::attribute {
+
+/*
+ * Immutable posting list without weights. Document ids are stored as
+ * bit-packed deltas in blocks of BLOCK_SIZE documents. A skip entry
+ * per block holds the last document id in the block and where the
+ * block starts, letting seeks skip blocks without decoding them.
+ */
+class CompressedPostingList
+{
+public:
+    static constexpr uint32_t BLOCK_SIZE = 128;
+
+    struct SkipEntry {
+        uint32_t _lastDocId;
+        uint32_t _wordOffset;
+        uint32_t _bitWidth;
+    };
+
+private:
+    std::vector<SkipEntry> _skip;
+    std::vector<uint64_t>  _words;
+    uint32_t               _size;
+
+public:
+    CompressedPostingList(const std::vector<uint32_t> &docIds);
+    ~CompressedPostingList();
+
+    uint32_t size() const { return _size; }
+    uint32_t numBlocks() const { return _skip.size(); }
+    const SkipEntry &getSkipEntry(uint32_t block) const { return _skip[block]; }
+    const SkipEntry *skipBegin() const { return _skip.data(); }
+    const SkipEntry *skipEnd() const { return skipBegin() + _skip.size(); }
+    uint32_t blockSize(uint32_t block) const {
+        return (block + 1 < numBlocks()) ? BLOCK_SIZE : (_size - block * BLOCK_SIZE);
+    }
+
+    /*
+     * Decode the document ids in the given block into dst, which must
+     * have room for BLOCK_SIZE entries. Returns the number of document
+     * ids decoded.
+     */
+    uint32_t decodeBlock(uint32_t block, uint32_t *dst) const;
+
+    template <typename FunctionType>
+    void foreach_key(FunctionType func) const {
+        uint32_t docIds[BLOCK_SIZE];
+        for (uint32_t block = 0; block < numBlocks(); ++block) {
+            uint32_t count = decodeBlock(block, docIds);
+            for (uint32_t i = 0; i < count; ++i) {
+                func(docIds[i]);
+            }
+        }
+    }
+
+    size_t extraByteSize() const;
+};
+
+/*
+ * Iterator over a compressed posting list, keeping one decoded block.
+ * Has the same interface as the inner posting list iterators used by
+ * attribute posting list search iterators.
+ */
+class CompressedPostingListIterator
+{
+    using SkipEntry = CompressedPostingList::SkipEntry;
+    static constexpr uint32_t BLOCK_SIZE = CompressedPostingList::BLOCK_SIZE;
+
+    const CompressedPostingList *_list;
+    uint32_t _block;
+    uint32_t _pos;
+    uint32_t _blockSize;
+    uint32_t _docIds[BLOCK_SIZE];
+
+    void loadBlock(uint32_t block);
+    // Position at first document id >= docId, looking no further back than firstBlock
+    void seekBlock(uint32_t firstBlock, uint32_t docId);
+public:
+    CompressedPostingListIterator();
+    CompressedPostingListIterator(const CompressedPostingList &list);
+
+    bool valid() const { return _pos < _blockSize; }
+    uint32_t getKey() const { return _docIds[_pos]; }
+    int32_t getData() const { return 1; }
+    btree::MinMaxAggregated getAggregated() const { return btree::MinMaxAggregated(1, 1); }
+    uint32_t size() const { return (_list != nullptr) ? _list->size() : 0u; }
+
+    CompressedPostingListIterator & operator++() {
+        if (++_pos == _blockSize) {
+            loadBlock(_block + 1);
+        }
+        return *this;
+    }
+
+    void linearSeek(uint32_t docId) {
+        if (valid() && getKey() < docId) {
+            if (_list->getSkipEntry(_block)._lastDocId < docId) {
+                seekBlock(_block + 1, docId);
+            } else {
+                while (_docIds[_pos] < docId) {
+                    ++_pos;
+                }
+            }
+        }
+    }
+
+    void lower_bound(uint32_t docId) { seekBlock(0, docId); }
+};
+
+}
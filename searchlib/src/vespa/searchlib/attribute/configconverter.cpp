@@ -10,6 +10,8 @@ namespace {
 
 using search::attribute::CollectionType;
 using search::attribute::BasicType;
+using search::attribute::DistanceMetric;
+using search::attribute::HnswIndexParams;
 using vespalib::eval::ValueType;
 
 typedef std::map<AttributesConfig::Attribute::Datatype, BasicType::Type> DataTypeMap;
@@ -46,6 +48,18 @@ getCollectionTypeMap()
     return map;
 }
 
+DistanceMetric
+getDistanceMetric(AttributesConfig::Attribute::Distancemetric metric)
+{
+    switch (metric) {
+    case AttributesConfig::Attribute::ANGULAR:
+        return DistanceMetric::Angular;
+    case AttributesConfig::Attribute::EUCLIDEAN:
+    default:
+        return DistanceMetric::Euclidean;
+    }
+}
+
 static DataTypeMap _dataTypeMap = getDataTypeMap();
 static CollectionTypeMap _collectionTypeMap = getCollectionTypeMap();
 
@@ -69,6 +83,14 @@ ConfigConverter::convert(const AttributesConfig::Attribute & cfg)
     retval.setIsFilter(cfg.enableonlybitvector);
     retval.setFastAccess(cfg.fastaccess);
     retval.setMutable(cfg.ismutable);
+    retval.setHashDictionary(cfg.dictionary.type == AttributesConfig::Attribute::Dictionary::HASH);
+    retval.setPaged(cfg.paged);
+    retval.setBitVectorCacheSize(cfg.bitvectorcache.maxbytes);
+    retval.setCompressedPostingLists(cfg.compressedpostinglists);
+    CompactionStrategy compactionStrategy;
+    retval.setCompactionStrategy(CompactionStrategy(compactionStrategy.getMaxDeadBytesRatio(),
+                                                    compactionStrategy.getMaxDeadAddressSpaceRatio(),
+                                                    cfg.compaction.maxdocspercommit));
     predicateParams.setArity(cfg.arity);
     predicateParams.setBounds(cfg.lowerbound, cfg.upperbound);
     predicateParams.setDensePostingListThreshold(cfg.densepostinglistthreshold);
@@ -79,6 +101,11 @@ ConfigConverter::convert(const AttributesConfig::Attribute & cfg)
         } else {
             retval.setTensorType(ValueType::tensor_type({}));
         }
+        if (cfg.index.hnsw.enabled) {
+            retval.setHnswIndexParams(HnswIndexParams(cfg.index.hnsw.maxlinkspernode,
+                                                      cfg.index.hnsw.neighborstoexploreatinsert,
+                                                      getDistanceMetric(cfg.distancemetric)));
+        }
     }
     return retval;
 }
@@ -0,0 +1,155 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "enum_store_hash_index.h"
+#include <cassert>
+
+namespace search {
+
+using datastore::EntryRef;
+
+class EnumStoreHashIndex::HeldTable : public vespalib::GenerationHeldBase
+{
+    std::unique_ptr<Table> _table;
+public:
+    HeldTable(std::unique_ptr<Table> table)
+        : GenerationHeldBase(table->size() * sizeof(uint64_t)),
+          _table(std::move(table))
+    { }
+    ~HeldTable() override = default;
+};
+
+EnumStoreHashIndex::Table::Table(uint32_t size)
+    : _slots(new std::atomic<uint64_t>[size]),
+      _mask(size - 1)
+{
+    assert((size & _mask) == 0);
+    for (uint32_t i = 0; i < size; ++i) {
+        _slots[i].store(EMPTY, std::memory_order_relaxed);
+    }
+}
+
+EnumStoreHashIndex::Table::~Table() = default;
+
+EnumStoreHashIndex::EnumStoreHashIndex()
+    : _table(nullptr),
+      _owned(),
+      _numLive(0),
+      _numUsed(0),
+      _genHolder()
+{
+    publish(std::make_unique<Table>(MIN_SIZE));
+}
+
+EnumStoreHashIndex::~EnumStoreHashIndex()
+{
+    _genHolder.clearHoldLists();
+}
+
+uint32_t
+EnumStoreHashIndex::calcSize(uint32_t numEntries)
+{
+    // Keep load factor at most 0.5 after a rebuild.
+    uint32_t size = MIN_SIZE;
+    while (size < 2 * static_cast<uint64_t>(numEntries)) {
+        size *= 2;
+    }
+    return size;
+}
+
+void
+EnumStoreHashIndex::publish(std::unique_ptr<Table> table)
+{
+    std::unique_ptr<Table> old(std::move(_owned));
+    _owned = std::move(table);
+    _table.store(_owned.get(), std::memory_order_release);
+    if (old) {
+        _genHolder.hold(std::make_unique<HeldTable>(std::move(old)));
+    }
+}
+
+void
+EnumStoreHashIndex::insertSlot(Table &table, uint64_t slot)
+{
+    uint32_t mask = table.mask();
+    for (uint32_t i = slotHash(slot) & mask; ; i = (i + 1) & mask) {
+        uint64_t old = table.slot(i).load(std::memory_order_relaxed);
+        if (!isLive(old)) {
+            table.slot(i).store(slot, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+void
+EnumStoreHashIndex::rehash(uint32_t numEntries)
+{
+    auto table = std::make_unique<Table>(calcSize(numEntries));
+    const Table &old = *_owned;
+    for (uint32_t i = 0; i < old.size(); ++i) {
+        uint64_t slot = old.slot(i).load(std::memory_order_relaxed);
+        if (isLive(slot)) {
+            insertSlot(*table, slot);
+        }
+    }
+    publish(std::move(table));
+    _numUsed = _numLive;
+}
+
+void
+EnumStoreHashIndex::insert(uint32_t hash, EntryRef ref)
+{
+    if (4 * static_cast<uint64_t>(_numUsed + 1) > 3 * static_cast<uint64_t>(_owned->size())) {
+        rehash(_numLive + 1);
+    }
+    Table &table = *_owned;
+    uint64_t slot = makeSlot(hash, ref);
+    uint32_t mask = table.mask();
+    for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+        uint64_t old = table.slot(i).load(std::memory_order_relaxed);
+        if (!isLive(old)) {
+            if (old == EMPTY) {
+                ++_numUsed;
+            }
+            table.slot(i).store(slot, std::memory_order_release);
+            ++_numLive;
+            return;
+        }
+    }
+}
+
+void
+EnumStoreHashIndex::remove(uint32_t hash, EntryRef ref)
+{
+    Table &table = *_owned;
+    uint64_t slot = makeSlot(hash, ref);
+    uint32_t mask = table.mask();
+    for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+        uint64_t old = table.slot(i).load(std::memory_order_relaxed);
+        if (old == slot) {
+            table.slot(i).store(TOMBSTONE, std::memory_order_release);
+            --_numLive;
+            return;
+        }
+        assert(old != EMPTY);
+    }
+}
+
+void
+EnumStoreHashIndex::clear(uint32_t numEntries)
+{
+    publish(std::make_unique<Table>(calcSize(numEntries)));
+    _numLive = 0;
+    _numUsed = 0;
+}
+
+MemoryUsage
+EnumStoreHashIndex::getMemoryUsage() const
+{
+    size_t slotSize = sizeof(uint64_t);
+    MemoryUsage usage(_owned->size() * slotSize, _numLive * slotSize,
+                      (_numUsed - _numLive) * slotSize, 0);
+    usage.mergeGenerationHeldBytes(_genHolder.getHeldBytes());
+    return usage;
+}
+
+}
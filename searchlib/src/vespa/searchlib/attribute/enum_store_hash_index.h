@@ -0,0 +1,133 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchlib/datastore/entryref.h>
+#include <vespa/searchlib/util/memoryusage.h>
+#include <vespa/vespalib/util/generationholder.h>
+#include <atomic>
+#include <cassert>
+#include <memory>
+
+namespace search {
+
+/**
+ * Hash index mapping from value hash to enum store entry, used beside the
+ * btree dictionary to resolve exact values without walking the tree.
+ *
+ * Open addressing with linear probing. Each slot is a single 64-bit word
+ * holding the hash value (upper half, with the top bit set for live slots)
+ * and the enum store entry ref (lower half), thus readers never see a torn
+ * slot. Removed entries leave a tombstone until the table is rebuilt.
+ *
+ * There is a single writer. Readers can run concurrently with the writer;
+ * when the table is grown or rebuilt a new table is published and the old
+ * one is kept on the hold list until no reader can reference it anymore.
+ * Readers must verify candidates against the actual value since different
+ * values can share hash value.
+ */
+class EnumStoreHashIndex
+{
+public:
+    using generation_t = vespalib::GenerationHandler::generation_t;
+
+private:
+    class Table {
+        std::unique_ptr<std::atomic<uint64_t>[]> _slots;
+        uint32_t _mask;
+    public:
+        Table(uint32_t size);
+        ~Table();
+        uint32_t size() const { return _mask + 1; }
+        uint32_t mask() const { return _mask; }
+        std::atomic<uint64_t> &slot(uint32_t i) { return _slots[i]; }
+        const std::atomic<uint64_t> &slot(uint32_t i) const { return _slots[i]; }
+    };
+    class HeldTable;
+
+    static constexpr uint64_t EMPTY = 0;
+    static constexpr uint64_t TOMBSTONE = 1;
+    static constexpr uint32_t LIVE_BIT = 0x80000000u;
+    static constexpr uint32_t MIN_SIZE = 16;
+
+    std::atomic<Table *>       _table;
+    std::unique_ptr<Table>     _owned;
+    uint32_t                   _numLive;
+    uint32_t                   _numUsed; // live entries and tombstones
+    vespalib::GenerationHolder _genHolder;
+
+    static uint32_t liveHash(uint32_t hash) { return hash | LIVE_BIT; }
+    static uint64_t makeSlot(uint32_t hash, datastore::EntryRef ref) {
+        return (static_cast<uint64_t>(liveHash(hash)) << 32) | ref.ref();
+    }
+    static bool isLive(uint64_t slot) { return (slot >> 32) != 0; }
+    static uint32_t slotHash(uint64_t slot) { return slot >> 32; }
+    static datastore::EntryRef slotRef(uint64_t slot) { return datastore::EntryRef(static_cast<uint32_t>(slot)); }
+    static uint32_t calcSize(uint32_t numEntries);
+
+    void publish(std::unique_ptr<Table> table);
+    void rehash(uint32_t numEntries);
+    static void insertSlot(Table &table, uint64_t slot);
+
+public:
+    EnumStoreHashIndex();
+    ~EnumStoreHashIndex();
+
+    /**
+     * Find the entry with the given hash value for which equal(ref)
+     * returns true. Safe to call from reader threads.
+     */
+    template <typename Equal>
+    datastore::EntryRef find(uint32_t hash, Equal equal) const {
+        const Table *table = _table.load(std::memory_order_acquire);
+        uint32_t wanted = liveHash(hash);
+        uint32_t mask = table->mask();
+        for (uint32_t i = hash & mask; ; i = (i + 1) & mask) {
+            uint64_t slot = table->slot(i).load(std::memory_order_acquire);
+            if (slot == EMPTY) {
+                return datastore::EntryRef();
+            }
+            if (slotHash(slot) == wanted && equal(slotRef(slot))) {
+                return slotRef(slot);
+            }
+        }
+    }
+
+    /**
+     * Insert an entry that is not already present. The entry must be
+     * fully written before it is inserted.
+     */
+    void insert(uint32_t hash, datastore::EntryRef ref);
+    void remove(uint32_t hash, datastore::EntryRef ref);
+
+    /**
+     * Publish a new empty table, sized for the given number of entries.
+     */
+    void clear(uint32_t numEntries = 0);
+
+    /**
+     * Replace all entries with the ones passed by fill to its argument,
+     * add(hash, ref). The new table is filled before it is published,
+     * thus readers see either all old or all new entries.
+     */
+    template <typename Fill>
+    void rebuild(uint32_t numEntries, Fill fill) {
+        auto table = std::make_unique<Table>(calcSize(numEntries));
+        uint32_t numLive = 0;
+        fill([&table, &numLive](uint32_t hash, datastore::EntryRef ref) {
+                 insertSlot(*table, makeSlot(hash, ref));
+                 ++numLive;
+             });
+        assert(numLive <= numEntries);
+        publish(std::move(table));
+        _numLive = numLive;
+        _numUsed = numLive;
+    }
+    uint32_t size() const { return _numLive; }
+
+    void transferHoldLists(generation_t generation) { _genHolder.transferHoldLists(generation); }
+    void trimHoldLists(generation_t firstUsed) { _genHolder.trimHoldLists(firstUsed); }
+    MemoryUsage getMemoryUsage() const;
+};
+
+}
@@ -13,7 +13,7 @@ EnumAttribute<B>::
 EnumAttribute(const vespalib::string &baseFileName,
               const AttributeVector::Config &cfg)
     : B(baseFileName, cfg),
-      _enumStore(0, cfg.fastSearch())
+      _enumStore(0, cfg.fastSearch(), cfg.hashDictionary())
 {
     this->setEnum(true);
 }
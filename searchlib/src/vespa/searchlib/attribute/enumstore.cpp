@@ -3,6 +3,7 @@
 #include "enumstore.h"
 #include "enumstore.hpp"
 #include <iomanip>
+#include <limits>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".searchlib.attribute.enum_store");
@@ -70,6 +71,47 @@ printEntry(vespalib::asciistream & os, const Entry & e) const
 }
 
 
+namespace {
+
+/*
+ * NaN values compare equal to each other, as do -0.0 and 0.0, thus they
+ * must hash to the same value.
+ */
+template <typename T>
+uint32_t
+hashFloatingPoint(T value)
+{
+    if (std::isnan(value)) {
+        value = std::numeric_limits<T>::quiet_NaN();
+    } else if (value == 0) {
+        value = 0;
+    }
+    return vespalib::hashValue(&value, sizeof(value));
+}
+
+}
+
+template <>
+uint32_t
+EnumStoreT<StringEntryType>::hashValue(Type value)
+{
+    return vespalib::hashValue(value);
+}
+
+template <>
+uint32_t
+EnumStoreT<NumericEntryType<float> >::hashValue(Type value)
+{
+    return hashFloatingPoint(value);
+}
+
+template <>
+uint32_t
+EnumStoreT<NumericEntryType<double> >::hashValue(Type value)
+{
+    return hashFloatingPoint(value);
+}
+
 template <>
 void
 EnumStoreT<StringEntryType>::printValue(vespalib::asciistream & os, Index idx) const
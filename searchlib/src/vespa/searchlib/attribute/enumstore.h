@@ -113,8 +113,8 @@ protected:
     void freeUnusedEnum(Index idx, IndexSet & unused) override;
 
 public:
-    EnumStoreT(uint64_t initBufferSize, bool hasPostings)
-        : EnumStoreBase(initBufferSize, hasPostings)
+    EnumStoreT(uint64_t initBufferSize, bool hasPostings, bool hasHashIndex = false)
+        : EnumStoreBase(initBufferSize, hasPostings, hasHashIndex)
     {
     }
 
@@ -122,6 +122,12 @@ public:
     Type     getValue(uint32_t idx) const { return getValue(Index(datastore::EntryRef(idx))); }
     Type     getValue(Index idx)    const { return getEntry(idx).getValue(); }
     uint32_t getFixedSize() const override { return Entry::fixedSize(); }
+    uint32_t getHash(Index idx) const override { return hashValue(getValue(idx)); }
+
+    /**
+     * Hash value consistent with the equality used by the comparator.
+     */
+    static uint32_t hashValue(Type value);
 
     static uint32_t
     getEntrySize(Type value)
@@ -176,6 +182,8 @@ public:
     void printCurrentContent(vespalib::asciistream &os) const;
 
 private:
+    Index findHashed(Type value) const;
+
     template <typename Dictionary>
     void reset(Builder &builder, Dictionary &dict);
 
@@ -207,6 +215,18 @@ EnumStoreT<StringEntryType>::Entry::getValue() const
 }
 
 
+template <>
+uint32_t
+EnumStoreT<StringEntryType>::hashValue(Type value);
+
+template <>
+uint32_t
+EnumStoreT<NumericEntryType<float> >::hashValue(Type value);
+
+template <>
+uint32_t
+EnumStoreT<NumericEntryType<double> >::hashValue(Type value);
+
 template <>
 void
 EnumStoreT<StringEntryType>::writeValues(BufferWriter &writer,
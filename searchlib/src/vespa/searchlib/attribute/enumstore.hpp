@@ -15,6 +15,7 @@
 #include <vespa/searchlib/btree/btree.hpp>
 #include <vespa/searchlib/util/bufferwriter.h>
 #include <vespa/vespalib/util/array.hpp>
+#include <vespa/vespalib/stllike/hash_fun.h>
 
 namespace search {
 
@@ -177,10 +178,35 @@ EnumStoreT<EntryType>::foldedChange(const Index &idx1, const Index &idx2)
 }
 
 
+template <typename EntryType>
+uint32_t
+EnumStoreT<EntryType>::hashValue(Type value)
+{
+    return vespalib::hashValue(&value, sizeof(value));
+}
+
+
+template <typename EntryType>
+typename EnumStoreT<EntryType>::Index
+EnumStoreT<EntryType>::findHashed(Type value) const
+{
+    return Index(_hashIndex->find(hashValue(value), [this, value](datastore::EntryRef ref)
+                                  { return ComparatorType::compare(value, getValue(Index(ref))) == 0; }));
+}
+
+
 template <typename EntryType>
 bool
 EnumStoreT<EntryType>::findEnum(Type value, EnumStoreBase::EnumHandle &e) const
 {
+    if (_hashIndex) {
+        Index idx = findHashed(value);
+        if (idx.valid()) {
+            e = idx.ref();
+            return true;
+        }
+        return false;
+    }
     ComparatorType cmp(*this, value);
     Index idx;
     if (_enumDict->findFrozenIndex(cmp, idx)) {
@@ -203,6 +229,10 @@ template <typename EntryType>
 bool
 EnumStoreT<EntryType>::findIndex(Type value, Index &idx) const
 {
+    if (_hashIndex) {
+        idx = findHashed(value);
+        return idx.valid();
+    }
     ComparatorType cmp(*this, value);
     return _enumDict->findIndex(cmp, idx);
 }
@@ -276,6 +306,7 @@ EnumStoreT<EntryType>::addEnum(Type value, Index &newIdx, Dictionary &dict)
 
     // update tree with new index
     dict.insert(it, newIdx, typename Dictionary::DataType());
+    this->insertInHashIndex(hashValue(value), newIdx);
 
     // Copy posting list idx from next entry if same
     // folded value.
@@ -368,6 +399,7 @@ EnumStoreT<EntryType>::reset(Builder &builder, Dictionary &dict)
 
     // reset Dictionary
     dict.assign(treeBuilder); // destructive copy of treeBuilder
+    this->rebuildHashIndex(dict);
 }
 
 
@@ -442,6 +474,7 @@ EnumStoreT<EntryType>::performCompaction(Dictionary &dict, EnumIndexMap & old2Ne
     if (disabledReEnumerate) {
         newEnum = this->_nextEnum; // use old range of enum values
     }
+    this->rebuildHashIndex(dict);
     this->postCompact(newEnum);
 }
 
@@ -64,11 +64,14 @@ EnumStoreBase::EnumBufferType::calcArraysToAlloc(uint32_t bufferId, size_t sizeN
 }
 
 EnumStoreBase::EnumStoreBase(uint64_t initBufferSize,
-                             bool hasPostings)
+                             bool hasPostings,
+                             bool hasHashIndex)
     : _enumDict(nullptr),
+      _hashIndex(),
       _store(),
       _type(),
       _nextEnum(0),
+      _compactionCount(0),
       _toHoldBuffers(),
       _disabledReEnumerate(false)
 {
@@ -76,6 +79,9 @@ EnumStoreBase::EnumStoreBase(uint64_t initBufferSize,
         _enumDict = new EnumStoreDict<EnumPostingTree>(*this);
     else
         _enumDict = new EnumStoreDict<EnumTree>(*this);
+    if (hasHashIndex) {
+        _hashIndex = std::make_unique<EnumStoreHashIndex>();
+    }
     _store.addType(&_type);
     _type.setSizeNeededAndDead(initBufferSize, 0);
     _store.initActiveBuffers();
@@ -96,7 +102,11 @@ EnumStoreBase::reset(uint64_t initBufferSize)
     _type.setSizeNeededAndDead(initBufferSize, 0);
     _store.initActiveBuffers();
     _enumDict->onReset();
+    if (_hashIndex) {
+        _hashIndex->clear();
+    }
     _nextEnum = 0;
+    ++_compactionCount;
 }
 
 uint32_t
@@ -116,6 +126,16 @@ EnumStoreBase::getMemoryUsage() const
     return _store.getMemoryUsage();
 }
 
+MemoryUsage
+EnumStoreBase::getTreeMemoryUsage() const
+{
+    MemoryUsage usage = _enumDict->getTreeMemoryUsage();
+    if (_hashIndex) {
+        usage.merge(_hashIndex->getMemoryUsage());
+    }
+    return usage;
+}
+
 AddressSpace
 EnumStoreBase::getAddressSpaceUsage() const
 {
@@ -127,6 +147,9 @@ void
 EnumStoreBase::transferHoldLists(generation_t generation)
 {
     _enumDict->onTransferHoldLists(generation);
+    if (_hashIndex) {
+        _hashIndex->transferHoldLists(generation);
+    }
     _store.transferHoldLists(generation);
 }
 
@@ -135,6 +158,9 @@ EnumStoreBase::trimHoldLists(generation_t firstUsed)
 {
     // remove generations in the range [0, firstUsed>
     _enumDict->onTrimHoldLists(firstUsed);
+    if (_hashIndex) {
+        _hashIndex->trimHoldLists(firstUsed);
+    }
     _store.trimHoldLists(firstUsed);
 }
 
@@ -184,6 +210,7 @@ EnumStoreBase::postCompact(uint32_t newEnum)
 {
     _store.finishCompact(_toHoldBuffers);
     _nextEnum = newEnum;
+    ++_compactionCount;
 }
 
 void
@@ -256,11 +283,27 @@ EnumStoreBase::deserialize(const void *src,
             builder.insert(*i, typename Tree::DataType());
         }
         tree.assign(builder);
+        rebuildHashIndex(tree);
     }
     return sz;
 }
 
 
+template <typename Tree>
+void
+EnumStoreBase::rebuildHashIndex(const Tree &tree)
+{
+    if (!_hashIndex) {
+        return;
+    }
+    _hashIndex->rebuild(tree.size(), [this, &tree](auto add) {
+        for (typename Tree::Iterator it(tree.begin()); it.valid(); ++it) {
+            add(getHash(it.getKey()), it.getKey());
+        }
+    });
+}
+
+
 template <typename Tree>
 void
 EnumStoreBase::fixupRefCounts(const EnumVector &hist, Tree &tree)
@@ -401,6 +444,7 @@ EnumStoreDict<Dictionary>::removeUnusedEnums(const IndexSet &unused,
          iter != mt; ++iter) {
         it.lower_bound(_dict.getRoot(), *iter, cmp);
         assert(it.valid() && !cmp(*iter, it.getKey()));
+        _enumStore.removeFromHashIndex(*iter);
         if (Iterator::hasData() && fcmp != nullptr) {
             typename Dictionary::DataType pidx(it.getData());
             _dict.remove(it);
@@ -626,6 +670,14 @@ template
 void
 EnumStoreBase::fixupRefCounts<EnumPostingTree>(const EnumVector &hist, EnumPostingTree &tree);
 
+template
+void
+EnumStoreBase::rebuildHashIndex<EnumTree>(const EnumTree &tree);
+
+template
+void
+EnumStoreBase::rebuildHashIndex<EnumPostingTree>(const EnumPostingTree &tree);
+
 template class EnumStoreDict<EnumTree>;
 
 template class EnumStoreDict<EnumPostingTree>;
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "enum_store_hash_index.h"
 #include <vespa/searchcommon/attribute/iattributevector.h>
 #include <vespa/searchlib/common/address_space.h>
 #include <vespa/searchlib/datastore/datastore.h>
@@ -238,16 +239,18 @@ protected:
     };
 
     EnumStoreDictBase    *_enumDict;
+    std::unique_ptr<EnumStoreHashIndex> _hashIndex;
     DataStoreType         _store;
     EnumBufferType        _type;
     uint32_t              _nextEnum;
+    uint32_t              _compactionCount; // number of times enum indexes have been remapped
     std::vector<uint32_t> _toHoldBuffers; // used during compaction
     // set before backgound flush, cleared during background flush
     mutable std::atomic<bool> _disabledReEnumerate;
 
     static const uint32_t TYPE_ID = 0;
 
-    EnumStoreBase(uint64_t initBufferSize, bool hasPostings);
+    EnumStoreBase(uint64_t initBufferSize, bool hasPostings, bool hasHashIndex);
 
     virtual ~EnumStoreBase();
 
@@ -264,6 +267,12 @@ protected:
         return (idx.valid() && idx.offset() < _store.getBufferState(idx.bufferId()).size());
     }
 
+    void insertInHashIndex(uint32_t hash, Index idx) {
+        if (_hashIndex) {
+            _hashIndex->insert(hash, idx);
+        }
+    }
+
     uint32_t getBufferIndex(datastore::BufferState::State status);
     void postCompact(uint32_t newEnum);
     bool preCompact(uint64_t bytesNeeded);
@@ -289,6 +298,7 @@ public:
     void fixupRefCounts(const EnumVector &hist, Tree &tree);
 
     uint32_t getLastEnum()          const { return _nextEnum ? _nextEnum - 1 : _nextEnum; }
+    uint32_t getCompactionCount()   const { return _compactionCount; }
     uint32_t getNumUniques() const { return _enumDict->getNumUniques(); }
 
     uint32_t getRemaining() const {
@@ -298,7 +308,7 @@ public:
         return _store.getBufferState(_store.getActiveBufferId(TYPE_ID)).capacity();
     }
     MemoryUsage getMemoryUsage() const;
-    MemoryUsage getTreeMemoryUsage() const { return _enumDict->getTreeMemoryUsage(); }
+    MemoryUsage getTreeMemoryUsage() const;
 
     AddressSpace getAddressSpaceUsage() const;
 
@@ -352,6 +362,20 @@ public:
 
     virtual bool performCompaction(uint64_t bytesNeeded, EnumIndexMap & old2New) = 0;
 
+    /**
+     * Hash value of the value for the given entry, as used by the hash index.
+     */
+    virtual uint32_t getHash(Index idx) const = 0;
+    bool hasHashIndex() const { return static_cast<bool>(_hashIndex); }
+    void removeFromHashIndex(Index idx) {
+        if (_hashIndex) {
+            _hashIndex->remove(getHash(idx), idx);
+        }
+    }
+
+    template <typename Tree>
+    void rebuildHashIndex(const Tree &tree);
+
     EnumStoreDictBase &getEnumStoreDict() { return *_enumDict; }
     const EnumStoreDictBase &getEnumStoreDict() const { return *_enumDict; }
     EnumPostingTree &getPostingDictionary() { return _enumDict->getPostingDictionary(); }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <vespa/searchlib/docstore/cachestats.h>
 
 namespace search
 {
@@ -24,6 +25,7 @@ public:
 
     virtual void forwardedShrinkLidSpace(uint32_t newSize) = 0;
     virtual MemoryUsage getMemoryUsage() const = 0;
+    virtual CacheStats getBitVectorCacheStats() const = 0;
 };
 
 
@@ -43,6 +43,15 @@ public:
         return _children[ref].getData();
     }
 
+    // Posting list b-tree leaf nodes are used as blocks for block-max WAND
+    int32_t get_block_max_weight(uint16_t ref) const {
+        return _children[ref].getLeafAggregated().getMax();
+    }
+
+    uint32_t get_block_last_docid(uint16_t ref) const {
+        return _children[ref].getLeafLastKey();
+    }
+
     std::unique_ptr<BitVector> get_hits(uint32_t begin_id, uint32_t end_id);
     void or_hits_into(BitVector &result, uint32_t begin_id);
 
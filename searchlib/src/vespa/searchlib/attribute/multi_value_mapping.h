@@ -44,7 +44,7 @@ public:
 
     void doneLoadFromMultiValue() { _store.setInitializing(false); }
 
-    void compactWorst(bool compactMemory, bool compactAddressSpace) override;
+    datastore::ICompactionContext::UP startCompactWorstBuffers(bool compactMemory, bool compactAddressSpace) override;
 
     AddressSpace getAddressSpaceUsage() const override;
     MemoryUsage getArrayStoreMemoryUsage() const override;
@@ -16,7 +16,11 @@ MultiValueMapping<EntryT,RefT>::MultiValueMapping(const datastore::ArrayStoreCon
 }
 
 template <typename EntryT, typename RefT>
-MultiValueMapping<EntryT,RefT>::~MultiValueMapping() = default;
+MultiValueMapping<EntryT,RefT>::~MultiValueMapping()
+{
+    // Compaction context refers to the array store
+    _compactionContext.reset();
+}
 
 template <typename EntryT, typename RefT>
 void
@@ -44,13 +48,10 @@ MultiValueMapping<EntryT,RefT>::replace(uint32_t docId, ConstArrayRef values)
 }
 
 template <typename EntryT, typename RefT>
-void
-MultiValueMapping<EntryT,RefT>::compactWorst(bool compactMemory, bool compactAddressSpace)
+datastore::ICompactionContext::UP
+MultiValueMapping<EntryT,RefT>::startCompactWorstBuffers(bool compactMemory, bool compactAddressSpace)
 {
-    datastore::ICompactionContext::UP compactionContext(_store.compactWorst(compactMemory, compactAddressSpace));
-    if (compactionContext) {
-        compactionContext->compact(vespalib::ArrayRef<EntryRef>(&_indices[0], _indices.size()));
-    }
+    return _store.compactWorst(compactMemory, compactAddressSpace);
 }
 
 template <typename EntryT, typename RefT>
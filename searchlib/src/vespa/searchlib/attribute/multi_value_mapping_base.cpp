@@ -18,7 +18,11 @@ MultiValueMappingBase::MultiValueMappingBase(const GrowStrategy &gs,
     : _indices(gs, genHolder),
       _totalValues(0u),
       _cachedArrayStoreMemoryUsage(),
-      _cachedArrayStoreAddressSpaceUsage(0, 0, (1ull << 32))
+      _cachedArrayStoreAddressSpaceUsage(0, 0, (1ull << 32)),
+      _compactionContext(),
+      _compactionDocId(0),
+      _compactionDocIdLimit(0),
+      _compactions(0)
 {
 }
 
@@ -81,9 +85,53 @@ MultiValueMappingBase::updateStat()
     return retval;
 }
 
+void
+MultiValueMappingBase::startCompactWorst(bool compactMemory, bool compactAddressSpace)
+{
+    if (compactionInProgress()) {
+        continueCompact(0);
+    }
+    _compactionContext = startCompactWorstBuffers(compactMemory, compactAddressSpace);
+    _compactionDocId = 0;
+    _compactionDocIdLimit = _indices.size();
+}
+
+void
+MultiValueMappingBase::continueCompact(uint32_t maxDocs)
+{
+    assert(compactionInProgress());
+    // Lid space might have been shrunk since compaction started
+    _compactionDocIdLimit = std::min(_compactionDocIdLimit, static_cast<uint32_t>(_indices.size()));
+    uint32_t endDocId = _compactionDocIdLimit;
+    if ((maxDocs != 0) && (_compactionDocId < endDocId) && (endDocId - _compactionDocId > maxDocs)) {
+        endDocId = _compactionDocId + maxDocs;
+    }
+    if (_compactionDocId < endDocId) {
+        _compactionContext->compact(vespalib::ArrayRef<EntryRef>(&_indices[_compactionDocId], endDocId - _compactionDocId));
+    }
+    _compactionDocId = endDocId;
+    if (_compactionDocId >= _compactionDocIdLimit) {
+        _compactionContext.reset();
+        _compactionDocId = 0;
+        _compactionDocIdLimit = 0;
+        ++_compactions;
+    }
+}
+
+void
+MultiValueMappingBase::compactWorst(bool compactMemory, bool compactAddressSpace)
+{
+    startCompactWorst(compactMemory, compactAddressSpace);
+    continueCompact(0);
+}
+
 bool
 MultiValueMappingBase::considerCompact(const CompactionStrategy &compactionStrategy)
 {
+    if (compactionInProgress()) {
+        continueCompact(compactionStrategy.getMaxCompactDocsPerCommit());
+        return true;
+    }
     size_t usedBytes = _cachedArrayStoreMemoryUsage.usedBytes();
     size_t deadBytes = _cachedArrayStoreMemoryUsage.deadBytes();
     size_t usedArrays = _cachedArrayStoreAddressSpaceUsage.used();
@@ -93,7 +141,8 @@ MultiValueMappingBase::considerCompact(const CompactionStrategy &compactionStrat
     bool compactAddressSpace = ((deadArrays >= DEAD_ARRAYS_SLACK) &&
                                 (usedArrays * compactionStrategy.getMaxDeadAddressSpaceRatio() < deadArrays));
     if (compactMemory || compactAddressSpace) {
-        compactWorst(compactMemory, compactAddressSpace);
+        startCompactWorst(compactMemory, compactAddressSpace);
+        continueCompact(compactionStrategy.getMaxCompactDocsPerCommit());
         return true;
     }
     return false;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <vespa/searchlib/datastore/entryref.h>
+#include <vespa/searchlib/datastore/i_compaction_context.h>
 #include <vespa/searchlib/common/rcuvector.h>
 #include <vespa/searchlib/common/address_space.h>
 #include <functional>
@@ -25,9 +26,14 @@ protected:
     size_t    _totalValues;
     MemoryUsage _cachedArrayStoreMemoryUsage;
     AddressSpace _cachedArrayStoreAddressSpaceUsage;
+    datastore::ICompactionContext::UP _compactionContext; // Set while a compaction is in progress
+    uint32_t _compactionDocId; // Next document to be moved by compaction in progress
+    uint32_t _compactionDocIdLimit; // Documents added after compaction started have no values to move
+    uint64_t _compactions;
 
     MultiValueMappingBase(const GrowStrategy &gs, vespalib::GenerationHolder &genHolder);
     virtual ~MultiValueMappingBase();
+    virtual datastore::ICompactionContext::UP startCompactWorstBuffers(bool compactMemory, bool compactAddressSpace) = 0;
 
     void updateValueCount(size_t oldValues, size_t newValues) {
         _totalValues += newValues - oldValues;
@@ -51,8 +57,25 @@ public:
 
     uint32_t getNumKeys() const { return _indices.size(); }
     uint32_t getCapacityKeys() const { return _indices.capacity(); }
-    virtual void compactWorst(bool compatMemory, bool compactAddressSpace) = 0;
+
+    /*
+     * Start compacting the worst buffers. Values for documents are moved
+     * out of these buffers by calls to continueCompact(), and the
+     * buffers are put on hold when all documents have been visited.
+     */
+    void startCompactWorst(bool compactMemory, bool compactAddressSpace);
+    /*
+     * Move values for up to maxDocs documents (0 means all remaining
+     * documents) for the compaction in progress.
+     */
+    void continueCompact(uint32_t maxDocs);
+    void compactWorst(bool compactMemory, bool compactAddressSpace);
     bool considerCompact(const CompactionStrategy &compactionStrategy);
+    bool compactionInProgress() const { return static_cast<bool>(_compactionContext); }
+    uint32_t getPendingCompactionDocs() const {
+        return compactionInProgress() ? (_compactionDocIdLimit - _compactionDocId) : 0u;
+    }
+    uint64_t getCompactions() const { return _compactions; }
 };
 
 }
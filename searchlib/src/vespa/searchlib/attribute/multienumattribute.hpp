@@ -167,6 +167,7 @@ MultiValueEnumAttribute<B, M>::onUpdateStat()
     mergeMemoryStats(total);
     this->updateStatistics(this->_mvMapping.getTotalValueCnt(), this->_enumStore.getNumUniques(), total.allocatedBytes(),
                      total.usedBytes(), total.deadBytes(), total.allocatedBytesOnHold());
+    this->getStatus().setCompactionProgress(this->_mvMapping.getCompactions(), this->_mvMapping.getPendingCompactionDocs());
 }
 
 template <typename B, typename M>
@@ -79,6 +79,7 @@ void MultiValueNumericAttribute<B, M>::onUpdateStat()
     usage.merge(this->getChangeVectorMemoryUsage());
     this->updateStatistics(this->_mvMapping.getTotalValueCnt(), this->_mvMapping.getTotalValueCnt(), usage.allocatedBytes(),
                            usage.usedBytes(), usage.deadBytes(), usage.allocatedBytesOnHold());
+    this->getStatus().setCompactionProgress(this->_mvMapping.getCompactions(), this->_mvMapping.getPendingCompactionDocs());
 }
 
 
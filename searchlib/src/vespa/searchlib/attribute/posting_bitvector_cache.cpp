@@ -0,0 +1,206 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "posting_bitvector_cache.h"
+#include "enumstorebase.h"
+#include <vespa/searchlib/common/bitvector.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
+#include <algorithm>
+
+namespace search::attribute {
+
+namespace {
+
+constexpr uint32_t SKETCH_WIDTH = 4096;
+constexpr uint8_t MAX_FREQUENCY = 15;
+
+uint64_t
+mix(uint64_t hash)
+{
+    // Finalizer from MurmurHash3, spreads the bits of the weak string hash
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+}
+
+PostingBitVectorCache::Entry::Entry(const vespalib::string &key_, BitVectorSP bitVector_, uint32_t docIdLimit_,
+                                    EntryRef lowBound_, EntryRef highBound_, generation_t generation_, size_t bytes_)
+    : key(key_),
+      bitVector(std::move(bitVector_)),
+      docIdLimit(docIdLimit_),
+      lowBound(lowBound_),
+      highBound(highBound_),
+      generation(generation_),
+      bytes(bytes_)
+{
+}
+
+PostingBitVectorCache::Entry::~Entry() = default;
+
+PostingBitVectorCache::FrequencySketch::FrequencySketch(uint32_t width)
+    : _counters(DEPTH * width, 0),
+      _mask(width - 1),
+      _additions(0),
+      _sampleSize(10 * width)
+{
+}
+
+PostingBitVectorCache::FrequencySketch::~FrequencySketch() = default;
+
+uint32_t
+PostingBitVectorCache::FrequencySketch::index(size_t hash, uint32_t row) const
+{
+    uint64_t mixed = mix(hash);
+    uint32_t h1 = mixed;
+    uint32_t h2 = (mixed >> 32) | 1;
+    return row * (_mask + 1) + ((h1 + row * h2) & _mask);
+}
+
+void
+PostingBitVectorCache::FrequencySketch::increment(size_t hash)
+{
+    for (uint32_t row = 0; row < DEPTH; ++row) {
+        uint8_t &counter = _counters[index(hash, row)];
+        if (counter < MAX_FREQUENCY) {
+            ++counter;
+        }
+    }
+    if (++_additions >= _sampleSize) {
+        // Age all frequencies, letting the sketch adapt to new term popularity
+        for (auto &counter : _counters) {
+            counter >>= 1;
+        }
+        _additions /= 2;
+    }
+}
+
+uint32_t
+PostingBitVectorCache::FrequencySketch::frequency(size_t hash) const
+{
+    uint32_t result = MAX_FREQUENCY;
+    for (uint32_t row = 0; row < DEPTH; ++row) {
+        result = std::min(result, static_cast<uint32_t>(_counters[index(hash, row)]));
+    }
+    return result;
+}
+
+PostingBitVectorCache::PostingBitVectorCache(size_t maxBytes)
+    : _mutex(),
+      _maxBytes(maxBytes),
+      _usedBytes(0),
+      _lru(),
+      _map(),
+      _sketch(SKETCH_WIDTH),
+      _invalidatedGeneration(0),
+      _stats()
+{
+}
+
+PostingBitVectorCache::~PostingBitVectorCache() = default;
+
+void
+PostingBitVectorCache::erase(LruList::iterator itr)
+{
+    _usedBytes -= itr->bytes;
+    _map.erase(itr->key);
+    _lru.erase(itr);
+}
+
+PostingBitVectorCache::BitVectorSP
+PostingBitVectorCache::find(const vespalib::string &key, generation_t generation, uint32_t docIdLimit)
+{
+    LockGuard guard(_mutex);
+    _sketch.increment(vespalib::hashValue(key.data(), key.size()));
+    auto itr = _map.find(key);
+    if (itr != _map.end()) {
+        const Entry &entry = *itr->second;
+        // Entries made by newer readers might contain documents not visible to this reader
+        if (entry.generation <= generation && entry.docIdLimit <= docIdLimit) {
+            _lru.splice(_lru.begin(), _lru, itr->second);
+            ++_stats.hits;
+            return entry.bitVector;
+        }
+    }
+    ++_stats.misses;
+    return BitVectorSP();
+}
+
+void
+PostingBitVectorCache::insert(const vespalib::string &key, BitVectorSP bitVector, uint32_t docIdLimit,
+                              EntryRef lowBound, EntryRef highBound, generation_t generation)
+{
+    size_t bytes = bitVector->sizeBytes() + key.size() + sizeof(Entry);
+    LockGuard guard(_mutex);
+    if (generation < _invalidatedGeneration || bytes > _maxBytes) {
+        return;
+    }
+    auto itr = _map.find(key);
+    if (itr != _map.end()) {
+        erase(itr->second);
+    }
+    uint32_t frequency = _sketch.frequency(vespalib::hashValue(key.data(), key.size()));
+    while (_usedBytes + bytes > _maxBytes) {
+        Entry &victim = _lru.back();
+        if (frequency <= _sketch.frequency(vespalib::hashValue(victim.key.data(), victim.key.size()))) {
+            return;
+        }
+        erase(std::prev(_lru.end()));
+    }
+    _lru.emplace_front(key, std::move(bitVector), docIdLimit, lowBound, highBound, generation, bytes);
+    _map[key] = _lru.begin();
+    _usedBytes += bytes;
+}
+
+void
+PostingBitVectorCache::invalidate(const std::vector<EntryRef> &changes, const EnumStoreComparator &cmp,
+                                  generation_t visibleGeneration)
+{
+    auto less = [&cmp](EntryRef lhs, EntryRef rhs) { return cmp(EnumStoreBase::Index(lhs), EnumStoreBase::Index(rhs)); };
+    LockGuard guard(_mutex);
+    _invalidatedGeneration = visibleGeneration;
+    for (auto itr = _lru.begin(); itr != _lru.end(); ) {
+        auto first = itr->lowBound.valid()
+                     ? std::lower_bound(changes.begin(), changes.end(), itr->lowBound, less)
+                     : changes.begin();
+        if (first != changes.end() && (!itr->highBound.valid() || !less(itr->highBound, *first))) {
+            ++_stats.invalidations;
+            erase(itr++);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+void
+PostingBitVectorCache::clear(generation_t visibleGeneration)
+{
+    LockGuard guard(_mutex);
+    _invalidatedGeneration = visibleGeneration;
+    _stats.invalidations += _lru.size();
+    _map.clear();
+    _lru.clear();
+    _usedBytes = 0;
+}
+
+size_t
+PostingBitVectorCache::size() const
+{
+    LockGuard guard(_mutex);
+    return _lru.size();
+}
+
+CacheStats
+PostingBitVectorCache::getStats() const
+{
+    LockGuard guard(_mutex);
+    CacheStats stats(_stats);
+    stats.elements = _lru.size();
+    stats.memory_used = _usedBytes;
+    return stats;
+}
+
+}
@@ -0,0 +1,126 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchlib/datastore/entryref.h>
+#include <vespa/searchlib/docstore/cachestats.h>
+#include <vespa/vespalib/stllike/hash_map.h>
+#include <vespa/vespalib/stllike/string.h>
+#include <vespa/vespalib/util/generationhandler.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace search {
+
+class BitVector;
+class EnumStoreComparator;
+
+namespace attribute {
+
+/**
+ * Cache of merged posting lists (as bitvectors) for terms matching
+ * multiple values in a fast-search attribute, e.g. range, prefix and
+ * regex terms. Used across queries.
+ *
+ * Memory usage is bounded. New entries are admitted using TinyLFU: when
+ * the cache is full a term is only admitted if it has been looked up more
+ * frequently than the least recently used entry it would evict. Lookup
+ * frequencies are tracked by a small count-min sketch that is aged by
+ * halving all counters at regular intervals.
+ *
+ * Each entry remembers the dictionary entries bounding the range of values
+ * it was merged from. When posting lists change the writer invalidates the
+ * entries with a bounding range covering any of the changed values, thus
+ * entries for unrelated terms survive attribute commits.
+ */
+class PostingBitVectorCache
+{
+public:
+    using BitVectorSP = std::shared_ptr<BitVector>;
+    using EntryRef = datastore::EntryRef;
+    using generation_t = vespalib::GenerationHandler::generation_t;
+
+private:
+    struct Entry {
+        vespalib::string key;
+        BitVectorSP bitVector;
+        uint32_t    docIdLimit;
+        EntryRef    lowBound;   // exclusive, invalid means unbounded
+        EntryRef    highBound;  // exclusive, invalid means unbounded
+        generation_t generation;
+        size_t      bytes;
+        Entry(const vespalib::string &key_, BitVectorSP bitVector_, uint32_t docIdLimit_,
+              EntryRef lowBound_, EntryRef highBound_, generation_t generation_, size_t bytes_);
+        ~Entry();
+    };
+    using LruList = std::list<Entry>;
+    using Map = vespalib::hash_map<vespalib::string, LruList::iterator>;
+
+    class FrequencySketch {
+        static constexpr uint32_t DEPTH = 4;
+        std::vector<uint8_t> _counters;
+        uint32_t _mask;
+        uint32_t _additions;
+        uint32_t _sampleSize;
+        uint32_t index(size_t hash, uint32_t row) const;
+    public:
+        FrequencySketch(uint32_t width);
+        ~FrequencySketch();
+        void increment(size_t hash);
+        uint32_t frequency(size_t hash) const;
+    };
+
+    using LockGuard = std::lock_guard<std::mutex>;
+
+    mutable std::mutex _mutex;
+    const size_t     _maxBytes;
+    size_t           _usedBytes;
+    LruList          _lru;        // most recently used first
+    Map              _map;
+    FrequencySketch  _sketch;
+    generation_t     _invalidatedGeneration;
+    CacheStats       _stats;
+
+    void erase(LruList::iterator itr);
+
+public:
+    PostingBitVectorCache(size_t maxBytes);
+    ~PostingBitVectorCache();
+
+    /**
+     * Lookup the bitvector for the given term on behalf of a reader that
+     * started at the given generation with the given docid limit.
+     * Returns an empty pointer on miss.
+     */
+    BitVectorSP find(const vespalib::string &key, generation_t generation, uint32_t docIdLimit);
+
+    /**
+     * Offer a bitvector merged from the dictionary entries strictly between
+     * lowBound and highBound by a reader that started at the given
+     * generation. The bitvector is dropped if the posting lists might have
+     * changed since the reader started or if TinyLFU rejects it.
+     */
+    void insert(const vespalib::string &key, BitVectorSP bitVector, uint32_t docIdLimit,
+                EntryRef lowBound, EntryRef highBound, generation_t generation);
+
+    /**
+     * Invalidate entries covering any of the given values, which must be
+     * sorted according to cmp. Called by the writer before the changed
+     * posting lists become visible to readers at visibleGeneration.
+     */
+    void invalidate(const std::vector<EntryRef> &changes, const EnumStoreComparator &cmp,
+                    generation_t visibleGeneration);
+
+    /**
+     * Invalidate all entries, e.g. when enum indexes have been remapped.
+     */
+    void clear(generation_t visibleGeneration);
+
+    size_t size() const;
+    CacheStats getStats() const;
+};
+
+}
+}
@@ -3,6 +3,7 @@
 #include "postinglistattribute.h"
 #include "loadednumericvalue.h"
 #include "enumcomparator.h"
+#include "postingstore.hpp"
 #include <vespa/vespalib/util/array.hpp>
 
 namespace search {
@@ -18,8 +19,15 @@ PostingListAttributeBase(AttributeVector &attr,
                    attr.getConfig()),
       _attr(attr),
       _dict(enumStore.getPostingDictionary()),
-      _esb(enumStore)
-{ }
+      _esb(enumStore),
+      _bitVectorCache(),
+      _bitVectorCacheCompactionCount(enumStore.getCompactionCount())
+{
+    size_t cacheSize = attr.getConfig().bitVectorCacheSize();
+    if (cacheSize != 0) {
+        _bitVectorCache = std::make_unique<attribute::PostingBitVectorCache>(cacheSize);
+    }
+}
 
 
 template <typename P>
@@ -47,10 +55,31 @@ PostingListAttributeBase<P>::clearAllPostings()
         itr.writeData(EntryRef());
         ++itr;
     }
+    if (_bitVectorCache) {
+        _bitVectorCacheCompactionCount = _esb.getCompactionCount();
+        _bitVectorCache->clear(_attr.getCurrentGeneration() + 1);
+    }
     _attr.incGeneration(); // Force freeze
 }
 
 
+template <typename P>
+void
+PostingListAttributeBase<P>::invalidateBitVectorCache(const std::vector<EntryRef> &changes,
+                                                      const EnumStoreComparator &cmp)
+{
+    // Changes become visible to readers when the generation is bumped
+    AttributeVector::generation_t visibleGeneration = _attr.getCurrentGeneration() + 1;
+    if (_esb.getCompactionCount() != _bitVectorCacheCompactionCount) {
+        // Cached entries refer to remapped enum indexes
+        _bitVectorCacheCompactionCount = _esb.getCompactionCount();
+        _bitVectorCache->clear(visibleGeneration);
+    } else {
+        _bitVectorCache->invalidate(changes, cmp, visibleGeneration);
+    }
+}
+
+
 template <typename P>
 void
 PostingListAttributeBase<P>::fillPostingsFixupEnumBase(
@@ -123,10 +152,17 @@ void
 PostingListAttributeBase<P>::updatePostings(PostingMap &changePost,
                                             EnumStoreComparator &cmp)
 {
+    std::vector<EntryRef> changes;
+    if (_bitVectorCache) {
+        changes.reserve(changePost.size());
+    }
     for (typename PostingMap::iterator
              it(changePost.begin()), mt(changePost.end()); it != mt; it++) {
         PostingChange<P> &change(it->second);
         EnumIndex idx(it->first.getEnumIdx());
+        if (_bitVectorCache) {
+            changes.push_back(idx);
+        }
         typename EnumPostingTree::Iterator dictItr =
             _dict.lowerBound(idx, cmp);
         assert(dictItr.valid() && dictItr.getKey() == idx);
@@ -142,6 +178,10 @@ PostingListAttributeBase<P>::updatePostings(PostingMap &changePost,
         _dict.thaw(dictItr);
         dictItr.writeData(newPosting);
     }
+    if (_bitVectorCache && !changes.empty()) {
+        invalidateBitVectorCache(changes, cmp);
+    }
+    _postingList.considerCompressPostingLists();
 }
 
 
@@ -192,6 +232,9 @@ clearPostings(attribute::IAttributeVector::EnumHandle eidx,
                        postings._removals.size());
     _dict.thaw(di);
     di.writeData(newPosting);
+    if (_bitVectorCache) {
+        invalidateBitVectorCache(std::vector<EntryRef>(1, er), cmp);
+    }
 }
 
 
@@ -209,6 +252,13 @@ PostingListAttributeBase<P>::getMemoryUsage() const
     return _postingList.getMemoryUsage();
 }
 
+template <typename P>
+CacheStats
+PostingListAttributeBase<P>::getBitVectorCacheStats() const
+{
+    return _bitVectorCache ? _bitVectorCache->getStats() : CacheStats();
+}
+
 template <typename P, typename LoadedVector, typename LoadedValueType,
           typename EnumStoreType>
 PostingListAttributeSubBase<P, LoadedVector, LoadedValueType, EnumStoreType>::
@@ -320,10 +370,7 @@ printPostingListContent(vespalib::asciistream & os) const
         os << "]: {";
 
         EntryRef postIdx = itr.getData();
-        PostingIterator postings = _postingList.begin(postIdx);
-        for (; postings.valid(); ++postings) {
-            os << postings.getKey() << ", ";
-        }
+        _postingList.foreach_unfrozen_key(postIdx, [&os](uint32_t docId) { os << docId << ", "; });
         os << "}\n";
     }
 }
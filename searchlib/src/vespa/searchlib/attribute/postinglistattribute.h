@@ -11,6 +11,7 @@
 #include "dociditerator.h"
 #include "postinglistsearchcontext.h"
 #include "postingchange.h"
+#include "posting_bitvector_cache.h"
 #include "ipostinglistattributebase.h"
 
 namespace search {
@@ -48,12 +49,16 @@ protected:
     AttributeVector &_attr;
     EnumPostingTree &_dict;
     EnumStoreBase   &_esb;
+    std::unique_ptr<attribute::PostingBitVectorCache> _bitVectorCache;
+    uint32_t         _bitVectorCacheCompactionCount;
 
     PostingListAttributeBase(AttributeVector &attr, EnumStoreBase &enumStore);
     virtual ~PostingListAttributeBase();
 
     virtual void updatePostings(PostingMap & changePost) = 0;
 
+    void invalidateBitVectorCache(const std::vector<EntryRef> &changes, const EnumStoreComparator &cmp);
+
     void updatePostings(PostingMap &changePost, EnumStoreComparator &cmp);
     void clearAllPostings();
     void disableFreeLists() { _postingList.disableFreeLists(); }
@@ -66,10 +71,12 @@ protected:
 
     void forwardedShrinkLidSpace(uint32_t newSize) override;
     virtual MemoryUsage getMemoryUsage() const override;
+    CacheStats getBitVectorCacheStats() const override;
 
 public:
     const PostingList & getPostingList() const { return _postingList; }
     PostingList & getPostingList()             { return _postingList; }
+    attribute::PostingBitVectorCache *getBitVectorCache() const { return _bitVectorCache.get(); }
 };
 
 template <typename P, typename LoadedVector, typename LoadedValueType,
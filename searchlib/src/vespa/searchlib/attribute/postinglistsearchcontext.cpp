@@ -18,6 +18,8 @@ PostingListSearchContext(const Dictionary &dictionary,
                          const EnumStoreBase &esb,
                          uint32_t minBvDocFreq,
                          bool useBitVector,
+                         PostingBitVectorCache *bitVectorCache,
+                         generation_t generation,
                          const ISearchContext &baseSearchCtx)
     : _frozenDictionary(dictionary.getFrozenView()),
       _lowerDictItr(BTreeNode::Ref(), dictionary.getAllocator()),
@@ -35,7 +37,11 @@ PostingListSearchContext(const Dictionary &dictionary,
       _esb(esb),
       _minBvDocFreq(minBvDocFreq),
       _gbv(nullptr),
-      _baseSearchCtx(baseSearchCtx)
+      _compressedList(nullptr),
+      _baseSearchCtx(baseSearchCtx),
+      _bitVectorCache(bitVectorCache),
+      _generation(generation),
+      _bitVectorCacheKey()
 {
 }
 
@@ -76,6 +82,31 @@ PostingListSearchContext::lookupSingle()
     }
 }
 
+
+PostingBitVectorCache::BitVectorSP
+PostingListSearchContext::findCachedBitVector() const
+{
+    return _bitVectorCache->find(_bitVectorCacheKey, _generation, _docIdLimit);
+}
+
+
+void
+PostingListSearchContext::insertCachedBitVector(PostingBitVectorCache::BitVectorSP bitVector) const
+{
+    // Values inserted strictly between the neighbours of the range might match the term
+    datastore::EntryRef lowBound;
+    if (_lowerDictItr.position() != 0) {
+        DictionaryConstIterator prev(_lowerDictItr);
+        --prev;
+        lowBound = prev.getKey();
+    }
+    datastore::EntryRef highBound;
+    if (_upperDictItr.valid()) {
+        highBound = _upperDictItr.getKey();
+    }
+    _bitVectorCache->insert(_bitVectorCacheKey, std::move(bitVector), _docIdLimit, lowBound, highBound, _generation);
+}
+
 template class PostingListSearchContextT<btree::BTreeNoLeafData>;
 template class PostingListSearchContextT<int32_t>;
 template class PostingListFoldedSearchContextT<btree::BTreeNoLeafData>;
@@ -6,6 +6,7 @@
 #include "postinglisttraits.h"
 #include "postingstore.h"
 #include "ipostinglistsearchcontext.h"
+#include "posting_bitvector_cache.h"
 #include <vespa/searchcommon/attribute/search_context_params.h>
 #include <vespa/searchcommon/common/range.h>
 #include <vespa/vespalib/util/regexp.h>
@@ -27,6 +28,7 @@ protected:
     using DictionaryConstIterator = Dictionary::ConstIterator;
     using FrozenDictionary = Dictionary::FrozenView;
     using EnumIndex = EnumStoreBase::Index;
+    using generation_t = PostingBitVectorCache::generation_t;
 
     const FrozenDictionary _frozenDictionary;
     DictionaryConstIterator _lowerDictItr;
@@ -44,17 +46,31 @@ protected:
     const EnumStoreBase    &_esb;
     uint32_t                _minBvDocFreq;
     const GrowableBitVector *_gbv; // bitvector if _useBitVector has been set
+    const CompressedPostingList *_compressedList; // Posting list in compressed form
     const ISearchContext    &_baseSearchCtx;
+    PostingBitVectorCache   *_bitVectorCache;
+    generation_t             _generation; // attribute generation when dictionary was frozen
+    vespalib::string         _bitVectorCacheKey; // empty if merged postings should not be cached
 
 
     PostingListSearchContext(const Dictionary &dictionary, uint32_t docIdLimit, uint64_t numValues, bool hasWeight,
-                             const EnumStoreBase &esb, uint32_t minBvDocFreq, bool useBitVector, const ISearchContext &baseSearchCtx);
+                             const EnumStoreBase &esb, uint32_t minBvDocFreq, bool useBitVector,
+                             PostingBitVectorCache *bitVectorCache, generation_t generation,
+                             const ISearchContext &baseSearchCtx);
 
     ~PostingListSearchContext();
 
     void lookupTerm(const EnumStoreComparator &comp);
     void lookupRange(const EnumStoreComparator &low, const EnumStoreComparator &high);
     void lookupSingle();
+    void setBitVectorCacheKey(const vespalib::string &key) {
+        if (_bitVectorCache != nullptr) {
+            _bitVectorCacheKey = key;
+        }
+    }
+    bool useBitVectorCache() const { return !_bitVectorCacheKey.empty(); }
+    PostingBitVectorCache::BitVectorSP findCachedBitVector() const;
+    void insertCachedBitVector(PostingBitVectorCache::BitVectorSP bitVector) const;
     virtual bool useThis(const DictionaryConstIterator & it) const {
         (void) it;
         return true;
@@ -114,7 +130,8 @@ protected:
 
     PostingListSearchContextT(const Dictionary &dictionary, uint32_t docIdLimit, uint64_t numValues,
                               bool hasWeight, const PostingList &postingList, const EnumStoreBase &esb,
-                              uint32_t minBvCocFreq, bool useBitVector, const ISearchContext &baseSearchCtx);
+                              uint32_t minBvCocFreq, bool useBitVector, PostingBitVectorCache *bitVectorCache,
+                              generation_t generation, const ISearchContext &baseSearchCtx);
     ~PostingListSearchContextT();
 
     void lookupSingle();
@@ -143,6 +160,7 @@ protected:
     using Parent = PostingListSearchContextT<DataT>;
     using Dictionary = typename Parent::Dictionary;
     using PostingList = typename Parent::PostingList;
+    using generation_t = typename Parent::generation_t;
     using Parent::_lowerDictItr;
     using Parent::_uniqueValues;
     using Parent::_postingList;
@@ -152,7 +170,8 @@ protected:
 
     PostingListFoldedSearchContextT(const Dictionary &dictionary, uint32_t docIdLimit, uint64_t numValues,
                                     bool hasWeight, const PostingList &postingList, const EnumStoreBase &esb,
-                                    uint32_t minBvCocFreq, bool useBitVector, const ISearchContext &baseSearchCtx);
+                                    uint32_t minBvCocFreq, bool useBitVector, PostingBitVectorCache *bitVectorCache,
+                                    generation_t generation, const ISearchContext &baseSearchCtx);
 
     unsigned int approximateHits() const override;
 };
@@ -257,6 +276,8 @@ PostingSearchContext(QueryTermSimpleUP qTerm, bool useBitVector, const AttrT &to
               toBeSearched.getEnumStore(),
               toBeSearched._postingList._minBvDocFreq,
               useBitVector,
+              toBeSearched.getBitVectorCache(),
+              toBeSearched.getCurrentGeneration(),
               *this),
       _toBeSearched(toBeSearched),
       _enumStore(_toBeSearched.getEnumStore())
@@ -295,6 +316,9 @@ StringPostingSearchContext(QueryTermSimpleUP qTerm, bool useBitVector, const Att
         }
         if (this->_uniqueValues == 1u) {
             this->lookupSingle();
+        } else if (this->_uniqueValues > 1u) {
+            const char *kind = this->isPrefix() ? "prefix:" : (this->isRegex() ? "regex:" : "word:");
+            this->setBitVectorCacheKey(kind + vespalib::string(this->queryTerm()->getTerm()));
         }
     }
 }
@@ -319,6 +343,12 @@ NumericPostingSearchContext(QueryTermSimpleUP qTerm, const Params & params_in, c
             bool shouldApplyRangeLimit = (params().diversityAttribute() == nullptr) &&
                                          (this->getRangeLimit() != 0);
             getIterators( shouldApplyRangeLimit );
+            if (this->getRangeLimit() == 0 && this->_uniqueValues > 1u) {
+                // Range limited results depend on postings outside the final range
+                vespalib::string key(reinterpret_cast<const char *>(&_low), sizeof(_low));
+                key.append(reinterpret_cast<const char *>(&_high), sizeof(_high));
+                this->setBitVectorCacheKey(key);
+            }
         }
         if (this->_uniqueValues == 1u) {
             this->lookupSingle();
@@ -21,8 +21,10 @@ template <typename DataT>
 PostingListSearchContextT<DataT>::
 PostingListSearchContextT(const Dictionary &dictionary, uint32_t docIdLimit, uint64_t numValues, bool hasWeight,
                           const PostingList &postingList, const EnumStoreBase &esb,
-                          uint32_t minBvDocFreq, bool useBitVector, const ISearchContext &searchContext)
-    : PostingListSearchContext(dictionary, docIdLimit, numValues, hasWeight, esb, minBvDocFreq, useBitVector, searchContext),
+                          uint32_t minBvDocFreq, bool useBitVector, PostingBitVectorCache *bitVectorCache,
+                          generation_t generation, const ISearchContext &searchContext)
+    : PostingListSearchContext(dictionary, docIdLimit, numValues, hasWeight, esb, minBvDocFreq, useBitVector,
+                               bitVectorCache, generation, searchContext),
       _postingList(postingList),
       _merger(docIdLimit),
       _fetchPostingsDone(false)
@@ -59,6 +61,8 @@ PostingListSearchContextT<DataT>::lookupSingle()
                     _gbv = bv; 
                 }
             }
+        } else if (_postingList.isCompressed(typeId)) {
+            _compressedList = _postingList.getCompressedEntry(_pidx)->_list.get();
         } else {
             auto frozenView = _postingList.getTreeEntry(_pidx)->getFrozenView(_postingList.getAllocator());
             _frozenRoot = frozenView.getRoot();
@@ -120,6 +124,13 @@ PostingListSearchContextT<DataT>::fetchPostings(bool strict)
     if (_uniqueValues < 2u) return;
 
     if (strict && !fallbackToFiltering()) {
+        if (useBitVectorCache()) {
+            auto bitVector = findCachedBitVector();
+            if (bitVector) {
+                _merger.setBitVector(std::move(bitVector));
+                return;
+            }
+        }
         size_t sum(countHits());
         if (sum < _docIdLimit / 64) {
             _merger.reserveArray(_uniqueValues, sum);
@@ -129,6 +140,9 @@ PostingListSearchContextT<DataT>::fetchPostings(bool strict)
             fillBitVector();
         }
         _merger.merge();
+        if (_merger.hasBitVector() && useBitVectorCache()) {
+            insertCachedBitVector(_merger.getBitVectorSP());
+        }
     }
 }
 
@@ -184,6 +198,14 @@ createPostingIterator(fef::TermFieldMatchData *matchData, bool strict)
             return std::make_unique<EmptySearch>();
         }
         const PostingList &postingList = _postingList;
+        if (_compressedList != nullptr) {
+            using DocIt = CompressedPostingListIterator;
+            if (postingList._isFilter) {
+                return std::make_unique<FilterAttributePostingListIteratorT<DocIt>>(_baseSearchCtx, matchData, *_compressedList);
+            } else {
+                return std::make_unique<AttributePostingListIteratorT<DocIt>>(_baseSearchCtx, _hasWeight, matchData, *_compressedList);
+            }
+        }
         if (!_frozenRoot.valid()) {
             uint32_t clusterSize = _postingList.getClusterSize(_pidx);
             assert(clusterSize != 0);
@@ -222,6 +244,9 @@ PostingListSearchContextT<DataT>::singleHits() const
     if (!_pidx.valid()) {
         return 0u;
     }
+    if (_compressedList != nullptr) {
+        return _compressedList->size();
+    }
     if (!_frozenRoot.valid()) {
         return _postingList.getClusterSize(_pidx);
     }
@@ -287,8 +312,10 @@ template <typename DataT>
 PostingListFoldedSearchContextT<DataT>::
 PostingListFoldedSearchContextT(const Dictionary &dictionary, uint32_t docIdLimit, uint64_t numValues,
                                 bool hasWeight, const PostingList &postingList, const EnumStoreBase &esb,
-                                uint32_t minBvDocFreq, bool useBitVector, const ISearchContext &searchContext)
-    : Parent(dictionary, docIdLimit, numValues, hasWeight, postingList, esb, minBvDocFreq, useBitVector, searchContext)
+                                uint32_t minBvDocFreq, bool useBitVector, PostingBitVectorCache *bitVectorCache,
+                                generation_t generation, const ISearchContext &searchContext)
+    : Parent(dictionary, docIdLimit, numValues, hasWeight, postingList, esb, minBvDocFreq, useBitVector,
+             bitVectorCache, generation, searchContext)
 {
 }
 
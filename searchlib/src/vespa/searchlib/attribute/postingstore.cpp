@@ -24,6 +24,7 @@ PostingStoreBase2::PostingStoreBase2(EnumPostingTree &dict, Status &status, cons
 #endif
       _enableOnlyBitVector(config.getEnableOnlyBitVector()),
       _isFilter(config.getIsFilter()),
+      _enableCompressedPostingLists(config.compressedPostingLists()),
       _bvSize(64u),
       _bvCapacity(128u),
       _minBvDocFreq(64),
@@ -31,7 +32,11 @@ PostingStoreBase2::PostingStoreBase2(EnumPostingTree &dict, Status &status, cons
       _bvs(),
       _dict(dict),
       _status(status),
-      _bvExtraBytes(0)
+      _bvExtraBytes(0),
+      _compressedExtraBytes(0),
+      _changesSinceCompression(0),
+      _compressionPass(0),
+      _hotPostingLists()
 {
 }
 
@@ -61,15 +66,32 @@ PostingStoreBase2::resizeBitVectors(uint32_t newSize, uint32_t newCapacity)
 }
 
 
+bool
+PostingStoreBase2::considerCompressPostingLists()
+{
+    if (!_enableCompressedPostingLists ||
+        _changesSinceCompression < std::max(MIN_CHANGES_BEFORE_COMPRESSION, _status.getNumUniqueValues() / 4)) {
+        return false;
+    }
+    return compressPostingLists();
+}
+
+
 template <typename DataT>
 PostingStore<DataT>::PostingStore(EnumPostingTree &dict, Status &status,
                                   const Config &config)
     : Parent(false),
       PostingStoreBase2(dict, status, config),
-      _bvType(1, 1024u, RefType::offsetSize())
+      _bvType(1, 1024u, RefType::offsetSize()),
+      _compressedType(1, config.compressedPostingLists() ? 1024u : 1u, RefType::offsetSize())
 {
     // TODO: Add type for bitvector
     _store.addType(&_bvType);
+    _store.addType(&_compressedType);
+    if (!std::is_same<DataT, BTreeNoLeafData>::value) {
+        // Compressed posting lists have no weights
+        _enableCompressedPostingLists = false;
+    }
     _store.initActiveBuffers();
     _store.enableFreeLists();
 }
@@ -163,6 +185,51 @@ PostingStore<DataT>::removeSparseBitVectors()
 }
 
 
+template <typename DataT>
+bool
+PostingStore<DataT>::compressPostingLists()
+{
+    _changesSinceCompression = 0;
+    bool res = false;
+    std::vector<uint32_t> docIds;
+    typedef EnumPostingTree::Iterator EnumIterator;
+    for (EnumIterator dictItr = _dict.begin(); dictItr.valid(); ++dictItr) {
+        EntryRef ref(dictItr.getData());
+        if (!ref.valid() || !isBTree(getTypeId(ref))) {
+            continue;
+        }
+        const BTreeType *tree = getTreeEntry(ref);
+        if (tree->size(_allocator) < MIN_COMPRESSED_SIZE) {
+            continue;
+        }
+        auto hotItr = _hotPostingLists.find(ref.ref());
+        if (hotItr != _hotPostingLists.end()) {
+            if (hotItr->second == _compressionPass) {
+                continue; // Changed since last pass, would soon be decompressed again
+            }
+            _hotPostingLists.erase(hotItr);
+        }
+        docIds.clear();
+        _allocator.getNodeStore().foreach_key(tree->getRoot(),
+                                              [&docIds](uint32_t docId) { docIds.push_back(docId); });
+        makeCompressed(ref, docIds);
+        _dict.thaw(dictItr);
+        dictItr.writeData(ref);
+        res = true;
+    }
+    // Forget lists that stayed quiet or are no longer btrees
+    for (auto itr = _hotPostingLists.begin(); itr != _hotPostingLists.end(); ) {
+        if (itr->second != _compressionPass) {
+            itr = _hotPostingLists.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+    ++_compressionPass;
+    return res;
+}
+
+
 template <typename DataT>
 void
 PostingStore<DataT>::applyNew(EntryRef &ref,
@@ -281,6 +348,47 @@ PostingStore<DataT>::makeBitVector(EntryRef &ref)
 }
 
     
+template <typename DataT>
+void
+PostingStore<DataT>::makeCompressed(EntryRef &ref, const std::vector<uint32_t> &docIds)
+{
+    assert(ref.valid());
+    RefType iRef(ref);
+    assert(isBTree(iRef));
+    BTreeType *tree = getWTreeEntry(iRef);
+    assert(tree->size(_allocator) == docIds.size());
+    auto list = std::make_shared<const CompressedPostingList>(docIds);
+    CompressedRefPair cPair(allocCompressed());
+    cPair.data->_list = list;
+    _compressedExtraBytes += list->extraByteSize();
+    _status.incCompressedPostingLists();
+    tree->clear(_allocator);
+    _store.holdElem(ref, 1);
+    ref = cPair.ref;
+}
+
+
+template <typename DataT>
+void
+PostingStore<DataT>::dropCompressed(EntryRef &ref)
+{
+    assert(ref.valid());
+    RefType iRef(ref);
+    assert(isCompressed(getTypeId(iRef)));
+    const CompressedPostingList &list = *getCompressedEntry(iRef)->_list;
+    BTreeTypeRefPair tPair(allocBTree());
+    Builder &builder = _builder;
+    builder.reuse();
+    list.foreach_key([&builder](uint32_t docId) { builder.insert(docId, bitVectorWeight()); });
+    tPair.data->assign(builder, _allocator);
+    assert(tPair.data->size(_allocator) == list.size());
+    _compressedExtraBytes -= list.extraByteSize();
+    _status.decCompressedPostingLists();
+    _store.holdElem(ref, 1);
+    ref = tPair.ref;
+}
+
+
 template <typename DataT>
 void
 PostingStore<DataT>::applyNewBitVector(EntryRef &ref,
@@ -356,6 +464,7 @@ PostingStore<DataT>::apply(EntryRef &ref,
                            RemoveIter r,
                            RemoveIter re)
 {
+    _changesSinceCompression += (ae - a) + (re - r);
     if (!ref.valid()) {
         // No old data
         applyNew(ref, a, ae);
@@ -372,6 +481,15 @@ PostingStore<DataT>::apply(EntryRef &ref,
         iRef = ref;
         typeId = getTypeId(iRef);
     }
+    if (isCompressed(typeId)) {
+        if (a == ae && r == re) {
+            return;
+        }
+        dropCompressed(ref);
+        iRef = ref;
+        typeId = getTypeId(iRef);
+        _hotPostingLists[iRef.ref()] = _compressionPass;
+    }
     // Old data was tree or has been converted to a tree
     // ... or old data was bitvector
     if (isBitVector(typeId)) {
@@ -400,6 +518,12 @@ PostingStore<DataT>::apply(EntryRef &ref,
             }
         }
     } else {
+        if (!_hotPostingLists.empty()) {
+            auto hotItr = _hotPostingLists.find(iRef.ref());
+            if (hotItr != _hotPostingLists.end()) {
+                hotItr->second = _compressionPass;
+            }
+        }
         BTreeType *tree = getWTreeEntry(iRef);
         applyTree(tree, a, ae, r, re, CompareT());
         if (_enableBitVectors) {
@@ -429,6 +553,8 @@ PostingStore<DataT>::internalSize(uint32_t typeId, const RefType & iRef) const
             const BitVector *bv = bve->_bv.get();
             return bv->countTrueBits();
         }
+    } else if (isCompressed(typeId)) {
+        return getCompressedEntry(iRef)->_list->size();
     } else {
         const BTreeType *tree = getTreeEntry(iRef);
         return tree->size(_allocator);
@@ -451,6 +577,8 @@ PostingStore<DataT>::internalFrozenSize(uint32_t typeId, const RefType & iRef) c
             // Some inaccuracy is expected, data changes underfeet
             return bve->_bv->countTrueBits();
         }
+    } else if (isCompressed(typeId)) {
+        return getCompressedEntry(iRef)->_list->size();
     } else {
         const BTreeType *tree = getTreeEntry(iRef);
         return tree->frozenSize(_allocator);
@@ -478,6 +606,7 @@ PostingStore<DataT>::begin(const EntryRef ref) const
             }
             return Iterator();
         }
+        assert(isBTree(typeId)); // Use foreach_unfrozen_key() for compressed posting lists
         const BTreeType *tree = getTreeEntry(iRef);
         return tree->begin(_allocator);
     }
@@ -506,6 +635,7 @@ PostingStore<DataT>::beginFrozen(const EntryRef ref) const
             }
             return ConstIterator();
         }
+        assert(isBTree(typeId)); // Compressed posting lists are only used without weights
         const BTreeType *tree = getTreeEntry(iRef);
         return tree->getFrozenView(_allocator).begin();
     }
@@ -539,6 +669,7 @@ PostingStore<DataT>::beginFrozen(const EntryRef ref,
             where.emplace_back();
             return;
         }
+        assert(isBTree(typeId)); // Compressed posting lists are only used without weights
         const BTreeType *tree = getTreeEntry(iRef);
         tree->getFrozenView(_allocator).begin(where);
         return;
@@ -568,6 +699,7 @@ PostingStore<DataT>::getAggregated(const EntryRef ref) const
             }
             return AggregatedType();
         }
+        assert(isBTree(typeId)); // Compressed posting lists are only used without weights
         const BTreeType *tree = getTreeEntry(iRef);
         return tree->getAggregated(_allocator);
     }
@@ -603,9 +735,14 @@ PostingStore<DataT>::clear(const EntryRef ref)
             _status.decBitVectors();
             _bvExtraBytes -= bve->_bv->extraByteSize();
             _store.holdElem(ref, 1);
+        } else if (isCompressed(typeId)) {
+            _compressedExtraBytes -= getCompressedEntry(iRef)->_list->extraByteSize();
+            _status.decCompressedPostingLists();
+            _store.holdElem(ref, 1);
         } else {
             BTreeType *tree = getWTreeEntry(iRef);
             tree->clear(_allocator);
+            _hotPostingLists.erase(ref.ref());
             _store.holdElem(ref, 1);
         }
     } else {
@@ -621,9 +758,9 @@ PostingStore<DataT>::getMemoryUsage() const
     MemoryUsage usage;
     usage.merge(_allocator.getMemoryUsage());
     usage.merge(_store.getMemoryUsage());
-    uint64_t bvExtraBytes = _bvExtraBytes;
-    usage.incUsedBytes(bvExtraBytes);
-    usage.incAllocatedBytes(bvExtraBytes);
+    uint64_t extraBytes = _bvExtraBytes + _compressedExtraBytes;
+    usage.incUsedBytes(extraBytes);
+    usage.incAllocatedBytes(extraBytes);
     return usage;
 }
 
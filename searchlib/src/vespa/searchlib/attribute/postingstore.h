@@ -4,6 +4,8 @@
 
 #include "postinglisttraits.h"
 #include "enumstorebase.h"
+#include "compressed_posting_list.h"
+#include <map>
 #include <set>
 
 namespace search {
@@ -30,12 +32,25 @@ public:
 };
 
 
+class CompressedPostingEntry
+{
+public:
+    std::shared_ptr<const CompressedPostingList> _list;
+
+public:
+    CompressedPostingEntry()
+        : _list()
+    { }
+};
+
+
 class PostingStoreBase2
 {
 public:
     bool _enableBitVectors;
     bool _enableOnlyBitVector;
     bool _isFilter;
+    bool _enableCompressedPostingLists;
 protected:
     uint32_t _bvSize;
     uint32_t _bvCapacity;
@@ -47,14 +62,34 @@ protected:
     EnumPostingTree   &_dict;
     Status            &_status;
     uint64_t           _bvExtraBytes;
+    uint64_t           _compressedExtraBytes;
+    uint64_t           _changesSinceCompression; // Postings added or removed since last compression pass
+    uint64_t           _compressionPass;
+    /*
+     * Btree posting lists that were decompressed by updates, mapped to the
+     * compression pass during which they were last changed. Such lists are
+     * left as btrees until they have been quiet for a full pass.
+     */
+    std::map<uint32_t, uint64_t> _hotPostingLists;
 
     static constexpr uint32_t BUFFERTYPE_BITVECTOR = 9u;
+    static constexpr uint32_t BUFFERTYPE_COMPRESSED = 10u;
+    static constexpr uint32_t MIN_COMPRESSED_SIZE = CompressedPostingList::BLOCK_SIZE;
+    static constexpr uint64_t MIN_CHANGES_BEFORE_COMPRESSION = 1024u;
 
 public:
     PostingStoreBase2(EnumPostingTree &dict, Status &status, const Config &config);
     virtual ~PostingStoreBase2();
     bool resizeBitVectors(uint32_t newSize, uint32_t newCapacity);
     virtual bool removeSparseBitVectors() = 0;
+
+    /*
+     * Compress btree posting lists if enough postings have changed
+     * since the last pass to pay for the dictionary scan. Returns true
+     * if any posting list was compressed.
+     */
+    bool considerCompressPostingLists();
+    virtual bool compressPostingLists() = 0;
 };
 
 template <typename DataT>
@@ -62,6 +97,7 @@ class PostingStore : public PostingListTraits<DataT>::PostingStoreBase,
     public PostingStoreBase2
 {
     datastore::BufferType<BitVectorEntry> _bvType;
+    datastore::BufferType<CompressedPostingEntry> _compressedType;
 public:
     typedef DataT DataType;
     typedef typename PostingListTraits<DataT>::PostingStoreBase Parent;
@@ -95,13 +131,16 @@ public:
     using Parent::_aggrCalc;
     using Parent::BUFFERTYPE_BTREE;
     typedef datastore::Handle<BitVectorEntry> BitVectorRefPair;
-    
+    typedef datastore::Handle<CompressedPostingEntry> CompressedRefPair;
+
 
     PostingStore(EnumPostingTree &dict, Status &status, const Config &config);
     ~PostingStore();
 
     bool removeSparseBitVectors() override;
+    bool compressPostingLists() override;
     static bool isBitVector(uint32_t typeId) { return typeId == BUFFERTYPE_BITVECTOR; }
+    static bool isCompressed(uint32_t typeId) { return typeId == BUFFERTYPE_COMPRESSED; }
     static bool isBTree(uint32_t typeId) { return typeId == BUFFERTYPE_BTREE; }
     bool isBTree(RefType ref) const { return isBTree(getTypeId(ref)); }
 
@@ -119,6 +158,20 @@ public:
     void dropBitVector(EntryRef &ref);
     void makeBitVector(EntryRef &ref);
 
+    CompressedRefPair allocCompressed() {
+        return _store.template freeListAllocator<CompressedPostingEntry,
+            btree::DefaultReclaimer<CompressedPostingEntry> >(BUFFERTYPE_COMPRESSED).alloc();
+    }
+
+    /*
+     * Replace btree with compressed posting list containing docIds.
+     */
+    void makeCompressed(EntryRef &ref, const std::vector<uint32_t> &docIds);
+    /*
+     * Recreate btree from compressed posting list, before it is changed.
+     */
+    void dropCompressed(EntryRef &ref);
+
     void applyNewBitVector(EntryRef &ref, AddIter aOrg, AddIter ae);
     void apply(BitVector &bv, AddIter a, AddIter ae, RemoveIter r, RemoveIter re);
 
@@ -158,6 +211,9 @@ public:
     ConstIterator beginFrozen(const EntryRef ref) const;
     void beginFrozen(const EntryRef ref, std::vector<ConstIterator> &where) const;
 
+    template <typename FunctionType>
+    VESPA_DLL_LOCAL void foreach_unfrozen_key(EntryRef ref, FunctionType func) const;
+
     template <typename FunctionType>
     VESPA_DLL_LOCAL void foreach_frozen_key(EntryRef ref, FunctionType func) const;
 
@@ -174,10 +230,17 @@ public:
         return _store.template getEntry<BitVectorEntry>(ref);
     }
 
+    const CompressedPostingEntry *getCompressedEntry(RefType ref) const {
+        return _store.template getEntry<CompressedPostingEntry>(ref);
+    }
+
     static inline DataT bitVectorWeight();
     MemoryUsage getMemoryUsage() const;
 
 private:
+    template <typename FunctionType, bool Frozen>
+    VESPA_DLL_LOCAL void foreach_key(EntryRef ref, FunctionType func) const;
+
     size_t internalSize(uint32_t typeId, const RefType & iRef) const;
     size_t internalFrozenSize(uint32_t typeId, const RefType & iRef) const;
 };
@@ -7,9 +7,9 @@
 namespace search::attribute {
 
 template<typename DataT>
-template<typename FunctionType>
+template<typename FunctionType, bool Frozen>
 void
-PostingStore<DataT>::foreach_frozen_key(EntryRef ref, FunctionType func) const {
+PostingStore<DataT>::foreach_key(EntryRef ref, FunctionType func) const {
     if (!ref.valid())
         return;
     RefType iRef(ref);
@@ -23,7 +23,7 @@ PostingStore<DataT>::foreach_frozen_key(EntryRef ref, FunctionType func) const {
             if (iRef2.valid()) {
                 assert(isBTree(iRef2));
                 const BTreeType *tree = getTreeEntry(iRef2);
-                _allocator.getNodeStore().foreach_key(tree->getFrozenRoot(), func);
+                _allocator.getNodeStore().foreach_key(Frozen ? tree->getFrozenRoot() : tree->getRoot(), func);
             } else {
                 const BitVector *bv = bve->_bv.get();
                 uint32_t docIdLimit = bv->size();
@@ -33,10 +33,12 @@ PostingStore<DataT>::foreach_frozen_key(EntryRef ref, FunctionType func) const {
                     docId = bv->getNextTrueBit(docId + 1);
                 }
             }
+        } else if (isCompressed(typeId)) {
+            getCompressedEntry(iRef)->_list->foreach_key(func);
         } else {
             assert(isBTree(typeId));
             const BTreeType *tree = getTreeEntry(iRef);
-            _allocator.getNodeStore().foreach_key(tree->getFrozenRoot(), func);
+            _allocator.getNodeStore().foreach_key(Frozen ? tree->getFrozenRoot() : tree->getRoot(), func);
         }
     } else {
         const KeyDataType *p = getKeyDataEntry(iRef, clusterSize);
@@ -48,6 +50,22 @@ PostingStore<DataT>::foreach_frozen_key(EntryRef ref, FunctionType func) const {
 }
 
 
+template<typename DataT>
+template<typename FunctionType>
+void
+PostingStore<DataT>::foreach_unfrozen_key(EntryRef ref, FunctionType func) const {
+    foreach_key<FunctionType, false>(ref, func);
+}
+
+
+template<typename DataT>
+template<typename FunctionType>
+void
+PostingStore<DataT>::foreach_frozen_key(EntryRef ref, FunctionType func) const {
+    foreach_key<FunctionType, true>(ref, func);
+}
+
+
 template<typename DataT>
 template<typename FunctionType>
 void
@@ -75,6 +93,8 @@ PostingStore<DataT>::foreach_frozen(EntryRef ref, FunctionType func) const {
                     docId = bv->getNextTrueBit(docId + 1);
                 }
             }
+        } else if (isCompressed(typeId)) {
+            getCompressedEntry(iRef)->_list->foreach_key([&func](uint32_t docId) { func(docId, bitVectorWeight()); });
         } else {
             const BTreeType *tree = getTreeEntry(iRef);
             _allocator.getNodeStore().foreach(tree->getFrozenRoot(), func);
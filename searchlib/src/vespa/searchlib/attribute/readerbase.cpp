@@ -99,6 +99,11 @@ ReaderBase::ReaderBase(AttributeVector &attr)
 
 ReaderBase::~ReaderBase() = default;
 
+vespalib::string
+ReaderBase::getDatFileName() const {
+    return _datFile->GetFileName();
+}
+
 bool
 ReaderBase::hasWeight() const {
     return _weightFile.get() && _weightFile->IsOpened();
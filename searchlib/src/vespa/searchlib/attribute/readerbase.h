@@ -46,6 +46,8 @@ public:
     const vespalib::GenericHeader &getDatHeader() const {
         return _datHeader;
     }
+    uint32_t getDatHeaderLen() const { return _datHeaderLen; }
+    vespalib::string getDatFileName() const;
 protected:
     std::unique_ptr<FastOS_FileInterface>  _datFile;
 private:
@@ -5,6 +5,7 @@
 #include "integerbase.h"
 #include "floatbase.h"
 #include <vespa/searchlib/common/rcuvector.h>
+#include <vespa/vespalib/hwaccelrated/iaccelrated.h>
 #include <limits>
 
 namespace search {
@@ -38,9 +39,10 @@ private:
     template <typename M>
     class SingleSearchContext : public M, public AttributeVector::SearchContext
     {
-    private:
+    protected:
         const T * _data;
 
+    private:
         int32_t onFind(DocId docId, int32_t elemId, int32_t & weight) const override {
             return find(docId, elemId, weight);
         }
@@ -72,6 +74,31 @@ private:
         createFilterIterator(fef::TermFieldMatchData * matchData, bool strict) override;
     };
 
+    /*
+     * Specialization of SingleSearchContext for range terms. A strict
+     * search evaluates the range for blocks of documents at a time using
+     * the hardware accelerated range filter.
+     */
+    class SingleRangeSearchContext : public SingleSearchContext<NumericAttribute::Range<T>>
+    {
+    private:
+        using Base = SingleSearchContext<NumericAttribute::Range<T>>;
+        uint32_t _docIdLimit;
+        vespalib::hwaccelrated::IAccelrated::UP _accelrator;
+
+    public:
+        SingleRangeSearchContext(std::unique_ptr<QueryTermSimple> qTerm, const NumericAttribute & toBeSearched);
+        ~SingleRangeSearchContext() override;
+
+        uint32_t getDocIdLimit() const { return _docIdLimit; }
+        void scanRange(DocId docId, uint32_t numDocs, uint64_t * bits) const {
+            _accelrator->rangeFilter(this->_data + docId, numDocs, this->_low, this->_high, bits);
+        }
+
+        std::unique_ptr<queryeval::SearchIterator>
+        createFilterIterator(fef::TermFieldMatchData * matchData, bool strict) override;
+    };
+
 
 protected:
     bool findEnum(T value, EnumHandle & e) const override {
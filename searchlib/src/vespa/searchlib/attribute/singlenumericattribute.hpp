@@ -8,6 +8,7 @@
 #include "primitivereader.h"
 #include "attributeiterators.hpp"
 #include <vespa/searchlib/queryeval/emptysearch.h>
+#include <unistd.h>
 
 namespace search {
 
@@ -140,10 +141,15 @@ SingleValueNumericAttribute<B>::onLoad()
     
     const size_t sz(attrReader.getDataCount());
     getGenerationHolder().clearHoldLists();
-    _data.reset();
-    _data.unsafe_reserve(sz);
-    for (uint32_t i = 0; i < sz; ++i) {
-        _data.push_back(attrReader.getNextData());
+    if (this->getConfig().paged() && (attrReader.getDatHeaderLen() % getpagesize()) == 0) {
+        // The saved data is the in-memory layout, map it instead of reading it.
+        _data.mapFile(attrReader.getDatFileName(), attrReader.getDatHeaderLen(), sz);
+    } else {
+        _data.reset();
+        _data.unsafe_reserve(sz);
+        for (uint32_t i = 0; i < sz; ++i) {
+            _data.push_back(attrReader.getNextData());
+        }
     }
 
     B::setNumDocs(sz);
@@ -162,7 +168,7 @@ SingleValueNumericAttribute<B>::getSearch(QueryTermSimple::UP qTerm,
     if (res.isEqual()) {
         return AttributeVector::SearchContext::UP(new SingleSearchContext< NumericAttribute::Equal<T> >(std::move(qTerm), *this));
     } else {
-        return AttributeVector::SearchContext::UP(new SingleSearchContext< NumericAttribute::Range<T> >(std::move(qTerm), *this));
+        return AttributeVector::SearchContext::UP(new SingleRangeSearchContext(std::move(qTerm), *this));
     }
 }
 
@@ -241,5 +247,27 @@ createFilterIterator(fef::TermFieldMatchData * matchData, bool strict)
              ? new AttributeIteratorStrict<SingleSearchContext<M> >(*this, matchData)
              : new AttributeIteratorT<SingleSearchContext<M> >(*this, matchData));
 }
+
+template <typename B>
+SingleValueNumericAttribute<B>::SingleRangeSearchContext::SingleRangeSearchContext(QueryTermSimple::UP qTerm,
+                                                                                   const NumericAttribute & toBeSearched) :
+    Base(std::move(qTerm), toBeSearched),
+    _docIdLimit(toBeSearched.getCommittedDocIdLimit()),
+    _accelrator(vespalib::hwaccelrated::IAccelrated::getAccelrator())
+{ }
+
+template <typename B>
+SingleValueNumericAttribute<B>::SingleRangeSearchContext::~SingleRangeSearchContext() = default;
+
+template <typename B>
+std::unique_ptr<queryeval::SearchIterator>
+SingleValueNumericAttribute<B>::SingleRangeSearchContext::
+createFilterIterator(fef::TermFieldMatchData * matchData, bool strict)
+{
+    if (strict && this->isValid()) {
+        return std::make_unique<AttributeRangeScanIteratorStrict<SingleRangeSearchContext>>(*this, matchData);
+    }
+    return Base::createFilterIterator(matchData, strict);
 }
 
+}
@@ -439,6 +439,26 @@ public:
     const AggrT &
     getAggregated() const;
 
+    /*
+     * Get aggregated values for the leaf node containing the current
+     * position.  Iterator must be valid.
+     */
+    const AggrT &
+    getLeafAggregated() const
+    {
+        return _leaf.getNode()->getAggregated();
+    }
+
+    /*
+     * Get last key in the leaf node containing the current position.
+     * Iterator must be valid.
+     */
+    const KeyType &
+    getLeafLastKey() const
+    {
+        return _leaf.getNode()->getLastKey();
+    }
+
     bool
     identical(const BTreeIteratorBase &rhs) const;
 
@@ -7,6 +7,7 @@
 #include <vespa/searchcommon/common/growstrategy.h>
 #include <vespa/vespalib/util/alloc.h>
 #include <vespa/vespalib/util/array.h>
+#include <vespa/vespalib/stllike/string.h>
 
 namespace search::attribute {
 
@@ -120,6 +121,15 @@ public:
     const T & operator[](size_t i) const { return _data[i]; }
 
     void reset();
+
+    /**
+     * Replace the content with n elements mapped copy-on-write from the
+     * given file, starting at fileOffset (page aligned). Elements are paged
+     * in on demand and writes only touch private copies of the pages.
+     * Spare capacity is added according to the grow parameters.
+     * Assumes no readers at this moment.
+     **/
+    void mapFile(const vespalib::string &fileName, size_t fileOffset, size_t n);
     void shrink(size_t newSize) __attribute__((noinline));
     void replaceVector(std::unique_ptr<Array> replacement);
 };
@@ -45,6 +45,14 @@ RcuVectorBase<T>::reset() {
     _data.reserve(16);
 }
 
+template <typename T>
+void
+RcuVectorBase<T>::mapFile(const vespalib::string &fileName, size_t fileOffset, size_t n) {
+    // Assumes no readers at this moment
+    Alloc buf = Alloc::allocMMapFile(fileName.c_str(), fileOffset, n * sizeof(T), calcNewSize(n) * sizeof(T));
+    Array(std::move(buf), n).swap(_data);
+}
+
 template <typename T>
 RcuVectorBase<T>::~RcuVectorBase() = default;
 
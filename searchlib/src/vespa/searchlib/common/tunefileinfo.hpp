@@ -15,6 +15,7 @@ TuneFileRandRead::setFromConfig(const enum TuneControlConfig::Io & tuneControlCo
         case TuneControlConfig::NORMAL:   _tuneControl = NORMAL; break;
         case TuneControlConfig::DIRECTIO: _tuneControl = DIRECTIO; break;
         case TuneControlConfig::MMAP:     _tuneControl = MMAP; break;
+        case TuneControlConfig::ASYNC:    _tuneControl = ASYNC; break;
         default:                          _tuneControl = NORMAL; break;
     }
     setFromMmapConfig(mmapFlags);
@@ -12,6 +12,7 @@
 #include <vespa/vespalib/stllike/cache.hpp>
 #include "pagedict4randread.h"
 #include "fileheader.h"
+#include "zcdocidblock.h"
 
 #include <vespa/log/log.h>
 LOG_SETUP(".diskindex.diskindex");
@@ -105,7 +106,7 @@ DiskIndex::openField(const vespalib::string &fieldDir,
     if (fileHeader.taste(postingName, tuneFileSearch._read)) {
         if (fileHeader.getVersion() == 1 &&
             fileHeader.getBigEndian() &&
-            fileHeader.getFormats().size() == 2 &&
+            ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
             fileHeader.getFormats()[0] ==
             DiskPostingFileDynamicKReal::getIdentifier() &&
             fileHeader.getFormats()[1] ==
@@ -113,7 +114,7 @@ DiskIndex::openField(const vespalib::string &fieldDir,
             dynamicK = true;
         } else if (fileHeader.getVersion() == 1 &&
                    fileHeader.getBigEndian() &&
-                   fileHeader.getFormats().size() == 2 &&
+                   ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
                    fileHeader.getFormats()[0] ==
                    DiskPostingFileReal::getIdentifier() &&
                    fileHeader.getFormats()[1] ==
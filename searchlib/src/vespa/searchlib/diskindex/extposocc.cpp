@@ -3,6 +3,7 @@
 #include "extposocc.h"
 #include "zcposocc.h"
 #include "fileheader.h"
+#include "zcdocidblock.h"
 #include <vespa/searchlib/index/postinglistcounts.h>
 #include <vespa/searchlib/index/docidandfeatures.h>
 #include <vespa/searchlib/index/postinglistcounts.h>
@@ -67,7 +68,7 @@ makePosOccWrite(const vespalib::string &name,
     if (fileHeader.taste(name, tuneFileWrite)) {
         if (fileHeader.getVersion() == 1 &&
             fileHeader.getBigEndian() &&
-            fileHeader.getFormats().size() == 2 &&
+            ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
             fileHeader.getFormats()[0] ==
             ZcPosOccSeqRead::getIdentifier() &&
             fileHeader.getFormats()[1] ==
@@ -75,7 +76,7 @@ makePosOccWrite(const vespalib::string &name,
             dynamicK = true;
         } else if (fileHeader.getVersion() == 1 &&
                    fileHeader.getBigEndian() &&
-                   fileHeader.getFormats().size() == 2 &&
+                   ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
                    fileHeader.getFormats()[0] ==
                    Zc4PosOccSeqRead::getIdentifier() &&
                    fileHeader.getFormats()[1] ==
@@ -113,7 +114,7 @@ makePosOccRead(const vespalib::string &name,
     if (fileHeader.taste(name, tuneFileRead)) {
         if (fileHeader.getVersion() == 1 &&
             fileHeader.getBigEndian() &&
-            fileHeader.getFormats().size() == 2 &&
+            ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
             fileHeader.getFormats()[0] ==
             ZcPosOccSeqRead::getIdentifier() &&
             fileHeader.getFormats()[1] ==
@@ -121,7 +122,7 @@ makePosOccRead(const vespalib::string &name,
             dynamicK = true;
         } else if (fileHeader.getVersion() == 1 &&
                    fileHeader.getBigEndian() &&
-                   fileHeader.getFormats().size() == 2 &&
+                   ZcDocIdBlock::checkFormats(fileHeader.getFormats()) &&
                    fileHeader.getFormats()[0] ==
                    Zc4PosOccSeqRead::getIdentifier() &&
                    fileHeader.getFormats()[1] ==
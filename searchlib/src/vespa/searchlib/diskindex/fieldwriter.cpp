@@ -62,6 +62,7 @@ FieldWriter::open(const vespalib::string &prefix,
         countParams.set("minChunkDocs", minChunkDocs);
         params.set("minChunkDocs", minChunkDocs);
     }
+    params.set("blockDocIds", schema.getIndexField(indexId).useBlockDocIds());
 
     _dictFile = std::make_unique<PageDict4FileSeqWrite>();
     _dictFile->setParams(countParams);
@@ -3,12 +3,16 @@
 #include "fusion.h"
 #include "fieldreader.h"
 #include "dictionarywordreader.h"
+#include "fusion_progress.h"
 #include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/searchlib/util/filekit.h>
 #include <vespa/searchlib/util/dirtraverse.h>
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/searchlib/common/documentsummary.h>
+#include <vespa/vespalib/util/count_down_latch.h>
 #include <vespa/vespalib/util/error.h>
+#include <vespa/vespalib/util/lambdatask.h>
+#include <vespa/vespalib/util/threadexecutor.h>
 #include <sstream>
 
 #include <vespa/log/log.h>
@@ -28,6 +32,19 @@ using vespalib::getLastErrorString;
 
 namespace search::diskindex {
 
+namespace {
+
+/*
+ * Counts down the latch when destroyed, so waiting for merged fields
+ * can't hang when a merge task throws or is dropped without running.
+ */
+struct CountDownOnDestroy {
+    void operator()(vespalib::CountDownLatch *latch) const { latch->countDown(); }
+};
+using CountDownGuard = std::unique_ptr<vespalib::CountDownLatch, CountDownOnDestroy>;
+
+}
+
 void
 FusionInputIndex::setSchema(const Schema::SP &schema)
 {
@@ -40,17 +57,13 @@ Fusion::Fusion(bool dynamicKPosIndexFormat,
     : _schema(nullptr),
       _oldIndexes(),
       _docIdLimit(0u),
-      _numWordIds(0u),
       _dynamicKPosIndexFormat(dynamicKPosIndexFormat),
       _outDir("merged"),
       _tuneFileIndexing(tuneFileIndexing),
       _fileHeaderContext(fileHeaderContext)
 { }
 
-Fusion::~Fusion()
-{
-    ReleaseMappingTables();
-}
+Fusion::~Fusion() = default;
 
 void
 Fusion::setSchema(const Schema *schema)
@@ -96,9 +109,8 @@ Fusion::openInputWordReaders(const SchemaUtil::IndexIterator &index,
     for (auto &i : getOldIndexes()) {
         OldIndex &oi = *i;
         auto reader(std::make_unique<DictionaryWordReader>());
-        const vespalib::string &tmpindexpath = oi.getTmpPath();
         const vespalib::string &oldindexpath = oi.getPath();
-        vespalib::string wordMapName = tmpindexpath + "/old2new.dat";
+        vespalib::string wordMapName = getFieldTmpPath(oi, index.getName()) + "/old2new.dat";
         vespalib::string fieldDir(oldindexpath + "/" + index.getName());
         vespalib::string dictName(fieldDir + "/dictionary");
         const Schema &oldSchema = oi.getSchema();
@@ -124,7 +136,9 @@ Fusion::openInputWordReaders(const SchemaUtil::IndexIterator &index,
 
 
 bool
-Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
+Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index,
+                             WordNumMappings &wordNumMappings,
+                             uint64_t &numWordIds)
 {
     vespalib::string indexName = index.getName();
     LOG(debug, "Renumber word IDs for field %s", indexName.c_str());
@@ -138,7 +152,7 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
     }
     heap.merge(out, 4);
     assert(heap.empty());
-    _numWordIds = out.getWordNum();
+    numWordIds = out.getWordNum();
 
     // Close files
     for (auto &i : readers) {
@@ -147,7 +161,7 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
 
     // Now read mapping files back into an array
     // XXX: avoid this, and instead make the array here
-    if (!ReadMappingFiles(&index)) {
+    if (!ReadMappingFiles(index, wordNumMappings)) {
         return false;
     }
     LOG(debug, "Finished renumbering words IDs for field %s",
@@ -158,22 +172,49 @@ Fusion::renumberFieldWordIds(const SchemaUtil::IndexIterator &index)
 
 
 bool
-Fusion::mergeFields()
+Fusion::mergeFields(vespalib::ThreadExecutor &executor, FusionProgress *progress)
 {
-   typedef SchemaUtil::IndexIterator IndexIterator;
+    typedef SchemaUtil::IndexIterator IndexIterator;
 
     const Schema &schema = getSchema();
+    std::vector<uint32_t> ids;
+    std::vector<vespalib::string> names(schema.getNumIndexFields());
     for (IndexIterator index(schema); index.isValid(); ++index) {
-        if (!mergeField(index.getIndex())) {
+        ids.push_back(index.getIndex());
+        names[index.getIndex()] = index.getName();
+    }
+    if (progress != nullptr) {
+        progress->startFusion(names);
+    }
+    std::vector<uint8_t> results(ids.size(), 0u);
+    vespalib::CountDownLatch latch(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto task = vespalib::makeLambdaTask([this, id = ids[i], result = &results[i], progress,
+                                              guard = CountDownGuard(&latch)]() {
+            try {
+                *result = mergeField(id, progress) ? 1u : 0u;
+            } catch (const std::exception &e) {
+                LOG(error, "Could not merge field %s: %s", getSchema().getIndexField(id).getName().c_str(), e.what());
+                *result = 0u;
+            }
+        });
+        vespalib::Executor::Task::UP rejected = executor.execute(std::move(task));
+        if (rejected) {
+            rejected->run();
+        }
+    }
+    latch.await();
+    for (uint8_t result : results) {
+        if (result == 0u) {
             return false;
         }
     }
-    return true;
+    return CleanTmpDirs();
 }
 
 
 bool
-Fusion::mergeField(uint32_t id)
+Fusion::mergeField(uint32_t id, FusionProgress *progress)
 {
     typedef SchemaUtil::IndexIterator IndexIterator;
     typedef SchemaUtil::IndexSettings IndexSettings;
@@ -188,23 +229,48 @@ Fusion::mergeField(uint32_t id)
     vespalib::string indexDir = _outDir + "/" + indexName;
 
     if (FileKit::hasStamp(indexDir + "/.mergeocc_done")) {
+        if (progress != nullptr) {
+            progress->startField(id);
+            progress->finishField(id, true, 0u);
+        }
         return true;
     }
+    if (progress != nullptr) {
+        progress->startField(id);
+    }
+    bool ok = mergeFieldFiles(index, indexDir, progress);
+    if (progress != nullptr) {
+        progress->finishField(id, ok, ok ? search::DirectoryTraverse(indexDir.c_str()).GetTreeSize() : 0u);
+    }
+    return ok;
+}
+
+
+bool
+Fusion::mergeFieldFiles(const SchemaUtil::IndexIterator &index, const vespalib::string &indexDir,
+                        FusionProgress *progress)
+{
+    const vespalib::string &indexName = index.getName();
     vespalib::mkdir(indexDir.c_str(), false);
 
     LOG(debug, "mergeField for field %s dir %s",
         indexName.c_str(), indexDir.c_str());
 
-    makeTmpDirs();
+    makeTmpDirs(indexName);
 
-    if (!renumberFieldWordIds(index)) {
+    WordNumMappings wordNumMappings(_oldIndexes.size());
+    uint64_t numWordIds = 0;
+    if (!renumberFieldWordIds(index, wordNumMappings, numWordIds)) {
         LOG(error, "Could not renumber field word ids for field %s dir %s",
             indexName.c_str(), indexDir.c_str());
         return false;
     }
+    if (progress != nullptr) {
+        progress->setFieldWords(index.getIndex(), numWordIds);
+    }
 
     // Tokamak
-    bool res = mergeFieldPostings(index);
+    bool res = mergeFieldPostings(index, wordNumMappings, numWordIds);
     if (!res) {
         LOG(error, "Could not merge field postings for field %s dir %s",
             indexName.c_str(), indexDir.c_str());
@@ -215,7 +281,7 @@ Fusion::mergeField(uint32_t id)
     }
     vespalib::File::sync(indexDir);
 
-    if (!CleanTmpDirs()) {
+    if (!cleanFieldTmpDirs(indexName)) {
         return false;
     }
 
@@ -289,18 +355,19 @@ Fusion::selectCookedOrRawFeatures(Reader &reader, Writer &writer)
 
 bool
 Fusion::openInputFieldReaders(const SchemaUtil::IndexIterator &index,
+                              const WordNumMappings &wordNumMappings,
                               std::vector<std::unique_ptr<FieldReader> > &
                               readers)
 {
     vespalib::string indexName = index.getName();
-    for (auto &i : _oldIndexes) {
-        OldIndex &oi = *i;
+    for (uint32_t i = 0; i < _oldIndexes.size(); ++i) {
+        OldIndex &oi = *_oldIndexes[i];
         const Schema &oldSchema = oi.getSchema();
         if (!index.hasOldFields(oldSchema, false)) {
             continue; // drop data
         }
         auto reader = FieldReader::allocFieldReader(index, oldSchema);
-        reader->setup(oi.getWordNumMapping(),
+        reader->setup(wordNumMappings[i],
                       oi.getDocIdMapping());
         if (!reader->open(oi.getPath() + "/" + indexName + "/", _tuneFileIndexing._read)) {
             return false;
@@ -356,15 +423,17 @@ Fusion::setupMergeHeap(const std::vector<std::unique_ptr<FieldReader> > &
 
 
 bool
-Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index)
+Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index,
+                           const WordNumMappings &wordNumMappings,
+                           uint64_t numWordIds)
 {
     std::vector<std::unique_ptr<FieldReader>> readers;
     PostingPriorityQueue<FieldReader> heap;
     /* OUTPUT */
-    FieldWriter fieldWriter(_docIdLimit, _numWordIds);
+    FieldWriter fieldWriter(_docIdLimit, numWordIds);
     vespalib::string indexName = index.getName();
 
-    if (!openInputFieldReaders(index, readers)) {
+    if (!openInputFieldReaders(index, wordNumMappings, readers)) {
         return false;
     }
     if (!openFieldWriter(index, fieldWriter)) {
@@ -392,15 +461,14 @@ Fusion::mergeFieldPostings(const SchemaUtil::IndexIterator &index)
 
 
 bool
-Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
+Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator &index, WordNumMappings &wordNumMappings)
 {
-    ReleaseMappingTables();
-
     size_t numberOfOldIndexes = _oldIndexes.size();
+    assert(wordNumMappings.size() == numberOfOldIndexes);
     for (uint32_t i = 0; i < numberOfOldIndexes; i++)
     {
         OldIndex &oi = *_oldIndexes[i];
-        WordNumMapping &wordNumMapping = oi.getWordNumMapping();
+        WordNumMapping &wordNumMapping = wordNumMappings[i];
         std::vector<uint32_t> oldIndexes;
         const Schema &oldSchema = oi.getSchema();
         if (!SchemaUtil::getIndexIds(oldSchema,
@@ -413,12 +481,12 @@ Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
             wordNumMapping.noMappingFile();
             continue;
         }
-        if (index && !index->hasOldFields(oldSchema, false)) {
+        if (!index.hasOldFields(oldSchema, false)) {
             continue; // drop data
         }
 
         // Open word mapping file
-        vespalib::string old2newname = oi.getTmpPath() + "/old2new.dat";
+        vespalib::string old2newname = getFieldTmpPath(oi, index.getName()) + "/old2new.dat";
         wordNumMapping.readMappingFile(old2newname, _tuneFileIndexing._read);
     }
 
@@ -426,28 +494,36 @@ Fusion::ReadMappingFiles(const SchemaUtil::IndexIterator *index)
 }
 
 
-bool
-Fusion::ReleaseMappingTables()
+vespalib::string
+Fusion::getFieldTmpPath(const FusionInputIndex &oi, const vespalib::string &indexName) const
 {
-    size_t numberOfOldIndexes = _oldIndexes.size();
-    for (uint32_t i = 0; i < numberOfOldIndexes; i++)
-    {
-        OldIndex &oi = *_oldIndexes[i];
-        oi.getWordNumMapping().clear();
-    }
-    return true;
+    return oi.getTmpPath() + "/" + indexName;
 }
 
 
 void
-Fusion::makeTmpDirs()
+Fusion::makeTmpDirs(const vespalib::string &indexName)
 {
     for (auto &i : getOldIndexes()) {
         OldIndex &oi = *i;
-        // Make tmpindex directories
-        const vespalib::string &tmpindexpath = oi.getTmpPath();
-        vespalib::mkdir(tmpindexpath, false);
+        // Make tmpindex directories, one per field being merged
+        vespalib::mkdir(getFieldTmpPath(oi, indexName), true);
+    }
+}
+
+bool
+Fusion::cleanFieldTmpDirs(const vespalib::string &indexName)
+{
+    for (auto &i : getOldIndexes()) {
+        OldIndex &oi = *i;
+        vespalib::string tmpindexpath = getFieldTmpPath(oi, indexName);
+        search::DirectoryTraverse dt(tmpindexpath.c_str());
+        if (!dt.RemoveTree()) {
+            LOG(error, "Failed to clean tmpdir %s", tmpindexpath.c_str());
+            return false;
+        }
     }
+    return true;
 }
 
 bool
@@ -530,7 +606,9 @@ Fusion::merge(const Schema &schema,
               const SelectorArray &selector,
               bool dynamicKPosOccFormat,
               const TuneFileIndexing &tuneFileIndexing,
-              const FileHeaderContext &fileHeaderContext)
+              const FileHeaderContext &fileHeaderContext,
+              vespalib::ThreadExecutor &executor,
+              FusionProgress *progress)
 {
     assert(sources.size() <= 255);
     uint32_t docIdLimit = selector.size();
@@ -599,7 +677,7 @@ Fusion::merge(const Schema &schema,
                            idx);
     }
     fusion->setDocIdLimit(trimmedDocIdLimit);
-    if (!fusion->mergeFields()) {
+    if (!fusion->mergeFields(executor, progress)) {
         return false;
     }
     return true;
@@ -10,6 +10,7 @@
 #include <string>
 
 namespace search { template <class IN> class PostingPriorityQueue; }
+namespace vespalib { class ThreadExecutor; }
 
 namespace search::common {
     class TuneFileIndexing;
@@ -21,6 +22,7 @@ namespace search::diskindex {
 class FieldReader;
 class FieldWriter;
 class DictionaryWordReader;
+class FusionProgress;
 
 class FusionInputIndex
 {
@@ -29,7 +31,6 @@ public:
     typedef diskindex::DocIdMapping DocIdMapping;
 private:
     vespalib::string _path;
-    WordNumMapping _wordNumMapping;
     DocIdMapping _docIdMapping;
     vespalib::string _tmpPath;
     index::Schema::SP _schema;
@@ -37,7 +38,6 @@ private:
 public:
     FusionInputIndex()
         : _path(),
-          _wordNumMapping(),
           _docIdMapping(),
           _tmpPath(),
           _schema()
@@ -50,8 +50,6 @@ public:
     const vespalib::string & getPath() const { return _path; }
     void setTmpPath(const vespalib::string &tmpPath) { _tmpPath = tmpPath; }
     const vespalib::string &getTmpPath() const { return _tmpPath; }
-    const WordNumMapping & getWordNumMapping() const { return _wordNumMapping; }
-    WordNumMapping & getWordNumMapping() { return _wordNumMapping; }
     const DocIdMapping & getDocIdMapping() const { return _docIdMapping; }
 
     DocIdMapping & getDocIdMapping() { return _docIdMapping; }
@@ -70,6 +68,7 @@ class Fusion
 public:
     typedef search::index::Schema Schema;
     typedef search::index::SchemaUtil SchemaUtil;
+    typedef std::vector<WordNumMapping> WordNumMappings;
 
 private:
     Fusion(const Fusion &);
@@ -83,22 +82,36 @@ public:
     virtual ~Fusion();
 
     void SetOldIndexList(const std::vector<vespalib::string> &oldIndexList);
-    bool mergeFields();
-    bool mergeField(uint32_t id);
+    /**
+     * Merge all index fields.  Fields are independent of each other and
+     * are merged concurrently using the given executor.  Each field
+     * merge has its own word number mappings and temporary files, thus
+     * memory usage is bounded by the number of executor threads.
+     */
+    bool mergeFields(vespalib::ThreadExecutor &executor, FusionProgress *progress);
+    bool mergeField(uint32_t id, FusionProgress *progress);
+    bool mergeFieldFiles(const SchemaUtil::IndexIterator &index, const vespalib::string &indexDir,
+                         FusionProgress *progress);
     bool openInputFieldReaders(const SchemaUtil::IndexIterator &index,
+                               const WordNumMappings &wordNumMappings,
                                std::vector<std::unique_ptr<FieldReader> > &
                                readers);
     bool openFieldWriter(const SchemaUtil::IndexIterator &index, FieldWriter & writer);
     bool setupMergeHeap(const std::vector<std::unique_ptr<FieldReader> > & readers,
                         FieldWriter &writer, PostingPriorityQueue<FieldReader> &heap);
-    bool mergeFieldPostings(const SchemaUtil::IndexIterator &index);
+    bool mergeFieldPostings(const SchemaUtil::IndexIterator &index,
+                            const WordNumMappings &wordNumMappings,
+                            uint64_t numWordIds);
     bool openInputWordReaders(const SchemaUtil::IndexIterator &index,
                               std::vector<std::unique_ptr<DictionaryWordReader> > &readers,
                               PostingPriorityQueue<DictionaryWordReader> &heap);
-    bool renumberFieldWordIds(const SchemaUtil::IndexIterator &index);
+    bool renumberFieldWordIds(const SchemaUtil::IndexIterator &index,
+                              WordNumMappings &wordNumMappings,
+                              uint64_t &numWordIds);
     void setSchema(const Schema *schema);
     void setOutDir(const vespalib::string &outDir);
-    void makeTmpDirs();
+    void makeTmpDirs(const vespalib::string &indexName);
+    bool cleanFieldTmpDirs(const vespalib::string &indexName);
     bool CleanTmpDirs();
     bool readSchemaFiles();
     bool checkSchemaCompat();
@@ -108,8 +121,8 @@ public:
     selectCookedOrRawFeatures(Reader &reader, Writer &writer);
 
 protected:
-    bool ReadMappingFiles(const SchemaUtil::IndexIterator *index);
-    bool ReleaseMappingTables();
+    bool ReadMappingFiles(const SchemaUtil::IndexIterator &index, WordNumMappings &wordNumMappings);
+    vespalib::string getFieldTmpPath(const FusionInputIndex &oi, const vespalib::string &indexName) const;
 protected:
 
     typedef FusionInputIndex OldIndex;
@@ -122,7 +135,6 @@ protected:
     // OUTPUT:
 
     uint32_t _docIdLimit;
-    uint64_t _numWordIds;
 
     // Index format parameters.
     bool _dynamicKPosIndexFormat;
@@ -156,7 +168,9 @@ public:
                       const SelectorArray &docIdSelector,
                       bool dynamicKPosOccFormat,
                       const TuneFileIndexing &tuneFileIndexing,
-                      const common::FileHeaderContext &fileHeaderContext);
+                      const common::FileHeaderContext &fileHeaderContext,
+                      vespalib::ThreadExecutor &executor,
+                      FusionProgress *progress = nullptr);
 };
 
 }
@@ -0,0 +1,106 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "fusion_progress.h"
+#include <cassert>
+
+namespace search::diskindex {
+
+using Guard = std::lock_guard<std::mutex>;
+
+FusionProgress::FieldStats::FieldStats(const vespalib::string &name_)
+    : name(name_),
+      state(State::PENDING),
+      numWords(0),
+      sizeOnDisk(0),
+      elapsedSeconds(0.0)
+{
+}
+
+double
+FusionProgress::FieldStats::wordsPerSecond() const
+{
+    return (elapsedSeconds > 0.0) ? (numWords / elapsedSeconds) : 0.0;
+}
+
+double
+FusionProgress::FieldStats::bytesPerSecond() const
+{
+    return (elapsedSeconds > 0.0) ? (sizeOnDisk / elapsedSeconds) : 0.0;
+}
+
+FusionProgress::FusionProgress()
+    : _lock(),
+      _fields()
+{
+}
+
+FusionProgress::~FusionProgress() = default;
+
+void
+FusionProgress::startFusion(const std::vector<vespalib::string> &fieldNames)
+{
+    Guard guard(_lock);
+    _fields.clear();
+    for (const auto &name : fieldNames) {
+        _fields.emplace_back(name);
+    }
+}
+
+void
+FusionProgress::startField(uint32_t fieldId)
+{
+    Guard guard(_lock);
+    assert(fieldId < _fields.size());
+    Field &field = _fields[fieldId];
+    field.stats.state = State::RUNNING;
+    field.start = clock::now();
+}
+
+void
+FusionProgress::setFieldWords(uint32_t fieldId, uint64_t numWords)
+{
+    Guard guard(_lock);
+    assert(fieldId < _fields.size());
+    _fields[fieldId].stats.numWords = numWords;
+}
+
+void
+FusionProgress::finishField(uint32_t fieldId, bool ok, uint64_t sizeOnDisk)
+{
+    Guard guard(_lock);
+    assert(fieldId < _fields.size());
+    Field &field = _fields[fieldId];
+    field.stats.state = ok ? State::DONE : State::FAILED;
+    field.stats.sizeOnDisk = sizeOnDisk;
+    field.stats.elapsedSeconds = std::chrono::duration<double>(clock::now() - field.start).count();
+}
+
+std::vector<FusionProgress::FieldStats>
+FusionProgress::getFields() const
+{
+    Guard guard(_lock);
+    std::vector<FieldStats> result;
+    result.reserve(_fields.size());
+    clock::time_point now = clock::now();
+    for (const auto &field : _fields) {
+        result.push_back(field.stats);
+        if (field.stats.state == State::RUNNING) {
+            result.back().elapsedSeconds = std::chrono::duration<double>(now - field.start).count();
+        }
+    }
+    return result;
+}
+
+const char *
+FusionProgress::stateName(State state)
+{
+    switch (state) {
+    case State::PENDING: return "pending";
+    case State::RUNNING: return "running";
+    case State::DONE:    return "done";
+    case State::FAILED:  return "failed";
+    }
+    return "unknown";
+}
+
+}
@@ -0,0 +1,62 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/stllike/string.h>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace search::diskindex {
+
+/**
+ * Tracks progress of an ongoing (or the last) fusion, one entry per
+ * index field.  Fields are merged concurrently, thus all methods are
+ * thread safe.
+ */
+class FusionProgress
+{
+public:
+    enum class State { PENDING, RUNNING, DONE, FAILED };
+
+    struct FieldStats {
+        vespalib::string name;
+        State            state;
+        uint64_t         numWords;
+        uint64_t         sizeOnDisk;
+        double           elapsedSeconds;
+
+        FieldStats(const vespalib::string &name_);
+        double wordsPerSecond() const;
+        double bytesPerSecond() const;
+    };
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct Field {
+        FieldStats        stats;
+        clock::time_point start;
+        Field(const vespalib::string &name) : stats(name), start() { }
+    };
+
+    mutable std::mutex _lock;
+    std::vector<Field> _fields;
+
+public:
+    FusionProgress();
+    ~FusionProgress();
+
+    /*
+     * Start tracking a new fusion.  Field ids are indexes into fieldNames.
+     */
+    void startFusion(const std::vector<vespalib::string> &fieldNames);
+    void startField(uint32_t fieldId);
+    void setFieldWords(uint32_t fieldId, uint64_t numWords);
+    void finishField(uint32_t fieldId, bool ok, uint64_t sizeOnDisk);
+
+    std::vector<FieldStats> getFields() const;
+    static const char *stateName(State state);
+};
+
+}
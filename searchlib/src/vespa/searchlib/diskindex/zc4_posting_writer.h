@@ -12,8 +12,9 @@ namespace search::diskindex {
  * Class used to write posting lists of type "Zc.4" and "Zc.5" (dynamic k).
  *
  * Common words have docid deltas and skip info separate from
- * features.
- * 
+ * features.  Docid deltas are either Zc-encoded one by one or, when
+ * block docids are enabled, bit packed in blocks (cf. ZcDocIdBlock).
+ *
  * Rare words do not have skip info, and docid deltas and features are
  * interleaved.
  */
@@ -1,6 +1,7 @@
 // Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "zc4_posting_writer_base.h"
+#include "zcdocidblock.h"
 #include <vespa/searchlib/index/postinglistcounts.h>
 
 using search::index::PostingListCounts;
@@ -26,6 +27,8 @@ public:
     }
 
     void write(ZcBuf &zc_buf, const DocIdAndFeatureSize &doc_id_and_feature_size);
+    void write_block(ZcBuf &zc_buf, const DocIdAndFeatureSize *doc_ids_and_feature_sizes);
+    void write_tail_marker(ZcBuf &zc_buf);
     void set_doc_id(uint32_t doc_id) { _doc_id = doc_id; }
     uint32_t get_doc_id() const { return _doc_id; }
     uint32_t get_doc_id_pos() const { return _doc_id_pos; }
@@ -108,6 +111,27 @@ DocIdEncoder::write(ZcBuf &zc_buf, const DocIdAndFeatureSize &doc_id_and_feature
     _doc_id_pos = zc_buf.size();
 }
 
+void
+DocIdEncoder::write_block(ZcBuf &zc_buf, const DocIdAndFeatureSize *doc_ids_and_feature_sizes)
+{
+    uint32_t deltas[ZcDocIdBlock::block_size];
+    for (uint32_t i = 0; i < ZcDocIdBlock::block_size; ++i) {
+        const auto &doc_id_and_feature_size = doc_ids_and_feature_sizes[i];
+        _feature_pos += doc_id_and_feature_size.second;
+        deltas[i] = doc_id_and_feature_size.first - _doc_id - 1;
+        _doc_id = doc_id_and_feature_size.first;
+    }
+    ZcDocIdBlock::encode(zc_buf, deltas);
+    _doc_id_pos = zc_buf.size();
+}
+
+void
+DocIdEncoder::write_tail_marker(ZcBuf &zc_buf)
+{
+    ZcDocIdBlock::encode_tail_marker(zc_buf);
+    _doc_id_pos = zc_buf.size();
+}
+
 void
 L1SkipEncoder::encode_skip(ZcBuf &zc_buf, const DocIdEncoder &doc_id_encoder)
 {
@@ -199,6 +223,7 @@ Zc4PostingWriterBase::Zc4PostingWriterBase(PostingListCounts &counts)
       _featureOffset(0),
       _writePos(0),
       _dynamicK(false),
+      _blockDocIds(false),
       _zcDocIds(),
       _l1Skip(),
       _l2Skip(),
@@ -244,8 +269,12 @@ Zc4PostingWriterBase::calc_skip_info(bool encode_features)
         l3_skip_encoder.set_doc_id(doc_id);
         l4_skip_encoder.set_doc_id(doc_id);
     }
-    for (const auto &doc_id_and_feature_size : _docIds) {
-        if (l1_skip_encoder.should_write_skip(L1SKIPSTRIDE)) {
+    // With block docids, L1 skip entries are placed at block boundaries
+    uint32_t l1_skip_stride = _blockDocIds ? ZcDocIdBlock::block_size : L1SKIPSTRIDE;
+    uint32_t num_docs = _docIds.size();
+    uint32_t blocks_end = _blockDocIds ? (num_docs - num_docs % ZcDocIdBlock::block_size) : 0u;
+    for (uint32_t i = 0; i < num_docs; ++i) {
+        if (l1_skip_encoder.should_write_skip(l1_skip_stride)) {
             l1_skip_encoder.write_skip(_l1Skip, doc_id_encoder);
             if (l2_skip_encoder.should_write_skip(L2SKIPSTRIDE)) {
                 l2_skip_encoder.write_skip(_l2Skip, l1_skip_encoder);
@@ -257,7 +286,16 @@ Zc4PostingWriterBase::calc_skip_info(bool encode_features)
                 }
             }
         }
-        doc_id_encoder.write(_zcDocIds, doc_id_and_feature_size);
+        if (i < blocks_end) {
+            if ((i % ZcDocIdBlock::block_size) == 0) {
+                doc_id_encoder.write_block(_zcDocIds, &_docIds[i]);
+            }
+            continue;
+        }
+        if (i == blocks_end && _blockDocIds) {
+            doc_id_encoder.write_tail_marker(_zcDocIds);
+        }
+        doc_id_encoder.write(_zcDocIds, _docIds[i]);
     }
     // Extra partial entries for skip tables to simplify iterator during search
     l1_skip_encoder.write_partial_skip(_l1Skip, doc_id_encoder.get_doc_id());
@@ -282,6 +320,7 @@ Zc4PostingWriterBase::set_posting_list_params(const PostingListParams &params)
     params.get("docIdLimit", _docIdLimit);
     params.get("minChunkDocs", _minChunkDocs);
     params.get("minSkipDocs", _minSkipDocs);
+    params.get("blockDocIds", _blockDocIds);
 }
 
 }
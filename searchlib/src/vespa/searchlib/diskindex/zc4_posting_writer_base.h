@@ -30,6 +30,7 @@ protected:
     uint64_t _featureOffset;        // Bit offset of next feature
     uint64_t _writePos; // Bit position for start of current word
     bool _dynamicK;     // Caclulate EG compression parameters ?
+    bool _blockDocIds;  // Use bit packed blocks for docid deltas ?
     ZcBuf _zcDocIds;    // Document id deltas
     ZcBuf _l1Skip;      // L1 skip info
     ZcBuf _l2Skip;      // L2 skip info
@@ -59,6 +60,8 @@ public:
     uint64_t get_num_words() const { return _numWords; }
     bool get_dynamic_k() const { return _dynamicK; }
     void set_dynamic_k(bool dynamicK) { _dynamicK = dynamicK; }
+    bool get_block_doc_ids() const { return _blockDocIds; }
+    void set_block_doc_ids(bool blockDocIds) { _blockDocIds = blockDocIds; }
     void set_posting_list_params(const index::PostingListParams &params);
 };
 
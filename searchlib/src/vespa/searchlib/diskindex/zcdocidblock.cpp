@@ -0,0 +1,159 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "zcdocidblock.h"
+#include "zcbuf.h"
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace search::diskindex {
+
+namespace {
+
+vespalib::string myId("DocIdBlock.128");
+
+constexpr uint32_t lanes = ZcDocIdBlock::lanes;
+constexpr uint32_t lane_values = ZcDocIdBlock::block_size / lanes;
+
+using UnpackFunc = void (*)(const uint32_t *words, uint32_t *deltas);
+
+/*
+ * Unpack deltas for a block with a fixed bit width.  The outer loop
+ * is fully unrolled by the compiler since bits is a compile time
+ * constant, and the inner loop over lanes maps to vector operations.
+ */
+template <uint32_t bits>
+void
+unpack(const uint32_t *words, uint32_t *deltas)
+{
+    constexpr uint32_t mask = (bits == 32) ? ~0u : ((1u << bits) - 1);
+    for (uint32_t i = 0; i < lane_values; ++i) {
+        const uint32_t bit_pos = i * bits;
+        const uint32_t word = bit_pos / 32;
+        const uint32_t shift = bit_pos % 32;
+        const uint32_t *src = words + word * lanes;
+        uint32_t *dst = deltas + i * lanes;
+        if (shift + bits > 32) {
+            for (uint32_t lane = 0; lane < lanes; ++lane) {
+                dst[lane] = ((src[lane] >> shift) | (src[lane + lanes] << (32 - shift))) & mask;
+            }
+        } else {
+            for (uint32_t lane = 0; lane < lanes; ++lane) {
+                dst[lane] = (src[lane] >> shift) & mask;
+            }
+        }
+    }
+}
+
+template <>
+void
+unpack<0>(const uint32_t *, uint32_t *deltas)
+{
+    memset(deltas, 0, ZcDocIdBlock::block_size * sizeof(uint32_t));
+}
+
+template <size_t... bits>
+constexpr std::array<UnpackFunc, sizeof...(bits)>
+make_unpack_funcs(std::index_sequence<bits...>)
+{
+    return {{ &unpack<bits>... }};
+}
+
+const std::array<UnpackFunc, 33> unpack_funcs = make_unpack_funcs(std::make_index_sequence<33>());
+
+uint32_t
+calc_bits(const uint32_t *deltas)
+{
+    uint32_t all_bits = 0;
+    for (uint32_t i = 0; i < ZcDocIdBlock::block_size; ++i) {
+        all_bits |= deltas[i];
+    }
+    return (all_bits == 0) ? 0 : (32 - __builtin_clz(all_bits));
+}
+
+}
+
+void
+ZcDocIdBlock::encode(ZcBuf &zc_buf, const uint32_t *deltas)
+{
+    uint32_t bits = calc_bits(deltas);
+    uint32_t words[block_size];
+    memset(words, 0, sizeof(words));
+    for (uint32_t i = 0; i < block_size; ++i) {
+        uint32_t lane = i % lanes;
+        uint32_t bit_pos = (i / lanes) * bits;
+        uint32_t word = bit_pos / 32;
+        uint32_t shift = bit_pos % 32;
+        words[word * lanes + lane] |= deltas[i] << shift;
+        if (shift + bits > 32) {
+            words[(word + 1) * lanes + lane] |= deltas[i] >> (32 - shift);
+        }
+    }
+    uint32_t size = encoded_size(bits);
+    while (zc_buf._valI + size > zc_buf._valE) {
+        zc_buf.expand();
+    }
+    *zc_buf._valI++ = bits;
+    memcpy(zc_buf._valI, words, size - 1);
+    zc_buf._valI += size - 1;
+    zc_buf.maybeExpand();
+}
+
+void
+ZcDocIdBlock::encode_tail_marker(ZcBuf &zc_buf)
+{
+    *zc_buf._valI++ = tail_marker;
+    zc_buf.maybeExpand();
+}
+
+uint32_t
+ZcDocIdBlock::decode(const uint8_t *&valI, const uint8_t *valE, uint32_t prev_doc_id, uint32_t *doc_ids)
+{
+    const uint8_t *src = valI;
+    uint32_t bits = *src++;
+    if (__builtin_expect(bits == tail_marker, false)) {
+        uint32_t num_docs = 0;
+        while (src < valE) {
+            uint32_t delta = 0;
+            for (uint32_t shift = 0; ; shift += 7) {
+                uint8_t val = *src++;
+                delta |= static_cast<uint32_t>(val & ((1 << 7) - 1)) << shift;
+                if (val < (1 << 7)) {
+                    break;
+                }
+            }
+            prev_doc_id += 1 + delta;
+            doc_ids[num_docs++] = prev_doc_id;
+        }
+        assert(num_docs < block_size);
+        valI = src;
+        return num_docs;
+    }
+    assert(bits <= 32);
+    uint32_t words[block_size];
+    uint32_t deltas[block_size];
+    memcpy(words, src, bits * lanes * sizeof(uint32_t));
+    unpack_funcs[bits](words, deltas);
+    for (uint32_t i = 0; i < block_size; ++i) {
+        prev_doc_id += 1 + deltas[i];
+        doc_ids[i] = prev_doc_id;
+    }
+    valI = src + bits * lanes * sizeof(uint32_t);
+    return block_size;
+}
+
+const vespalib::string &
+ZcDocIdBlock::getIdentifier()
+{
+    return myId;
+}
+
+bool
+ZcDocIdBlock::checkFormats(const std::vector<vespalib::string> &formats)
+{
+    return formats.size() == 2 ||
+        (formats.size() == 3 && formats[2] == myId);
+}
+
+}
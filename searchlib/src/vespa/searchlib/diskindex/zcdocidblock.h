@@ -0,0 +1,63 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/stllike/string.h>
+#include <cstdint>
+#include <vector>
+
+namespace search::diskindex {
+
+class ZcBuf;
+
+/*
+ * Block encoding of document id deltas for common words, used instead
+ * of one Zc-encoded delta per document when the posting list file has
+ * block docids enabled.
+ *
+ * A full block contains block_size deltas (docid - prevDocId - 1)
+ * packed with a common bit width.  The block starts with a byte
+ * containing the bit width, followed by bit width * 16 bytes of packed
+ * data.  Deltas are distributed round robin over 4 lanes of 32-bit
+ * words, with words from the lanes interleaved, which allows the
+ * unpacking loop to be vectorized.
+ *
+ * Documents remaining after the last full block are stored as a tail,
+ * starting with a marker byte followed by one Zc-encoded delta per
+ * document until the end of the document id deltas for the chunk.
+ *
+ * L1 skip entries are placed at block boundaries, thus a skip never
+ * lands in the middle of a block.
+ */
+class ZcDocIdBlock
+{
+public:
+    static constexpr uint32_t block_size = 128;
+    static constexpr uint32_t lanes = 4;
+    static constexpr uint8_t tail_marker = 0xff;
+
+    /*
+     * Encode a full block of docid deltas.
+     */
+    static void encode(ZcBuf &zc_buf, const uint32_t *deltas);
+    static void encode_tail_marker(ZcBuf &zc_buf);
+
+    /*
+     * Decode a full block or a tail starting at valI into absolute
+     * document ids.  valE is the end of the docid deltas for the
+     * chunk.  Returns number of document ids decoded and updates
+     * valI to point to next block.
+     */
+    static uint32_t decode(const uint8_t *&valI, const uint8_t *valE, uint32_t prev_doc_id, uint32_t *doc_ids);
+    static uint32_t encoded_size(uint32_t bits) { return 1 + bits * block_size / 8; }
+    static const vespalib::string &getIdentifier();
+
+    /*
+     * Check that the formats from a posting list file header has
+     * the posting and feature formats, optionally followed by the
+     * block docids format.
+     */
+    static bool checkFormats(const std::vector<vespalib::string> &formats);
+};
+
+}
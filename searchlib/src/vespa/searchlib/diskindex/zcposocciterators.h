@@ -34,7 +34,7 @@ private:
     DecodeContext _decodeContextReal;
 public:
     Zc4PosOccIterator(Position start, uint64_t bitLength, uint32_t docIdLimit,
-                      uint32_t minChunkDocs, const index::PostingListCounts &counts,
+                      uint32_t minChunkDocs, bool blockDocIds, const index::PostingListCounts &counts,
                       const bitcompression::PosOccFieldsParams *fieldsParams,
                       const fef::TermFieldMatchDataArray &matchData);
 };
@@ -67,7 +67,7 @@ private:
     DecodeContext _decodeContextReal;
 public:
     ZcPosOccIterator(Position start, uint64_t bitLength, uint32_t docidLimit,
-                     uint32_t minChunkDocs, const index::PostingListCounts &counts,
+                     uint32_t minChunkDocs, bool blockDocIds, const index::PostingListCounts &counts,
                      const bitcompression::PosOccFieldsParams *fieldsParams,
                      const fef::TermFieldMatchDataArray &matchData);
 };
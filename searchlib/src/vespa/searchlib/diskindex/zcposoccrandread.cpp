@@ -2,6 +2,7 @@
 
 #include "zcposoccrandread.h"
 #include "zcposocciterators.h"
+#include "zcdocidblock.h"
 #include <vespa/vespalib/data/fileheader.h>
 #include <vespa/searchlib/queryeval/emptysearch.h>
 #include <vespa/fastos/file.h>
@@ -42,7 +43,8 @@ ZcPosOccRandRead::ZcPosOccRandRead()
       _fileBitSize(0),
       _headerBitSize(0),
       _fieldsParams(),
-      _dynamicK(true)
+      _dynamicK(true),
+      _blockDocIds(false)
 { }
 
 
@@ -97,7 +99,8 @@ createIterator(const PostingListCounts &counts,
     if (numDocs < _minSkipDocs) {
         return new ZcRareWordPosOccIterator<true>(start, handle._bitLength, _docIdLimit, &_fieldsParams, matchData);
     } else {
-        return new ZcPosOccIterator<true>(start, handle._bitLength, _docIdLimit, _minChunkDocs, counts, &_fieldsParams, matchData);
+        return new ZcPosOccIterator<true>(start, handle._bitLength, _docIdLimit, _minChunkDocs, _blockDocIds, counts,
+                                          &_fieldsParams, matchData);
     }
 }
 
@@ -218,7 +221,7 @@ ZcPosOccRandRead::readHeader()
     assert(header.hasTag("fileBitSize"));
     assert(header.hasTag("format.0"));
     assert(header.hasTag("format.1"));
-    assert(!header.hasTag("format.2"));
+    assert(!header.hasTag("format.3"));
     assert(header.hasTag("numWords"));
     assert(header.hasTag("minChunkDocs"));
     assert(header.hasTag("docIdLimit"));
@@ -227,6 +230,8 @@ ZcPosOccRandRead::readHeader()
     _fileBitSize = header.getTag("fileBitSize").asInteger();
     assert(header.getTag("format.0").asString() == myId5);
     assert(header.getTag("format.1").asString() == d.getIdentifier());
+    _blockDocIds = header.hasTag("format.2");
+    assert(!_blockDocIds || header.getTag("format.2").asString() == ZcDocIdBlock::getIdentifier());
     _numWords = header.getTag("numWords").asInteger();
     _minChunkDocs = header.getTag("minChunkDocs").asInteger();
     _docIdLimit = header.getTag("docIdLimit").asInteger();
@@ -306,7 +311,8 @@ createIterator(const PostingListCounts &counts,
     if (numDocs < _minSkipDocs) {
         return new Zc4RareWordPosOccIterator<true>(start, handle._bitLength, _docIdLimit, &_fieldsParams, matchData);
     } else {
-        return new Zc4PosOccIterator<true>(start, handle._bitLength, _docIdLimit, _minChunkDocs, counts, &_fieldsParams, matchData);
+        return new Zc4PosOccIterator<true>(start, handle._bitLength, _docIdLimit, _minChunkDocs, _blockDocIds, counts,
+                                           &_fieldsParams, matchData);
     }
 }
 
@@ -330,7 +336,7 @@ Zc4PosOccRandRead::readHeader()
     assert(header.hasTag("fileBitSize"));
     assert(header.hasTag("format.0"));
     assert(header.hasTag("format.1"));
-    assert(!header.hasTag("format.2"));
+    assert(!header.hasTag("format.3"));
     assert(header.hasTag("numWords"));
     assert(header.hasTag("minChunkDocs"));
     assert(header.hasTag("docIdLimit"));
@@ -339,6 +345,8 @@ Zc4PosOccRandRead::readHeader()
     _fileBitSize = header.getTag("fileBitSize").asInteger();
     assert(header.getTag("format.0").asString() == myId4);
     assert(header.getTag("format.1").asString() == d.getIdentifier());
+    _blockDocIds = header.hasTag("format.2");
+    assert(!_blockDocIds || header.getTag("format.2").asString() == ZcDocIdBlock::getIdentifier());
     _numWords = header.getTag("numWords").asInteger();
     _minChunkDocs = header.getTag("minChunkDocs").asInteger();
     _docIdLimit = header.getTag("docIdLimit").asInteger();
@@ -24,7 +24,7 @@ protected:
     uint64_t _headerBitSize;
     bitcompression::PosOccFieldsParams _fieldsParams;
     bool _dynamicK;
-
+    bool _blockDocIds;      // Docid deltas are bit packed in blocks ?
 
 public:
     ZcPosOccRandRead();
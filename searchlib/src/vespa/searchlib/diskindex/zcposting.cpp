@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "zcposting.h"
+#include "zcdocidblock.h"
 #include <vespa/searchlib/index/postinglistcounts.h>
 #include <vespa/searchlib/index/postinglistcountfile.h>
 #include <vespa/searchlib/index/postinglistfile.h>
@@ -44,7 +45,12 @@ Zc4PostingSeqRead(PostingListCountFileSeqRead *countFile)
       _minChunkDocs(1 << 30),
       _minSkipDocs(64),
       _docIdLimit(10000000),
+      _blockDocIds(false),
       _zcDocIds(),
+      _docIdBlock(),
+      _docIdBlockPos(0),
+      _docIdBlockNum(0),
+      _docIdBlockStart(0),
       _l1Skip(),
       _l2Skip(),
       _l3Skip(),
@@ -92,17 +98,38 @@ Zc4PostingSeqRead::~Zc4PostingSeqRead()
 }
 
 
+uint32_t
+Zc4PostingSeqRead::readCommonWordDocId(uint32_t &docIdPos)
+{
+    if (!_blockDocIds) {
+        assert(_zcDocIds._valI < _zcDocIds._valE);
+        docIdPos = _zcDocIds.pos();
+        return _prevDocId + 1 + _zcDocIds.decode();
+    }
+    if (_docIdBlockPos >= _docIdBlockNum) {
+        assert(_zcDocIds._valI < _zcDocIds._valE);
+        _docIdBlockStart = _zcDocIds.pos();
+        const uint8_t *valI = _zcDocIds._valI;
+        _docIdBlockNum = ZcDocIdBlock::decode(valI, _zcDocIds._valE, _prevDocId, &_docIdBlock[0]);
+        _zcDocIds._valI += (valI - _zcDocIds._valI);
+        _docIdBlockPos = 0;
+    }
+    // Skip info refers to the start of the block
+    docIdPos = _docIdBlockStart;
+    return _docIdBlock[_docIdBlockPos++];
+}
+
+
 void
 Zc4PostingSeqRead::
 readCommonWordDocIdAndFeatures(DocIdAndFeatures &features)
 {
-    if ((_zcDocIds._valI >= _zcDocIds._valE) && _hasMore) {
+    if (docIdsAtEnd() && _hasMore) {
         readWordStart();    // Read start of next chunk
     }
     // Split docid & features.
-    assert(_zcDocIds._valI < _zcDocIds._valE);
-    uint32_t docIdPos = _zcDocIds.pos();
-    uint32_t docId = _prevDocId + 1 + _zcDocIds.decode();
+    uint32_t docIdPos = 0;
+    uint32_t docId = readCommonWordDocId(docIdPos);
     features._docId = docId;
     _prevDocId = docId;
     assert(docId <= _lastDocId);
@@ -165,10 +192,11 @@ readCommonWordDocIdAndFeatures(DocIdAndFeatures &features)
     }
     if (docId < _lastDocId) {
         // Assert more space available when not yet at last docid
-        assert(_zcDocIds._valI < _zcDocIds._valE);
+        assert(!docIdsAtEnd());
     } else {
         // Assert that space has been used when at last docid
         assert(_zcDocIds._valI == _zcDocIds._valE);
+        assert(_docIdBlockPos == _docIdBlockNum);
         // Assert that we've read to end of skip info
         assert(_l1SkipDocId == _lastDocId);
         assert(_l2SkipDocId == _lastDocId);
@@ -416,6 +444,8 @@ Zc4PostingSeqRead::readWordStartWithSkip()
     _l4SkipL2SkipPos = 0;
     _l4SkipL3SkipPos = 0;
     _l4SkipFeaturesPos = _decodeContext->getReadOffset();
+    _docIdBlockPos = 0;
+    _docIdBlockNum = 0;
     _hasMore = hasMore;
     // Decode context is now positioned at start of features
 }
@@ -555,7 +585,7 @@ Zc4PostingSeqRead::readHeader()
     assert(header.hasTag("fileBitSize"));
     assert(header.hasTag("format.0"));
     assert(header.hasTag("format.1"));
-    assert(!header.hasTag("format.2"));
+    assert(!header.hasTag("format.3"));
     assert(header.hasTag("numWords"));
     assert(header.hasTag("minChunkDocs"));
     assert(header.hasTag("docIdLimit"));
@@ -570,6 +600,11 @@ Zc4PostingSeqRead::readHeader()
     assert(header.getTag("format.0").asString() == myId);
     (void) myId;
     assert(header.getTag("format.1").asString() == d.getIdentifier());
+    _blockDocIds = header.hasTag("format.2");
+    if (_blockDocIds) {
+        assert(header.getTag("format.2").asString() == ZcDocIdBlock::getIdentifier());
+        _docIdBlock.resize(ZcDocIdBlock::block_size);
+    }
     _numWords = header.getTag("numWords").asInteger();
     _minChunkDocs = header.getTag("minChunkDocs").asInteger();
     _docIdLimit = header.getTag("docIdLimit").asInteger();
@@ -671,6 +706,9 @@ Zc4PostingSeqWrite::makeHeader(const FileHeaderContext &fileHeaderContext)
     header.putTag(Tag("fileBitSize", 0));
     header.putTag(Tag("format.0", myId));
     header.putTag(Tag("format.1", f.getIdentifier()));
+    if (_writer.get_block_doc_ids()) {
+        header.putTag(Tag("format.2", ZcDocIdBlock::getIdentifier()));
+    }
     header.putTag(Tag("numWords", 0));
     header.putTag(Tag("minChunkDocs", _writer.get_min_chunk_docs()));
     header.putTag(Tag("docIdLimit", _writer.get_docid_limit()));
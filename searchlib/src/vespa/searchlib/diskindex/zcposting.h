@@ -34,8 +34,13 @@ protected:
     uint32_t _minChunkDocs; // # of documents needed for chunking
     uint32_t _minSkipDocs;  // # of documents needed for skipping
     uint32_t _docIdLimit;   // Limit for document ids (docId < docIdLimit)
+    bool _blockDocIds;      // Docid deltas are bit packed in blocks ?
 
     ZcBuf _zcDocIds;    // Document id deltas
+    std::vector<uint32_t> _docIdBlock; // Decoded document ids for block
+    uint32_t _docIdBlockPos;    // Next document id in decoded block
+    uint32_t _docIdBlockNum;    // Number of document ids in decoded block
+    uint32_t _docIdBlockStart;  // Position of block in document id deltas
     ZcBuf _l1Skip;      // L1 skip info
     ZcBuf _l2Skip;      // L2 skip info
     ZcBuf _l3Skip;      // L3 skip info
@@ -88,6 +93,11 @@ public:
      */
     virtual void readCommonWordDocIdAndFeatures(DocIdAndFeatures &features);
 
+    bool docIdsAtEnd() const {
+        return _zcDocIds._valI >= _zcDocIds._valE && _docIdBlockPos >= _docIdBlockNum;
+    }
+    uint32_t readCommonWordDocId(uint32_t &docIdPos);
+
     void readDocIdAndFeatures(DocIdAndFeatures &features) override;
     void readCounts(const PostingListCounts &counts) override; // Fill in for next word
     bool open(const vespalib::string &name, const TuneFileSeqRead &tuneFileRead) override;
@@ -207,11 +207,16 @@ ZcRareWordPostingIterator<bigEndian>::readWordStart(uint32_t docIdLimit)
     clearUnpacked();
 }
 
-ZcPostingIteratorBase::ZcPostingIteratorBase(const TermFieldMatchDataArray &matchData, Position start, uint32_t docIdLimit)
+ZcPostingIteratorBase::ZcPostingIteratorBase(const TermFieldMatchDataArray &matchData, Position start, uint32_t docIdLimit,
+                                             bool blockDocIds)
     : ZcIteratorBase(matchData, start, docIdLimit),
       _valI(nullptr),
       _valIBase(nullptr),
+      _valIEnd(nullptr),
       _featureSeekPos(0),
+      _docIdBlock(blockDocIds ? ZcDocIdBlock::block_size : 0u),
+      _docIdBlockI(nullptr),
+      _blockDocIds(blockDocIds),
       _l1(),
       _l2(),
       _l3(),
@@ -227,10 +232,11 @@ template <bool bigEndian>
 ZcPostingIterator<bigEndian>::
 ZcPostingIterator(uint32_t minChunkDocs,
                   bool dynamicK,
+                  bool blockDocIds,
                   const PostingListCounts &counts,
                   const search::fef::TermFieldMatchDataArray &matchData,
                   Position start, uint32_t docIdLimit)
-    : ZcPostingIteratorBase(matchData, start, docIdLimit),
+    : ZcPostingIteratorBase(matchData, start, docIdLimit, blockDocIds),
       _decodeContext(nullptr),
       _minChunkDocs(minChunkDocs),
       _docIdK(0),
@@ -316,6 +322,7 @@ ZcPostingIterator<bigEndian>::readWordStart(uint32_t docIdLimit)
     const uint8_t *bcompr = d.getByteCompr();
     _valIBase = _valI = bcompr;
     bcompr += docIdsSize;
+    _valIEnd = bcompr;
     _l1.setup(prevDocId, _chunk._lastDocId, bcompr, l1SkipSize);
     _l2.setup(prevDocId, _chunk._lastDocId, bcompr, l2SkipSize);
     _l3.setup(prevDocId, _chunk._lastDocId, bcompr, l3SkipSize);
@@ -539,6 +546,21 @@ ZcPostingIteratorBase::doSeek(uint32_t docId)
         doL1SkipSeek(docId);
     }
     uint32_t oDocId = getDocId();
+    if (_blockDocIds) {
+        /*
+         * L1 skip entries are placed at block boundaries, thus the
+         * L1 skip docid is the last docid in the decoded block and
+         * the scan below stays within the block.
+         */
+        const uint32_t *docIdBlockI = _docIdBlockI;
+        while (__builtin_expect(oDocId < docId, true)) {
+            oDocId = *++docIdBlockI;
+            incNeedUnpack();
+        }
+        _docIdBlockI = docIdBlockI;
+        setDocId(oDocId);
+        return;
+    }
 #if DEBUG_ZCPOSTING_ASSERT
     assert(oDocId <= _l1._skipDocId);
     assert(docId <= _l1._skipDocId);
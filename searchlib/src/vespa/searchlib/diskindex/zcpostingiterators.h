@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "zcdocidblock.h"
 #include <vespa/searchlib/index/postinglistfile.h>
 #include <vespa/searchlib/bitcompression/compression.h>
 #include <vespa/searchlib/queryeval/iterators.h>
@@ -106,7 +107,12 @@ class ZcPostingIteratorBase : public ZcIteratorBase
 protected:
     const uint8_t *_valI;     // docid deltas
     const uint8_t *_valIBase; // start of docid deltas
+    const uint8_t *_valIEnd;  // end of docid deltas
     uint64_t _featureSeekPos;
+    // Decoded document ids for current block when using block docids
+    std::vector<uint32_t> _docIdBlock;
+    const uint32_t *_docIdBlockI;
+    bool _blockDocIds;
 
     // Helper class for L1 skip info
     class L1Skip
@@ -242,10 +248,19 @@ protected:
     uint32_t _chunkNo;
 
     void nextDocId(uint32_t prevDocId) {
+        if (_blockDocIds) {
+            nextDocIdBlock(prevDocId);
+            return;
+        }
         uint32_t docId = prevDocId + 1;
         ZCDECODE(_valI, docId +=);
         setDocId(docId);
     }
+    void nextDocIdBlock(uint32_t prevDocId) {
+        ZcDocIdBlock::decode(_valI, _valIEnd, prevDocId, &_docIdBlock[0]);
+        _docIdBlockI = &_docIdBlock[0];
+        setDocId(*_docIdBlockI);
+    }
     virtual void featureSeek(uint64_t offset) = 0;
     VESPA_DLL_LOCAL void doChunkSkipSeek(uint32_t docId);
     VESPA_DLL_LOCAL void doL4SkipSeek(uint32_t docId);
@@ -254,7 +269,8 @@ protected:
     VESPA_DLL_LOCAL void doL1SkipSeek(uint32_t docId);
     void doSeek(uint32_t docId) override;
 public:
-    ZcPostingIteratorBase(const fef::TermFieldMatchDataArray &matchData, Position start, uint32_t docIdLimit);
+    ZcPostingIteratorBase(const fef::TermFieldMatchDataArray &matchData, Position start, uint32_t docIdLimit,
+                          bool blockDocIds);
 };
 
 template <bool bigEndian>
@@ -280,7 +296,7 @@ public:
     // Counts used for assertions
     const PostingListCounts &_counts;
 
-    ZcPostingIterator(uint32_t minChunkDocs, bool dynamicK, const PostingListCounts &counts,
+    ZcPostingIterator(uint32_t minChunkDocs, bool dynamicK, bool blockDocIds, const PostingListCounts &counts,
                       const search::fef::TermFieldMatchDataArray &matchData, Position start, uint32_t docIdLimit);
 
 
@@ -0,0 +1,68 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "chunk_read_cache.h"
+#include "chunk.h"
+
+namespace search {
+
+ChunkReadCache::Entry::Entry(uint64_t nameId, uint32_t chunkId, size_t bytes, std::unique_ptr<Chunk> chunk)
+    : _nameId(nameId),
+      _chunkId(chunkId),
+      _bytes(bytes),
+      _chunk(std::move(chunk))
+{ }
+
+ChunkReadCache::Entry::Entry(Entry &&) noexcept = default;
+ChunkReadCache::Entry & ChunkReadCache::Entry::operator = (Entry &&) noexcept = default;
+ChunkReadCache::Entry::~Entry() = default;
+
+ChunkReadCache::ChunkReadCache()
+    : ChunkReadCache(DEFAULT_MAX_BYTES)
+{ }
+
+ChunkReadCache::ChunkReadCache(size_t maxBytes)
+    : _entries(),
+      _bytes(0),
+      _maxBytes(maxBytes),
+      _hits(0),
+      _misses(0),
+      _scratch()
+{ }
+
+ChunkReadCache::~ChunkReadCache() = default;
+
+const Chunk *
+ChunkReadCache::find(uint64_t nameId, uint32_t chunkId)
+{
+    for (const Entry & entry : _entries) {
+        if ((entry._nameId == nameId) && (entry._chunkId == chunkId)) {
+            _hits++;
+            return entry._chunk.get();
+        }
+    }
+    _misses++;
+    return nullptr;
+}
+
+const Chunk &
+ChunkReadCache::insert(uint64_t nameId, uint32_t chunkId, std::unique_ptr<Chunk> chunk)
+{
+    size_t bytes = chunk->getMemoryUsage().allocatedBytes();
+    size_t numEvict = 0;
+    while ((numEvict < _entries.size()) && (_bytes + bytes > _maxBytes)) {
+        _bytes -= _entries[numEvict++]._bytes;
+    }
+    _entries.erase(_entries.begin(), _entries.begin() + numEvict);
+    _bytes += bytes;
+    _entries.emplace_back(nameId, chunkId, bytes, std::move(chunk));
+    return *_entries.back()._chunk;
+}
+
+vespalib::DataBuffer &
+ChunkReadCache::getScratchBuffer()
+{
+    _scratch.clear();
+    return _scratch;
+}
+
+}
@@ -0,0 +1,65 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/data/databuffer.h>
+#include <memory>
+#include <vector>
+
+namespace search {
+
+class Chunk;
+
+/**
+ * Per reader cache of decompressed chunks, used when reading many
+ * lids for a single request (e.g. a docsum request). Lids found in a
+ * chunk that is already decompressed are served directly from the
+ * chunk without another disk read, decompression or copy.
+ *
+ * Data returned from a read using this cache is only valid until the
+ * next read using the same cache. Not thread safe.
+ **/
+class ChunkReadCache
+{
+public:
+    static constexpr size_t DEFAULT_MAX_BYTES = 0x400000;
+
+    ChunkReadCache();
+    explicit ChunkReadCache(size_t maxBytes);
+    ChunkReadCache(const ChunkReadCache &) = delete;
+    ChunkReadCache & operator = (const ChunkReadCache &) = delete;
+    ~ChunkReadCache();
+
+    const Chunk * find(uint64_t nameId, uint32_t chunkId);
+    const Chunk & insert(uint64_t nameId, uint32_t chunkId, std::unique_ptr<Chunk> chunk);
+
+    /**
+     * Cleared buffer used for data that is not read from a cached chunk.
+     **/
+    vespalib::DataBuffer & getScratchBuffer();
+
+    size_t getNumChunks() const { return _entries.size(); }
+    size_t getBytes() const { return _bytes; }
+    size_t getHits() const { return _hits; }
+    size_t getMisses() const { return _misses; }
+private:
+    struct Entry {
+        uint64_t               _nameId;
+        uint32_t               _chunkId;
+        size_t                 _bytes;
+        std::unique_ptr<Chunk> _chunk;
+        Entry(uint64_t nameId, uint32_t chunkId, size_t bytes, std::unique_ptr<Chunk> chunk);
+        Entry(Entry &&) noexcept;
+        Entry & operator = (Entry &&) noexcept;
+        ~Entry();
+    };
+
+    std::vector<Entry>   _entries; // Oldest first
+    size_t               _bytes;
+    size_t               _maxBytes;
+    size_t               _hits;
+    size_t               _misses;
+    vespalib::DataBuffer _scratch;
+};
+
+}
@@ -1,12 +1,14 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "cachestats.h"
+#include "chunk_read_cache.h"
 #include "documentstore.h"
 #include "visitcache.h"
 #include "ibucketizer.h"
 #include "value.h"
 #include <vespa/document/fieldvalue/document.h>
 #include <vespa/vespalib/stllike/cache.hpp>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/vespalib/data/databuffer.h>
 #include <vespa/vespalib/util/compressor.h>
 
@@ -42,6 +44,34 @@ DocumentVisitorAdapter::visit(uint32_t lid, vespalib::ConstBufferRef buf) {
     }
 }
 
+/**
+ * Deserializes visited documents into their positions in the result of a batched read.
+ */
+class DocumentCollector : public IBufferVisitor
+{
+public:
+    using LidPositions = vespalib::hash_map<uint32_t, size_t>;
+    DocumentCollector(const DocumentTypeRepo & repo, const LidPositions & positions,
+                      std::vector<IDocumentStore::DocumentUP> & docs)
+        : _repo(repo),
+          _positions(positions),
+          _docs(docs)
+    { }
+    void visit(uint32_t lid, vespalib::ConstBufferRef buf) override;
+private:
+    const DocumentTypeRepo                  & _repo;
+    const LidPositions                      & _positions;
+    std::vector<IDocumentStore::DocumentUP> & _docs;
+};
+
+void
+DocumentCollector::visit(uint32_t lid, vespalib::ConstBufferRef buf) {
+    if (buf.size() > 0) {
+        vespalib::nbostream is(buf.c_str(), buf.size());
+        _docs[_positions.find(lid)->second] = std::make_unique<document::Document>(_repo, is);
+    }
+}
+
 document::Document::UP
 deserializeDocument(const vespalib::DataBuffer & uncompressed, const DocumentTypeRepo &repo) {
     vespalib::nbostream is(uncompressed.getData(), uncompressed.getDataLen());
@@ -62,6 +92,7 @@ public:
     { }
 
     bool read(DocumentIdT key, Value &value) const;
+    bool read(DocumentIdT key, Value &value, ChunkReadCache &chunkCache) const;
     void visit(const IDocumentStore::LidVector &lids, const DocumentTypeRepo &repo, IDocumentVisitor &visitor) const;
     void write(DocumentIdT, const Value &);
     void erase(DocumentIdT) {}
@@ -91,6 +122,18 @@ BackingStore::read(DocumentIdT key, Value &value) const {
     return found;
 }
 
+bool
+BackingStore::read(DocumentIdT key, Value &value, ChunkReadCache &chunkCache) const {
+    vespalib::ConstBufferRef blob = _backingStore.read(key, chunkCache);
+    if (blob.size() == 0) {
+        return false;
+    }
+    vespalib::DataBuffer buf(blob.size());
+    buf.writeBytes(blob.c_str(), blob.size());
+    value.set(std::move(buf), blob.size(), _compression);
+    return true;
+}
+
 void
 BackingStore::write(DocumentIdT lid, const Value & value)
 {
@@ -200,6 +243,70 @@ DocumentStore::read(DocumentIdT lid, const DocumentTypeRepo &repo) const
     return std::unique_ptr<document::Document>();
 }
 
+std::unique_ptr<document::Document>
+DocumentStore::readFromCache(DocumentIdT lid, const DocumentTypeRepo &repo, ChunkReadCache &chunkCache) const
+{
+    Value value = _cache->read(lid, chunkCache);
+    if (value.empty()) {
+        return std::unique_ptr<document::Document>();
+    }
+    Value::Result result = value.decompressed();
+    if ( ! result.second ) {
+        return read(lid, repo); // Invalidates the corrupt entry and reads directly from backing store
+    }
+    return deserializeDocument(result.first, repo);
+}
+
+std::unique_ptr<document::Document>
+DocumentStore::read(DocumentIdT lid, const DocumentTypeRepo &repo, ChunkReadCache &cache) const
+{
+    if (useCache()) {
+        // Documents are kept compressed in the cache and must be decompressed anyway.
+        return readFromCache(lid, repo, cache);
+    }
+    _uncached_lookups.fetch_add(1);
+    vespalib::ConstBufferRef buf = _backingStore.read(lid, cache);
+    if (buf.size() > 0) {
+        vespalib::nbostream_longlivedbuf is(buf.c_str(), buf.size());
+        return std::make_unique<document::Document>(repo, is);
+    }
+    return std::unique_ptr<document::Document>();
+}
+
+std::vector<DocumentStore::DocumentUP>
+DocumentStore::read(const LidVector & lids, const DocumentTypeRepo &repo) const
+{
+    std::vector<DocumentUP> docs;
+    if (useCache()) {
+        // Cache misses are populated one by one, sharing chunks decompressed by earlier misses.
+        ChunkReadCache chunkCache;
+        docs.reserve(lids.size());
+        for (DocumentIdT lid : lids) {
+            docs.push_back(readFromCache(lid, repo, chunkCache));
+        }
+        return docs;
+    }
+    _uncached_lookups.fetch_add(lids.size());
+    docs.resize(lids.size());
+    DocumentCollector::LidPositions positions(lids.size() * 2);
+    LidVector uniqueLids;
+    uniqueLids.reserve(lids.size());
+    for (size_t i(0); i < lids.size(); i++) {
+        if (positions.insert(std::make_pair(lids[i], i)).second) {
+            uniqueLids.push_back(lids[i]);
+        }
+    }
+    DocumentCollector collector(repo, positions, docs);
+    _backingStore.read(uniqueLids, collector);
+    for (size_t i(0); i < lids.size(); i++) {
+        size_t first = positions[lids[i]];
+        if ((first != i) && docs[first]) {
+            docs[i] = std::make_unique<document::Document>(*docs[first]);
+        }
+    }
+    return docs;
+}
+
 void
 DocumentStore::write(uint64_t syncToken, DocumentIdT lid, const document::Document& doc) {
     nbostream stream(12345);
@@ -66,6 +66,8 @@ public:
     ~DocumentStore() override;
 
     DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const override;
+    DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo, ChunkReadCache &cache) const override;
+    std::vector<DocumentUP> read(const LidVector & lids, const document::DocumentTypeRepo &repo) const override;
     void visit(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const override;
     void write(uint64_t synkToken, DocumentIdT lid, const document::Document& doc) override;
     void write(uint64_t synkToken, DocumentIdT lid, const vespalib::nbostream & os) override;
@@ -104,6 +106,7 @@ public:
 
 private:
     bool useCache() const;
+    DocumentUP readFromCache(DocumentIdT lid, const document::DocumentTypeRepo &repo, ChunkReadCache &chunkCache) const;
 
     template <class> class WrapVisitor;
     class WrapVisitorProgress;
@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "filechunk.h"
+#include "chunk_read_cache.h"
 #include "data_store_file_chunk_stats.h"
 #include "summaryexceptions.h"
 #include "randreaders.h"
@@ -28,6 +29,7 @@ namespace {
 
 constexpr size_t ALIGNMENT=0x1000;
 constexpr size_t ENTRY_BIAS_SIZE=8;
+constexpr size_t MAX_OUTSTANDING_READS=32;
 const vespalib::string DOC_ID_LIMIT_KEY("docIdLimit");
 
 }
@@ -251,9 +253,12 @@ FileChunk::updateLidMap(const LockGuard &guard, ISetLid &ds, uint64_t serialNum,
 }
 
 void
-FileChunk::enableRead()
+FileChunk::enableRead(vespalib::Executor * asyncReadExecutor)
 {
-    if (_tune._randRead.getWantDirectIO()) {
+    if (_tune._randRead.getWantAsync() && (asyncReadExecutor != nullptr)) {
+        LOG(debug, "enableRead(): AsyncRandRead: file='%s'", _dataFileName.c_str());
+        _file.reset(new AsyncRandRead(_dataFileName, *asyncReadExecutor));
+    } else if (_tune._randRead.getWantDirectIO()) {
         LOG(debug, "enableRead(): DirectIORandRead: file='%s'", _dataFileName.c_str());
         _file.reset(new DirectIORandRead(_dataFileName));
     } else if (_tune._randRead.getWantMemoryMap()) {
@@ -364,19 +369,46 @@ void
 FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const
 {
     if (count == 0) { return; }
+    std::vector<std::pair<size_t, size_t>> groups; // Start and count of lids in each chunk
     uint32_t prevChunk = begin->getChunkId();
-    uint32_t start(0);
+    size_t start(0);
     for (size_t i(0); i < count; i++) {
         const LidInfoWithLid & li = *(begin + i);
         if (li.getChunkId() != prevChunk) {
-            ChunkInfo ci = _chunkInfo[prevChunk];
-            read(begin + start, i - start, ci, visitor);
+            groups.emplace_back(start, i - start);
             prevChunk = li.getChunkId();
             start = i;
         }
     }
-    ChunkInfo ci = _chunkInfo[prevChunk];
-    read(begin + start, count - start, ci, visitor);
+    groups.emplace_back(start, count - start);
+    if ((groups.size() == 1) || !_tune._randRead.getWantAsync()) {
+        for (const auto & group : groups) {
+            LidInfoWithLidV::const_iterator first = begin + group.first;
+            read(first, group.second, _chunkInfo[first->getChunkId()], visitor);
+        }
+        return;
+    }
+    // Keep a window of chunk reads in flight and visit them in order as they complete.
+    for (size_t windowStart(0); windowStart < groups.size(); windowStart += MAX_OUTSTANDING_READS) {
+        size_t windowEnd = std::min(groups.size(), windowStart + MAX_OUTSTANDING_READS);
+        std::vector<vespalib::DataBuffer> buffers;
+        std::vector<std::future<FileRandRead::FSP>> pending;
+        buffers.reserve(windowEnd - windowStart);
+        pending.reserve(windowEnd - windowStart);
+        for (size_t i(windowStart); i < windowEnd; i++) {
+            const ChunkInfo & ci = _chunkInfo[(begin + groups[i].first)->getChunkId()];
+            buffers.emplace_back(0ul, ALIGNMENT);
+            pending.push_back(_file->readAsync(ci.getOffset(), buffers.back(), ci.getSize()));
+        }
+        // All reads must have completed before the buffers can go away, also on failure.
+        for (auto & future : pending) {
+            future.wait();
+        }
+        for (size_t i(windowStart); i < windowEnd; i++) {
+            FileRandRead::FSP keepAlive = pending[i - windowStart].get();
+            visit(begin + groups[i].first, groups[i].second, buffers[i - windowStart], visitor);
+        }
+    }
 }
 
 void
@@ -384,6 +416,13 @@ FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo c
 {
     vespalib::DataBuffer whole(0ul, ALIGNMENT);
     FileRandRead::FSP keepAlive = _file->read(ci.getOffset(), whole, ci.getSize());
+    visit(begin, count, whole, visitor);
+}
+
+void
+FileChunk::visit(LidInfoWithLidV::const_iterator begin, size_t count, const vespalib::DataBuffer & whole,
+                 IBufferVisitor & visitor) const
+{
     Chunk chunk(begin->getChunkId(), whole.getData(), whole.getDataLen(), _skipCrcOnRead);
     for (size_t i(0); i < count; i++) {
         const LidInfoWithLid & li = *(begin + i);
@@ -413,6 +452,28 @@ FileChunk::read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo,
     return chunk.read(lid, buffer);
 }
 
+vespalib::ConstBufferRef
+FileChunk::read(uint32_t lid, SubChunkId chunkId, ChunkReadCache & cache) const
+{
+    return (chunkId < _chunkInfo.size())
+        ? read(lid, chunkId, _chunkInfo[chunkId], cache)
+        : vespalib::ConstBufferRef();
+}
+
+vespalib::ConstBufferRef
+FileChunk::read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo, ChunkReadCache & cache) const
+{
+    // Chunks on disk are immutable and name ids are never reused, so cached chunks never get stale.
+    const Chunk * cached = cache.find(_nameId.getId(), chunkId);
+    if (cached == nullptr) {
+        vespalib::DataBuffer whole(0ul, ALIGNMENT);
+        FileRandRead::FSP keepAlive(_file->read(chunkInfo.getOffset(), whole, chunkInfo.getSize()));
+        cached = &cache.insert(_nameId.getId(), chunkId,
+                               std::make_unique<Chunk>(chunkId, whole.getData(), whole.getDataLen(), _skipCrcOnRead));
+    }
+    return cached->getLid(lid);
+}
+
 uint64_t
 FileChunk::readDataHeader(FileRandRead &datFile)
 {
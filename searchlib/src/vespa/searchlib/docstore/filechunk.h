@@ -18,12 +18,14 @@ class FastOS_FileInterface;
 
 namespace vespalib {
     class DataBuffer;
+    class Executor;
     class GenericHeader;
     class ThreadExecutor;
 }
 
 namespace search {
 
+class ChunkReadCache;
 class DataStoreFileChunkStats;
 
 class IWriteData
@@ -113,6 +115,7 @@ public:
     virtual size_t updateLidMap(const LockGuard &guard, ISetLid &lidMap, uint64_t serialNum, uint32_t docIdLimit);
     virtual ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const;
     virtual void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const;
+    virtual vespalib::ConstBufferRef read(uint32_t lid, SubChunkId chunk, ChunkReadCache & cache) const;
     void remove(uint32_t lid, uint32_t size);
     virtual size_t getDiskFootprint() const { return _diskFootprint; }
     virtual size_t getMemoryFootprint() const;
@@ -168,9 +171,10 @@ public:
     /**
      * Must be called after chunk has been created to allow correct
      * underlying file object to be created.  Must be called before
-     * any read.
+     * any read.  An executor must be given for async reads to be used
+     * when wanted by the tuning, otherwise normal reads are used.
      */
-    void enableRead();
+    void enableRead(vespalib::Executor * asyncReadExecutor = nullptr);
     // This should never be done to something that is used. Backing
     // Files are removed and everythings dies.
     void erase();
@@ -235,6 +239,9 @@ protected:
     void setNumUniqueBuckets(size_t numUniqueBuckets) { _numUniqueBuckets = numUniqueBuckets; }
     ssize_t read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo, vespalib::DataBuffer & buffer) const;
     void read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo ci, IBufferVisitor & visitor) const;
+    void visit(LidInfoWithLidV::const_iterator begin, size_t count, const vespalib::DataBuffer & whole,
+               IBufferVisitor & visitor) const;
+    vespalib::ConstBufferRef read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo, ChunkReadCache & cache) const;
     static uint32_t readDocIdLimit(vespalib::GenericHeader &header);
     static void writeDocIdLimit(vespalib::GenericHeader &header, uint32_t docIdLimit);
 
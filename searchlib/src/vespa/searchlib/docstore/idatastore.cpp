@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "idatastore.h"
+#include "chunk_read_cache.h"
 
 namespace search {
 
@@ -14,4 +15,14 @@ IDataStore::~IDataStore()
 {
 }
 
+vespalib::ConstBufferRef
+IDataStore::read(uint32_t lid, ChunkReadCache & cache) const
+{
+    vespalib::DataBuffer & buffer = cache.getScratchBuffer();
+    ssize_t len = read(lid, buffer);
+    return (len > 0)
+        ? vespalib::ConstBufferRef(buffer.getData(), len)
+        : vespalib::ConstBufferRef();
+}
+
 } // namespace search
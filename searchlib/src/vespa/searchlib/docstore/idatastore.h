@@ -7,11 +7,13 @@
 #include <vespa/searchlib/common/i_compactable_lid_space.h>
 #include <vespa/searchlib/util/memoryusage.h>
 #include <vespa/vespalib/stllike/string.h>
+#include <vespa/vespalib/util/buffer.h>
 #include <vector>
 
 namespace vespalib { class DataBuffer; }
 namespace search {
 
+class ChunkReadCache;
 class IBufferVisitor;
 
 class IDataStoreVisitor
@@ -62,6 +64,16 @@ public:
     virtual ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const = 0;
     virtual void read(const LidVector & lids, IBufferVisitor & visitor) const = 0;
 
+    /**
+     * Read data from the data store without copying it when possible.
+     * Chunks decompressed during the read are kept in the cache and reused
+     * by later reads of lids in the same chunk.
+     * @param lid The local ID associated with the data.
+     * @param cache The chunk cache of the reader.
+     * @return The data, empty if not found. Only valid until the next read using the same cache.
+     **/
+    virtual vespalib::ConstBufferRef read(uint32_t lid, ChunkReadCache & cache) const;
+
     /**
      * Write data to the data store.
      * @param serialNum The official unique reference number for this operation.
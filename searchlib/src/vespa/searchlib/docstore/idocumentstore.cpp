@@ -9,6 +9,21 @@ IDocumentStore::IDocumentStore() = default;
 
 IDocumentStore::~IDocumentStore() = default;
 
+IDocumentStore::DocumentUP
+IDocumentStore::read(DocumentIdT lid, const document::DocumentTypeRepo &repo, ChunkReadCache &) const {
+    return read(lid, repo);
+}
+
+std::vector<IDocumentStore::DocumentUP>
+IDocumentStore::read(const LidVector & lids, const document::DocumentTypeRepo &repo) const {
+    std::vector<DocumentUP> docs;
+    docs.reserve(lids.size());
+    for (uint32_t lid : lids) {
+        docs.push_back(read(lid, repo));
+    }
+    return docs;
+}
+
 void IDocumentStore::visit(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const {
     for (uint32_t lid : lids) {
         visitor.visit(lid, read(lid, repo));
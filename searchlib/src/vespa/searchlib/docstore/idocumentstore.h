@@ -16,6 +16,7 @@ namespace vespalib { class nbostream; }
 
 namespace search {
 
+class ChunkReadCache;
 struct CacheStats;
 
 class IDocumentStoreReadVisitor
@@ -85,6 +86,25 @@ public:
      * @return NULL if there is no document associated with the lid.
      **/
     virtual DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const = 0;
+
+    /**
+     * Make a Document from a stored serialized data blob, reading through
+     * the given chunk cache. Field values are deserialized lazily from the
+     * blob without copying it, so the document must not be used after the
+     * next read using the same cache.
+     * @param lid The local ID associated with the document.
+     * @param cache The chunk cache of the reader.
+     * @return NULL if there is no document associated with the lid.
+     **/
+    virtual DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo, ChunkReadCache &cache) const;
+
+    /**
+     * Make Documents for multiple lids. Lids are grouped by chunk, so
+     * each chunk is read and decompressed once instead of once per lid.
+     * @param lids The local IDs of the documents.
+     * @return One entry per lid in the same order, NULL where there is no document.
+     **/
+    virtual std::vector<DocumentUP> read(const LidVector & lids, const document::DocumentTypeRepo &repo) const;
     virtual void visit(const LidVector & lidVector, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const;
 
     /**
@@ -9,6 +9,7 @@
 #include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/searchlib/common/rcuvector.hpp>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/threadstackexecutor.h>
 #include <thread>
 
 #include <vespa/log/log.h>
@@ -29,6 +30,13 @@ using docstore::StoreByBucket;
 using docstore::BucketCompacter;
 using namespace std::literals;
 
+namespace {
+
+constexpr uint32_t ASYNC_READ_THREADS = 8;
+constexpr uint32_t ASYNC_READ_STACK_SIZE = 128 * 1024;
+
+}
+
 LogDataStore::Config::Config()
     : _maxFileSize(1000000000ul),
       _maxDiskBloatFactor(0.2),
@@ -59,6 +67,9 @@ LogDataStore::LogDataStore(vespalib::ThreadExecutor &executor, const vespalib::s
       _tune(tune),
       _fileHeaderContext(fileHeaderContext),
       _genHandler(),
+      _asyncReadExecutor(tune._randRead.getWantAsync()
+                         ? std::make_unique<vespalib::ThreadStackExecutor>(ASYNC_READ_THREADS, ASYNC_READ_STACK_SIZE)
+                         : std::unique_ptr<vespalib::ThreadStackExecutor>()),
       _lidInfo(growStrategy.getDocsInitialCapacity(),
                growStrategy.getDocsGrowPercent(),
                growStrategy.getDocsGrowDelta()),
@@ -171,6 +182,23 @@ LogDataStore::read(uint32_t lid, vespalib::DataBuffer& buffer) const
     return sz;
 }
 
+vespalib::ConstBufferRef
+LogDataStore::read(uint32_t lid, ChunkReadCache & cache) const
+{
+    if (lid < getDocIdLimit()) {
+        LidInfo li(0);
+        {
+            GenerationHandler::Guard guard(_genHandler.takeGuard());
+            li = _lidInfo[lid];
+        }
+        if (!li.empty() && li.valid()) {
+            const FileChunk & fc(*_fileChunks[li.getFileId()]);
+            return fc.read(lid, li.getChunkId(), cache);
+        }
+    }
+    return vespalib::ConstBufferRef();
+}
+
 
 void
 LogDataStore::write(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len)
@@ -630,7 +658,7 @@ FileChunk::UP
 LogDataStore::createReadOnlyFile(FileId fileId, NameId nameId) {
     FileChunk::UP file(new FileChunk(fileId, nameId, getBaseDir(), _tune,
                                      _bucketizer.get(), _config.crcOnReadDisabled()));
-    file->enableRead();
+    file->enableRead(_asyncReadExecutor.get());
     return file;
 }
 
@@ -649,7 +677,7 @@ LogDataStore::createWritableFile(FileId fileId, SerialNum serialNum, NameId name
                                               serialNum, docIdLimit,
                                               _config.getFileConfig(), _tune, _fileHeaderContext,
                                               _bucketizer.get(), _config.crcOnReadDisabled()));
-    file->enableRead();
+    file->enableRead(_asyncReadExecutor.get());
     return file;
 }
 
@@ -13,6 +13,8 @@
 
 #include <set>
 
+namespace vespalib { class ThreadStackExecutor; }
+
 namespace search {
 
 namespace common { class FileHeaderContext; }
@@ -93,6 +95,7 @@ public:
     // Implements IDataStore API
     ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const override;
     void read(const LidVector & lids, IBufferVisitor & visitor) const override;
+    vespalib::ConstBufferRef read(uint32_t lid, ChunkReadCache & cache) const override;
     void write(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len) override;
     void remove(uint64_t serialNum, uint32_t lid) override;
     void flush(uint64_t syncToken) override;
@@ -271,6 +274,7 @@ private:
     TuneFileSummary                          _tune;
     const search::common::FileHeaderContext &_fileHeaderContext;
     mutable vespalib::GenerationHandler      _genHandler;
+    std::unique_ptr<vespalib::ThreadStackExecutor> _asyncReadExecutor;
     LidInfoVector                            _lidInfo;
     FileChunkVector                          _fileChunks;
     std::vector<uint32_t>                    _holdFileChunks;
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 
 class FastOS_FileInterface;
@@ -18,6 +19,11 @@ public:
     typedef std::shared_ptr<FastOS_FileInterface> FSP;
     virtual ~FileRandRead() { }
     virtual FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) = 0;
+    /**
+     * Start reading sz bytes at offset into buffer. The buffer must be kept alive
+     * until the returned future is ready. Default implementation reads synchronously.
+     */
+    virtual std::future<FSP> readAsync(size_t offset, vespalib::DataBuffer & buffer, size_t sz);
     virtual int64_t getSize() = 0;
 };
 
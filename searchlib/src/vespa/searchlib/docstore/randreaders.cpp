@@ -3,6 +3,8 @@
 #include "randreaders.h"
 #include "summaryexceptions.h"
 #include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/util/executor.h>
+#include <vespa/vespalib/util/lambdatask.h>
 #include <vespa/fastos/file.h>
 
 #include <vespa/log/log.h>
@@ -10,6 +12,18 @@ LOG_SETUP(".search.docstore.randreaders");
 
 namespace search {
 
+std::future<FileRandRead::FSP>
+FileRandRead::readAsync(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
+{
+    std::promise<FSP> promise;
+    try {
+        promise.set_value(read(offset, buffer, sz));
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+    return promise.get_future();
+}
+
 DirectIORandRead::DirectIORandRead(const vespalib::string & fileName)
     : _file(std::make_unique<FastOS_File>(fileName.c_str())),
       _alignment(1),
@@ -167,4 +181,48 @@ NormalRandRead::getSize()
     return _file->GetSize();
 }
 
+AsyncRandRead::AsyncRandRead(const vespalib::string & fileName, vespalib::Executor & executor)
+    : _file(std::make_unique<FastOS_File>(fileName.c_str())),
+      _executor(executor)
+{
+    if ( ! _file->OpenReadOnly()) {
+        throw SummaryException("Failed opening data file", *_file, VESPA_STRLOC);
+    }
+}
+
+FileRandRead::FSP
+AsyncRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
+{
+    buffer.clear();
+    buffer.ensureFree(sz);
+    _file->ReadBuf(buffer.getFree(), sz, offset);
+    buffer.moveFreeToData(sz);
+    return FSP();
+}
+
+std::future<FileRandRead::FSP>
+AsyncRandRead::readAsync(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
+{
+    std::promise<FSP> promise;
+    std::future<FSP> future = promise.get_future();
+    auto task = vespalib::makeLambdaTask([this, offset, &buffer, sz, promise = std::move(promise)]() mutable {
+        try {
+            promise.set_value(read(offset, buffer, sz));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    });
+    vespalib::Executor::Task::UP rejected = _executor.execute(std::move(task));
+    if (rejected) {
+        rejected->run();
+    }
+    return future;
+}
+
+int64_t
+AsyncRandRead::getSize()
+{
+    return _file->GetSize();
+}
+
 }
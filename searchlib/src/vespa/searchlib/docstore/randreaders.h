@@ -8,6 +8,8 @@
 
 class FastOS_FileInterface;
 
+namespace vespalib { class Executor; }
+
 namespace search {
 
 class DirectIORandRead : public FileRandRead
@@ -60,4 +62,21 @@ private:
     std::unique_ptr<FastOS_FileInterface>  _file;
 };
 
+/**
+ * Uses positional reads like NormalRandRead, but async reads are handed to an
+ * executor so that a batch of chunk reads can be in flight against the disk at
+ * the same time. Tasks rejected by the executor are run in the calling thread.
+ */
+class AsyncRandRead : public FileRandRead
+{
+public:
+    AsyncRandRead(const vespalib::string & fileName, vespalib::Executor & executor);
+    FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    std::future<FSP> readAsync(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    int64_t getSize() override;
+private:
+    std::unique_ptr<FastOS_FileInterface>  _file;
+    vespalib::Executor                    &_executor;
+};
+
 }
@@ -3,6 +3,7 @@
 #include "writeablefilechunk.h"
 #include "data_store_file_chunk_stats.h"
 #include "summaryexceptions.h"
+#include "chunk_read_cache.h"
 #include <vespa/vespalib/util/closuretask.h>
 #include <vespa/vespalib/util/array.hpp>
 #include <vespa/vespalib/data/fileheader.h>
@@ -265,6 +266,34 @@ WriteableFileChunk::read(uint32_t lid, SubChunkId chunkId, vespalib::DataBuffer
     return FileChunk::read(lid, chunkId, chunkInfo, buffer);
 }
 
+vespalib::ConstBufferRef
+WriteableFileChunk::read(uint32_t lid, SubChunkId chunkId, ChunkReadCache & cache) const
+{
+    ChunkInfo chunkInfo;
+    if (!frozen()) {
+        LockGuard guard(_lock);
+        if ((chunkId >= _chunkInfo.size()) || !_chunkInfo[chunkId].valid()) {
+            // Chunks still in memory may change, so they are copied instead of cached.
+            vespalib::DataBuffer & buffer = cache.getScratchBuffer();
+            ChunkMap::const_iterator found = _chunkMap.find(chunkId);
+            ssize_t len(0);
+            if (found != _chunkMap.end()) {
+                len = found->second->read(lid, buffer);
+            } else {
+                assert(chunkId == _active->getId());
+                len = _active->read(lid, buffer);
+            }
+            return (len > 0)
+                ? vespalib::ConstBufferRef(buffer.getData(), len)
+                : vespalib::ConstBufferRef();
+        }
+        chunkInfo = _chunkInfo[chunkId];
+    } else {
+        chunkInfo = _chunkInfo[chunkId];
+    }
+    return FileChunk::read(lid, chunkId, chunkInfo, cache);
+}
+
 void
 WriteableFileChunk::internalFlush(uint32_t chunkId, uint64_t serialNum)
 {
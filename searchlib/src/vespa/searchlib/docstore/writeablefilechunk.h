@@ -51,6 +51,7 @@ public:
 
     ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const override;
     void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const override;
+    vespalib::ConstBufferRef read(uint32_t lid, SubChunkId chunk, ChunkReadCache & cache) const override;
 
     LidInfo append(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len);
     void flush(bool block, uint64_t syncToken);
@@ -247,6 +247,36 @@ NumSearchPartitions::lookup(const Properties &props, uint32_t defaultValue)
     return lookupUint32(props, NAME, defaultValue);
 }
 
+const vespalib::string WorkStealing::NAME("vespa.matching.workstealing");
+const bool WorkStealing::DEFAULT_VALUE(false);
+
+bool
+WorkStealing::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+bool
+WorkStealing::lookup(const Properties &props, bool defaultValue)
+{
+    return lookupBool(props, NAME, defaultValue);
+}
+
+const vespalib::string FirstHitsOnly::NAME("vespa.matching.firsthitsonly");
+const bool FirstHitsOnly::DEFAULT_VALUE(false);
+
+bool
+FirstHitsOnly::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+bool
+FirstHitsOnly::lookup(const Properties &props, bool defaultValue)
+{
+    return lookupBool(props, NAME, defaultValue);
+}
+
 const vespalib::string MinHitsPerThread::NAME("vespa.matching.minhitsperthread");
 const uint32_t MinHitsPerThread::DEFAULT_VALUE(0);
 
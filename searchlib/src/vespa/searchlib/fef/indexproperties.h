@@ -175,6 +175,30 @@ namespace matching {
         static uint32_t lookup(const Properties &props);
         static uint32_t lookup(const Properties &props, uint32_t defaultValue);
     };
+    /**
+     * Property for whether the search threads should use work
+     * stealing to distribute partitions of the docid space between
+     * themselves.
+     **/
+    struct WorkStealing {
+        static const vespalib::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool lookup(const Properties &props);
+        static bool lookup(const Properties &props, bool defaultValue);
+    };
+    /**
+     * Property for whether matching should stop as soon as
+     * offset+hits documents have been found, scanning the docid space
+     * in increasing order. Only used for queries without sorting or
+     * grouping, and ranking is skipped for those queries. The default
+     * value is false.
+     **/
+    struct FirstHitsOnly {
+        static const vespalib::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool lookup(const Properties &props);
+        static bool lookup(const Properties &props, bool defaultValue);
+    };
 }
 
 namespace softtimeout {
@@ -37,6 +37,8 @@ RankSetup::RankSetup(const BlueprintFactory &factory, const IIndexEnvironment &i
       _numThreads(0),
       _minHitsPerThread(0),
       _numSearchPartitions(0),
+      _workStealing(false),
+      _firstHitsOnly(false),
       _heapSize(0),
       _arraySize(0),
       _estimatePoint(0),
@@ -80,6 +82,8 @@ RankSetup::configure()
     setNumThreadsPerSearch(matching::NumThreadsPerSearch::lookup(_indexEnv.getProperties()));
     setMinHitsPerThread(matching::MinHitsPerThread::lookup(_indexEnv.getProperties()));
     setNumSearchPartitions(matching::NumSearchPartitions::lookup(_indexEnv.getProperties()));
+    setWorkStealing(matching::WorkStealing::lookup(_indexEnv.getProperties()));
+    setFirstHitsOnly(matching::FirstHitsOnly::lookup(_indexEnv.getProperties()));
     setHeapSize(hitcollector::HeapSize::lookup(_indexEnv.getProperties()));
     setArraySize(hitcollector::ArraySize::lookup(_indexEnv.getProperties()));
     setDegradationAttribute(matchphase::DegradationAttribute::lookup(_indexEnv.getProperties()));
@@ -35,6 +35,8 @@ private:
     uint32_t                 _numThreads;
     uint32_t                 _minHitsPerThread;
     uint32_t                 _numSearchPartitions;
+    bool                     _workStealing;
+    bool                     _firstHitsOnly;
     uint32_t                 _heapSize;
     uint32_t                 _arraySize;
     uint32_t                 _estimatePoint;
@@ -157,6 +159,14 @@ public:
 
     uint32_t getNumSearchPartitions() const { return _numSearchPartitions; }
 
+    void setWorkStealing(bool workStealing) { _workStealing = workStealing; }
+
+    bool getWorkStealing() const { return _workStealing; }
+
+    void setFirstHitsOnly(bool firstHitsOnly) { _firstHitsOnly = firstHitsOnly; }
+
+    bool getFirstHitsOnly() const { return _firstHitsOnly; }
+
     /**
      * Sets the heap size to be used in the hit collector.
      *
@@ -8,11 +8,13 @@
 #include <vespa/document/annotation/alternatespanlist.h>
 #include <vespa/document/datatype/urldatatype.h>
 #include <vespa/document/repo/fixedtyperepo.h>
+#include <vespa/searchlib/common/gatecallback.h>
 #include <vespa/searchlib/common/isequencedtaskexecutor.h>
 #include <vespa/searchlib/common/sort.h>
 #include <vespa/searchlib/util/url.h>
 #include <vespa/vespalib/text/lowercase.h>
 #include <vespa/vespalib/text/utf8.h>
+#include <vespa/vespalib/util/gate.h>
 #include <stdexcept>
 
 #include <vespa/log/log.h>
@@ -39,6 +41,28 @@ using index::DocIdAndPosOccFeatures;
 using index::Schema;
 using search::util::URL;
 
+namespace {
+
+/**
+ * Resets a field inverter when all word shards of the field have been pushed.
+ */
+class ShardsPushedContext : public IDestructorCallback
+{
+    FieldInverter &_inverter;
+    std::shared_ptr<IDestructorCallback> _onWriteDone;
+    std::shared_ptr<IDestructorCallback> _pushDone;
+public:
+    ShardsPushedContext(FieldInverter &inverter, std::shared_ptr<IDestructorCallback> onWriteDone,
+                        std::shared_ptr<IDestructorCallback> pushDone)
+        : _inverter(inverter),
+          _onWriteDone(std::move(onWriteDone)),
+          _pushDone(std::move(pushDone))
+    { }
+    ~ShardsPushedContext() override { _inverter.reset(); }
+};
+
+}
+
 DocumentInverter::DocumentInverter(const Schema &schema,
                                    ISequencedTaskExecutor &invertThreads,
                                    ISequencedTaskExecutor &pushThreads)
@@ -49,7 +73,8 @@ DocumentInverter::DocumentInverter(const Schema &schema,
       _inverters(),
       _urlInverters(),
       _invertThreads(invertThreads),
-      _pushThreads(pushThreads)
+      _pushThreads(pushThreads),
+      _pushDone()
 {
     _schemaIndexFields.setup(schema);
 
@@ -77,6 +102,7 @@ DocumentInverter::~DocumentInverter()
 {
     _invertThreads.sync();
     _pushThreads.sync();
+    waitForPushDone();
 }
 
 void
@@ -174,22 +200,70 @@ void
 DocumentInverter::pushDocuments(FieldIndexCollection &fieldIndexes,
                                 const std::shared_ptr<IDestructorCallback> &onWriteDone)
 {
-    auto indexFieldIterator = fieldIndexes.getFieldIndexes().begin();
+    waitForPushDone();
+    _pushDone = std::make_unique<vespalib::Gate>();
+    auto pushDone = std::make_shared<GateCallback>(*_pushDone);
+    if (fieldIndexes.getNumWordShards() > 1) {
+        pushShardedDocuments(fieldIndexes, onWriteDone, pushDone);
+        return;
+    }
     uint32_t fieldId = 0;
     for (auto &inverter : _inverters) {
-        FieldIndex &fieldIndex(**indexFieldIterator);
+        FieldIndex &fieldIndex(*fieldIndexes.getFieldIndex(fieldId));
         FieldIndexRemover &remover(fieldIndex.getDocumentRemover());
         OrderedFieldIndexInserter &inserter(fieldIndex.getInserter());
         _pushThreads.execute(fieldId,
                              [inverter(inverter.get()), &remover, &inserter,
-                              &fieldIndex, onWriteDone]()
+                              &fieldIndex, onWriteDone, pushDone]()
                              { inverter->applyRemoves(remover);
                                  inverter->pushDocuments(inserter);
                                  fieldIndex.commit(); });
-        ++indexFieldIterator;
         ++fieldId;
     }
 }
 
+void
+DocumentInverter::pushShardedDocuments(FieldIndexCollection &fieldIndexes,
+                                       const std::shared_ptr<IDestructorCallback> &onWriteDone,
+                                       const std::shared_ptr<IDestructorCallback> &pushDone)
+{
+    using ExecutorId = ISequencedTaskExecutor::ExecutorId;
+    uint32_t numWordShards = fieldIndexes.getNumWordShards();
+    uint32_t numFields = _inverters.size();
+    for (uint32_t fieldId = 0; fieldId < numFields; ++fieldId) {
+        FieldInverter &inverter(*_inverters[fieldId]);
+        std::vector<FieldIndexRemover *> removers;
+        std::vector<std::pair<ExecutorId, FieldIndex *>> shards;
+        for (uint32_t shard = 0; shard < numWordShards; ++shard) {
+            FieldIndex *fieldIndex = fieldIndexes.getFieldIndex(fieldId, shard);
+            removers.push_back(&fieldIndex->getDocumentRemover());
+            shards.emplace_back(_pushThreads.getExecutorId(fieldId * numWordShards + shard), fieldIndex);
+        }
+        auto shardsPushed = std::make_shared<ShardsPushedContext>(inverter, onWriteDone, pushDone);
+        // Removes must be applied to, and positions sorted by, the field inverter
+        // before the word shards of the field can be pushed in parallel.
+        _pushThreads.execute(shards.front().first,
+                             [&pushThreads = _pushThreads, &inverter, removers(std::move(removers)),
+                              shards(std::move(shards)), shardsPushed]()
+                             {
+                                 inverter.prepareShardedPush(removers);
+                                 for (uint32_t shard = 0; shard < shards.size(); ++shard) {
+                                     FieldIndex &fieldIndex(*shards[shard].second);
+                                     pushThreads.execute(shards[shard].first,
+                                                         [&inverter, &fieldIndex, shard, shardsPushed]()
+                                                         { inverter.pushShard(fieldIndex.getInserter(), shard);
+                                                             fieldIndex.commit(); });
+                                 }
+                             });
+    }
+}
+
+void
+DocumentInverter::waitForPushDone()
+{
+    if (_pushDone) {
+        _pushDone->await();
+    }
 }
 
+}
@@ -18,6 +18,8 @@ namespace search {
     class IDestructorCallback;
 }
 
+namespace vespalib { class Gate; }
+
 namespace search::memoryindex {
 
 class FieldInverter;
@@ -52,9 +54,14 @@ private:
     std::vector<std::unique_ptr<UrlFieldInverter>> _urlInverters;
     ISequencedTaskExecutor &_invertThreads;
     ISequencedTaskExecutor &_pushThreads;
+    std::unique_ptr<vespalib::Gate> _pushDone;
 
     const index::Schema &getSchema() const { return _schema; }
 
+    void pushShardedDocuments(FieldIndexCollection &fieldIndexes,
+                              const std::shared_ptr<IDestructorCallback> &onWriteDone,
+                              const std::shared_ptr<IDestructorCallback> &pushDone);
+
 public:
     /**
      * Create a new document inverter based on the given schema.
@@ -79,11 +86,22 @@ public:
      * All tasks hold a reference to the 'onWriteDone' callback, so when the last task is completed,
      * the callback is destructed.
      *
+     * When the field indexes are split into word shards, there is one task per word shard,
+     * allowing a single field to be pushed by multiple threads. A task per field first applies
+     * the pending removes and sorts the inverted documents, then adds the word shard tasks for
+     * that field. Syncing the 'push threads' executor does not wait for these follow-up tasks,
+     * use waitForPushDone() before the inverter is used again.
+     *
      * NOTE: The caller of this function should sync the 'invert threads' executor first,
      * to ensure that inverting is completed before pushing starts.
      */
     void pushDocuments(FieldIndexCollection &fieldIndexes, const std::shared_ptr<IDestructorCallback> &onWriteDone);
 
+    /**
+     * Wait until all tasks added by the last call to pushDocuments() are completed.
+     */
+    void waitForPushDone();
+
     /**
      * Invert (add) the given document.
      *
@@ -148,73 +148,89 @@ FieldIndex::compactFeatures()
 void
 FieldIndex::dump(search::index::IndexBuilder & indexBuilder)
 {
-    vespalib::stringref word;
+    dumpShards({this}, indexBuilder);
+}
+
+void
+FieldIndex::dumpShards(const std::vector<FieldIndex *> &shards, search::index::IndexBuilder & indexBuilder)
+{
     FeatureStore::DecodeContextCooked decoder(nullptr);
     DocIdAndFeatures features;
-    vespalib::Array<uint32_t> wordMap(_numUniqueWords + 1, 0);
-    _featureStore.setupForField(_fieldId, decoder);
-    for (auto itr = _dict.begin(); itr.valid(); ++itr) {
-        const WordKey & wk = itr.getKey();
-        PostingListStore::RefType plist(EntryRef(itr.getData()));
-        word = _wordStore.getWord(wk._wordRef);
-        if (!plist.valid()) {
-            continue;
-        }
-        indexBuilder.startWord(word);
-        uint32_t clusterSize = _postingListStore.getClusterSize(plist);
-        if (clusterSize == 0) {
-            const PostingList *tree = _postingListStore.getTreeEntry(plist);
-            auto pitr = tree->begin(_postingListStore.getAllocator());
-            assert(pitr.valid());
-            for (; pitr.valid(); ++pitr) {
-                uint32_t docId = pitr.getKey();
-                EntryRef featureRef(pitr.getData());
-                indexBuilder.startDocument(docId);
-                _featureStore.setupForReadFeatures(featureRef, decoder);
-                decoder.readFeatures(features);
-                size_t poff = 0;
-                uint32_t wpIdx = 0u;
-                size_t numElements = features._elements.size();
-                for (size_t i = 0; i < numElements; ++i) {
-                    const WordDocElementFeatures & fef = features._elements[i];
-                    indexBuilder.startElement(fef.getElementId(), fef.getWeight(), fef.getElementLen());
-                    for (size_t j = 0; j < fef.getNumOccs(); ++j, ++wpIdx) {
-                        assert(wpIdx == poff + j);
-                        indexBuilder.addOcc(features._wordPositions[poff + j]);
-                    }
-                    poff += fef.getNumOccs();
-                    indexBuilder.endElement();
-                }
-                indexBuilder.endDocument();
-            }
-        } else {
-            const PostingListKeyDataType *kd =
-                _postingListStore.getKeyDataEntry(plist, clusterSize);
-            const PostingListKeyDataType *kde = kd + clusterSize;
-            for (; kd != kde; ++kd) {
-                uint32_t docId = kd->_key;
-                EntryRef featureRef(kd->getData());
-                indexBuilder.startDocument(docId);
-                _featureStore.setupForReadFeatures(featureRef, decoder);
-                decoder.readFeatures(features);
-                size_t poff = 0;
-                uint32_t wpIdx = 0u;
-                size_t numElements = features._elements.size();
-                for (size_t i = 0; i < numElements; ++i) {
-                    const WordDocElementFeatures & fef = features._elements[i];
-                    indexBuilder.startElement(fef.getElementId(), fef.getWeight(), fef.getElementLen());
-                    for (size_t j = 0; j < fef.getNumOccs(); ++j, ++wpIdx) {
-                        assert(wpIdx == poff + j);
-                        indexBuilder.addOcc(features._wordPositions[poff + j]);
-                    }
-                    poff += fef.getNumOccs();
-                    indexBuilder.endElement();
+    // All word shards of a field use the same feature parameters.
+    shards.front()->_featureStore.setupForField(shards.front()->_fieldId, decoder);
+    std::vector<DictionaryTree::Iterator> itrs;
+    for (FieldIndex *shard : shards) {
+        itrs.push_back(shard->_dict.begin());
+    }
+    for (;;) {
+        // Words are unique across shards, pick the shard with the lowest next word.
+        size_t bestShard = shards.size();
+        const char *bestWord = nullptr;
+        for (size_t i = 0; i < itrs.size(); ++i) {
+            if (itrs[i].valid()) {
+                const char *word = shards[i]->_wordStore.getWord(itrs[i].getKey()._wordRef);
+                if (bestWord == nullptr || strcmp(word, bestWord) < 0) {
+                    bestShard = i;
+                    bestWord = word;
                 }
-                indexBuilder.endDocument();
             }
         }
-        indexBuilder.endWord();
+        if (bestShard == shards.size()) {
+            break;
+        }
+        PostingListStore::RefType plist(EntryRef(itrs[bestShard].getData()));
+        if (plist.valid()) {
+            shards[bestShard]->dumpWord(bestWord, plist, decoder, features, indexBuilder);
+        }
+        ++itrs[bestShard];
+    }
+}
+
+void
+FieldIndex::dumpWord(vespalib::stringref word, EntryRef plist, FeatureStore::DecodeContextCooked &decoder,
+                     DocIdAndFeatures &features, search::index::IndexBuilder & indexBuilder)
+{
+    indexBuilder.startWord(word);
+    uint32_t clusterSize = _postingListStore.getClusterSize(plist);
+    if (clusterSize == 0) {
+        const PostingList *tree = _postingListStore.getTreeEntry(plist);
+        auto pitr = tree->begin(_postingListStore.getAllocator());
+        assert(pitr.valid());
+        for (; pitr.valid(); ++pitr) {
+            dumpDocument(pitr.getKey(), EntryRef(pitr.getData()), decoder, features, indexBuilder);
+        }
+    } else {
+        const PostingListKeyDataType *kd =
+            _postingListStore.getKeyDataEntry(plist, clusterSize);
+        const PostingListKeyDataType *kde = kd + clusterSize;
+        for (; kd != kde; ++kd) {
+            dumpDocument(kd->_key, EntryRef(kd->getData()), decoder, features, indexBuilder);
+        }
+    }
+    indexBuilder.endWord();
+}
+
+void
+FieldIndex::dumpDocument(uint32_t docId, EntryRef featureRef, FeatureStore::DecodeContextCooked &decoder,
+                         DocIdAndFeatures &features, search::index::IndexBuilder & indexBuilder)
+{
+    indexBuilder.startDocument(docId);
+    _featureStore.setupForReadFeatures(featureRef, decoder);
+    decoder.readFeatures(features);
+    size_t poff = 0;
+    uint32_t wpIdx = 0u;
+    size_t numElements = features._elements.size();
+    for (size_t i = 0; i < numElements; ++i) {
+        const WordDocElementFeatures & fef = features._elements[i];
+        indexBuilder.startElement(fef.getElementId(), fef.getWeight(), fef.getElementLen());
+        for (size_t j = 0; j < fef.getNumOccs(); ++j, ++wpIdx) {
+            assert(wpIdx == poff + j);
+            indexBuilder.addOcc(features._wordPositions[poff + j]);
+        }
+        poff += fef.getNumOccs();
+        indexBuilder.endElement();
     }
+    indexBuilder.endDocument();
 }
 
 MemoryUsage
@@ -140,6 +140,11 @@ private:
         _generationHandler.incGeneration();
     }
 
+    void dumpWord(vespalib::stringref word, datastore::EntryRef plist, FeatureStore::DecodeContextCooked &decoder,
+                  index::DocIdAndFeatures &features, search::index::IndexBuilder & indexBuilder);
+    void dumpDocument(uint32_t docId, datastore::EntryRef featureRef, FeatureStore::DecodeContextCooked &decoder,
+                      index::DocIdAndFeatures &features, search::index::IndexBuilder & indexBuilder);
+
 public:
     GenerationHandler::Guard takeGenerationGuard() {
         return _generationHandler.takeGuard();
@@ -150,6 +155,12 @@ public:
 
     void dump(search::index::IndexBuilder & indexBuilder);
 
+    /**
+     * Dump the given word shards of a field as a single field, merging the
+     * dictionaries of the shards in word order. A word is only present in one shard.
+     */
+    static void dumpShards(const std::vector<FieldIndex *> &shards, search::index::IndexBuilder & indexBuilder);
+
     MemoryUsage getMemoryUsage() const;
     DictionaryTree &getDictionaryTree() { return _dict; }
     PostingListStore &getPostingListStore() { return _postingListStore; }
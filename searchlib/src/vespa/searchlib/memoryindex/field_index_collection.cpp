@@ -26,13 +26,16 @@ using index::Schema;
 
 namespace memoryindex {
 
-FieldIndexCollection::FieldIndexCollection(const Schema & schema)
+FieldIndexCollection::FieldIndexCollection(const Schema & schema, uint32_t numWordShards)
     : _fieldIndexes(),
-      _numFields(schema.getNumIndexFields())
+      _numFields(schema.getNumIndexFields()),
+      _numWordShards(std::max(numWordShards, 1u))
 {
     for (uint32_t fieldId = 0; fieldId < _numFields; ++fieldId) {
-        auto fieldIndex = std::make_unique<FieldIndex>(schema, fieldId);
-        _fieldIndexes.push_back(std::move(fieldIndex));
+        for (uint32_t shard = 0; shard < _numWordShards; ++shard) {
+            auto fieldIndex = std::make_unique<FieldIndex>(schema, fieldId);
+            _fieldIndexes.push_back(std::move(fieldIndex));
+        }
     }
 }
 
@@ -45,7 +48,15 @@ FieldIndexCollection::dump(search::index::IndexBuilder &indexBuilder)
 {
     for (uint32_t fieldId = 0; fieldId < _numFields; ++fieldId) {
         indexBuilder.startField(fieldId);
-        _fieldIndexes[fieldId]->dump(indexBuilder);
+        if (_numWordShards == 1) {
+            getFieldIndex(fieldId)->dump(indexBuilder);
+        } else {
+            std::vector<FieldIndex *> shards;
+            for (uint32_t shard = 0; shard < _numWordShards; ++shard) {
+                shards.push_back(getFieldIndex(fieldId, shard));
+            }
+            FieldIndex::dumpShards(shards, indexBuilder);
+        }
         indexBuilder.endField();
     }
 }
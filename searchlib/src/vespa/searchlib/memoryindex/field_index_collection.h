@@ -3,6 +3,7 @@
 #pragma once
 
 #include "field_index.h"
+#include "word_shard.h"
 
 namespace search::memoryindex {
 
@@ -14,6 +15,10 @@ class FieldInverter;
  *
  * Provides functions to create a posting list iterator (used for searching)
  * for a given word in a given field.
+ *
+ * Each field can be split into multiple word shards, where each shard is a
+ * separate FieldIndex containing the words with a given hash (see getWordShard()).
+ * This allows pushing changes for a single field using multiple threads.
  */
 class FieldIndexCollection {
 public:
@@ -22,19 +27,21 @@ public:
 private:
     using GenerationHandler = vespalib::GenerationHandler;
 
+    // Word shards for the same field are stored consecutively.
     std::vector<std::unique_ptr<FieldIndex>> _fieldIndexes;
     uint32_t                _numFields;
+    uint32_t                _numWordShards;
 
 public:
-    FieldIndexCollection(const index::Schema &schema);
+    FieldIndexCollection(const index::Schema &schema, uint32_t numWordShards = 1);
     ~FieldIndexCollection();
     PostingList::Iterator find(const vespalib::stringref word,
                                uint32_t fieldId) const {
-        return _fieldIndexes[fieldId]->find(word);
+        return getFieldIndexForWord(fieldId, word)->find(word);
     }
 
     PostingList::ConstIterator findFrozen(const vespalib::stringref word, uint32_t fieldId) const {
-        return _fieldIndexes[fieldId]->findFrozen(word);
+        return getFieldIndexForWord(fieldId, word)->findFrozen(word);
     }
 
     uint64_t getNumUniqueWords() const {
@@ -49,13 +56,25 @@ public:
 
     MemoryUsage getMemoryUsage() const;
 
-    FieldIndex *getFieldIndex(uint32_t fieldId) const {
-        return _fieldIndexes[fieldId].get();
+    /**
+     * Returns the field index for the given word shard of the given field.
+     * When fields are not sharded, this is the field index for the entire field.
+     */
+    FieldIndex *getFieldIndex(uint32_t fieldId, uint32_t shard = 0) const {
+        return _fieldIndexes[fieldId * _numWordShards + shard].get();
+    }
+
+    FieldIndex *getFieldIndexForWord(uint32_t fieldId, const vespalib::stringref word) const {
+        if (_numWordShards == 1) {
+            return getFieldIndex(fieldId);
+        }
+        return getFieldIndex(fieldId, getWordShard(word, _numWordShards));
     }
 
     const std::vector<std::unique_ptr<FieldIndex>> &getFieldIndexes() const { return _fieldIndexes; }
 
     uint32_t getNumFields() const { return _numFields; }
+    uint32_t getNumWordShards() const { return _numWordShards; }
 };
 
 }
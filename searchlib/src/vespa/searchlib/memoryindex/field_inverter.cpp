@@ -2,6 +2,7 @@
 
 #include "field_inverter.h"
 #include "ordered_field_index_inserter.h"
+#include "word_shard.h"
 #include <vespa/document/annotation/alternatespanlist.h>
 #include <vespa/document/annotation/annotation.h>
 #include <vespa/document/annotation/span.h>
@@ -17,6 +18,7 @@
 #include <vespa/searchlib/common/sort.h>
 #include <vespa/searchlib/util/url.h>
 #include <vespa/vespalib/text/lowercase.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/vespalib/text/utf8.h>
 #include <vespa/vespalib/util/stringfmt.h>
 #include <stdexcept>
@@ -166,6 +168,7 @@ FieldInverter::reset()
     _elems.clear();
     _positions.clear();
     _wordRefs.resize(1);
+    _wordShards.clear();
     _pendingDocs.clear();
     _abortedDocs.clear();
     _removeDocs.clear();
@@ -183,7 +186,8 @@ FieldInverter::sortWords()
 
     // Make a dictionary for words.
     { // Use radix sort based on first four bytes of word, before finalizing with std::sort.
-        vespalib::Array<uint64_t> firstFourBytes(_wordRefs.size());
+        vespalib::Array<uint64_t> &firstFourBytes = _sortKeys;
+        firstFourBytes.resize(_wordRefs.size());
         for (size_t i(1); i < _wordRefs.size(); i++) {
             uint64_t firstFour = ntohl(*reinterpret_cast<const uint32_t *>(getWordFromRef(_wordRefs[i])));
             firstFourBytes[i] = (firstFour << 32) | _wordRefs[i];
@@ -330,6 +334,8 @@ FieldInverter::FieldInverter(const Schema &schema, uint32_t fieldId)
       _features(),
       _elementWordRefs(),
       _wordRefs(1),
+      _wordShards(),
+      _sortKeys(),
       _terms(),
       _abortedDocs(),
       _pendingDocs(),
@@ -467,14 +473,13 @@ FieldInverter::applyRemoves(FieldIndexRemover &remover)
     _removeDocs.clear();
 }
 
-void
-FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
+bool
+FieldInverter::sortPositions()
 {
     trimAbortedDocs();
 
     if (_positions.empty()) {
-        reset();
-        return;             // All documents with words aborted
+        return false;       // All documents with words aborted
     }
 
     sortWords();
@@ -482,7 +487,50 @@ FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
     // Sort for terms.
     ShiftBasedRadixSorter<PosInfo, FullRadix, std::less<PosInfo>, 56, true>::
         radix_sort(FullRadix(), std::less<PosInfo>(), &_positions[0], _positions.size(), 16);
+    return true;
+}
+
+void
+FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
+{
+    if (sortPositions()) {
+        pushPositions(inserter, _features, 0u);
+    }
+    reset();
+}
+
+bool
+FieldInverter::prepareShardedPush(const std::vector<FieldIndexRemover *> &removers)
+{
+    for (auto docId : _removeDocs) {
+        for (FieldIndexRemover *remover : removers) {
+            remover->remove(docId, *this);
+        }
+    }
+    _removeDocs.clear();
+    if (!sortPositions()) {
+        reset();
+        return false;
+    }
+    uint32_t numWordShards = removers.size();
+    _wordShards.resize(_wordRefs.size());
+    for (uint32_t wordNum = 1; wordNum < _wordRefs.size(); ++wordNum) {
+        _wordShards[wordNum] = getWordShard(getWordFromNum(wordNum), numWordShards);
+    }
+    return true;
+}
+
+void
+FieldInverter::pushShard(IOrderedFieldIndexInserter &inserter, uint32_t shard) const
+{
+    index::DocIdAndPosOccFeatures features;
+    pushPositions(inserter, features, shard);
+}
 
+void
+FieldInverter::pushPositions(IOrderedFieldIndexInserter &inserter, index::DocIdAndPosOccFeatures &features,
+                             uint32_t shard) const
+{
     constexpr uint32_t NO_ELEMENT_ID = std::numeric_limits<uint32_t>::max();
     constexpr uint32_t NO_WORD_POS = std::numeric_limits<uint32_t>::max();
     uint32_t lastWordNum = 0;
@@ -492,6 +540,7 @@ FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
     uint32_t lastDocId = 0;
     vespalib::stringref word;
     bool emptyFeatures = true;
+    bool skipWord = false;
 
     inserter.rewind();
 
@@ -500,24 +549,33 @@ FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
         (void) numWordIds;
         if (lastWordNum != i._wordNum || lastDocId != i._docId) {
             if (!emptyFeatures) {
-                inserter.add(lastDocId, _features);
+                inserter.add(lastDocId, features);
                 emptyFeatures = true;
             }
             if (lastWordNum != i._wordNum) {
                 lastWordNum = i._wordNum;
-                word = getWordFromNum(lastWordNum);
-                inserter.setNextWord(word);
+                skipWord = !_wordShards.empty() && _wordShards[lastWordNum] != shard;
+                if (!skipWord) {
+                    word = getWordFromNum(lastWordNum);
+                    inserter.setNextWord(word);
+                }
             }
             lastDocId = i._docId;
+            if (skipWord) {
+                continue;
+            }
             if (i.removed()) {
                 inserter.remove(lastDocId);
                 continue;
             }
         }
+        if (skipWord) {
+            continue;
+        }
         if (emptyFeatures) {
             if (!i.removed()) {
                 emptyFeatures = false;
-                _features.clear(lastDocId);
+                features.clear(lastDocId);
                 lastElemId = NO_ELEMENT_ID;
                 lastWordPos = NO_WORD_POS;
             } else {
@@ -529,8 +587,8 @@ FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
         }
         const ElemInfo &elem = _elems[i._elemRef];
         if (i._wordPos != lastWordPos || i._elemId != lastElemId) {
-            _features.addNextOcc(i._elemId, i._wordPos,
-                                 elem._weight, elem._len);
+            features.addNextOcc(i._elemId, i._wordPos,
+                                elem._weight, elem._len);
             lastElemId = i._elemId;
             lastWordPos = i._wordPos;
         } else {
@@ -539,11 +597,12 @@ FieldInverter::pushDocuments(IOrderedFieldIndexInserter &inserter)
     }
 
     if (!emptyFeatures) {
-        inserter.add(lastDocId, _features);
+        inserter.add(lastDocId, features);
     }
     inserter.flush();
-    reset();
 }
 
 }
 
+
+VESPALIB_HASH_MAP_INSTANTIATE(uint32_t, search::memoryindex::FieldInverter::PositionRange);
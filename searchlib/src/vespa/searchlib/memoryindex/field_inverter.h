@@ -9,8 +9,8 @@
 #include <vespa/searchlib/bitcompression/compression.h>
 #include <vespa/searchlib/bitcompression/posocccompression.h>
 #include <vespa/searchlib/index/docidandfeatures.h>
+#include <vespa/vespalib/stllike/hash_map.h>
 #include <limits>
-#include <map>
 #include <set>
 
 namespace search::memoryindex {
@@ -138,6 +138,12 @@ private:
         uint32_t _len;
 
     public:
+        PositionRange()
+            : _start(0u),
+              _len(0u)
+        {
+        }
+
         PositionRange(uint32_t start, uint32_t len)
             : _start(start),
               _len(len)
@@ -170,14 +176,19 @@ private:
     index::DocIdAndPosOccFeatures  _features;
     std::vector<uint32_t>          _elementWordRefs;
     std::vector<uint32_t>          _wordRefs;
+    std::vector<uint32_t>          _wordShards; // word number -> word shard, empty if not sharded
+    vespalib::Array<uint64_t>      _sortKeys;   // radix sort keys used by sortWords(), reused between pushes
 
     using SpanTerm = std::pair<document::Span, const document::FieldValue *>;
     using SpanTermVector = std::vector<SpanTerm>;
     SpanTermVector                      _terms;
 
     // Info about aborted and pending documents.
+    // Pending documents are kept in a hash map to avoid a heap allocation per document.
+    // The vectors keep their capacity across reset(). Clearing the hash map allocates a
+    // new node store with the same table size, thus there is one allocation per push.
     std::vector<PositionRange>      _abortedDocs;
-    std::map<uint32_t, PositionRange> _pendingDocs;
+    vespalib::hash_map<uint32_t, PositionRange> _pendingDocs;
     std::vector<uint32_t>             _removeDocs;
 
     void
@@ -255,14 +266,20 @@ private:
     const index::Schema &getSchema() const { return _schema; }
 
     /**
-     * Clear internal memory structures.
+     * Calculate word numbers and replace word references with word numbers in internal memory structures.
      */
-    void reset();
+    void sortWords();
 
     /**
-     * Calculate word numbers and replace word references with word numbers in internal memory structures.
+     * Trim aborted documents and sort positions on {word, docId}.
+     * Returns false if there are no positions to push.
      */
-    void sortWords();
+    bool sortPositions();
+
+    /**
+     * Push the sorted positions for words in the given word shard (or all words if not sharded) using the given inserter.
+     */
+    void pushPositions(IOrderedFieldIndexInserter &inserter, index::DocIdAndPosOccFeatures &features, uint32_t shard) const;
 
     void moveNotAbortedDocs(uint32_t &dstIdx, uint32_t srcIdx, uint32_t nextTrimIdx);
 
@@ -292,6 +309,28 @@ public:
      */
     void pushDocuments(IOrderedFieldIndexInserter &inserter);
 
+    /**
+     * Apply pending removes using the removers for all word shards of the field,
+     * and prepare for pushing the current batch of inverted documents to the word shards.
+     * Each word is assigned to a word shard based on its hash, see getWordShard().
+     *
+     * Returns false if there is nothing to push.
+     */
+    bool prepareShardedPush(const std::vector<FieldIndexRemover *> &removers);
+
+    /**
+     * Push the inverted documents for words assigned to the given word shard using the given inserter.
+     *
+     * Multiple word shards can be pushed in parallel after prepareShardedPush(),
+     * and reset() must be called when all word shards are pushed.
+     */
+    void pushShard(IOrderedFieldIndexInserter &inserter, uint32_t shard) const;
+
+    /**
+     * Clear internal memory structures.
+     */
+    void reset();
+
     /**
      * Invert a normal text field, based on annotations.
      */
@@ -319,8 +358,8 @@ public:
 
     void endDoc() {
         uint32_t newPosSize = static_cast<uint32_t>(_positions.size());
-        _pendingDocs.insert({ _docId,
-                                 { _oldPosSize, newPosSize - _oldPosSize } });
+        _pendingDocs.insert(std::make_pair(_docId,
+                                           PositionRange(_oldPosSize, newPosSize - _oldPosSize)));
         _docId = 0;
         _oldPosSize = newPosSize;
     }
@@ -55,14 +55,15 @@ namespace search::memoryindex {
 
 MemoryIndex::MemoryIndex(const Schema &schema,
                          ISequencedTaskExecutor &invertThreads,
-                         ISequencedTaskExecutor &pushThreads)
+                         ISequencedTaskExecutor &pushThreads,
+                         uint32_t numWordShards)
     : _schema(schema),
       _invertThreads(invertThreads),
       _pushThreads(pushThreads),
       _inverter0(std::make_unique<DocumentInverter>(_schema, _invertThreads, _pushThreads)),
       _inverter1(std::make_unique<DocumentInverter>(_schema, _invertThreads, _pushThreads)),
       _inverter(_inverter0.get()),
-      _fieldIndexes(std::make_unique<FieldIndexCollection>(_schema)),
+      _fieldIndexes(std::make_unique<FieldIndexCollection>(_schema, numWordShards)),
       _frozen(false),
       _maxDocId(0), // docId 0 is reserved
       _numDocs(0),
@@ -78,6 +79,8 @@ MemoryIndex::~MemoryIndex()
 {
     _invertThreads.sync();
     _pushThreads.sync();
+    _inverter0->waitForPushDone();
+    _inverter1->waitForPushDone();
 }
 
 void
@@ -116,6 +119,7 @@ MemoryIndex::commit(const std::shared_ptr<IDestructorCallback> &onWriteDone)
     _pushThreads.sync(); // drain use of other inverter
     _inverter->pushDocuments(*_fieldIndexes, onWriteDone);
     flipInverter();
+    _inverter->waitForPushDone(); // drain word shard pushes from other inverter
 }
 
 void
@@ -133,6 +137,8 @@ MemoryIndex::freeze()
 void
 MemoryIndex::dump(IndexBuilder &indexBuilder)
 {
+    _inverter0->waitForPushDone();
+    _inverter1->waitForPushDone();
     _fieldIndexes->dump(indexBuilder);
 }
 
@@ -204,7 +210,7 @@ public:
         const vespalib::string termStr = queryeval::termAsString(n);
         LOG(debug, "searching for '%s' in '%s'",
             termStr.c_str(), _field.getName().c_str());
-        FieldIndex *fieldIndex = _fieldIndexes.getFieldIndex(_fieldId);
+        FieldIndex *fieldIndex = _fieldIndexes.getFieldIndexForWord(_fieldId, termStr);
         GenerationHandler::Guard genGuard = fieldIndex->takeGenerationGuard();
         FieldIndex::PostingList::ConstIterator pitr = fieldIndex->findFrozen(termStr);
         bool useBitVector = _field.isFilter();
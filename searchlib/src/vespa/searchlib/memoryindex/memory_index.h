@@ -85,10 +85,13 @@ public:
      * @param invertThreads the executor with threads for doing document inverting.
      * @param pushThreads   the executor with threads for doing pushing of changes (inverted documents)
      *                      to corresponding field indexes.
+     * @param numWordShards the number of word shards each field index is split into,
+     *                      allowing changes to a single field to be pushed by multiple threads.
      */
     MemoryIndex(const index::Schema &schema,
                 ISequencedTaskExecutor &invertThreads,
-                ISequencedTaskExecutor &pushThreads);
+                ISequencedTaskExecutor &pushThreads,
+                uint32_t numWordShards = 1);
 
     ~MemoryIndex();
 
@@ -116,7 +119,8 @@ public:
      *
      * When commit is completed, 'onWriteDone' goes out of scope, scheduling completion callback.
      *
-     * Callers can call pushThreads.sync() to wait for push completion.
+     * Callers can wait for 'onWriteDone' to be destructed to know when push is completed.
+     * Syncing the push threads is not enough when field indexes are split into word shards.
      */
     void commit(const std::shared_ptr<IDestructorCallback> &onWriteDone);
 
@@ -0,0 +1,20 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/vespalib/stllike/hash_fun.h>
+#include <vespa/vespalib/stllike/string.h>
+
+namespace search::memoryindex {
+
+/**
+ * Returns which word shard of a field the given word belongs to when the
+ * field index is split into the given number of word shards.
+ */
+inline uint32_t
+getWordShard(vespalib::stringref word, uint32_t numWordShards)
+{
+    return vespalib::hashValue(word.data(), word.size()) % numWordShards;
+}
+
+}
@@ -102,6 +102,7 @@ public:
         _name[ParseItem::ITEM_PREDICATE_QUERY] = 'P';
         _name[ParseItem::ITEM_REGEXP] = '^';
         _name[ParseItem::ITEM_WORD_ALTERNATIVES] = 'a';
+        _name[ParseItem::ITEM_NEAREST_NEIGHBOR] = 'n';
     }
     char operator[] (ParseItem::ItemType i) const { return _name[i]; }
     char operator[] (size_t i) const { return _name[i]; }
@@ -318,6 +319,21 @@ SimpleQueryStack::StackbufToString(vespalib::stringref theBuf)
                 result.append(make_string("%c/%d:%.*s/%d(", _G_ItemName[type], idxRefLen, idxRefLen, idxRef, arity));
                 break;
             }
+            case ParseItem::ITEM_NEAREST_NEIGHBOR: {
+                idxRefLen = static_cast<uint32_t>(ReadCompressedPositiveInt(p));
+                idxRef = p;
+                p += idxRefLen;
+                termRefLen = static_cast<uint32_t>(ReadCompressedPositiveInt(p));
+                termRef = p;
+                p += termRefLen;
+                uint32_t targetNumHits = ReadCompressedPositiveInt(p);
+                uint32_t allowApproximate = ReadCompressedPositiveInt(p);
+                uint32_t exploreAdditionalHits = ReadCompressedPositiveInt(p);
+                result.append(make_string("%c/%d:%.*s/%d:%.*s(%u,%u,%u)~", _G_ItemName[type],
+                                          idxRefLen, idxRefLen, idxRef, termRefLen, termRefLen, termRef,
+                                          targetNumHits, allowApproximate, exploreAdditionalHits));
+                break;
+            }
         default:
             LOG(error, "Unhandled type %d", type);
             LOG_ABORT("should not be reached");
@@ -24,6 +24,8 @@ SimpleQueryStackDumpIterator::SimpleQueryStackDumpIterator(vespalib::stringref b
     _currArg1(0),
     _currArg2(0),
     _currArg3(0),
+    _extraIntArg2(0),
+    _extraIntArg3(0),
     _predicate_query_term(),
     _currIndexName(nullptr),
     _currIndexNameLen(0),
@@ -285,6 +287,24 @@ SimpleQueryStackDumpIterator::next()
         _currTermLen = 0;
         break;
 
+    case ParseItem::ITEM_NEAREST_NEIGHBOR:
+        try {
+            _currIndexNameLen = readCompressedPositiveInt(p); // field name
+            _currIndexName = p;
+            p += _currIndexNameLen;
+            _currTermLen = readCompressedPositiveInt(p); // query tensor name
+            _currTerm = p;
+            p += _currTermLen;
+            _currArg1 = readCompressedPositiveInt(p); // targetNumHits
+            _extraIntArg2 = readCompressedPositiveInt(p); // allowApproximate
+            _extraIntArg3 = readCompressedPositiveInt(p); // exploreAdditionalHits
+            _currArity = 0;
+            if (p > _bufEnd) return false;
+        } catch (...) {
+            return false;
+        }
+        break;
+
     default:
         // Unknown item, so report that no more are available
         return false;
@@ -48,6 +48,9 @@ private:
     double _currArg2;
     /** The third argument of the current item (threshold boost factor of WAND for example) */
     double _currArg3;
+    /** Extra integer arguments of the current item (allow approximate and explore additional hits of NEAREST_NEIGHBOR) */
+    uint32_t _extraIntArg2;
+    uint32_t _extraIntArg3;
     /** The predicate query specification */
     query::PredicateQueryTerm::UP _predicate_query_term;
     /** Pointer to the position of the index name in the current item */
@@ -143,6 +146,10 @@ public:
 
     double getArg3() const { return _currArg3; }
 
+    uint32_t getExtraIntArg2() const { return _extraIntArg2; }
+
+    uint32_t getExtraIntArg3() const { return _extraIntArg3; }
+
     query::PredicateQueryTerm::UP getPredicateQueryTerm()
     { return std::move(_predicate_query_term); }
 
@@ -202,6 +202,15 @@ createRegExpTerm(vespalib::stringref term, vespalib::stringref view, int32_t id,
     return new typename NodeTypes::RegExpTerm(term, view, id, weight);
 }
 
+template <class NodeTypes>
+typename NodeTypes::NearestNeighborTerm *
+create_nearest_neighbor_term(vespalib::stringref query_tensor_name, vespalib::stringref field_name,
+                             int32_t id, Weight weight, uint32_t target_num_hits,
+                             bool allow_approximate, uint32_t explore_additional_hits) {
+    return new typename NodeTypes::NearestNeighborTerm(query_tensor_name, field_name, id, weight,
+                                                       target_num_hits, allow_approximate, explore_additional_hits);
+}
+
 template <class NodeTypes>
 class QueryBuilder : public QueryBuilderBase {
     template <class T>
@@ -309,6 +318,16 @@ public:
         adjustWeight(weight);
         return addTerm(createRegExpTerm<NodeTypes>(term, view, id, weight));
     }
+    typename NodeTypes::NearestNeighborTerm &add_nearest_neighbor_term(stringref query_tensor_name,
+                                                                       stringref field_name, int32_t id, Weight weight,
+                                                                       uint32_t target_num_hits, bool allow_approximate,
+                                                                       uint32_t explore_additional_hits)
+    {
+        adjustWeight(weight);
+        return addTerm(create_nearest_neighbor_term<NodeTypes>(query_tensor_name, field_name, id, weight,
+                                                               target_num_hits, allow_approximate,
+                                                               explore_additional_hits));
+    }
 };
 
 }
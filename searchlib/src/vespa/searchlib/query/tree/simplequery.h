@@ -103,6 +103,14 @@ struct SimpleRegExpTerm : RegExpTerm {
         : RegExpTerm(term, view, id, weight) {
     }
 };
+struct SimpleNearestNeighborTerm : NearestNeighborTerm {
+    SimpleNearestNeighborTerm(vespalib::stringref query_tensor_name, vespalib::stringref field_name,
+                              int32_t id, Weight weight, uint32_t target_num_hits,
+                              bool allow_approximate, uint32_t explore_additional_hits)
+        : NearestNeighborTerm(query_tensor_name, field_name, id, weight,
+                              target_num_hits, allow_approximate, explore_additional_hits)
+    {}
+};
 
 
 struct SimpleQueryNodeTypes {
@@ -128,6 +136,7 @@ struct SimpleQueryNodeTypes {
     typedef SimpleWandTerm WandTerm;
     typedef SimplePredicateQuery PredicateQuery;
     typedef SimpleRegExpTerm RegExpTerm;
+    typedef SimpleNearestNeighborTerm NearestNeighborTerm;
 };
 
 }
@@ -147,6 +147,12 @@ private:
                 t = &builder.addPredicateQuery(queryStack.getPredicateQueryTerm(), view, id, weight);
             } else if (type == ParseItem::ITEM_REGEXP) {
                 t = &builder.addRegExpTerm(term, view, id, weight);
+            } else if (type == ParseItem::ITEM_NEAREST_NEIGHBOR) {
+                uint32_t target_num_hits = queryStack.getArg1();
+                bool allow_approximate = (queryStack.getExtraIntArg2() != 0);
+                uint32_t explore_additional_hits = queryStack.getExtraIntArg3();
+                t = &builder.add_nearest_neighbor_term(term, view, id, weight, target_num_hits,
+                                                       allow_approximate, explore_additional_hits);
             } else {
                 LOG(error, "Unable to create query tree from stack dump. node type = %d.", type);
             }
@@ -23,4 +23,6 @@ LocationTerm::~LocationTerm() = default;
 
 RegExpTerm::~RegExpTerm() = default;
 
+NearestNeighborTerm::~NearestNeighborTerm() = default;
+
 }
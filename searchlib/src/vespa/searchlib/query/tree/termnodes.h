@@ -113,5 +113,36 @@ public:
     virtual ~RegExpTerm() = 0;
 };
 
+//-----------------------------------------------------------------------------
+
+/**
+ * Term used to find the nearest neighbors of a query tensor in a tensor attribute.
+ * The query tensor itself is passed as a rank property, referenced by name.
+ */
+class NearestNeighborTerm : public QueryNodeMixin<NearestNeighborTerm, TermNode>
+{
+private:
+    vespalib::string _query_tensor_name;
+    uint32_t _target_num_hits;
+    bool _allow_approximate;
+    uint32_t _explore_additional_hits;
+
+public:
+    NearestNeighborTerm(vespalib::stringref query_tensor_name, vespalib::stringref field_name,
+                        int32_t id, Weight weight, uint32_t target_num_hits,
+                        bool allow_approximate, uint32_t explore_additional_hits)
+        : QueryNodeMixinType(field_name, id, weight),
+          _query_tensor_name(query_tensor_name),
+          _target_num_hits(target_num_hits),
+          _allow_approximate(allow_approximate),
+          _explore_additional_hits(explore_additional_hits)
+    {}
+    virtual ~NearestNeighborTerm() = 0;
+    const vespalib::string& get_query_tensor_name() const { return _query_tensor_name; }
+    uint32_t get_target_num_hits() const { return _target_num_hits; }
+    bool get_allow_approximate() const { return _allow_approximate; }
+    uint32_t get_explore_additional_hits() const { return _explore_additional_hits; }
+};
+
 
 }
@@ -67,7 +67,8 @@ Blueprint::State::State(const FieldSpecBaseList &fields_in)
     : _fields(fields_in),
       _estimate(),
       _tree_size(1),
-      _allow_termwise_eval(true)
+      _allow_termwise_eval(true),
+      _cost_tier(COST_TIER_NORMAL)
 {
 }
 
@@ -156,6 +157,7 @@ Blueprint::visitMembers(vespalib::ObjectVisitor &visitor) const
     visitor.visitInt("estHits", state.estimate().estHits);
     visitor.visitInt("tree_size", state.tree_size());
     visitor.visitInt("allow_termwise_eval", state.allow_termwise_eval());
+    visitor.visitInt("cost_tier", state.cost_tier());
     visitor.closeStruct();
     visitor.visitInt("sourceId", _sourceId);
     visitor.visitInt("docid_limit", _docid_limit);
@@ -228,6 +230,16 @@ IntermediateBlueprint::infer_allow_termwise_eval() const
     return true;
 };
 
+uint8_t
+IntermediateBlueprint::calculate_cost_tier() const
+{
+    uint8_t cost_tier = State::COST_TIER_MAX;
+    for (const Blueprint * child : _children) {
+        cost_tier = std::min(cost_tier, child->getState().cost_tier());
+    }
+    return (_children.empty() ? State::COST_TIER_NORMAL : cost_tier);
+}
+
 size_t
 IntermediateBlueprint::count_termwise_nodes(const UnpackInfo &unpack) const
 {
@@ -292,6 +304,7 @@ IntermediateBlueprint::calculateState() const
     state.estimate(calculateEstimate());
     state.allow_termwise_eval(infer_allow_termwise_eval());
     state.tree_size(calculate_tree_size());
+    state.cost_tier(calculate_cost_tier());
     return state;
 }
 
@@ -530,6 +543,13 @@ LeafBlueprint::set_tree_size(uint32_t value)
     notifyChange();    
 }
 
+void
+LeafBlueprint::set_cost_tier(uint8_t value)
+{
+    _state.cost_tier(value);
+    notifyChange();
+}
+
 //-----------------------------------------------------------------------------
 
 }
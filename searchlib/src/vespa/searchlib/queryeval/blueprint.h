@@ -59,8 +59,16 @@ public:
         HitEstimate       _estimate;
         uint32_t          _tree_size;
         bool              _allow_termwise_eval;
+        uint8_t           _cost_tier;
 
     public:
+        // Rough cost of driving a (strict) iterator through the
+        // corpus. Lower tiers are evaluated before higher tiers when
+        // children are ordered, independent of hit estimates.
+        static constexpr uint8_t COST_TIER_NORMAL = 1;
+        static constexpr uint8_t COST_TIER_EXPENSIVE = 2;
+        static constexpr uint8_t COST_TIER_MAX = 255;
+
         State(const FieldSpecBaseList &fields_in);
         ~State();
         void swap(State & rhs) {
@@ -68,6 +76,7 @@ public:
             std::swap(_estimate, rhs._estimate);
             std::swap(_tree_size, rhs._tree_size);
             std::swap(_allow_termwise_eval, rhs._allow_termwise_eval);
+            std::swap(_cost_tier, rhs._cost_tier);
         }
 
         bool isTermLike() const { return !_fields.empty(); }
@@ -95,6 +104,8 @@ public:
         uint32_t tree_size() const { return _tree_size; }
         void allow_termwise_eval(bool value) { _allow_termwise_eval = value; }
         bool allow_termwise_eval() const { return _allow_termwise_eval; }
+        void cost_tier(uint8_t value) { _cost_tier = value; }
+        uint8_t cost_tier() const { return _cost_tier; }
     };
 
     // utility that just takes maximum estimate
@@ -117,6 +128,30 @@ public:
         }
     };
 
+    // utility to sort cheaper cost tiers first, then greater estimate
+    struct TieredGreaterEstimate {
+        bool operator () (Blueprint * const &a, Blueprint * const &b) const {
+            const auto &lhs = a->getState();
+            const auto &rhs = b->getState();
+            if (lhs.cost_tier() != rhs.cost_tier()) {
+                return (lhs.cost_tier() < rhs.cost_tier());
+            }
+            return (rhs.estimate() < lhs.estimate());
+        }
+    };
+
+    // utility to sort cheaper cost tiers first, then lesser estimate
+    struct TieredLessEstimate {
+        bool operator () (Blueprint * const &a, Blueprint * const &b) const {
+            const auto &lhs = a->getState();
+            const auto &rhs = b->getState();
+            if (lhs.cost_tier() != rhs.cost_tier()) {
+                return (lhs.cost_tier() < rhs.cost_tier());
+            }
+            return (lhs.estimate() < rhs.estimate());
+        }
+    };
+
 private:
     Blueprint *_parent;
     uint32_t   _sourceId;
@@ -240,6 +275,9 @@ protected:
 
     virtual bool isPositive(size_t index) const { (void) index; return true; }
 
+    // default: the cheapest child drives the search
+    virtual uint8_t calculate_cost_tier() const;
+
     bool should_do_termwise_eval(const UnpackInfo &unpack, double match_limit) const;
 
 public:
@@ -287,6 +325,7 @@ protected:
     void setEstimate(HitEstimate est);
     void set_allow_termwise_eval(bool value);
     void set_tree_size(uint32_t value);
+    void set_cost_tier(uint8_t value);
 
     LeafBlueprint(const FieldSpecBaseList &fields, bool allow_termwise_eval);
 public:
@@ -58,6 +58,7 @@ public:
     void visit(query::Rank &) override { illegalVisit(); }
     void visit(query::WeakAnd &) override { illegalVisit(); }
     void visit(query::SameElement &) override { illegalVisit(); }
+    void visit(query::NearestNeighborTerm &) override { illegalVisit(); }
 
     void visit(query::Phrase &n) override {
         visitPhrase(n);
@@ -8,8 +8,21 @@ namespace queryeval {
 FakeRequestContext::FakeRequestContext(attribute::IAttributeContext * context, fastos::TimeStamp doom_in) :
     _clock(),
     _doom(_clock, doom_in),
-    _attributeContext(context)
+    _attributeContext(context),
+    _query_tensors()
 { }
 
+FakeRequestContext::~FakeRequestContext() = default;
+
+std::unique_ptr<vespalib::tensor::Tensor>
+FakeRequestContext::get_query_tensor(const vespalib::string &tensor_name) const
+{
+    auto itr = _query_tensors.find(tensor_name);
+    if (itr != _query_tensors.end() && itr->second) {
+        return itr->second->clone();
+    }
+    return std::unique_ptr<vespalib::tensor::Tensor>();
+}
+
 }
 }
@@ -5,7 +5,9 @@
 #include <vespa/searchlib/queryeval/irequestcontext.h>
 #include <vespa/searchcommon/attribute/iattributecontext.h>
 #include <vespa/searchlib/attribute/attributevector.h>
+#include <vespa/eval/tensor/tensor.h>
 #include <limits>
+#include <map>
 
 namespace search {
 namespace queryeval {
@@ -14,6 +16,7 @@ class FakeRequestContext : public IRequestContext
 {
 public:
     FakeRequestContext(attribute::IAttributeContext * context = nullptr, fastos::TimeStamp doom=std::numeric_limits<int64_t>::max());
+    ~FakeRequestContext() override;
     const vespalib::Doom & getSoftDoom() const override { return _doom; }
     const attribute::IAttributeVector *getAttribute(const vespalib::string &name) const override {
         return _attributeContext
@@ -25,10 +28,15 @@ public:
                    ? _attributeContext->getAttribute(name)
                    : nullptr;
     }
+    std::unique_ptr<vespalib::tensor::Tensor> get_query_tensor(const vespalib::string &tensor_name) const override;
+    void set_query_tensor(const vespalib::string &tensor_name, std::unique_ptr<vespalib::tensor::Tensor> tensor) {
+        _query_tensors[tensor_name] = std::move(tensor);
+    }
 private:
     vespalib::Clock _clock;
     const vespalib::Doom _doom;
     attribute::IAttributeContext *_attributeContext;
+    std::map<vespalib::string, std::unique_ptr<vespalib::tensor::Tensor>> _query_tensors;
 };
 
 }
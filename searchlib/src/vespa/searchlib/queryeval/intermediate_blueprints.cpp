@@ -68,6 +68,18 @@ void optimize_source_blenders(IntermediateBlueprint &self, size_t begin_idx) {
     }
 }
 
+uint8_t max_cost_tier(const IntermediateBlueprint &self) {
+    uint8_t cost_tier = Blueprint::State::COST_TIER_NORMAL;
+    for (size_t i = 0; i < self.childCnt(); ++i) {
+        cost_tier = std::max(cost_tier, self.getChild(i).getState().cost_tier());
+    }
+    return cost_tier;
+}
+
+uint8_t first_child_cost_tier(const IntermediateBlueprint &self) {
+    return (self.childCnt() > 0) ? self.getChild(0).getState().cost_tier() : Blueprint::State::COST_TIER_NORMAL;
+}
+
 } // namespace search::queryeval::<unnamed>
 
 //-----------------------------------------------------------------------------
@@ -120,11 +132,17 @@ AndNotBlueprint::get_replacement()
     return Blueprint::UP();
 }
 
+uint8_t
+AndNotBlueprint::calculate_cost_tier() const
+{
+    return first_child_cost_tier(*this);
+}
+
 void
 AndNotBlueprint::sort(std::vector<Blueprint*> &children) const
 {
     if (children.size() > 2) {
-        std::sort(children.begin() + 1, children.end(), GreaterEstimate());
+        std::sort(children.begin() + 1, children.end(), TieredGreaterEstimate());
     }
 }
 
@@ -197,7 +215,7 @@ AndBlueprint::get_replacement()
 void
 AndBlueprint::sort(std::vector<Blueprint*> &children) const
 {
-    std::sort(children.begin(), children.end(), LessEstimate());
+    std::sort(children.begin(), children.end(), TieredLessEstimate());
 }
 
 bool
@@ -271,6 +289,12 @@ OrBlueprint::get_replacement()
     return Blueprint::UP();
 }
 
+uint8_t
+OrBlueprint::calculate_cost_tier() const
+{
+    return max_cost_tier(*this);
+}
+
 void
 OrBlueprint::sort(std::vector<Blueprint*> &children) const
 {
@@ -321,6 +345,12 @@ WeakAndBlueprint::exposeFields() const
     return FieldSpecBaseList();
 }
 
+uint8_t
+WeakAndBlueprint::calculate_cost_tier() const
+{
+    return max_cost_tier(*this);
+}
+
 void
 WeakAndBlueprint::sort(std::vector<Blueprint*> &) const
 {
@@ -468,6 +498,12 @@ RankBlueprint::get_replacement()
     return Blueprint::UP();
 }
 
+uint8_t
+RankBlueprint::calculate_cost_tier() const
+{
+    return first_child_cost_tier(*this);
+}
+
 void
 RankBlueprint::sort(std::vector<Blueprint*> &children) const
 {
@@ -525,6 +561,12 @@ SourceBlenderBlueprint::exposeFields() const
     return mixChildrenFields();
 }
 
+uint8_t
+SourceBlenderBlueprint::calculate_cost_tier() const
+{
+    return max_cost_tier(*this);
+}
+
 void
 SourceBlenderBlueprint::sort(std::vector<Blueprint*> &) const
 {
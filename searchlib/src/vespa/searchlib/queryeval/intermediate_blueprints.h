@@ -19,6 +19,7 @@ public:
     FieldSpecBaseList exposeFields() const override;
     void optimize_self() override;
     Blueprint::UP get_replacement() override;
+    uint8_t calculate_cost_tier() const override;
     void sort(std::vector<Blueprint*> &children) const override;
     bool inheritStrict(size_t i) const override;
     SearchIterator::UP
@@ -55,6 +56,7 @@ public:
     FieldSpecBaseList exposeFields() const override;
     void optimize_self() override;
     Blueprint::UP get_replacement() override;
+    uint8_t calculate_cost_tier() const override;
     void sort(std::vector<Blueprint*> &children) const override;
     bool inheritStrict(size_t i) const override;
     SearchIterator::UP
@@ -73,6 +75,7 @@ private:
 public:
     HitEstimate combine(const std::vector<HitEstimate> &data) const override;
     FieldSpecBaseList exposeFields() const override;
+    uint8_t calculate_cost_tier() const override;
     void sort(std::vector<Blueprint*> &children) const override;
     bool inheritStrict(size_t i) const override;
     SearchIterator::UP
@@ -138,6 +141,7 @@ public:
     FieldSpecBaseList exposeFields() const override;
     void optimize_self() override;
     Blueprint::UP get_replacement() override;
+    uint8_t calculate_cost_tier() const override;
     void sort(std::vector<Blueprint*> &children) const override;
     bool inheritStrict(size_t i) const override;
     SearchIterator::UP
@@ -156,6 +160,7 @@ public:
     SourceBlenderBlueprint(const ISourceSelector &selector);
     HitEstimate combine(const std::vector<HitEstimate> &data) const override;
     FieldSpecBaseList exposeFields() const override;
+    uint8_t calculate_cost_tier() const override;
     void sort(std::vector<Blueprint*> &children) const override;
     bool inheritStrict(size_t i) const override;
     /**
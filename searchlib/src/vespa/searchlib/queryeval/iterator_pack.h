@@ -4,6 +4,7 @@
 
 #include "searchiterator.h"
 #include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <limits>
 
 namespace search::fef { class MatchData; }
 
@@ -43,6 +44,15 @@ public:
         return _childMatch[ref]->getWeight();
     }
 
+    // No block level information, each document is a separate block
+    int32_t get_block_max_weight(uint32_t) const {
+        return std::numeric_limits<int32_t>::max();
+    }
+
+    uint32_t get_block_last_docid(uint32_t ref) const {
+        return get_docid(ref);
+    }
+
     void unpack(uint32_t ref, uint32_t docid) {
         _children[ref]->doUnpack(docid);
     }
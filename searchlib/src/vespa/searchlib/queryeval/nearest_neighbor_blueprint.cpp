@@ -0,0 +1,122 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "nearest_neighbor_blueprint.h"
+#include "nearest_neighbor_iterator.h"
+#include <vespa/eval/tensor/dense/dense_tensor_view.h>
+#include <vespa/searchlib/fef/termfieldmatchdataarray.h>
+#include <vespa/searchlib/tensor/dense_tensor_attribute.h>
+#include <vespa/searchlib/tensor/distance_functions.h>
+#include <vespa/vespalib/objects/visit.h>
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+namespace search::queryeval {
+
+namespace {
+
+struct CompareDocId {
+    bool operator()(const NearestNeighborBlueprint::Neighbor &lhs, const NearestNeighborBlueprint::Neighbor &rhs) const {
+        return lhs.docid < rhs.docid;
+    }
+};
+
+struct CompareDistance {
+    bool operator()(const NearestNeighborBlueprint::Neighbor &lhs, const NearestNeighborBlueprint::Neighbor &rhs) const {
+        return lhs.distance < rhs.distance;
+    }
+};
+
+}
+
+NearestNeighborBlueprint::NearestNeighborBlueprint(const queryeval::FieldSpec &field,
+                                                   const tensor::DenseTensorAttribute &attr_tensor,
+                                                   std::unique_ptr<vespalib::tensor::DenseTensorView> query_tensor,
+                                                   uint32_t target_num_hits, bool approximate, uint32_t explore_additional_hits)
+    : ComplexLeafBlueprint(field),
+      _attr_tensor(attr_tensor),
+      _query_tensor(std::move(query_tensor)),
+      _target_num_hits(target_num_hits),
+      _approximate(approximate && (attr_tensor.nearest_neighbor_index() != nullptr)),
+      _explore_additional_hits(explore_additional_hits),
+      _found_hits()
+{
+    uint32_t est_hits = std::min(_target_num_hits, _attr_tensor.getCommittedDocIdLimit());
+    setEstimate(HitEstimate(est_hits, (est_hits == 0)));
+}
+
+NearestNeighborBlueprint::~NearestNeighborBlueprint() = default;
+
+void
+NearestNeighborBlueprint::perform_approximate_search()
+{
+    const auto &index = *_attr_tensor.nearest_neighbor_index();
+    _found_hits = index.find_top_k(_target_num_hits, _query_tensor->cellsRef(),
+                                   _target_num_hits + _explore_additional_hits);
+}
+
+void
+NearestNeighborBlueprint::perform_exact_search()
+{
+    const auto *index = _attr_tensor.nearest_neighbor_index();
+    tensor::SquaredEuclideanDistance default_distance;
+    const tensor::DistanceFunction &dist_fun = (index != nullptr) ? index->distance_function() : default_distance;
+    auto query_cells = _query_tensor->cellsRef();
+    // Max-heap on distance, keeping the best k hits seen so far.
+    std::priority_queue<Neighbor, std::vector<Neighbor>, CompareDistance> best;
+    uint32_t doc_id_limit = _attr_tensor.getCommittedDocIdLimit();
+    for (uint32_t docid = 1; docid < doc_id_limit; ++docid) {
+        auto cells = _attr_tensor.get_vector(docid);
+        if (cells.size() != query_cells.size()) {
+            continue;
+        }
+        double distance = dist_fun.calc(query_cells, cells);
+        if (best.size() < _target_num_hits) {
+            best.emplace(docid, distance);
+        } else if (!best.empty() && distance < best.top().distance) {
+            best.pop();
+            best.emplace(docid, distance);
+        }
+    }
+    _found_hits.clear();
+    _found_hits.reserve(best.size());
+    while (!best.empty()) {
+        _found_hits.push_back(best.top());
+        best.pop();
+    }
+}
+
+void
+NearestNeighborBlueprint::fetchPostings(bool strict)
+{
+    (void) strict;
+    if (_target_num_hits == 0) {
+        return;
+    }
+    if (_approximate) {
+        perform_approximate_search();
+    } else {
+        perform_exact_search();
+    }
+    std::sort(_found_hits.begin(), _found_hits.end(), CompareDocId());
+}
+
+SearchIterator::UP
+NearestNeighborBlueprint::createLeafSearch(const fef::TermFieldMatchDataArray &tfmda, bool) const
+{
+    assert(tfmda.size() == 1);
+    return std::make_unique<NearestNeighborIterator>(*tfmda[0], _found_hits);
+}
+
+void
+NearestNeighborBlueprint::visitMembers(vespalib::ObjectVisitor &visitor) const
+{
+    ComplexLeafBlueprint::visitMembers(visitor);
+    visit(visitor, "attribute_tensor", _attr_tensor.getTensorType().to_spec());
+    visit(visitor, "target_num_hits", _target_num_hits);
+    visit(visitor, "approximate", _approximate);
+    visit(visitor, "explore_additional_hits", _explore_additional_hits);
+    visit(visitor, "found_hits", static_cast<uint32_t>(_found_hits.size()));
+}
+
+}
@@ -0,0 +1,58 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "blueprint.h"
+#include <vespa/searchlib/tensor/nearest_neighbor_index.h>
+#include <memory>
+#include <vector>
+
+namespace vespalib::tensor { class DenseTensorView; }
+namespace search::tensor { class DenseTensorAttribute; }
+
+namespace search::queryeval {
+
+/**
+ * Blueprint for nearest neighbor search over a dense tensor attribute.
+ *
+ * The k nearest neighbors of the query tensor are calculated in fetchPostings(),
+ * either (approximately) by using the nearest neighbor index of the attribute,
+ * or (exactly) by a brute force scan over all documents.
+ * Other query restrictions are applied after the k hits are found.
+ */
+class NearestNeighborBlueprint : public ComplexLeafBlueprint
+{
+public:
+    using Neighbor = tensor::NearestNeighborIndex::Neighbor;
+
+private:
+    const tensor::DenseTensorAttribute &_attr_tensor;
+    std::unique_ptr<vespalib::tensor::DenseTensorView> _query_tensor;
+    uint32_t _target_num_hits;
+    bool _approximate;
+    uint32_t _explore_additional_hits;
+    std::vector<Neighbor> _found_hits;
+
+    void perform_approximate_search();
+    void perform_exact_search();
+
+public:
+    NearestNeighborBlueprint(const queryeval::FieldSpec &field,
+                             const tensor::DenseTensorAttribute &attr_tensor,
+                             std::unique_ptr<vespalib::tensor::DenseTensorView> query_tensor,
+                             uint32_t target_num_hits, bool approximate, uint32_t explore_additional_hits);
+    NearestNeighborBlueprint(const NearestNeighborBlueprint &) = delete;
+    NearestNeighborBlueprint &operator=(const NearestNeighborBlueprint &) = delete;
+    ~NearestNeighborBlueprint() override;
+
+    const tensor::DenseTensorAttribute &get_attribute_tensor() const { return _attr_tensor; }
+    const vespalib::tensor::DenseTensorView &get_query_tensor() const { return *_query_tensor; }
+    uint32_t get_target_num_hits() const { return _target_num_hits; }
+    bool is_approximate() const { return _approximate; }
+
+    void fetchPostings(bool strict) override;
+    SearchIteratorUP createLeafSearch(const fef::TermFieldMatchDataArray &tfmda, bool strict) const override;
+    void visitMembers(vespalib::ObjectVisitor &visitor) const override;
+};
+
+}
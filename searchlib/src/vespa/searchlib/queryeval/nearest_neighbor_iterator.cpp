@@ -0,0 +1,53 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "nearest_neighbor_iterator.h"
+#include <vespa/searchlib/fef/termfieldmatchdata.h>
+#include <algorithm>
+
+namespace search::queryeval {
+
+NearestNeighborIterator::NearestNeighborIterator(fef::TermFieldMatchData &tfmd, const std::vector<Neighbor> &hits)
+    : _tfmd(tfmd),
+      _hits(hits),
+      _pos(0)
+{
+}
+
+NearestNeighborIterator::~NearestNeighborIterator() = default;
+
+void
+NearestNeighborIterator::updateDocId()
+{
+    if (_pos < _hits.size() && _hits[_pos].docid < getEndId()) {
+        setDocId(_hits[_pos].docid);
+    } else {
+        setAtEnd();
+    }
+}
+
+void
+NearestNeighborIterator::initRange(uint32_t begin, uint32_t end)
+{
+    SearchIterator::initRange(begin, end);
+    auto itr = std::lower_bound(_hits.begin(), _hits.end(), begin,
+                                [](const Neighbor &hit, uint32_t docid) { return hit.docid < docid; });
+    _pos = itr - _hits.begin();
+    updateDocId();
+}
+
+void
+NearestNeighborIterator::doSeek(uint32_t docId)
+{
+    while (_pos < _hits.size() && _hits[_pos].docid < docId) {
+        ++_pos;
+    }
+    updateDocId();
+}
+
+void
+NearestNeighborIterator::doUnpack(uint32_t docId)
+{
+    _tfmd.setRawScore(docId, _hits[_pos].distance);
+}
+
+}
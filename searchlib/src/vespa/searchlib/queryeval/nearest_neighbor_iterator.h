@@ -0,0 +1,40 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "searchiterator.h"
+#include <vespa/searchlib/tensor/nearest_neighbor_index.h>
+#include <vector>
+
+namespace search::fef { class TermFieldMatchData; }
+
+namespace search::queryeval {
+
+/**
+ * Search iterator over a precomputed set of nearest neighbors.
+ *
+ * The hits must be sorted on increasing docid.
+ * The distance of each hit is exposed as raw score when unpacking.
+ */
+class NearestNeighborIterator : public SearchIterator
+{
+public:
+    using Neighbor = tensor::NearestNeighborIndex::Neighbor;
+
+private:
+    fef::TermFieldMatchData     &_tfmd;
+    const std::vector<Neighbor> &_hits;
+    uint32_t                     _pos;
+
+    void updateDocId();
+
+public:
+    NearestNeighborIterator(fef::TermFieldMatchData &tfmd, const std::vector<Neighbor> &hits);
+    ~NearestNeighborIterator() override;
+    void initRange(uint32_t begin, uint32_t end) override;
+    void doSeek(uint32_t docId) override;
+    void doUnpack(uint32_t docId) override;
+    Trinary is_strict() const override { return Trinary::True; }
+};
+
+}
@@ -44,7 +44,9 @@ private:
     void seek_strict(uint32_t docid) {
         _algo.set_candidate(_terms, _heaps, docid);
         while (_algo.solve_wand_constraint(_terms, _heaps, GreaterThan(_boostedThreshold))) {
-            if (_algo.check_score(_terms, _heaps, DotProductScorer(), GreaterThan(_threshold))) {
+            if (!_algo.check_block_max_score(_terms, _heaps, GreaterThan(_threshold))) {
+                _algo.skip_blocks(_terms, _heaps);
+            } else if (_algo.check_score(_terms, _heaps, DotProductScorer(), GreaterThan(_threshold))) {
                 setDocId(_algo.get_candidate());
                 return;
             } else {
@@ -57,7 +59,9 @@ private:
     void seek_unstrict(uint32_t docid) {
         if (docid > _algo.get_candidate()) {
             _algo.set_candidate(_terms, _heaps, docid);
-            if (_algo.check_wand_constraint(_terms, _heaps, GreaterThan(_boostedThreshold))) {
+            if (_algo.check_wand_constraint(_terms, _heaps, GreaterThan(_boostedThreshold)) &&
+                _algo.check_block_max_score(_terms, _heaps, GreaterThan(_threshold)))
+            {
                 if (_algo.check_score(_terms, _heaps, DotProductScorer(), GreaterThan(_threshold))) {
                     setDocId(_algo.get_candidate());
                 }
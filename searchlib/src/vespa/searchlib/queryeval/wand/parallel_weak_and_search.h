@@ -11,6 +11,9 @@ namespace search::queryeval {
 
 /**
  * WAND search iterator that uses a shared heap between match threads.
+ * Children exposing per block max weights (attribute posting lists)
+ * are used for block-max WAND, skipping whole blocks that cannot
+ * produce a hit above the current threshold.
  */
 struct ParallelWeakAndSearch : public SearchIterator
 {
@@ -177,7 +177,19 @@ public:
 
     uint32_t seek(uint16_t ref, uint32_t docid) { return _iteratorPack.seek(ref, docid); }
     int32_t get_weight(uint16_t ref, uint32_t docid) { return _iteratorPack.get_weight(ref, docid); }
-    
+    uint32_t get_block_last_docid(uint16_t ref) const { return _iteratorPack.get_block_last_docid(ref); }
+
+    /**
+     * Upper bound for the dot product score of a term within the
+     * posting block containing its current document.
+     **/
+    score_t blockMaxScore(ref_t ref) const {
+        if (_weight[ref] < 0) {
+            return _maxScore[ref];
+        }
+        return std::min(_maxScore[ref], _weight[ref] * (score_t)_iteratorPack.get_block_max_weight(ref));
+    }
+
     vespalib::string stringify_docid() const;
 };
 
@@ -472,6 +484,7 @@ private:
     score_t _upperBound;
     score_t _maxUpperBound;
     score_t _partial_score;
+    docid_t _blockEnd;
 
     template <typename VectorizedTerms>
     bool step_term(VectorizedTerms &terms, ref_t ref) {
@@ -557,10 +570,14 @@ private:
         _upperBound = 0;
         _maxUpperBound = 0;
         _partial_score = 0;
+        _blockEnd = SearchIterator::beginId();
     }
 
 public:
-    Algorithm() : _candidate(SearchIterator::beginId()), _upperBound(0), _maxUpperBound(0), _partial_score(0) {}
+    Algorithm()
+        : _candidate(SearchIterator::beginId()), _upperBound(0), _maxUpperBound(0), _partial_score(0),
+          _blockEnd(SearchIterator::beginId())
+    {}
 
     template <typename VectorizedTerms, typename Heaps>
     void init_range(VectorizedTerms &terms, Heaps &heaps, uint32_t begin_id, uint32_t end_id) {
@@ -616,6 +633,41 @@ public:
         return true;
     }
 
+    /**
+     * Block-max check of the current candidate. Present terms
+     * contribute with the max score of their current posting block
+     * while past terms contribute with their global max score. The
+     * bound is valid for all documents up to the end of the first
+     * ending block among the present terms.
+     **/
+    template <typename VectorizedTerms, typename Heaps, typename AboveThreshold>
+    bool check_block_max_score(VectorizedTerms &terms, Heaps &heaps, AboveThreshold &&aboveThreshold) {
+        if (!heaps.has_present()) {
+            return true;
+        }
+        score_t max_score = _maxUpperBound;
+        _blockEnd = search::endDocId;
+        ref_t *end = heaps.present_end();
+        for (ref_t *ref = heaps.present_begin(); ref != end; ++ref) {
+            max_score -= (terms.maxScore(*ref) - terms.blockMaxScore(*ref));
+            _blockEnd = std::min(_blockEnd, terms.get_block_last_docid(*ref));
+        }
+        return aboveThreshold(max_score);
+    }
+
+    /**
+     * Skip past all documents covered by a failed block-max check,
+     * stopping at the next document of a future term.
+     **/
+    template <typename VectorizedTerms, typename Heaps>
+    void skip_blocks(VectorizedTerms &terms, Heaps &heaps) {
+        docid_t next = _blockEnd + 1;
+        if (heaps.has_future()) {
+            next = std::min(next, terms.docId(heaps.future()));
+        }
+        set_candidate(terms, heaps, next);
+    }
+
     template <typename VectorizedTerms, typename Heaps, typename Scorer, typename AboveThreshold>
     bool check_score(VectorizedTerms &terms, Heaps &heaps, Scorer &&scorer, AboveThreshold &&aboveThreshold) {
         _partial_score = 0;
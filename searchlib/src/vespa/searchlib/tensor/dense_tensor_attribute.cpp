@@ -2,6 +2,8 @@
 
 #include "dense_tensor_attribute.h"
 #include "dense_tensor_attribute_saver.h"
+#include "hnsw_index.h"
+#include "inv_log_level_generator.h"
 #include "tensor_attribute.hpp"
 #include <vespa/eval/tensor/tensor.h>
 #include <vespa/eval/tensor/dense/mutable_dense_tensor_view.h>
@@ -11,6 +13,7 @@
 #include <vespa/log/log.h>
 LOG_SETUP(".searchlib.tensor.dense_tensor_attribute");
 
+using search::attribute::HnswIndexParams;
 using vespalib::eval::ValueType;
 using vespalib::tensor::MutableDenseTensorView;
 using vespalib::tensor::Tensor;
@@ -20,6 +23,8 @@ namespace search::tensor {
 namespace {
 
 constexpr uint32_t DENSE_TENSOR_ATTRIBUTE_VERSION = 1;
+// Version 2 appends the serialized nearest neighbor index after the tensors.
+constexpr uint32_t DENSE_TENSOR_ATTRIBUTE_VERSION_WITH_INDEX = 2;
 const vespalib::string tensorTypeTag("tensortype");
 
 class TensorReader : public ReaderBase
@@ -38,6 +43,7 @@ public:
     const vespalib::eval::ValueType &tensorType() const { return _tensorType; }
     const std::vector<uint32_t> &getUnboundDimSizes() const { return _unboundDimSizes; }
     void readTensor(void *buf, size_t len) { _datFile->ReadBuf(buf, len); }
+    FastOS_FileInterface &getDatFile() { return *_datFile; }
 };
 
 TensorReader::TensorReader(AttributeVector &attr)
@@ -80,13 +86,37 @@ TensorReader::getNumCells() {
     return numCells;
 }
 
+bool
+can_use_nearest_neighbor_index(const ValueType &type)
+{
+    return (type.dimensions().size() == 1) && type.dimensions()[0].is_bound();
+}
+
 }
 
 DenseTensorAttribute::DenseTensorAttribute(vespalib::stringref baseFileName,
                                  const Config &cfg)
     : TensorAttribute(baseFileName, cfg, _denseTensorStore),
-      _denseTensorStore(cfg.tensorType())
+      _denseTensorStore(cfg.tensorType()),
+      _index()
 {
+    const auto &params = cfg.hnswIndexParams();
+    if (params.has_value()) {
+        if (!can_use_nearest_neighbor_index(cfg.tensorType())) {
+            LOG(warning, "Cannot create nearest neighbor index for attribute '%s' with tensor type '%s'. "
+                "A single bound indexed dimension is required",
+                getName().c_str(), cfg.tensorType().to_spec().c_str());
+        } else {
+            HnswIndex::Config hnsw_cfg(params.value().max_links_per_node() * 2,
+                                       params.value().max_links_per_node(),
+                                       params.value().neighbors_to_explore_at_insert(),
+                                       true);
+            _index = std::make_unique<HnswIndex>(*this,
+                                                 make_distance_function(params.value().distance_metric()),
+                                                 std::make_unique<InvLogLevelGenerator>(params.value().max_links_per_node()),
+                                                 hnsw_cfg, getGenerationHolder());
+        }
+    }
 }
 
 
@@ -96,12 +126,28 @@ DenseTensorAttribute::~DenseTensorAttribute()
     _tensorStore.clearHoldLists();
 }
 
+MemoryUsage
+DenseTensorAttribute::memory_usage() const
+{
+    MemoryUsage result = TensorAttribute::memory_usage();
+    if (_index) {
+        result.merge(_index->memory_usage());
+    }
+    return result;
+}
+
 void
 DenseTensorAttribute::setTensor(DocId docId, const Tensor &tensor)
 {
     checkTensorType(tensor);
     EntryRef ref = _denseTensorStore.setTensor(tensor);
+    if (_index && _refVector[docId].valid()) {
+        _index->remove_document(docId);
+    }
     setTensorRef(docId, ref);
+    if (_index) {
+        _index->add_document(docId);
+    }
 }
 
 
@@ -136,7 +182,8 @@ DenseTensorAttribute::onLoad()
         return false;
     }
     setCreateSerialNum(tensorReader.getCreateSerialNum());
-    assert(tensorReader.getVersion() == DENSE_TENSOR_ATTRIBUTE_VERSION);
+    uint32_t version = tensorReader.getVersion();
+    assert(version == DENSE_TENSOR_ATTRIBUTE_VERSION || version == DENSE_TENSOR_ATTRIBUTE_VERSION_WITH_INDEX);
     assert(getConfig().tensorType().to_spec() ==
            tensorReader.getDatHeader().getTag(tensorTypeTag).asString());
     uint32_t numDocs(tensorReader.getDocIdLimit());
@@ -157,6 +204,17 @@ DenseTensorAttribute::onLoad()
     }
     setNumDocs(numDocs);
     setCommittedDocIdLimit(numDocs);
+    if (_index) {
+        if (version == DENSE_TENSOR_ATTRIBUTE_VERSION_WITH_INDEX && _index->load(tensorReader.getDatFile())) {
+            return true;
+        }
+        // No compatible index was saved, rebuild it from the loaded tensors.
+        for (uint32_t lid = 0; lid < numDocs; ++lid) {
+            if (_refVector[lid].valid()) {
+                _index->add_document(lid);
+            }
+        }
+    }
     return true;
 }
 
@@ -170,7 +228,8 @@ DenseTensorAttribute::onInitSave(vespalib::stringref fileName)
         (std::move(guard),
          this->createAttributeHeader(fileName),
          getRefCopy(),
-         _denseTensorStore);
+         _denseTensorStore,
+         (_index ? _index->make_saver() : std::unique_ptr<NearestNeighborIndexSaver>()));
 }
 
 void
@@ -182,7 +241,57 @@ DenseTensorAttribute::compactWorst()
 uint32_t
 DenseTensorAttribute::getVersion() const
 {
-    return DENSE_TENSOR_ATTRIBUTE_VERSION;
+    return _index ? DENSE_TENSOR_ATTRIBUTE_VERSION_WITH_INDEX : DENSE_TENSOR_ATTRIBUTE_VERSION;
+}
+
+uint32_t
+DenseTensorAttribute::clearDoc(DocId docId)
+{
+    if (_index && _refVector[docId].valid()) {
+        _index->remove_document(docId);
+    }
+    return TensorAttribute::clearDoc(docId);
+}
+
+void
+DenseTensorAttribute::clearDocs(DocId lidLow, DocId lidLimit)
+{
+    if (_index) {
+        for (DocId lid = lidLow; lid < lidLimit; ++lid) {
+            if (_refVector[lid].valid()) {
+                _index->remove_document(lid);
+            }
+        }
+    }
+    TensorAttribute::clearDocs(lidLow, lidLimit);
+}
+
+void
+DenseTensorAttribute::onGenerationChange(generation_t generation)
+{
+    TensorAttribute::onGenerationChange(generation);
+    if (_index) {
+        _index->transfer_hold_lists(generation - 1);
+    }
+}
+
+void
+DenseTensorAttribute::removeOldGenerations(generation_t firstUsed)
+{
+    TensorAttribute::removeOldGenerations(firstUsed);
+    if (_index) {
+        _index->trim_hold_lists(firstUsed);
+    }
+}
+
+vespalib::tensor::TypedCells
+DenseTensorAttribute::get_vector(uint32_t docid) const
+{
+    EntryRef ref;
+    if (docid < _refVector.size()) {
+        ref = _refVector[docid];
+    }
+    return _denseTensorStore.get_cells(ref);
 }
 
 }
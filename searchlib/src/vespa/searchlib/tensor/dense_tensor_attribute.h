@@ -4,6 +4,7 @@
 
 #include "tensor_attribute.h"
 #include "dense_tensor_store.h"
+#include "doc_vector_access.h"
 
 namespace vespalib { namespace tensor { class MutableDenseTensorView; }}
 
@@ -11,13 +12,21 @@ namespace search {
 
 namespace tensor {
 
+class NearestNeighborIndex;
+
 /**
  * Attribute vector class used to store dense tensors for all
  * documents in memory.
+ *
+ * If configured, an index for (approximate) nearest neighbor search
+ * is maintained over the tensors of a single bound indexed dimension.
  */
-class DenseTensorAttribute : public TensorAttribute
+class DenseTensorAttribute : public TensorAttribute, public DocVectorAccess
 {
     DenseTensorStore _denseTensorStore;
+    std::unique_ptr<NearestNeighborIndex> _index;
+
+    MemoryUsage memory_usage() const override;
 public:
     DenseTensorAttribute(vespalib::stringref baseFileName, const Config &cfg);
     virtual ~DenseTensorAttribute();
@@ -28,6 +37,14 @@ public:
     virtual std::unique_ptr<AttributeSaver> onInitSave(vespalib::stringref fileName) override;
     virtual void compactWorst() override;
     virtual uint32_t getVersion() const override;
+    uint32_t clearDoc(DocId docId) override;
+    void clearDocs(DocId lidLow, DocId lidLimit) override;
+    void onGenerationChange(generation_t generation) override;
+    void removeOldGenerations(generation_t firstUsed) override;
+    const NearestNeighborIndex *nearest_neighbor_index() const override { return _index.get(); }
+
+    // Implements DocVectorAccess
+    vespalib::tensor::TypedCells get_vector(uint32_t docid) const override;
 };
 
 
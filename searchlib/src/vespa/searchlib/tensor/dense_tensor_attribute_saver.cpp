@@ -3,6 +3,7 @@
 #include "dense_tensor_attribute_saver.h"
 #include <vespa/searchlib/util/bufferwriter.h>
 #include "dense_tensor_store.h"
+#include "nearest_neighbor_index.h"
 #include <vespa/searchlib/attribute/iattributesavetarget.h>
 
 using vespalib::GenerationHandler;
@@ -22,10 +23,12 @@ DenseTensorAttributeSaver::
 DenseTensorAttributeSaver(GenerationHandler::Guard &&guard,
                           const attribute::AttributeHeader &header,
                           RefCopyVector &&refs,
-                          const DenseTensorStore &tensorStore)
+                          const DenseTensorStore &tensorStore,
+                          std::unique_ptr<NearestNeighborIndexSaver> index_saver)
     : AttributeSaver(std::move(guard), header),
       _refs(std::move(refs)),
-      _tensorStore(tensorStore)
+      _tensorStore(tensorStore),
+      _index_saver(std::move(index_saver))
 {
 }
 
@@ -55,6 +58,9 @@ DenseTensorAttributeSaver::onSave(IAttributeSaveTarget &saveTarget)
             datWriter->write(&tensorIsNotPresent, sizeof(tensorIsNotPresent));
         }
     }
+    if (_index_saver) {
+        _index_saver->save(*datWriter);
+    }
     datWriter->flush();
     return true;
 }
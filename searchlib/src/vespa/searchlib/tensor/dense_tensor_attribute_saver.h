@@ -8,6 +8,7 @@
 namespace search::tensor {
 
 class DenseTensorStore;
+class NearestNeighborIndexSaver;
 
 /*
  * Class for saving a tensor attribute.
@@ -19,12 +20,14 @@ public:
 private:
     RefCopyVector      _refs;
     const DenseTensorStore &_tensorStore;
+    std::unique_ptr<NearestNeighborIndexSaver> _index_saver;
     using GenerationHandler = vespalib::GenerationHandler;
 
     bool onSave(IAttributeSaveTarget &saveTarget) override;
 public:
     DenseTensorAttributeSaver(GenerationHandler::Guard &&guard, const attribute::AttributeHeader &header,
-                              RefCopyVector &&refs, const DenseTensorStore &tensorStore);
+                              RefCopyVector &&refs, const DenseTensorStore &tensorStore,
+                              std::unique_ptr<NearestNeighborIndexSaver> index_saver);
 
     ~DenseTensorAttributeSaver() override;
 };
@@ -5,6 +5,7 @@
 #include <vespa/eval/tensor/dense/dense_tensor_view.h>
 #include <vespa/eval/tensor/dense/mutable_dense_tensor_view.h>
 #include <vespa/eval/tensor/dense/dense_tensor.h>
+#include <vespa/eval/tensor/dense/typed_dense_tensor.h>
 #include <vespa/eval/tensor/serialization/typed_binary_format.h>
 #include <vespa/searchlib/datastore/datastore.hpp>
 
@@ -13,6 +14,7 @@ using vespalib::tensor::Tensor;
 using vespalib::tensor::DenseTensor;
 using vespalib::tensor::DenseTensorView;
 using vespalib::tensor::MutableDenseTensorView;
+using vespalib::tensor::TypedCells;
 using vespalib::eval::ValueType;
 
 namespace search::tensor {
@@ -27,7 +29,7 @@ constexpr size_t DENSE_TENSOR_ALIGNMENT = 32;
 DenseTensorStore::TensorSizeCalc::TensorSizeCalc(const ValueType &type)
     : _numBoundCells(1u),
       _numUnboundDims(0u),
-      _cellSize(sizeof(double))
+      _cellSize(vespalib::eval::cell_type_size(type.cell_type()))
 {
     for (const auto & dim : type.dimensions()) {
         if (dim.is_bound()) {
@@ -76,7 +78,7 @@ DenseTensorStore::DenseTensorStore(const ValueType &type)
       _type(type),
       _emptyCells()
 {
-    _emptyCells.resize(_tensorSizeCalc._numBoundCells, 0.0);
+    _emptyCells.resize(_tensorSizeCalc._numBoundCells * _tensorSizeCalc._cellSize, 0);
     _store.addType(&_bufferType);
     _store.initActiveBuffers();
     if (_tensorSizeCalc._numUnboundDims == 0) {
@@ -185,16 +187,16 @@ void makeConcreteType(MutableDenseTensorView &tensor,
 std::unique_ptr<Tensor>
 DenseTensorStore::getTensor(EntryRef ref) const
 {
-    using CellsRef = DenseTensorView::CellsRef;
     if (!ref.valid()) {
         return std::unique_ptr<Tensor>();
     }
     auto raw = getRawBuffer(ref);
     size_t numCells = getNumCells(raw);
+    TypedCells cells(raw, _type.cell_type(), numCells);
     if (_tensorSizeCalc._numUnboundDims == 0) {
-        return std::make_unique<DenseTensorView>(_type, CellsRef(static_cast<const double *>(raw), numCells));
+        return std::make_unique<DenseTensorView>(_type, cells);
     } else {
-        auto result = std::make_unique<MutableDenseTensorView>(_type, CellsRef(static_cast<const double *>(raw), numCells));
+        auto result = std::make_unique<MutableDenseTensorView>(_type, cells);
         makeConcreteType(*result, raw, _tensorSizeCalc._numUnboundDims);
         return result;
     }
@@ -204,14 +206,14 @@ void
 DenseTensorStore::getTensor(EntryRef ref, MutableDenseTensorView &tensor) const
 {
     if (!ref.valid()) {
-        tensor.setCells(DenseTensorView::CellsRef(&_emptyCells[0], _emptyCells.size()));
+        tensor.setCells(TypedCells(&_emptyCells[0], _type.cell_type(), _tensorSizeCalc._numBoundCells));
         if (_tensorSizeCalc._numUnboundDims > 0) {
             tensor.setUnboundDimensionsForEmptyTensor();
         }
     } else {
         auto raw = getRawBuffer(ref);
         size_t numCells = getNumCells(raw);
-        tensor.setCells(DenseTensorView::CellsRef(static_cast<const double *>(raw), numCells));
+        tensor.setCells(TypedCells(raw, _type.cell_type(), numCells));
         if (_tensorSizeCalc._numUnboundDims > 0) {
             makeConcreteType(tensor, raw, _tensorSizeCalc._numUnboundDims);
         }
@@ -270,9 +272,10 @@ DenseTensorStore::setDenseTensor(const TensorType &tensor)
 {
     size_t numCells = tensor.cellsRef().size();
     checkMatchingType(_type, tensor.type(), numCells);
+    assert(tensor.cellsRef().type() == _type.cell_type());
     auto raw = allocRawBuffer(numCells);
     setDenseTensorUnboundDimSizes(raw.data, _type, _tensorSizeCalc._numUnboundDims, tensor.type());
-    memcpy(raw.data, &tensor.cellsRef()[0], numCells * _tensorSizeCalc._cellSize);
+    memcpy(raw.data, tensor.cellsRef().data(), numCells * _tensorSizeCalc._cellSize);
     return raw.ref;
 }
 
@@ -280,6 +283,10 @@ TensorStore::EntryRef
 DenseTensorStore::setTensor(const Tensor &tensor)
 {
     const DenseTensorView &view(dynamic_cast<const DenseTensorView &>(tensor));
+    if (view.cellsRef().type() != _type.cell_type()) {
+        auto converted = vespalib::tensor::convert_cells(view, _type.cell_type());
+        return setDenseTensor(*converted);
+    }
     return setDenseTensor(view);
 }
 
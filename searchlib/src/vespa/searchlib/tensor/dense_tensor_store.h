@@ -4,6 +4,7 @@
 
 #include "tensor_store.h"
 #include <vespa/eval/eval/value_type.h>
+#include <vespa/eval/tensor/dense/typed_cells.h>
 
 namespace vespalib { namespace tensor { class MutableDenseTensorView; }}
 
@@ -22,6 +23,9 @@ namespace search::tensor {
  * If both start of tensor dimension size information and start of
  * tensor cells were to be 32 byte aligned then tensors of type tensor(x[3])
  * would use 64 bytes.
+ *
+ * Cells are stored using the cell type of the tensor type (e.g. float cells
+ * use half the memory of double cells).
  */
 class DenseTensorStore : public TensorStore
 {
@@ -34,7 +38,7 @@ public:
     {
         size_t   _numBoundCells; // product of bound dimension sizes
         uint32_t _numUnboundDims;
-        uint32_t _cellSize; // size of a cell (e.g. double => 8)
+        uint32_t _cellSize; // size of a cell (e.g. double => 8, float => 4)
         
         TensorSizeCalc(const ValueType &type);
         size_t arraySize() const;
@@ -61,7 +65,7 @@ private:
     TensorSizeCalc _tensorSizeCalc;
     BufferType _bufferType;
     ValueType _type; // type of dense tensor
-    std::vector<double> _emptyCells;
+    std::vector<char> _emptyCells;
 
     size_t unboundCells(const void *buffer) const;
 
@@ -88,6 +92,13 @@ public:
     std::unique_ptr<Tensor> getTensor(EntryRef ref) const;
     void getTensor(EntryRef ref, vespalib::tensor::MutableDenseTensorView &tensor) const;
     EntryRef setTensor(const Tensor &tensor);
+    vespalib::tensor::TypedCells get_cells(EntryRef ref) const {
+        if (!ref.valid()) {
+            return vespalib::tensor::TypedCells(nullptr, _type.cell_type(), 0);
+        }
+        auto raw = getRawBuffer(ref);
+        return vespalib::tensor::TypedCells(raw, _type.cell_type(), getNumCells(raw));
+    }
     // The following method is meant to be used only for unit tests.
     uint32_t getArraySize() const { return _bufferType.getArraySize(); }
 };
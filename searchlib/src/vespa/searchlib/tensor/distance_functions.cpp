@@ -0,0 +1,85 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "distance_functions.h"
+#include <vespa/eval/tensor/dense/dense_dot_product_function.h>
+#include <cassert>
+#include <cmath>
+
+namespace search::tensor {
+
+using vespalib::ConstArrayRef;
+using vespalib::hwaccelrated::IAccelrated;
+using vespalib::tensor::DotProduct;
+using vespalib::tensor::dispatch_2;
+using Vector = DistanceFunction::Vector;
+
+namespace {
+
+struct CalcSquaredEuclidean {
+    template <typename LCT, typename RCT>
+    static double call(const Vector &lhs_in, const Vector &rhs_in) {
+        ConstArrayRef<LCT> lhs = lhs_in.typify<LCT>();
+        ConstArrayRef<RCT> rhs = rhs_in.typify<RCT>();
+        double sum = 0.0;
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            double diff = lhs[i] - rhs[i];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+};
+
+struct CalcAngular {
+    template <typename LCT, typename RCT>
+    static double call(const IAccelrated &hw, const Vector &lhs_in, const Vector &rhs_in) {
+        const LCT *lhs = lhs_in.typify<LCT>().cbegin();
+        const RCT *rhs = rhs_in.typify<RCT>().cbegin();
+        size_t sz = lhs_in.size();
+        double a_norm_sq = DotProduct<LCT, LCT>::apply(hw, lhs, lhs, sz);
+        double b_norm_sq = DotProduct<RCT, RCT>::apply(hw, rhs, rhs, sz);
+        double squared_norms = a_norm_sq * b_norm_sq;
+        if (squared_norms == 0.0) {
+            return 1.0;
+        }
+        double dot_product = DotProduct<LCT, RCT>::apply(hw, lhs, rhs, sz);
+        double cosine_similarity = dot_product / std::sqrt(squared_norms);
+        return 1.0 - cosine_similarity;
+    }
+};
+
+}
+
+double
+SquaredEuclideanDistance::calc(const Vector &lhs, const Vector &rhs) const
+{
+    assert(lhs.size() == rhs.size());
+    return dispatch_2<CalcSquaredEuclidean>(lhs.type(), rhs.type(), lhs, rhs);
+}
+
+AngularDistance::AngularDistance()
+    : _computer(IAccelrated::getAccelrator())
+{
+}
+
+AngularDistance::~AngularDistance() = default;
+
+double
+AngularDistance::calc(const Vector &lhs, const Vector &rhs) const
+{
+    assert(lhs.size() == rhs.size());
+    return dispatch_2<CalcAngular>(lhs.type(), rhs.type(), *_computer, lhs, rhs);
+}
+
+DistanceFunction::UP
+make_distance_function(attribute::DistanceMetric metric)
+{
+    switch (metric) {
+    case attribute::DistanceMetric::Angular:
+        return std::make_unique<AngularDistance>();
+    case attribute::DistanceMetric::Euclidean:
+    default:
+        return std::make_unique<SquaredEuclideanDistance>();
+    }
+}
+
+}
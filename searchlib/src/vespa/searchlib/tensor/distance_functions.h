@@ -0,0 +1,50 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchcommon/attribute/distance_metric.h>
+#include <vespa/eval/tensor/dense/typed_cells.h>
+#include <vespa/vespalib/hwaccelrated/iaccelrated.h>
+#include <memory>
+
+namespace search::tensor {
+
+/**
+ * Interface used to calculate the distance between two n-dimensional vectors.
+ *
+ * The vectors must be of same size, but may have different cell types.
+ * A lower distance means that the vectors are closer.
+ */
+class DistanceFunction {
+public:
+    using UP = std::unique_ptr<DistanceFunction>;
+    using Vector = vespalib::tensor::TypedCells;
+    virtual ~DistanceFunction() {}
+    virtual double calc(const Vector &lhs, const Vector &rhs) const = 0;
+};
+
+/**
+ * Calculates the square of the euclidean distance.
+ * The square root is omitted as the ordering of distances is unchanged.
+ */
+class SquaredEuclideanDistance : public DistanceFunction {
+public:
+    double calc(const Vector &lhs, const Vector &rhs) const override;
+};
+
+/**
+ * Calculates the angular distance (1 - cosine similarity) using the
+ * hardware accelerated dot product.
+ */
+class AngularDistance : public DistanceFunction {
+private:
+    vespalib::hwaccelrated::IAccelrated::UP _computer;
+public:
+    AngularDistance();
+    ~AngularDistance() override;
+    double calc(const Vector &lhs, const Vector &rhs) const override;
+};
+
+DistanceFunction::UP make_distance_function(attribute::DistanceMetric metric);
+
+}
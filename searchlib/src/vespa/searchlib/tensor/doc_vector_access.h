@@ -0,0 +1,22 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/tensor/dense/typed_cells.h>
+#include <cstdint>
+
+namespace search::tensor {
+
+/**
+ * Interface that provides access to the vector that is associated with the given document id.
+ *
+ * All vectors should be the same size.
+ * An empty vector is returned if the document has no vector.
+ */
+class DocVectorAccess {
+public:
+    virtual ~DocVectorAccess() {}
+    virtual vespalib::tensor::TypedCells get_vector(uint32_t docid) const = 0;
+};
+
+}
@@ -0,0 +1,114 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "hnsw_graph.h"
+#include <vespa/searchlib/common/rcuvector.hpp>
+#include <vespa/searchlib/datastore/array_store.hpp>
+#include <atomic>
+
+namespace search::tensor {
+
+namespace {
+
+constexpr size_t min_num_arrays_for_new_buffer = 8 * 1024;
+constexpr float alloc_grow_factor = 0.2;
+constexpr size_t huge_page_size = 4 * 1024 * 1024;
+constexpr size_t small_page_size = 4 * 1024;
+
+template <typename StoreType>
+datastore::ArrayStoreConfig
+make_default_config(size_t max_small_array_size)
+{
+    return StoreType::optimizedConfigForHugePage(max_small_array_size,
+                                                 huge_page_size,
+                                                 small_page_size,
+                                                 min_num_arrays_for_new_buffer,
+                                                 alloc_grow_factor);
+}
+
+}
+
+HnswGraph::HnswGraph(vespalib::GenerationHolder &gen_holder)
+  : node_refs(16, 100, 128 * 1024, gen_holder),
+    nodes(make_default_config<LevelArrayStore>(max_level_array_size)),
+    links(make_default_config<LinkArrayStore>(max_link_array_size)),
+    entry_docid_and_level()
+{
+    set_entry_node(0, -1); // Note that docid 0 is reserved and never used
+}
+
+HnswGraph::~HnswGraph() = default;
+
+void
+HnswGraph::make_node_for_document(uint32_t docid, uint32_t num_levels)
+{
+    node_refs.ensure_size(docid + 1, EntryRef());
+    // A document cannot be added twice.
+    assert(!node_refs[docid].valid());
+    // Note: The level array instance lives as long as the document is present in the index.
+    std::vector<EntryRef> levels(num_levels, EntryRef());
+    auto node_ref = nodes.add(levels);
+    std::atomic_thread_fence(std::memory_order_release);
+    node_refs[docid] = node_ref;
+}
+
+void
+HnswGraph::remove_node_for_document(uint32_t docid)
+{
+    auto node_ref = node_refs[docid];
+    assert(node_ref.valid());
+    node_refs[docid] = EntryRef();
+    auto levels = nodes.get(node_ref);
+    for (auto link_ref : levels) {
+        links.remove(link_ref);
+    }
+    nodes.remove(node_ref);
+}
+
+void
+HnswGraph::set_link_array(uint32_t docid, uint32_t level, const LinkArrayRef& new_links)
+{
+    auto old_node_ref = node_refs[docid];
+    auto old_levels = nodes.get(old_node_ref);
+    assert(level < old_levels.size());
+    std::vector<EntryRef> new_levels(old_levels.cbegin(), old_levels.cend());
+    auto old_link_ref = new_levels[level];
+    new_levels[level] = links.add(new_links);
+    auto new_node_ref = nodes.add(new_levels);
+    std::atomic_thread_fence(std::memory_order_release);
+    node_refs[docid] = new_node_ref;
+    links.remove(old_link_ref);
+    nodes.remove(old_node_ref);
+}
+
+void
+HnswGraph::transfer_hold_lists(generation_t current_gen)
+{
+    nodes.transferHoldLists(current_gen);
+    links.transferHoldLists(current_gen);
+}
+
+void
+HnswGraph::trim_hold_lists(generation_t first_used_gen)
+{
+    nodes.trimHoldLists(first_used_gen);
+    links.trimHoldLists(first_used_gen);
+}
+
+MemoryUsage
+HnswGraph::memory_usage() const
+{
+    MemoryUsage result;
+    result.merge(node_refs.getMemoryUsage());
+    result.merge(nodes.getMemoryUsage());
+    result.merge(links.getMemoryUsage());
+    return result;
+}
+
+}
+
+namespace search::datastore {
+
+template class ArrayStore<EntryRef>;
+template class ArrayStore<uint32_t>;
+
+}
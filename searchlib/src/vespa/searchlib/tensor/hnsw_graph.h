@@ -0,0 +1,91 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/searchlib/common/rcuvector.h>
+#include <vespa/searchlib/datastore/array_store.h>
+#include <vespa/searchlib/datastore/entryref.h>
+#include <atomic>
+
+namespace search::tensor {
+
+/**
+ * Storage of a hierarchical navigable small world graph (HNSW)
+ * that is used for approximate K-nearest neighbor search.
+ *
+ * Each document is a node in the graph. A node has an array of levels,
+ * where each level refers to an array of links (docids) to neighbor nodes.
+ * Both level and link arrays are immutable once added to the array stores:
+ * an update allocates new arrays and puts the old arrays on hold, such that
+ * concurrent readers always observe a consistent node.
+ */
+class HnswGraph {
+public:
+    using EntryRef = datastore::EntryRef;
+    using NodeRefVector = attribute::RcuVectorBase<EntryRef>;
+    using LevelArrayStore = datastore::ArrayStore<EntryRef>;
+    using LevelArrayRef = LevelArrayStore::ConstArrayRef;
+    using LinkArrayStore = datastore::ArrayStore<uint32_t>;
+    using LinkArrayRef = LinkArrayStore::ConstArrayRef;
+    using generation_t = vespalib::GenerationHandler::generation_t;
+
+    // Arrays larger than these sizes are heap allocated by the array stores.
+    static constexpr size_t max_level_array_size = 16;
+    static constexpr size_t max_link_array_size = 64;
+
+    struct EntryNode {
+        uint32_t docid;
+        int32_t  level;
+        EntryNode(uint32_t docid_in, int32_t level_in) : docid(docid_in), level(level_in) {}
+    };
+
+    NodeRefVector   node_refs;
+    LevelArrayStore nodes;
+    LinkArrayStore  links;
+    // Entry node docid (low 32 bits) and level (high 32 bits), packed such that
+    // concurrent readers always observe a matching pair.
+    std::atomic<uint64_t> entry_docid_and_level;
+
+    HnswGraph(vespalib::GenerationHolder &gen_holder);
+    ~HnswGraph();
+
+    void make_node_for_document(uint32_t docid, uint32_t num_levels);
+    void remove_node_for_document(uint32_t docid);
+
+    bool has_node(uint32_t docid) const {
+        return (docid < node_refs.size()) && node_refs[docid].valid();
+    }
+
+    LevelArrayRef get_level_array(uint32_t docid) const {
+        if (docid >= node_refs.size()) {
+            return LevelArrayRef();
+        }
+        return nodes.get(node_refs[docid]);
+    }
+
+    LinkArrayRef get_link_array(uint32_t docid, uint32_t level) const {
+        auto levels = get_level_array(docid);
+        if (level >= levels.size()) {
+            return LinkArrayRef();
+        }
+        return links.get(levels[level]);
+    }
+
+    void set_link_array(uint32_t docid, uint32_t level, const LinkArrayRef& new_links);
+
+    void set_entry_node(uint32_t docid, int32_t level) {
+        uint64_t value = (static_cast<uint64_t>(static_cast<uint32_t>(level)) << 32) | docid;
+        entry_docid_and_level.store(value, std::memory_order_release);
+    }
+
+    EntryNode get_entry_node() const {
+        uint64_t value = entry_docid_and_level.load(std::memory_order_acquire);
+        return EntryNode(static_cast<uint32_t>(value), static_cast<int32_t>(static_cast<uint32_t>(value >> 32)));
+    }
+
+    void transfer_hold_lists(generation_t current_gen);
+    void trim_hold_lists(generation_t first_used_gen);
+    MemoryUsage memory_usage() const;
+};
+
+}
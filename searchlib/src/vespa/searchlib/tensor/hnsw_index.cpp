@@ -0,0 +1,478 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "hnsw_index.h"
+#include "hnsw_index_loader.h"
+#include "hnsw_index_saver.h"
+#include <algorithm>
+#include <limits>
+
+namespace search::tensor {
+
+namespace {
+
+/**
+ * Tracks the nodes visited by search_layer() in a generation tagged
+ * vector indexed by docid. One instance is reused by all searches in a
+ * thread, so starting a new search only bumps the generation instead of
+ * allocating and clearing a set. The cost is 2 bytes per document for
+ * each thread that has searched the index.
+ */
+class VisitedTracker {
+    std::vector<uint16_t> _visited;
+    uint16_t              _generation;
+
+public:
+    VisitedTracker() : _visited(), _generation(0) {}
+
+    void start(uint32_t doc_id_limit) {
+        if (_visited.size() < doc_id_limit) {
+            _visited.resize(doc_id_limit, 0);
+        }
+        if (++_generation == 0) {
+            std::fill(_visited.begin(), _visited.end(), 0);
+            _generation = 1;
+        }
+    }
+
+    bool try_mark_visited(uint32_t docid) {
+        if (docid >= _visited.size()) {
+            // The node was added concurrently after the search started.
+            _visited.resize(docid + 1, 0);
+        }
+        if (_visited[docid] == _generation) {
+            return false;
+        }
+        _visited[docid] = _generation;
+        return true;
+    }
+};
+
+thread_local VisitedTracker visited_tracker;
+
+bool
+has_link_to(vespalib::ConstArrayRef<uint32_t> links, uint32_t id)
+{
+    for (uint32_t link : links) {
+        if (link == id) return true;
+    }
+    return false;
+}
+
+struct PairDist {
+    uint32_t id_first;
+    uint32_t id_second;
+    double distance;
+    PairDist(uint32_t i1, uint32_t i2, double d)
+      : id_first(i1), id_second(i2), distance(d)
+    {}
+    bool operator< (const PairDist &other) const {
+        return (distance < other.distance);
+    }
+};
+
+}
+
+uint32_t
+HnswIndex::max_links_for_level(uint32_t level) const
+{
+    return (level == 0) ? _cfg.max_links_at_level_0() : _cfg.max_links_on_inserts();
+}
+
+void
+HnswIndex::add_link_to(uint32_t docid, uint32_t level, const LinkArrayRef& old_links, uint32_t new_link)
+{
+    LinkArray new_links(old_links.begin(), old_links.end());
+    new_links.push_back(new_link);
+    _graph.set_link_array(docid, level, new_links);
+}
+
+bool
+HnswIndex::have_closer_distance(HnswCandidate candidate, const LinkArray& result) const
+{
+    for (uint32_t result_docid : result) {
+        double dist = calc_distance(candidate.docid, result_docid);
+        if (dist < candidate.distance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+HnswIndex::LinkArray
+HnswIndex::select_neighbors_simple(const HnswCandidateVector& neighbors, uint32_t max_links) const
+{
+    HnswCandidateVector sorted(neighbors);
+    std::sort(sorted.begin(), sorted.end(), LesserDistance());
+    LinkArray result;
+    for (size_t i = 0, m = std::min(static_cast<size_t>(max_links), sorted.size()); i < m; ++i) {
+        result.push_back(sorted[i].docid);
+    }
+    return result;
+}
+
+HnswIndex::LinkArray
+HnswIndex::select_neighbors_heuristic(const HnswCandidateVector& neighbors, uint32_t max_links) const
+{
+    LinkArray result;
+    bool need_filtering = neighbors.size() > max_links;
+    NearestPriQ nearest;
+    for (const auto& entry : neighbors) {
+        nearest.push(entry);
+    }
+    while (!nearest.empty()) {
+        auto candidate = nearest.top();
+        nearest.pop();
+        if (need_filtering && have_closer_distance(candidate, result)) {
+            continue;
+        }
+        result.push_back(candidate.docid);
+        if (result.size() == max_links) {
+            return result;
+        }
+    }
+    return result;
+}
+
+HnswIndex::LinkArray
+HnswIndex::select_neighbors(const HnswCandidateVector& neighbors, uint32_t max_links) const
+{
+    if (_cfg.heuristic_select_neighbors()) {
+        return select_neighbors_heuristic(neighbors, max_links);
+    } else {
+        return select_neighbors_simple(neighbors, max_links);
+    }
+}
+
+void
+HnswIndex::shrink_if_needed(uint32_t docid, uint32_t level)
+{
+    auto old_links = _graph.get_link_array(docid, level);
+    uint32_t max_links = max_links_for_level(level);
+    if (old_links.size() > max_links) {
+        HnswCandidateVector neighbors;
+        neighbors.reserve(old_links.size());
+        for (uint32_t neighbor_docid : old_links) {
+            double dist = calc_distance(docid, neighbor_docid);
+            neighbors.emplace_back(neighbor_docid, dist);
+        }
+        auto split = select_neighbors(neighbors, max_links);
+        LinkArray removed_links;
+        for (uint32_t neighbor_docid : old_links) {
+            if (!has_link_to(split, neighbor_docid)) {
+                removed_links.push_back(neighbor_docid);
+            }
+        }
+        _graph.set_link_array(docid, level, split);
+        for (uint32_t removed_docid : removed_links) {
+            remove_link_to(removed_docid, docid, level);
+        }
+    }
+}
+
+void
+HnswIndex::connect_new_node(uint32_t docid, const LinkArray &neighbors, uint32_t level)
+{
+    _graph.set_link_array(docid, level, neighbors);
+    for (uint32_t neighbor_docid : neighbors) {
+        auto old_links = _graph.get_link_array(neighbor_docid, level);
+        add_link_to(neighbor_docid, level, old_links, docid);
+    }
+    for (uint32_t neighbor_docid : neighbors) {
+        shrink_if_needed(neighbor_docid, level);
+    }
+}
+
+void
+HnswIndex::remove_link_to(uint32_t remove_from, uint32_t remove_id, uint32_t level)
+{
+    LinkArray new_links;
+    auto old_links = _graph.get_link_array(remove_from, level);
+    new_links.reserve(old_links.size());
+    for (uint32_t id : old_links) {
+        if (id != remove_id) {
+            new_links.push_back(id);
+        }
+    }
+    _graph.set_link_array(remove_from, level, new_links);
+}
+
+void
+HnswIndex::mutual_reconnect(const LinkArray &cluster, uint32_t level)
+{
+    std::vector<PairDist> pairs;
+    for (uint32_t i = 0; i + 1 < cluster.size(); ++i) {
+        uint32_t n_id_1 = cluster[i];
+        auto n_list_1 = _graph.get_link_array(n_id_1, level);
+        for (uint32_t j = i + 1; j < cluster.size(); ++j) {
+            uint32_t n_id_2 = cluster[j];
+            if (has_link_to(n_list_1, n_id_2)) {
+                continue;
+            }
+            pairs.emplace_back(n_id_1, n_id_2, calc_distance(n_id_1, n_id_2));
+        }
+    }
+    std::sort(pairs.begin(), pairs.end());
+    for (const PairDist &pair : pairs) {
+        auto old_links_1 = _graph.get_link_array(pair.id_first, level);
+        if (old_links_1.size() >= _cfg.max_links_on_inserts()) {
+            continue;
+        }
+        auto old_links_2 = _graph.get_link_array(pair.id_second, level);
+        if (old_links_2.size() >= _cfg.max_links_on_inserts()) {
+            continue;
+        }
+        add_link_to(pair.id_first, level, old_links_1, pair.id_second);
+        add_link_to(pair.id_second, level, old_links_2, pair.id_first);
+    }
+}
+
+void
+HnswIndex::find_new_entry_node(uint32_t removed_docid, const std::vector<LinkArray> &removed_links)
+{
+    for (int32_t level = removed_links.size() - 1; level >= 0; --level) {
+        const auto &links = removed_links[level];
+        if (!links.empty()) {
+            uint32_t new_entry = links[0];
+            _graph.set_entry_node(new_entry, _graph.get_level_array(new_entry).size() - 1);
+            return;
+        }
+    }
+    // The removed node was not connected to any other nodes, fall back to scanning all nodes.
+    uint32_t best_docid = 0;
+    int32_t best_level = -1;
+    for (uint32_t docid = 1; docid < _graph.node_refs.size(); ++docid) {
+        if (docid == removed_docid) {
+            continue;
+        }
+        int32_t level = static_cast<int32_t>(_graph.get_level_array(docid).size()) - 1;
+        if (level > best_level) {
+            best_docid = docid;
+            best_level = level;
+        }
+    }
+    _graph.set_entry_node(best_docid, best_level);
+}
+
+double
+HnswIndex::calc_distance(uint32_t lhs_docid, uint32_t rhs_docid) const
+{
+    auto lhs = get_vector(lhs_docid);
+    return calc_distance(lhs, rhs_docid);
+}
+
+double
+HnswIndex::calc_distance(const Vector& lhs, uint32_t rhs_docid) const
+{
+    auto rhs = get_vector(rhs_docid);
+    if (lhs.size() != rhs.size()) {
+        // The document was removed concurrently with a search.
+        return std::numeric_limits<double>::max();
+    }
+    return _distance_func->calc(lhs, rhs);
+}
+
+HnswCandidate
+HnswIndex::find_nearest_in_layer(const Vector& input, const HnswCandidate& entry_point, uint32_t level) const
+{
+    HnswCandidate nearest = entry_point;
+    bool keep_searching = true;
+    while (keep_searching) {
+        keep_searching = false;
+        for (uint32_t neighbor_docid : _graph.get_link_array(nearest.docid, level)) {
+            double dist = calc_distance(input, neighbor_docid);
+            if (dist < nearest.distance) {
+                nearest = HnswCandidate(neighbor_docid, dist);
+                keep_searching = true;
+            }
+        }
+    }
+    return nearest;
+}
+
+void
+HnswIndex::search_layer(const Vector& input, uint32_t neighbors_to_find, FurthestPriQ& best_neighbors, uint32_t level) const
+{
+    NearestPriQ candidates;
+    VisitedTracker &visited = visited_tracker;
+    visited.start(_graph.node_refs.size());
+    for (const auto &entry : best_neighbors.peek()) {
+        candidates.push(entry);
+        visited.try_mark_visited(entry.docid);
+    }
+    double limit_dist = std::numeric_limits<double>::max();
+
+    while (!candidates.empty()) {
+        auto cand = candidates.top();
+        if (cand.distance > limit_dist) {
+            break;
+        }
+        candidates.pop();
+        for (uint32_t neighbor_docid : _graph.get_link_array(cand.docid, level)) {
+            if (!visited.try_mark_visited(neighbor_docid)) {
+                continue;
+            }
+            double dist_to_input = calc_distance(input, neighbor_docid);
+            if (dist_to_input < limit_dist) {
+                candidates.emplace(neighbor_docid, dist_to_input);
+                best_neighbors.emplace(neighbor_docid, dist_to_input);
+                while (best_neighbors.size() > neighbors_to_find) {
+                    best_neighbors.pop();
+                }
+                if (best_neighbors.size() == neighbors_to_find) {
+                    limit_dist = best_neighbors.top().distance;
+                }
+            }
+        }
+    }
+}
+
+HnswIndex::HnswIndex(const DocVectorAccess& vectors, DistanceFunction::UP distance_func,
+                     RandomLevelGenerator::UP level_generator, const Config& cfg,
+                     vespalib::GenerationHolder &gen_holder)
+    : _vectors(vectors),
+      _distance_func(std::move(distance_func)),
+      _level_generator(std::move(level_generator)),
+      _cfg(cfg),
+      _graph(gen_holder)
+{
+}
+
+HnswIndex::~HnswIndex() = default;
+
+void
+HnswIndex::add_document(uint32_t docid)
+{
+    auto input = get_vector(docid);
+    int level = _level_generator->max_level();
+    _graph.make_node_for_document(docid, level + 1);
+    auto entry = _graph.get_entry_node();
+    uint32_t entry_docid = entry.docid;
+    if (entry_docid == 0) {
+        _graph.set_entry_node(docid, level);
+        return;
+    }
+
+    int search_level = entry.level;
+    double entry_dist = calc_distance(input, entry_docid);
+    HnswCandidate entry_point(entry_docid, entry_dist);
+    while (search_level > level) {
+        entry_point = find_nearest_in_layer(input, entry_point, search_level);
+        --search_level;
+    }
+
+    FurthestPriQ best_neighbors;
+    best_neighbors.push(entry_point);
+    search_level = std::min(level, search_level);
+
+    // Insert the added document in each level it should exist in.
+    while (search_level >= 0) {
+        search_layer(input, _cfg.neighbors_to_explore_at_construction(), best_neighbors, search_level);
+        auto neighbors = select_neighbors(best_neighbors.peek(), _cfg.max_links_on_inserts());
+        connect_new_node(docid, neighbors, search_level);
+        --search_level;
+    }
+    if (level > entry.level) {
+        _graph.set_entry_node(docid, level);
+    }
+}
+
+void
+HnswIndex::remove_document(uint32_t docid)
+{
+    if (!_graph.has_node(docid)) {
+        return;
+    }
+    bool need_new_entrypoint = (docid == _graph.get_entry_node().docid);
+    auto node_levels = _graph.get_level_array(docid);
+    std::vector<LinkArray> removed_links;
+    removed_links.reserve(node_levels.size());
+    for (uint32_t level = 0; level < node_levels.size(); ++level) {
+        auto links = _graph.get_link_array(docid, level);
+        removed_links.emplace_back(links.cbegin(), links.cend());
+    }
+    for (uint32_t level = 0; level < removed_links.size(); ++level) {
+        const auto &my_links = removed_links[level];
+        for (uint32_t neighbor_id : my_links) {
+            remove_link_to(neighbor_id, docid, level);
+        }
+        mutual_reconnect(my_links, level);
+    }
+    _graph.remove_node_for_document(docid);
+    if (need_new_entrypoint) {
+        find_new_entry_node(docid, removed_links);
+    }
+}
+
+void
+HnswIndex::transfer_hold_lists(generation_t current_gen)
+{
+    _graph.transfer_hold_lists(current_gen);
+}
+
+void
+HnswIndex::trim_hold_lists(generation_t first_used_gen)
+{
+    _graph.trim_hold_lists(first_used_gen);
+}
+
+MemoryUsage
+HnswIndex::memory_usage() const
+{
+    return _graph.memory_usage();
+}
+
+std::unique_ptr<NearestNeighborIndexSaver>
+HnswIndex::make_saver() const
+{
+    return std::make_unique<HnswIndexSaver>(_graph);
+}
+
+bool
+HnswIndex::load(FastOS_FileInterface &file)
+{
+    HnswIndexLoader loader(_graph);
+    return loader.load(file);
+}
+
+std::vector<NearestNeighborIndex::Neighbor>
+HnswIndex::find_top_k(uint32_t k, Vector vector, uint32_t explore_k) const
+{
+    std::vector<Neighbor> result;
+    FurthestPriQ best_neighbors = top_k_candidates(vector, std::max(k, explore_k));
+    while (best_neighbors.size() > k) {
+        best_neighbors.pop();
+    }
+    result.reserve(best_neighbors.size());
+    for (const HnswCandidate &hit : best_neighbors.peek()) {
+        if (hit.distance != std::numeric_limits<double>::max()) {
+            result.emplace_back(hit.docid, hit.distance);
+        }
+    }
+    std::sort(result.begin(), result.end(),
+              [](const Neighbor &a, const Neighbor &b) { return a.distance < b.distance; });
+    return result;
+}
+
+FurthestPriQ
+HnswIndex::top_k_candidates(const Vector &vector, uint32_t k) const
+{
+    FurthestPriQ best_neighbors;
+    auto entry = _graph.get_entry_node();
+    uint32_t entry_docid = entry.docid;
+    int32_t entry_level = entry.level;
+    if (entry_docid == 0) {
+        return best_neighbors;
+    }
+    double entry_dist = calc_distance(vector, entry_docid);
+    HnswCandidate entry_point(entry_docid, entry_dist);
+    int search_level = entry_level;
+    while (search_level > 0) {
+        entry_point = find_nearest_in_layer(vector, entry_point, search_level);
+        --search_level;
+    }
+    best_neighbors.push(entry_point);
+    search_layer(vector, k, best_neighbors, 0);
+    return best_neighbors;
+}
+
+}
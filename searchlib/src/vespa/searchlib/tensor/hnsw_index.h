@@ -0,0 +1,113 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "distance_functions.h"
+#include "doc_vector_access.h"
+#include "hnsw_graph.h"
+#include "hnsw_index_utils.h"
+#include "nearest_neighbor_index.h"
+#include "random_level_generator.h"
+
+namespace search::tensor {
+
+/**
+ * Implementation of a hierarchical navigable small world graph (HNSW)
+ * that is used for approximate K-nearest neighbor search.
+ *
+ * The implementation supports 1 write thread and multiple search threads without the use of mutexes.
+ * This is achieved by using data stores that use generation tracking and associated memory management.
+ *
+ * The implementation is mainly based on the algorithms described in
+ * "Efficient and robust approximate nearest neighbor search using Hierarchical Navigable Small World graphs"
+ * (Yu. A. Malkov, D. A. Yashunin), available at https://arxiv.org/abs/1603.09320
+ */
+class HnswIndex : public NearestNeighborIndex {
+public:
+    class Config {
+    private:
+        uint32_t _max_links_at_level_0;
+        uint32_t _max_links_on_inserts;
+        uint32_t _neighbors_to_explore_at_construction;
+        bool _heuristic_select_neighbors;
+
+    public:
+        Config(uint32_t max_links_at_level_0_in,
+               uint32_t max_links_on_inserts_in,
+               uint32_t neighbors_to_explore_at_construction_in,
+               bool heuristic_select_neighbors_in)
+            : _max_links_at_level_0(max_links_at_level_0_in),
+              _max_links_on_inserts(max_links_on_inserts_in),
+              _neighbors_to_explore_at_construction(neighbors_to_explore_at_construction_in),
+              _heuristic_select_neighbors(heuristic_select_neighbors_in)
+        {}
+        uint32_t max_links_at_level_0() const { return _max_links_at_level_0; }
+        uint32_t max_links_on_inserts() const { return _max_links_on_inserts; }
+        uint32_t neighbors_to_explore_at_construction() const { return _neighbors_to_explore_at_construction; }
+        bool heuristic_select_neighbors() const { return _heuristic_select_neighbors; }
+    };
+
+protected:
+    using LevelArrayRef = HnswGraph::LevelArrayRef;
+    using LinkArrayRef = HnswGraph::LinkArrayRef;
+    using LinkArray = std::vector<uint32_t>;
+
+    const DocVectorAccess& _vectors;
+    DistanceFunction::UP _distance_func;
+    RandomLevelGenerator::UP _level_generator;
+    Config _cfg;
+    HnswGraph _graph;
+
+    uint32_t max_links_for_level(uint32_t level) const;
+    void add_link_to(uint32_t docid, uint32_t level, const LinkArrayRef& old_links, uint32_t new_link);
+    bool have_closer_distance(HnswCandidate candidate, const LinkArray& curr_result) const;
+    LinkArray select_neighbors_simple(const HnswCandidateVector& neighbors, uint32_t max_links) const;
+    LinkArray select_neighbors_heuristic(const HnswCandidateVector& neighbors, uint32_t max_links) const;
+    LinkArray select_neighbors(const HnswCandidateVector& neighbors, uint32_t max_links) const;
+    void shrink_if_needed(uint32_t docid, uint32_t level);
+    void connect_new_node(uint32_t docid, const LinkArray &neighbors, uint32_t level);
+    void remove_link_to(uint32_t remove_from, uint32_t remove_id, uint32_t level);
+    void mutual_reconnect(const LinkArray &cluster, uint32_t level);
+    void find_new_entry_node(uint32_t removed_docid, const std::vector<LinkArray> &removed_links);
+
+    inline Vector get_vector(uint32_t docid) const {
+        return _vectors.get_vector(docid);
+    }
+
+    double calc_distance(uint32_t lhs_docid, uint32_t rhs_docid) const;
+    double calc_distance(const Vector& lhs, uint32_t rhs_docid) const;
+
+    /**
+     * Performs a greedy search in the given layer to find the candidate that is nearest the input vector.
+     */
+    HnswCandidate find_nearest_in_layer(const Vector& input, const HnswCandidate& entry_point, uint32_t level) const;
+    void search_layer(const Vector& input, uint32_t neighbors_to_find, FurthestPriQ& found_neighbors, uint32_t level) const;
+
+public:
+    HnswIndex(const DocVectorAccess& vectors, DistanceFunction::UP distance_func,
+              RandomLevelGenerator::UP level_generator, const Config& cfg,
+              vespalib::GenerationHolder &gen_holder);
+    ~HnswIndex() override;
+
+    const Config& config() const { return _cfg; }
+
+    // Implements NearestNeighborIndex
+    void add_document(uint32_t docid) override;
+    void remove_document(uint32_t docid) override;
+    void transfer_hold_lists(generation_t current_gen) override;
+    void trim_hold_lists(generation_t first_used_gen) override;
+    MemoryUsage memory_usage() const override;
+    std::unique_ptr<NearestNeighborIndexSaver> make_saver() const override;
+    bool load(FastOS_FileInterface &file) override;
+    std::vector<Neighbor> find_top_k(uint32_t k, Vector vector, uint32_t explore_k) const override;
+    const DistanceFunction &distance_function() const override { return *_distance_func; }
+
+    FurthestPriQ top_k_candidates(const Vector &vector, uint32_t k) const;
+
+    // Should only be used by unit tests.
+    uint32_t get_entry_docid() const { return _graph.get_entry_node().docid; }
+    int32_t get_entry_level() const { return _graph.get_entry_node().level; }
+    const HnswGraph &get_graph() const { return _graph; }
+};
+
+}
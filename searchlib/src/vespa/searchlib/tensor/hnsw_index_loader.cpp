@@ -0,0 +1,42 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "hnsw_index_loader.h"
+#include "hnsw_graph.h"
+#include <vespa/searchlib/util/fileutil.h>
+
+namespace search::tensor {
+
+HnswIndexLoader::HnswIndexLoader(HnswGraph &graph)
+    : _graph(graph)
+{
+}
+
+HnswIndexLoader::~HnswIndexLoader() = default;
+
+bool
+HnswIndexLoader::load(FastOS_FileInterface& file)
+{
+    FileReader<uint32_t> reader(file);
+    uint32_t entry_docid = reader.readHostOrder();
+    int32_t entry_level = static_cast<int32_t>(reader.readHostOrder());
+    uint32_t num_nodes = reader.readHostOrder();
+    std::vector<uint32_t> link_array;
+    for (uint32_t docid = 0; docid < num_nodes; ++docid) {
+        uint32_t num_levels = reader.readHostOrder();
+        if (num_levels > 0) {
+            _graph.make_node_for_document(docid, num_levels);
+            for (uint32_t level = 0; level < num_levels; ++level) {
+                uint32_t num_links = reader.readHostOrder();
+                link_array.clear();
+                for (uint32_t i = 0; i < num_links; ++i) {
+                    link_array.push_back(reader.readHostOrder());
+                }
+                _graph.set_link_array(docid, level, link_array);
+            }
+        }
+    }
+    _graph.set_entry_node(entry_docid, entry_level);
+    return true;
+}
+
+}
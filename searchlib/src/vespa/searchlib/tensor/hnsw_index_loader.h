@@ -0,0 +1,25 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+class FastOS_FileInterface;
+
+namespace search::tensor {
+
+class HnswGraph;
+
+/**
+ * Implements loading of HNSW graph structure from binary format.
+ * See HnswIndexSaver for a description of the format.
+ */
+class HnswIndexLoader {
+public:
+    HnswIndexLoader(HnswGraph &graph);
+    ~HnswIndexLoader();
+    bool load(FastOS_FileInterface& file);
+
+private:
+    HnswGraph &_graph;
+};
+
+}
@@ -0,0 +1,59 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "hnsw_index_saver.h"
+#include "hnsw_graph.h"
+#include <vespa/searchlib/util/bufferwriter.h>
+
+namespace search::tensor {
+
+namespace {
+
+void
+write_uint32(BufferWriter& writer, uint32_t value)
+{
+    writer.write(&value, sizeof(uint32_t));
+}
+
+}
+
+HnswIndexSaver::HnswIndexSaver(const HnswGraph &graph)
+    : _graph(graph),
+      _node_refs(),
+      _entry_docid(0),
+      _entry_level(-1)
+{
+    auto entry = graph.get_entry_node();
+    _entry_docid = entry.docid;
+    _entry_level = entry.level;
+    size_t num_nodes = graph.node_refs.size();
+    _node_refs.reserve(num_nodes);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        _node_refs.push_back(graph.node_refs[i]);
+    }
+}
+
+HnswIndexSaver::~HnswIndexSaver() = default;
+
+void
+HnswIndexSaver::save(BufferWriter& writer) const
+{
+    write_uint32(writer, _entry_docid);
+    writer.write(&_entry_level, sizeof(int32_t));
+    uint32_t num_nodes = _node_refs.size();
+    write_uint32(writer, num_nodes);
+    for (auto node_ref : _node_refs) {
+        auto levels = _graph.nodes.get(node_ref);
+        uint32_t num_levels = levels.size();
+        write_uint32(writer, num_levels);
+        for (auto links_ref : levels) {
+            auto links = _graph.links.get(links_ref);
+            uint32_t num_links = links.size();
+            write_uint32(writer, num_links);
+            if (num_links > 0) {
+                writer.write(&links[0], sizeof(uint32_t) * num_links);
+            }
+        }
+    }
+}
+
+}
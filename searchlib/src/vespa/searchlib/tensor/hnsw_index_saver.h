@@ -0,0 +1,39 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "nearest_neighbor_index.h"
+#include <vespa/searchlib/datastore/entryref.h>
+#include <vector>
+
+namespace search::tensor {
+
+class HnswGraph;
+
+/**
+ * Implements saving of HNSW graph structure in binary format.
+ * The constructor takes a snapshot of all meta-data, but
+ * the links will be fetched from the graph in the save()
+ * method, which must run while holding a generation guard.
+ *
+ * Format: entry docid, entry level and number of nodes, followed by
+ * (for each node) the number of levels and (for each level) the
+ * number of links and the links themselves. All values are uint32_t
+ * (entry level is int32_t) in host byte order.
+ */
+class HnswIndexSaver : public NearestNeighborIndexSaver {
+public:
+    using EntryRef = datastore::EntryRef;
+
+    HnswIndexSaver(const HnswGraph &graph);
+    ~HnswIndexSaver() override;
+    void save(BufferWriter& writer) const override;
+
+private:
+    const HnswGraph &_graph;
+    std::vector<EntryRef> _node_refs;
+    uint32_t _entry_docid;
+    int32_t _entry_level;
+};
+
+}
@@ -12,6 +12,8 @@ namespace vespalib::eval { class ValueType; }
 
 namespace search::tensor {
 
+class NearestNeighborIndex;
+
 /**
  * Interface for tensor attribute used by feature executors to get information.
  */
@@ -25,6 +27,11 @@ public:
     virtual std::unique_ptr<Tensor> getEmptyTensor() const = 0;
     virtual void getTensor(uint32_t docId, vespalib::tensor::MutableDenseTensorView &tensor) const = 0;
     virtual vespalib::eval::ValueType getTensorType() const = 0;
+
+    /**
+     * Returns the index used for (approximate) nearest neighbor search, or nullptr if not present.
+     */
+    virtual const NearestNeighborIndex *nearest_neighbor_index() const { return nullptr; }
 };
 
 }  // namespace search::tensor
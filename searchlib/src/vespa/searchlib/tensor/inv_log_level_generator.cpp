@@ -0,0 +1,26 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "inv_log_level_generator.h"
+#include <cmath>
+
+namespace search::tensor {
+
+InvLogLevelGenerator::InvLogLevelGenerator(uint32_t m)
+    : _rng(0x1234deadbeef5678uLL),
+      _uniform(0.0, 1.0),
+      _level_multiplier(1.0 / std::log(std::max(m, 2u)))
+{
+}
+
+InvLogLevelGenerator::~InvLogLevelGenerator() = default;
+
+uint32_t
+InvLogLevelGenerator::max_level()
+{
+    // Use (1 - u) to avoid taking the logarithm of zero.
+    double unif = 1.0 - _uniform(_rng);
+    double r = -std::log(unif) * _level_multiplier;
+    return (uint32_t) r;
+}
+
+}
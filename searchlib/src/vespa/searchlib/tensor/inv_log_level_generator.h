@@ -0,0 +1,25 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "random_level_generator.h"
+#include <random>
+
+namespace search::tensor {
+
+/**
+ * Generates levels with an exponentially decaying probability,
+ * using the normalization factor 1/ln(m) from the hnsw paper,
+ * where m is the max number of links per node.
+ */
+class InvLogLevelGenerator : public RandomLevelGenerator {
+    std::mt19937_64 _rng;
+    std::uniform_real_distribution<double> _uniform;
+    double _level_multiplier;
+public:
+    InvLogLevelGenerator(uint32_t m);
+    ~InvLogLevelGenerator() override;
+    uint32_t max_level() override;
+};
+
+}
@@ -0,0 +1,74 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/tensor/dense/typed_cells.h>
+#include <vespa/searchlib/util/memoryusage.h>
+#include <vespa/vespalib/util/generationhandler.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class FastOS_FileInterface;
+
+namespace search { class BufferWriter; }
+
+namespace search::tensor {
+
+class DistanceFunction;
+
+/**
+ * Interface for saving a nearest neighbor index to a buffer writer.
+ *
+ * The saver is created in the attribute writer thread, while save()
+ * is called in a background thread while holding a generation guard.
+ */
+class NearestNeighborIndexSaver {
+public:
+    virtual ~NearestNeighborIndexSaver() {}
+    virtual void save(BufferWriter &writer) const = 0;
+};
+
+/**
+ * Interface for an index that is used for (approximate) nearest neighbor search.
+ */
+class NearestNeighborIndex {
+public:
+    using generation_t = vespalib::GenerationHandler::generation_t;
+    using Vector = vespalib::tensor::TypedCells;
+    struct Neighbor {
+        uint32_t docid;
+        double distance;
+        Neighbor(uint32_t id, double dist)
+          : docid(id), distance(dist)
+        {}
+        Neighbor() : docid(0), distance(0.0) {}
+    };
+    virtual ~NearestNeighborIndex() {}
+    virtual void add_document(uint32_t docid) = 0;
+    virtual void remove_document(uint32_t docid) = 0;
+    virtual void transfer_hold_lists(generation_t current_gen) = 0;
+    virtual void trim_hold_lists(generation_t first_used_gen) = 0;
+    virtual MemoryUsage memory_usage() const = 0;
+
+    /**
+     * Creates a saver that is used to save the index to binary form.
+     */
+    virtual std::unique_ptr<NearestNeighborIndexSaver> make_saver() const = 0;
+
+    /**
+     * Loads the index from the given file, positioned at the start of the serialized index.
+     * Returns false if the serialized index is not compatible with this index.
+     */
+    virtual bool load(FastOS_FileInterface &file) = 0;
+
+    /**
+     * Returns the (approximate) k nearest neighbors of the given vector, sorted by increasing distance.
+     * At least explore_k candidates are considered during the search of the lowest graph level.
+     */
+    virtual std::vector<Neighbor> find_top_k(uint32_t k, Vector vector, uint32_t explore_k) const = 0;
+
+    virtual const DistanceFunction &distance_function() const = 0;
+};
+
+}
@@ -0,0 +1,20 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace search::tensor {
+
+/**
+ * Interface for generating the max level a node should have in a hierarchical graph.
+ */
+class RandomLevelGenerator {
+public:
+    using UP = std::unique_ptr<RandomLevelGenerator>;
+    virtual ~RandomLevelGenerator() {}
+    virtual uint32_t max_level() = 0;
+};
+
+}
@@ -4,7 +4,7 @@
 #include <vespa/document/base/exceptions.h>
 #include <vespa/document/datatype/tensor_data_type.h>
 #include <vespa/eval/eval/simple_tensor.h>
-#include <vespa/eval/tensor/dense/dense_tensor.h>
+#include <vespa/eval/tensor/dense/typed_dense_tensor.h>
 #include <vespa/eval/tensor/sparse/sparse_tensor.h>
 #include <vespa/eval/tensor/wrapped_simple_tensor.h>
 #include <vespa/searchlib/common/rcuvector.hpp>
@@ -12,7 +12,6 @@
 using vespalib::eval::SimpleTensor;
 using vespalib::eval::ValueType;
 using vespalib::tensor::Tensor;
-using vespalib::tensor::DenseTensor;
 using vespalib::tensor::SparseTensor;
 using vespalib::tensor::WrappedSimpleTensor;
 using document::TensorDataType;
@@ -41,7 +40,7 @@ createEmptyTensorType(const ValueType &type)
             list.emplace_back(dim);
         }
     }
-    return ValueType::tensor_type(std::move(list));
+    return ValueType::tensor_type(std::move(list), type.cell_type());
 }
 
 Tensor::UP
@@ -54,7 +53,7 @@ createEmptyTensor(const ValueType &type)
         for (const auto &dimension : type.dimensions()) {
             size *= dimension.size;
         }
-        return std::make_unique<DenseTensor>(type, DenseTensor::Cells(size));
+        return vespalib::tensor::create_dense_tensor(type, std::vector<double>(size));
     } else {
         return std::make_unique<WrappedSimpleTensor>(std::make_unique<SimpleTensor>(type, SimpleTensor::Cells()));
     }
@@ -121,12 +120,19 @@ TensorAttribute::onCommit()
 }
 
 
+MemoryUsage
+TensorAttribute::memory_usage() const
+{
+    MemoryUsage result = _refVector.getMemoryUsage();
+    result.merge(_tensorStore.getMemoryUsage());
+    return result;
+}
+
 void
 TensorAttribute::onUpdateStat()
 {
     // update statistics
-    MemoryUsage total = _refVector.getMemoryUsage();
-    total.merge(_tensorStore.getMemoryUsage());
+    MemoryUsage total = memory_usage();
     total.mergeGenerationHeldBytes(getGenerationHolder().getHeldBytes());
     this->updateStatistics(_refVector.size(),
                            _refVector.size(),
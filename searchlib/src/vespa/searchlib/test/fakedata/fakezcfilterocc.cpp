@@ -93,7 +93,8 @@ FakeZcFilterOcc::FakeZcFilterOcc(const FakeWord &fw)
       _compressedMalloc(NULL),
       _featuresSize(0),
       _fieldsParams(fw.getFieldsParams()),
-      _bigEndian(true)
+      _bigEndian(true),
+      _blockDocIds(false)
 {
     setup(fw, false, true);
 }
@@ -115,7 +116,8 @@ FakeZcFilterOcc::FakeZcFilterOcc(const FakeWord &fw,
       _compressed(std::make_pair(static_cast<uint64_t *>(NULL), 0)),
       _featuresSize(0),
       _fieldsParams(fw.getFieldsParams()),
-      _bigEndian(bigEndian)
+      _bigEndian(bigEndian),
+      _blockDocIds(false)
 {
     // subclass responsible for calling setup(fw, false/true);
 }
@@ -163,6 +165,7 @@ FakeZcFilterOcc::setupT(const FakeWord &fw, bool doFeatures,
     params.set("docIdLimit", fw._docIdLimit);
     params.set("minChunkDocs", 1000000000); // Disable chunking
     params.set("minSkipDocs", 1u);          // Force skip info
+    params.set("blockDocIds", _blockDocIds);
     writer.set_posting_list_params(params);
     auto &writeContext = writer.get_write_context();
     search::ComprBuffer &cb = writeContext;
@@ -1279,6 +1282,7 @@ class FakeZcSkipPosOcc : public FakeZcFilterOcc
     search::index::PostingListCounts _counts;
 public:
     FakeZcSkipPosOcc(const FakeWord &fw);
+    FakeZcSkipPosOcc(const FakeWord &fw, bool blockDocIds, const char *nameSuffix);
     ~FakeZcSkipPosOcc();
 
     size_t bitSize() const override;
@@ -1297,6 +1301,16 @@ FakeZcSkipPosOcc<bigEndian>::FakeZcSkipPosOcc(const FakeWord &fw)
 }
 
 
+template <bool bigEndian>
+FakeZcSkipPosOcc<bigEndian>::FakeZcSkipPosOcc(const FakeWord &fw, bool blockDocIds, const char *nameSuffix)
+    : FakeZcFilterOcc(fw, bigEndian, nameSuffix)
+{
+    _blockDocIds = blockDocIds;
+    setup(fw, true, true);
+    _counts._bitLength = _compressedBits;
+}
+
+
 template <bool bigEndian>
 FakeZcSkipPosOcc<bigEndian>::~FakeZcSkipPosOcc()
 {
@@ -1326,13 +1340,36 @@ FakeZcSkipPosOcc<bigEndian>::
 createIterator(const TermFieldMatchDataArray &matchData) const
 {
     return new ZcPosOccIterator<bigEndian>(Position(_compressed.first, 0), _compressedBits, _docIdLimit,
-                                           static_cast<uint32_t>(-1),
+                                           static_cast<uint32_t>(-1), _blockDocIds,
                                            _counts,
                                            &_fieldsParams,
                                            matchData);
 }
 
 
+template <bool bigEndian>
+class FakeZcBlockSkipPosOcc : public FakeZcSkipPosOcc<bigEndian>
+{
+public:
+    FakeZcBlockSkipPosOcc(const FakeWord &fw);
+    ~FakeZcBlockSkipPosOcc();
+};
+
+
+template <bool bigEndian>
+FakeZcBlockSkipPosOcc<bigEndian>::FakeZcBlockSkipPosOcc(const FakeWord &fw)
+    : FakeZcSkipPosOcc<bigEndian>(fw, true,
+                                  bigEndian ? ".zcblockskipposoccbe" : ".zcblockskipposoccle")
+{
+}
+
+
+template <bool bigEndian>
+FakeZcBlockSkipPosOcc<bigEndian>::~FakeZcBlockSkipPosOcc()
+{
+}
+
+
 template <bool bigEndian>
 class FakeZc2SkipPosOcc : public FakeZcFilterOcc
 {
@@ -1385,7 +1422,7 @@ FakeZc2SkipPosOcc<bigEndian>::
 createIterator(const TermFieldMatchDataArray &matchData) const
 {
     return new Zc4PosOccIterator<bigEndian>(Position(_compressed.first, 0), _compressedBits, _docIdLimit,
-                                            static_cast<uint32_t>(-1), _counts, &_fieldsParams, matchData);
+                                            static_cast<uint32_t>(-1), false, _counts, &_fieldsParams, matchData);
 }
 
 
@@ -1418,6 +1455,16 @@ initSkipPosle(std::make_pair("ZcSkipPosOccLE",
                              makeFPFactory<FPFactoryT<FakeZcSkipPosOcc<false> > >));
 
 
+static FPFactoryInit
+initBlockSkipPosbe(std::make_pair("ZcBlockSkipPosOccBE",
+                                  makeFPFactory<FPFactoryT<FakeZcBlockSkipPosOcc<true> > >));
+
+
+static FPFactoryInit
+initBlockSkipPosle(std::make_pair("ZcBlockSkipPosOccLE",
+                                  makeFPFactory<FPFactoryT<FakeZcBlockSkipPosOcc<false> > >));
+
+
 static FPFactoryInit
 initSkipPos0be(std::make_pair("Zc2SkipPosOccBE",
                               makeFPFactory<FPFactoryT<FakeZc2SkipPosOcc<true> > >));
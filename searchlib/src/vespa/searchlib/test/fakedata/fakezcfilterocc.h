@@ -31,6 +31,7 @@ protected:
     uint64_t _featuresSize;
     const search::bitcompression::PosOccFieldsParams &_fieldsParams;
     bool _bigEndian;
+    bool _blockDocIds;
 protected:
     void setup(const FakeWord &fw, bool doFeatures, bool dynamicK);
 
@@ -53,6 +53,9 @@ bool Packet::merge(const Packet & packet)
 {
     bool retval(_range.to() < packet._range.from());
     if (retval) {
+        if (_count == 0) {
+            _range.from(packet._range.from());
+        }
         _count += packet._count;
         _range.to(packet._range.to());
         _buf.write(packet.getHandle().c_str(), packet.getHandle().size());
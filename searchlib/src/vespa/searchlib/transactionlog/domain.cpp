@@ -3,6 +3,7 @@
 #include "domain.h"
 #include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/vespalib/util/closuretask.h>
+#include <vespa/vespalib/util/lambdatask.h>
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/fastos/file.h>
 #include <algorithm>
@@ -26,8 +27,10 @@ namespace search::transactionlog {
 
 Domain::Domain(const string &domainName, const string & baseDir, Executor & commitExecutor,
                Executor & sessionExecutor, uint64_t domainPartSize, DomainPart::Crc defaultCrcType,
+               const DomainPart::CompressionConfig &compression, const CommitConfig &commitConfig,
                const FileHeaderContext &fileHeaderContext) :
     _defaultCrcType(defaultCrcType),
+    _compression(compression),
     _commitExecutor(commitExecutor),
     _sessionExecutor(sessionExecutor),
     _sessionId(1),
@@ -42,7 +45,17 @@ Domain::Domain(const string &domainName, const string & baseDir, Executor & comm
     _maxSessionRunTime(),
     _baseDir(baseDir),
     _fileHeaderContext(fileHeaderContext),
-    _markedDeleted(false)
+    _markedDeleted(false),
+    _commitConfig(commitConfig),
+    _commitLock(),
+    _commitCond(),
+    _lastSerial(0),
+    _pendingPacket(std::make_unique<Packet>()),
+    _pendingCallbacks(),
+    _pendingSince(),
+    _commitRunning(false),
+    _preallocating(false),
+    _nextPartPreallocated(false)
 {
     int retval(0);
     if ((retval = makeDirectory(_baseDir.c_str())) != 0) {
@@ -60,13 +73,15 @@ Domain::Domain(const string &domainName, const string & baseDir, Executor & comm
     }
     _sessionExecutor.sync();
     if (_parts.empty() || _parts.crbegin()->second->isClosed()) {
-        _parts[lastPart] = std::make_shared<DomainPart>(_name, dir(), lastPart, _defaultCrcType, _fileHeaderContext, false);
+        _parts[lastPart] = std::make_shared<DomainPart>(_name, dir(), lastPart, _defaultCrcType, _compression, _fileHeaderContext, false);
         vespalib::File::sync(dir());
     }
+    _lastSerial = end();
+    preallocateNextPart();
 }
 
 void Domain::addPart(int64_t partId, bool isLastPart) {
-    auto dp = std::make_shared<DomainPart>(_name, dir(), partId, _defaultCrcType, _fileHeaderContext, isLastPart);
+    auto dp = std::make_shared<DomainPart>(_name, dir(), partId, _defaultCrcType, _compression, _fileHeaderContext, isLastPart);
     if (dp->size() == 0) {
         // Only last domain part is allowed to be truncated down to
         // empty size.
@@ -104,7 +119,25 @@ private:
     bool              & _pendingSync;
 };
 
-Domain::~Domain() { }
+class Close : public vespalib::Executor::Task
+{
+public:
+    Close(const DomainPart::SP &dp) :
+        _dp(dp)
+    { }
+private:
+    void run() override {
+        _dp->close();
+    }
+
+    DomainPart::SP _dp;
+};
+
+Domain::~Domain()
+{
+    std::unique_lock<std::mutex> guard(_commitLock);
+    _commitCond.wait(guard, [this]() { return ! _commitRunning && ! _preallocating; });
+}
 
 DomainInfo
 Domain::getDomainInfo() const
@@ -178,20 +211,19 @@ Domain::getSynced() const
 {
     SerialNum s(0);
     LockGuard guard(_lock);
-    if (_parts.empty()) {
-        return s;
-    }
-    DomainPartList::const_iterator it(_parts.end());
-    --it;
-    s = it->second->getSynced();
-    if (s == 0 && it != _parts.begin()) {
-        --it;
-        s = it->second->getSynced();
+    // Parts are closed in the background after rollover, possibly out of order.
+    // Nothing beyond the first part that is not fully synced can be reported as synced.
+    for (const auto &entry : _parts) {
+        const DomainPart &part = *entry.second;
+        SerialNum synced = part.getSynced();
+        s = std::max(s, synced);
+        if (synced < part.range().to()) {
+            break;
+        }
     }
     return s;
 }
 
-
 void
 Domain::triggerSyncNow()
 {
@@ -267,41 +299,111 @@ void Domain::cleanSessions()
     }
 }
 
-namespace {
-
-void waitPendingSync(vespalib::Monitor &syncMonitor, bool &pendingSync)
+void Domain::commit(const Packet & packet, Writer::DoneCallback onDone)
 {
-    MonitorGuard guard(syncMonitor);
-    while (pendingSync) {
-        guard.wait();
+    if (packet.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(_commitLock);
+    if (packet.range().from() <= _lastSerial) {
+        throw runtime_error(make_string("Incomming serial number(%" PRIu64 ") must be bigger than the last one (%" PRIu64 ").",
+                                        packet.range().from(), _lastSerial));
+    }
+    _lastSerial = packet.range().to();
+    if (_pendingPacket->empty()) {
+        _pendingSince = std::chrono::steady_clock::now();
+    }
+    _pendingPacket->merge(packet);
+    _pendingCallbacks.push_back(std::move(onDone));
+    if (_commitRunning) {
+        // Joins the next write. Wake the writer if it waits for the chunk to fill up.
+        if (_pendingPacket->sizeBytes() >= _commitConfig.chunkSizeLimit) {
+            _commitCond.notify_all();
+        }
+        return;
+    }
+    _commitRunning = true;
+    guard.unlock();
+    auto rejected = _commitExecutor.execute(vespalib::makeLambdaTask([this]() { commitPending(); }));
+    if (rejected) {
+        rejected->run();
     }
 }
 
+void Domain::commitPending()
+{
+    std::unique_lock<std::mutex> guard(_commitLock);
+    while ( ! _pendingPacket->empty()) {
+        auto deadline = _pendingSince + std::chrono::duration_cast<std::chrono::steady_clock::duration>(_commitConfig.chunkAgeLimit);
+        _commitCond.wait_until(guard, deadline, [this]() { return _pendingPacket->sizeBytes() >= _commitConfig.chunkSizeLimit; });
+        std::unique_ptr<Packet> packet = std::move(_pendingPacket);
+        _pendingPacket = std::make_unique<Packet>();
+        std::vector<Writer::DoneCallback> callbacks;
+        callbacks.swap(_pendingCallbacks);
+        guard.unlock();
+        commitChunk(*packet);
+        callbacks.clear();
+        guard.lock();
+    }
+    _commitRunning = false;
+    _commitCond.notify_all();
 }
 
-void Domain::commit(const Packet & packet)
+void Domain::commitChunk(const Packet & packet)
 {
     DomainPart::SP dp(_parts.rbegin()->second);
     vespalib::nbostream_longlivedbuf is(packet.getHandle().c_str(), packet.getHandle().size());
     Packet::Entry entry;
     entry.deserialize(is);
     if (dp->byteSize() > _domainPartSize) {
-        waitPendingSync(_syncMonitor, _pendingSync);
-        triggerSyncNow();
-        waitPendingSync(_syncMonitor, _pendingSync);
-        dp->close();
-        dp = std::make_shared<DomainPart>(_name, dir(), entry.serial(), _defaultCrcType, _fileHeaderContext, false);
+        _commitExecutor.execute(std::make_unique<Close>(dp));
+        bool usePreallocated(false);
+        {
+            std::lock_guard<std::mutex> guard(_commitLock);
+            std::swap(usePreallocated, _nextPartPreallocated);
+        }
+        dp = std::make_shared<DomainPart>(_name, dir(), entry.serial(), _defaultCrcType, _compression, _fileHeaderContext,
+                                          false, usePreallocated);
         {
             LockGuard guard(_lock);
             _parts[entry.serial()] = dp;
         }
         dp = _parts.rbegin()->second;
-        vespalib::File::sync(dir());
+        if ( ! usePreallocated) {
+            vespalib::File::sync(dir());
+        }
+        preallocateNextPart();
     }
     dp->commit(entry.serial(), packet);
+    if (_commitConfig.fsync) {
+        dp->sync();
+    }
     cleanSessions();
 }
 
+void Domain::preallocateNextPart()
+{
+    {
+        std::lock_guard<std::mutex> guard(_commitLock);
+        if (_preallocating || _nextPartPreallocated) {
+            return;
+        }
+        _preallocating = true;
+    }
+    auto rejected = _commitExecutor.execute(vespalib::makeLambdaTask([this]() {
+        bool ready = DomainPart::preallocate(_name, dir());
+        std::lock_guard<std::mutex> guard(_commitLock);
+        _nextPartPreallocated = ready;
+        _preallocating = false;
+        _commitCond.notify_all();
+    }));
+    if (rejected) {
+        std::lock_guard<std::mutex> guard(_commitLock);
+        _preallocating = false;
+        _commitCond.notify_all();
+    }
+}
+
 bool Domain::erase(SerialNum to)
 {
     bool retval(true);
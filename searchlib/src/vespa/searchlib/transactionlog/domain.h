@@ -5,6 +5,8 @@
 #include "session.h"
 #include <vespa/vespalib/util/threadexecutor.h>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 
 namespace search::transactionlog {
 
@@ -35,6 +37,19 @@ struct DomainInfo {
 
 typedef std::map<vespalib::string, DomainInfo> DomainStats;
 
+/**
+ * Controls how commits are grouped into writes to the domain.
+ **/
+struct CommitConfig {
+    using DurationSeconds = std::chrono::duration<double>;
+    size_t          chunkSizeLimit; // Pending bytes that are written without waiting for more commits.
+    DurationSeconds chunkAgeLimit;  // Max time the oldest pending commit waits for more to join it.
+    bool            fsync;          // Sync the part before releasing the commits of a write.
+    CommitConfig() : chunkSizeLimit(256000), chunkAgeLimit(0), fsync(false) {}
+    CommitConfig(size_t chunkSizeLimit_in, DurationSeconds chunkAgeLimit_in, bool fsync_in)
+        : chunkSizeLimit(chunkSizeLimit_in), chunkAgeLimit(chunkAgeLimit_in), fsync(fsync_in) {}
+};
+
 class Domain
 {
 public:
@@ -42,6 +57,7 @@ public:
     using Executor = vespalib::ThreadExecutor;
     Domain(const vespalib::string &name, const vespalib::string &baseDir, Executor & commitExecutor,
            Executor & sessionExecutor, uint64_t domainPartSize, DomainPart::Crc defaultCrcType,
+           const DomainPart::CompressionConfig &compression, const CommitConfig &commitConfig,
            const common::FileHeaderContext &fileHeaderContext);
 
     virtual ~Domain();
@@ -50,7 +66,13 @@ public:
     const vespalib::string & name() const { return _name; }
     bool erase(SerialNum to);
 
-    void commit(const Packet & packet);
+    /**
+     * Queues the packet to be written. Packets committed while an earlier
+     * write is in progress or within the chunk age limit are written
+     * together. onDone is released when the packet has been written, and
+     * synced if that is configured.
+     */
+    void commit(const Packet & packet, Writer::DoneCallback onDone);
     int visit(const Domain::SP & self, SerialNum from, SerialNum to, std::unique_ptr<Session::Destination> dest);
 
     SerialNum begin() const;
@@ -86,6 +108,9 @@ private:
     void cleanSessions();
     vespalib::string dir() const { return getDir(_baseDir, _name); }
     void addPart(int64_t partId, bool isLastPart);
+    void commitPending();
+    void commitChunk(const Packet & packet);
+    void preallocateNextPart();
 
     using SerialNumList = std::vector<SerialNum>;
 
@@ -96,6 +121,7 @@ private:
     using DurationSeconds = std::chrono::duration<double>;
 
     DomainPart::Crc     _defaultCrcType;
+    DomainPart::CompressionConfig _compression;
     Executor          & _commitExecutor;
     Executor          & _sessionExecutor;
     std::atomic<int>    _sessionId;
@@ -111,6 +137,17 @@ private:
     vespalib::string    _baseDir;
     const common::FileHeaderContext &_fileHeaderContext;
     bool                _markedDeleted;
+    const CommitConfig  _commitConfig;
+    std::mutex          _commitLock;
+    std::condition_variable _commitCond;
+    // Protected by _commitLock
+    SerialNum           _lastSerial;
+    std::unique_ptr<Packet> _pendingPacket;
+    std::vector<Writer::DoneCallback> _pendingCallbacks;
+    std::chrono::steady_clock::time_point _pendingSince;
+    bool                _commitRunning;
+    bool                _preallocating;
+    bool                _nextPartPreallocated;
 };
 
 }
@@ -2,8 +2,10 @@
 
 #include "domainpart.h"
 #include <vespa/vespalib/util/crc.h>
+#include <vespa/vespalib/util/compressor.h>
 #include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/vespalib/data/fileheader.h>
+#include <vespa/vespalib/io/fileutil.h>
 #include <vespa/searchlib/common/fileheadercontext.h>
 #include <vespa/fastlib/io/bufferedfile.h>
 #include <xxhash.h>
@@ -27,6 +29,14 @@ namespace search::transactionlog {
 
 namespace {
 
+/*
+ * The first byte of each entry holds the crc type in the low bits and,
+ * for compressed entries, the compression type in the high bits.
+ */
+constexpr uint8_t CRC_MASK = 0x0f;
+constexpr uint8_t COMPRESSION_SHIFT = 4;
+constexpr size_t ENTRY_FRAMING_SIZE = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(int32_t);
+
 void
 handleSync(FastOS_FileInterface &file) __attribute__ ((noinline));
 
@@ -266,8 +276,10 @@ DomainPart::buildPacketMapping(bool allowTruncate)
 }
 
 DomainPart::DomainPart(const string & name, const string & baseDir, SerialNum s, Crc defaultCrc,
-                       const FileHeaderContext &fileHeaderContext, bool allowTruncate) :
+                       const CompressionConfig &compression, const FileHeaderContext &fileHeaderContext,
+                       bool allowTruncate, bool usePreallocated) :
     _defaultCrc(defaultCrc),
+    _compression(compression),
     _lock(),
     _fileLock(),
     _range(s),
@@ -278,6 +290,7 @@ DomainPart::DomainPart(const string & name, const string & baseDir, SerialNum s,
     _transLog(std::make_unique<FastOS_File>(_fileName.c_str())),
     _skipList(),
     _headerLen(0),
+    _pendingDirSync(),
     _writeLock(),
     _writtenSerial(0),
     _syncedSerial(0)
@@ -299,6 +312,14 @@ DomainPart::DomainPart(const string & name, const string & baseDir, SerialNum s,
         }
         _byteSize = currPos;
     } else {
+        if (usePreallocated) {
+            string preallocated(preallocatedFileName(name, baseDir));
+            if ( ! FastOS_File::Rename(preallocated.c_str(), _fileName.c_str())) {
+                LOG(warning, "Failed renaming preallocated file '%s' to '%s': %s. Creating it instead.",
+                    preallocated.c_str(), _fileName.c_str(), getLastErrorString().c_str());
+            }
+            _pendingDirSync = baseDir;
+        }
         if ( ! _transLog->OpenWriteOnly()) {
             string e(make_string("Failed opening new file '%s' for writing: '%s'", _transLog->GetFileName(), getLastErrorString().c_str()));
 
@@ -312,7 +333,9 @@ DomainPart::DomainPart(const string & name, const string & baseDir, SerialNum s,
         throw runtime_error(make_string("Failed moving write pointer to the end of the file %s(%" PRIu64 ").",
                                         _transLog->GetFileName(), _transLog->GetSize()));
     }
-    handleSync(*_transLog);
+    if (_pendingDirSync.empty()) {
+        handleSync(*_transLog);
+    }
     _writtenSerial = _range.to();
     _syncedSerial = _writtenSerial;
 }
@@ -342,11 +365,12 @@ DomainPart::close()
     {
         LockGuard guard(_fileLock);
         /*
-         * Sync old domainpart before starting writing new, to avoid
-         * hole.  XXX: Feed latency spike due to lack of delayed open
-         * for new domainpart.
+         * Sync before closing, to avoid hole. The domain closes old
+         * domainparts in the background and does not report the new
+         * domainpart as synced until this has completed.
          */
         handleSync(*_transLog);
+        syncDirIfPending();
         _transLog->dropFromCache();
         retval = _transLog->Close();
         LockGuard wguard(_writeLock);
@@ -363,6 +387,41 @@ DomainPart::close()
     return retval;
 }
 
+void
+DomainPart::syncDirIfPending()
+{
+    // The name of a part that took over a preallocated file is only durable once its directory is synced.
+    if ( ! _pendingDirSync.empty()) {
+        vespalib::File::sync(_pendingDirSync);
+        _pendingDirSync.clear();
+    }
+}
+
+string
+DomainPart::preallocatedFileName(const string &name, const string &baseDir)
+{
+    return make_string("%s/%s-next", baseDir.c_str(), name.c_str());
+}
+
+bool
+DomainPart::preallocate(const string &name, const string &baseDir)
+{
+    FastOS_File file(preallocatedFileName(name, baseDir).c_str());
+    if ( ! file.OpenWriteOnlyTruncate()) {
+        LOG(warning, "Failed creating preallocated file '%s': %s", file.GetFileName(), getLastErrorString().c_str());
+        return false;
+    }
+    try {
+        handleSync(file);
+        file.Close();
+        vespalib::File::sync(baseDir);
+    } catch (const std::exception &e) {
+        LOG(warning, "Failed syncing preallocated file '%s': %s", file.GetFileName(), e.what());
+        return false;
+    }
+    return true;
+}
+
 bool
 DomainPart::isClosed() const {
     return ! _transLog->IsOpened();
@@ -404,24 +463,28 @@ DomainPart::commit(SerialNum firstSerial, const Packet &packet)
 {
     int64_t firstPos(_transLog->GetPosition());
     nbostream_longlivedbuf h(packet.getHandle().c_str(), packet.getHandle().size());
-    if (_range.from() == 0) {
-        _range.from(firstSerial);
-    }
+    nbostream os(packet.getHandle().size() + packet.size() * ENTRY_FRAMING_SIZE);
+    Packet::Entry entry;
+    SerialNum lastSerial(_range.to());
+    size_t numEntries(0);
     for (size_t i(0); h.size() > 0; i++) {
-        //LOG(spam,
-        //"Pos(%d) Len(%d), Lim(%d), Remaining(%d)",
-        //h.getPos(), h.getLength(), h.getLimit(), h.getRemaining());
-        Packet::Entry entry;
         entry.deserialize(h);
-        if (_range.to() < entry.serial()) {
-            write(*_transLog, entry);
-            _sz++;
-            _range.to(entry.serial());
+        if (lastSerial < entry.serial()) {
+            encode(os, entry);
+            numEntries++;
+            lastSerial = entry.serial();
         } else {
             throw runtime_error(make_string("Incomming serial number(%" PRIu64 ") must be bigger than the last one (%" PRIu64 ").",
-                                            entry.serial(), _range.to()));
+                                            entry.serial(), lastSerial));
         }
     }
+    // All entries in the packet are written with a single write call.
+    write(*_transLog, entry, os);
+    if (_range.from() == 0) {
+        _range.from(firstSerial);
+    }
+    _sz += numEntries;
+    _range.to(lastSerial);
 
     bool merged(false);
     LockGuard guard(_lock);
@@ -450,6 +513,7 @@ void DomainPart::sync()
     }
     LockGuard guard(_fileLock);
     handleSync(*_transLog);
+    syncDirIfPending();
     LockGuard wguard(_writeLock);
     if (_syncedSerial < syncSerial) {
         _syncedSerial = syncSerial;
@@ -574,28 +638,44 @@ DomainPart::visit(FastOS_FileInterface &file, SerialNumRange &r, Packet &packet)
 }
 
 void
-DomainPart::write(FastOS_FileInterface &file, const Packet::Entry &entry)
+DomainPart::encode(nbostream &os, const Packet::Entry &entry) const
 {
-    int64_t lastKnownGoodPos(file.GetPosition());
-    int32_t crc(0);
-    uint32_t len(entry.serializedSize() + sizeof(crc));
-    nbostream os;
+    size_t start(os.size());
+    if (_compression.useCompression()) {
+        nbostream raw(entry.serializedSize());
+        entry.serialize(raw);
+        vespalib::compression::Compress compressed(_compression, raw.c_str(), raw.size());
+        if (compressed.type() != CompressionConfig::NONE) {
+            uint32_t len(sizeof(uint32_t) + compressed.size() + sizeof(int32_t));
+            os << static_cast<uint8_t>(_defaultCrc | (compressed.type() << COMPRESSION_SHIFT));
+            os << len;
+            size_t payloadStart(os.size());
+            os << static_cast<uint32_t>(raw.size());
+            os.write(compressed.data(), compressed.size());
+            os << calcCrc(_defaultCrc, os.c_str() + payloadStart, os.size() - payloadStart);
+            assert(os.size() - start == len + sizeof(len) + sizeof(uint8_t));
+            return;
+        }
+    }
+    uint32_t len(entry.serializedSize() + sizeof(int32_t));
     os << static_cast<uint8_t>(_defaultCrc);
     os << len;
-    size_t start(os.size());
+    size_t payloadStart(os.size());
     entry.serialize(os);
-    size_t end(os.size());
-    crc = calcCrc(_defaultCrc, os.c_str()+start, end - start);
-    os << crc;
-    size_t osSize = os.size();
-    assert(osSize == len + sizeof(len) + sizeof(uint8_t));
+    os << calcCrc(_defaultCrc, os.c_str() + payloadStart, os.size() - payloadStart);
+    assert(os.size() - start == len + sizeof(len) + sizeof(uint8_t));
+}
 
+void
+DomainPart::write(FastOS_FileInterface &file, const Packet::Entry &lastEntry, const nbostream &os)
+{
+    int64_t lastKnownGoodPos(file.GetPosition());
     LockGuard guard(_writeLock);
-    if ( ! file.CheckedWrite(os.c_str(), osSize) ) {
-        throw runtime_error(handleWriteError("Failed writing the entry.", file, lastKnownGoodPos, entry, end - start));
+    if ( ! file.CheckedWrite(os.c_str(), os.size()) ) {
+        throw runtime_error(handleWriteError("Failed writing the entries.", file, lastKnownGoodPos, lastEntry, os.size()));
     }
-    _writtenSerial = entry.serial();
-    _byteSize.store(lastKnownGoodPos + osSize, std::memory_order_release);
+    _writtenSerial = lastEntry.serial();
+    _byteSize.store(lastKnownGoodPos + os.size(), std::memory_order_release);
 }
 
 bool
@@ -613,8 +693,12 @@ DomainPart::read(FastOS_FileInterface &file,
     uint32_t len(0);
     his >> version >> len;
     if ((retval = (rlen == sizeof(tmp)))) {
-        if ( ! (retval = (version == ccitt_crc32) || version == xxh64)) {
-            string msg(make_string("Version mismatch. Expected 'ccitt_crc32=1' or 'xxh64=2',"
+        uint8_t crcVersion(version & CRC_MASK);
+        auto compression(static_cast<CompressionConfig::Type>(version >> COMPRESSION_SHIFT));
+        if ( ! (retval = ((crcVersion == ccitt_crc32) || (crcVersion == xxh64)) &&
+                         ((compression == CompressionConfig::NONE) || CompressionConfig::isCompressed(compression))))
+        {
+            string msg(make_string("Version mismatch. Expected 'ccitt_crc32=1' or 'xxh64=2', optionally compressed,"
                                              " got %d from '%s' at position %" PRId64,
                                              version, file.GetFileName(), lastKnownGoodPos));
             if ((version == 0) && (len == 0) && tailOfFileIsZero(file, lastKnownGoodPos)) {
@@ -632,16 +716,27 @@ DomainPart::read(FastOS_FileInterface &file,
         if (!retval) {
             retval = handleReadError("packet blob", file, len, rlen, lastKnownGoodPos, allowTruncate);
         } else {
-            nbostream_longlivedbuf is(buf.get(), len);
-            entry.deserialize(is);
             int32_t crc(0);
-            is >> crc;
-            int32_t crcVerify(calcCrc(static_cast<Crc>(version), buf.get(), len - sizeof(crc)));
+            nbostream_longlivedbuf crcis(static_cast<const char *>(buf.get()) + len - sizeof(crc), sizeof(crc));
+            crcis >> crc;
+            int32_t crcVerify(calcCrc(static_cast<Crc>(crcVersion), buf.get(), len - sizeof(crc)));
             if (crc != crcVerify) {
                 throw runtime_error(make_string("Got bad crc for packet from '%s' (len pos=%" PRId64 ", len=%d) : crcVerify = %d, expected %d",
                                                 file.GetFileName(), file.GetPosition() - len - sizeof(len),
                                                 static_cast<int>(len), static_cast<int>(crcVerify), static_cast<int>(crc)));
             }
+            if (compression != CompressionConfig::NONE) {
+                nbostream_longlivedbuf cis(buf.get(), len - sizeof(crc));
+                uint32_t uncompressedLen(0);
+                cis >> uncompressedLen;
+                vespalib::compression::Decompress decompressed(compression, uncompressedLen, cis.peek(), cis.size());
+                Alloc uncompressed(Alloc::alloc(std::max(static_cast<size_t>(uncompressedLen), buf.size())));
+                memcpy(uncompressed.get(), decompressed.data(), decompressed.size());
+                uncompressed.swap(buf);
+                len = uncompressedLen + sizeof(crc);
+            }
+            nbostream_longlivedbuf is(buf.get(), len - sizeof(crc));
+            entry.deserialize(is);
         }
     } else {
         if (rlen == 0) {
@@ -4,6 +4,7 @@
 #include "common.h"
 #include <vespa/vespalib/util/sync.h>
 #include <vespa/vespalib/util/memory.h>
+#include <vespa/vespalib/util/compressionconfig.h>
 #include <map>
 #include <vector>
 #include <atomic>
@@ -23,9 +24,16 @@ public:
         ccitt_crc32=1,
         xxh64=2
     };
+    using CompressionConfig = vespalib::compression::CompressionConfig;
     typedef std::shared_ptr<DomainPart> SP;
+    /**
+     * A new part with usePreallocated set takes over the file made by
+     * preallocate() instead of creating one. Neither the file nor the
+     * directory is synced then; that is left to the first sync() or close().
+     */
     DomainPart(const vespalib::string &name, const vespalib::string &baseDir, SerialNum s, Crc defaultCrc,
-               const common::FileHeaderContext &FileHeaderContext, bool allowTruncate);
+               const CompressionConfig &compression, const common::FileHeaderContext &FileHeaderContext,
+               bool allowTruncate, bool usePreallocated = false);
 
     ~DomainPart();
 
@@ -48,13 +56,23 @@ public:
         return _byteSize.load(std::memory_order_acquire);
     }
     bool        isClosed() const;
+
+    /**
+     * Creates and syncs an empty file for the next part of the domain,
+     * under a name that is not picked up as a part when scanning the
+     * domain directory. Returns false if the file could not be made ready.
+     */
+    static bool preallocate(const vespalib::string &name, const vespalib::string &baseDir);
+    static vespalib::string preallocatedFileName(const vespalib::string &name, const vespalib::string &baseDir);
 private:
+    void syncDirIfPending();
     bool openAndFind(FastOS_FileInterface &file, const SerialNum &from);
     int64_t buildPacketMapping(bool allowTruncate);
 
     static bool read(FastOS_FileInterface &file, Packet::Entry &entry, vespalib::alloc::Alloc &buf, bool allowTruncate);
 
-    void write(FastOS_FileInterface &file, const Packet::Entry &entry);
+    void encode(vespalib::nbostream &os, const Packet::Entry &entry) const;
+    void write(FastOS_FileInterface &file, const Packet::Entry &lastEntry, const vespalib::nbostream &os);
     static int32_t calcCrc(Crc crc, const void * buf, size_t len);
     void writeHeader(const common::FileHeaderContext &fileHeaderContext);
 
@@ -78,6 +96,7 @@ private:
     typedef std::vector<SkipInfo> SkipList;
     typedef std::map<SerialNum, Packet> PacketList;
     const Crc      _defaultCrc;
+    const CompressionConfig _compression;
     vespalib::Lock _lock;
     vespalib::Lock _fileLock;
     SerialNumRange _range;
@@ -88,6 +107,8 @@ private:
     std::unique_ptr<FastOS_FileInterface> _transLog;
     SkipList       _skipList;
     uint32_t       _headerLen;
+    // Protected by _fileLock
+    vespalib::string _pendingDirSync;
     vespalib::Lock _writeLock;
     // Protected by _writeLock
     SerialNum      _writtenSerial;
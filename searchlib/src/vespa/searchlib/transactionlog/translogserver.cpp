@@ -1,8 +1,10 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 #include "translogserver.h"
+#include <vespa/searchlib/common/gatecallback.h>
 #include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/vespalib/io/fileutil.h>
 #include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/sync.h>
 #include <vespa/fnet/frt/supervisor.h>
 #include <vespa/fnet/frt/rpcrequest.h>
 #include <vespa/fnet/task.h>
@@ -77,17 +79,21 @@ TransLogServer::TransLogServer(const vespalib::string &name, int listenPort, con
 
 TransLogServer::TransLogServer(const vespalib::string &name, int listenPort, const vespalib::string &baseDir,
                                const FileHeaderContext &fileHeaderContext, uint64_t domainPartSize)
-    : TransLogServer(name, listenPort, baseDir, fileHeaderContext, domainPartSize, 4, DomainPart::Crc::xxh64)
+    : TransLogServer(name, listenPort, baseDir, fileHeaderContext, domainPartSize, 4, DomainPart::Crc::xxh64,
+                     DomainPart::CompressionConfig(), CommitConfig())
 {}
 
 TransLogServer::TransLogServer(const vespalib::string &name, int listenPort, const vespalib::string &baseDir,
                                const FileHeaderContext &fileHeaderContext, uint64_t domainPartSize,
-                               size_t maxThreads, DomainPart::Crc defaultCrcType)
+                               size_t maxThreads, DomainPart::Crc defaultCrcType,
+                               const DomainPart::CompressionConfig &compression, const CommitConfig &commitConfig)
     : FRT_Invokable(),
       _name(name),
       _baseDir(baseDir),
       _domainPartSize(domainPartSize),
       _defaultCrcType(defaultCrcType),
+      _compression(compression),
+      _commitConfig(commitConfig),
       _commitExecutor(maxThreads, 128*1024),
       _sessionExecutor(maxThreads, 128*1024),
       _threadPool(8192, 1),
@@ -106,7 +112,8 @@ TransLogServer::TransLogServer(const vespalib::string &name, int listenPort, con
                 if ( ! domainName.empty()) {
                     try {
                         auto domain = std::make_shared<Domain>(domainName, dir(), _commitExecutor, _sessionExecutor,
-                                                               _domainPartSize, _defaultCrcType,_fileHeaderContext);
+                                                               _domainPartSize, _defaultCrcType, _compression, _commitConfig,
+                                                               _fileHeaderContext);
                         _domains[domain->name()] = domain;
                     } catch (const std::exception & e) {
                         LOG(warning, "Failed creating %s domain on startup. Exception = %s", domainName.c_str(), e.what());
@@ -428,7 +435,8 @@ TransLogServer::createDomain(FRT_RPCRequest *req)
     if ( !domain ) {
         try {
             domain = std::make_shared<Domain>(domainName, dir(), _commitExecutor, _sessionExecutor,
-                                              _domainPartSize, _defaultCrcType, _fileHeaderContext);
+                                              _domainPartSize, _defaultCrcType, _compression, _commitConfig,
+                                              _fileHeaderContext);
             Guard domainGuard(_lock);
             _domains[domain->name()] = domain;
             writeDomainDir(domainGuard, dir(), domainList(), _domains);
@@ -537,10 +545,9 @@ TransLogServer::domainStatus(FRT_RPCRequest *req)
 void
 TransLogServer::commit(const vespalib::string & domainName, const Packet & packet, DoneCallback done)
 {
-    (void) done;
     Domain::SP domain(findDomain(domainName));
     if (domain) {
-        domain->commit(packet);
+        domain->commit(packet, std::move(done));
     } else {
         throw IllegalArgumentException("Could not find domain " + domainName);
     }
@@ -557,7 +564,9 @@ TransLogServer::domainCommit(FRT_RPCRequest *req)
     if (domain) {
         Packet packet(params[1]._data._buf, params[1]._data._len);
         try {
-            domain->commit(packet);
+            vespalib::Gate gate;
+            domain->commit(packet, std::make_shared<GateCallback>(gate));
+            gate.await();
             ret.AddInt32(0);
             ret.AddString("ok");
         } catch (const std::exception & e) {
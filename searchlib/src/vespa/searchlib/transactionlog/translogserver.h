@@ -26,7 +26,8 @@ public:
 
     TransLogServer(const vespalib::string &name, int listenPort, const vespalib::string &baseDir,
                    const common::FileHeaderContext &fileHeaderContext,
-                   uint64_t domainPartSize, size_t maxThreads, DomainPart::Crc defaultCrc);
+                   uint64_t domainPartSize, size_t maxThreads, DomainPart::Crc defaultCrc,
+                   const DomainPart::CompressionConfig &compression, const CommitConfig &commitConfig);
     TransLogServer(const vespalib::string &name, int listenPort, const vespalib::string &baseDir,
                    const common::FileHeaderContext &fileHeaderContext, uint64_t domainPartSize);
     TransLogServer(const vespalib::string &name, int listenPort, const vespalib::string &baseDir,
@@ -83,6 +84,8 @@ private:
     vespalib::string                    _baseDir;
     const uint64_t                      _domainPartSize;
     const DomainPart::Crc               _defaultCrcType;
+    const DomainPart::CompressionConfig _compression;
+    const CommitConfig                  _commitConfig;
     vespalib::ThreadStackExecutor       _commitExecutor;
     vespalib::ThreadStackExecutor       _sessionExecutor;
     FastOS_ThreadPool                   _threadPool;
@@ -36,6 +36,25 @@ getCrc(searchlib::TranslogserverConfig::Crcmethod crcType)
     LOG_ABORT("should not be reached");
 }
 
+DomainPart::CompressionConfig
+getCompression(const searchlib::TranslogserverConfig::Compression &compression)
+{
+    DomainPart::CompressionConfig config;
+    if (compression.type == searchlib::TranslogserverConfig::Compression::LZ4) {
+        config.type = DomainPart::CompressionConfig::LZ4;
+    } else if (compression.type == searchlib::TranslogserverConfig::Compression::ZSTD) {
+        config.type = DomainPart::CompressionConfig::ZSTD;
+    }
+    config.compressionLevel = compression.level;
+    return config;
+}
+
+CommitConfig
+getCommitConfig(const searchlib::TranslogserverConfig &cfg)
+{
+    return CommitConfig(cfg.chunk.sizelimit, CommitConfig::DurationSeconds(cfg.chunk.agelimit), cfg.usefsync);
+}
+
 }
 
 void
@@ -43,7 +62,8 @@ TransLogServerApp::start()
 {
     std::shared_ptr<searchlib::TranslogserverConfig> c = _tlsConfig.get();
     auto tls = std::make_shared<TransLogServer>(c->servername, c->listenport, c->basedir, _fileHeaderContext,
-                                            c->filesizemax, c->maxthreads, getCrc(c->crcmethod));
+                                            c->filesizemax, c->maxthreads, getCrc(c->crcmethod),
+                                            getCompression(c->compression), getCommitConfig(*c));
     std::lock_guard<std::mutex> guard(_lock);
     _tls = std::move(tls);
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "docsumstorevalue.h"
+#include <vector>
 
 namespace search::docsummary {
 
@@ -38,6 +39,15 @@ public:
      **/
     virtual DocsumStoreValue getMappedDocsum(uint32_t docid) = 0;
 
+    /**
+     * Hint that docsums for the given documents will be fetched
+     * next, allowing the store to fetch them together. Default is to
+     * do nothing.
+     *
+     * @param docids local document ids in the order they will be fetched
+     **/
+    virtual void prefetch(const std::vector<uint32_t> &docids) { (void) docids; }
+
     /**
      * Will return default input class used.
      **/
@@ -23,6 +23,13 @@ public:
     void write(const K & k, const V & v) {
         (*this)[k] = v;
     }
+    bool read(const K & k, V & v, const V & suffix) const {
+        bool ok = read(k, v);
+        if (ok) {
+            v += suffix;
+        }
+        return ok;
+    }
     void erase(const K & k) {
         M::erase(k);
     }
@@ -48,6 +55,17 @@ TEST("testCache") {
     EXPECT_TRUE(cache.size() == 1);
 }
 
+TEST("require that extra read arguments are passed on to backing store") {
+    B m;
+    cache< CacheParam<P, B> > cache(m, -1);
+    m[1] = "From backing store";
+    EXPECT_EQUAL("From backing store with suffix", cache.read(1, string(" with suffix")));
+    EXPECT_EQUAL("From backing store with suffix", cache.read(1, string(" not used")));
+    EXPECT_EQUAL("From backing store with suffix", cache.read(1));
+    EXPECT_EQUAL(1u, cache.getMiss());
+    EXPECT_EQUAL(2u, cache.getHit());
+}
+
 TEST("testCacheSize")
 {
     B m;
@@ -97,6 +97,13 @@ public:
      */
     V read(const K & key);
 
+    /**
+     * Same as read(key), but the extra arguments are passed on to the
+     * backing store if it has to be consulted.
+     */
+    template <typename... StoreArgs>
+    V read(const K & key, StoreArgs &&... storeArgs);
+
     /**
      * Update the cache and write through to backing store.
      * Object is then put at head of LRU list.
@@ -87,6 +87,14 @@ cache<P>::getGuard() {
 template< typename P >
 typename P::Value
 cache<P>::read(const K & key)
+{
+    return read<>(key);
+}
+
+template< typename P >
+template< typename... StoreArgs >
+typename P::Value
+cache<P>::read(const K & key, StoreArgs &&... storeArgs)
 {
     {
         vespalib::LockGuard guard(_hashLock);
@@ -108,7 +116,7 @@ cache<P>::read(const K & key)
         }
     }
     V value;
-    if (_store.read(key, value)) {
+    if (_store.read(key, value, std::forward<StoreArgs>(storeArgs)...)) {
         vespalib::LockGuard guard(_hashLock);
         Lru::insert(key, value);
         _sizeBytes += calcSize(key, value);
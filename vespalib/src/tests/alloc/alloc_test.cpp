@@ -4,6 +4,10 @@
 #include <vespa/vespalib/util/alloc.h>
 #include <vespa/vespalib/util/exceptions.h>
 #include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
 
 using namespace vespalib;
 using namespace vespalib::alloc;
@@ -248,4 +252,38 @@ TEST("auto alloced mmap alloc can not be shrinked below HUGEPAGE_SIZE/2 + 1 ") {
     EXPECT_EQUAL(SZ, buf.size());
 }
 
+TEST("file can be mapped copy-on-write into anonymous memory") {
+    const char *fileName = "mapped_file.dat";
+    size_t pageSize = getpagesize();
+    std::vector<char> content(pageSize + 100);
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = i % 251;
+    }
+    {
+        std::ofstream os(fileName, std::ios::binary);
+        os.write(&content[0], content.size());
+    }
+    {
+        Alloc buf = Alloc::allocMMapFile(fileName, pageSize, 100, 3 * pageSize);
+        EXPECT_EQUAL(3 * pageSize, buf.size());
+        char *p = static_cast<char *>(buf.get());
+        EXPECT_EQUAL(0, memcmp(p, &content[pageSize], 100));
+        EXPECT_EQUAL(0, p[100]);
+        EXPECT_EQUAL(0, p[2 * pageSize]);
+        p[0] = 42;
+        p[2 * pageSize] = 43;
+        EXPECT_EQUAL(42, p[0]);
+        Alloc grown = buf.create(4 * pageSize);
+        EXPECT_EQUAL(4 * pageSize, grown.size());
+    }
+    {
+        std::ifstream is(fileName, std::ios::binary);
+        std::vector<char> after(content.size());
+        is.read(&after[0], after.size());
+        EXPECT_TRUE(content == after);
+    }
+    EXPECT_EXCEPTION(Alloc::allocMMapFile(fileName, 100, 100, pageSize), IllegalArgumentException, "not page aligned");
+    unlink(fileName);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -2,6 +2,7 @@
 
 #include "avx512.h"
 #include "avxprivate.hpp"
+#include "rangeprivate.hpp"
 
 namespace vespalib:: hwaccelrated {
 
@@ -17,4 +18,40 @@ Avx512Accelrator::dotProduct(const double * af, const double * bf, size_t sz) co
     return avx::dotProductSelectAlignment<double, 64>(af, bf, sz);
 }
 
+void
+Avx512Accelrator::rangeFilter(const int8_t * values, size_t sz, int8_t low, int8_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+Avx512Accelrator::rangeFilter(const int16_t * values, size_t sz, int16_t low, int16_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+Avx512Accelrator::rangeFilter(const int32_t * values, size_t sz, int32_t low, int32_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+Avx512Accelrator::rangeFilter(const int64_t * values, size_t sz, int64_t low, int64_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+Avx512Accelrator::rangeFilter(const float * values, size_t sz, float low, float high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+Avx512Accelrator::rangeFilter(const double * values, size_t sz, double low, double high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
 }
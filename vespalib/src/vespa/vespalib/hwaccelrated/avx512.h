@@ -14,6 +14,12 @@ class Avx512Accelrator : public Avx2Accelrator
 public:
     float dotProduct(const float * a, const float * b, size_t sz) const override;
     double dotProduct(const double * a, const double * b, size_t sz) const override;
+    void rangeFilter(const int8_t * values, size_t sz, int8_t low, int8_t high, uint64_t * bits) const override;
+    void rangeFilter(const int16_t * values, size_t sz, int16_t low, int16_t high, uint64_t * bits) const override;
+    void rangeFilter(const int32_t * values, size_t sz, int32_t low, int32_t high, uint64_t * bits) const override;
+    void rangeFilter(const int64_t * values, size_t sz, int64_t low, int64_t high, uint64_t * bits) const override;
+    void rangeFilter(const float * values, size_t sz, float low, float high, uint64_t * bits) const override;
+    void rangeFilter(const double * values, size_t sz, double low, double high, uint64_t * bits) const override;
 };
 
 }
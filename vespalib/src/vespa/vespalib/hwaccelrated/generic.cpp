@@ -1,6 +1,7 @@
 // Copyright 2017 Yahoo Holdings. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "generic.h"
+#include "rangeprivate.hpp"
 
 namespace vespalib::hwaccelrated {
 
@@ -113,4 +114,40 @@ GenericAccelrator::notBit(void * aOrg, size_t bytes) const
     }
 }
 
+void
+GenericAccelrator::rangeFilter(const int8_t * values, size_t sz, int8_t low, int8_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+GenericAccelrator::rangeFilter(const int16_t * values, size_t sz, int16_t low, int16_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+GenericAccelrator::rangeFilter(const int32_t * values, size_t sz, int32_t low, int32_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+GenericAccelrator::rangeFilter(const int64_t * values, size_t sz, int64_t low, int64_t high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+GenericAccelrator::rangeFilter(const float * values, size_t sz, float low, float high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
+void
+GenericAccelrator::rangeFilter(const double * values, size_t sz, double low, double high, uint64_t * bits) const
+{
+    range::computeRangeFilter(values, sz, low, high, bits);
+}
+
 }
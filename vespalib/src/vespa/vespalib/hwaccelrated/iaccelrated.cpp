@@ -67,6 +67,27 @@ void verifyAccelrator(const IAccelrated & accel)
     delete [] b;
 }
 
+template<typename T>
+void verifyRangeFilter(const IAccelrated & accel)
+{
+    const size_t testLength(200);
+    T values[testLength];
+    for (size_t i(0); i < testLength; i++) {
+        values[i] = (i * 7) % 23;
+    }
+    for (size_t j(0); j < 0x20; j++) {
+        uint64_t bits[4];
+        accel.rangeFilter(&values[j], testLength - j, T(5), T(11), bits);
+        for (size_t i(0); i < 4 * 64; i++) {
+            bool expected = (i < testLength - j) && (values[i + j] >= T(5)) && (values[i + j] <= T(11));
+            if (expected != (((bits[i / 64] >> (i % 64)) & 1) != 0)) {
+                fprintf(stderr, "Accelrator is not computing range filter correctly.\n");
+                LOG_ABORT("should not be reached");
+            }
+        }
+    }
+}
+
 class RuntimeVerificator
 {
 public:
@@ -86,6 +107,9 @@ RuntimeVerificator::RuntimeVerificator()
    verifyAccelrator<double>(*thisCpu); 
    verifyAccelrator<int32_t>(*thisCpu); 
    verifyAccelrator<int64_t>(*thisCpu); 
+   verifyRangeFilter<int8_t>(*thisCpu);
+   verifyRangeFilter<int32_t>(*thisCpu);
+   verifyRangeFilter<double>(*thisCpu);
    
 }
 
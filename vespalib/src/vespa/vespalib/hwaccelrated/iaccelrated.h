@@ -24,6 +24,16 @@ public:
     virtual void andBit(void * a, const void * b, size_t bytes) const = 0;
     virtual void andNotBit(void * a, const void * b, size_t bytes) const = 0;
     virtual void notBit(void * a, size_t bytes) const = 0;
+    /**
+     * Sets bit i in bits if low <= values[i] <= high, for i < sz. Bits
+     * must have room for (sz + 63) / 64 words, unused bits are cleared.
+     */
+    virtual void rangeFilter(const int8_t * values, size_t sz, int8_t low, int8_t high, uint64_t * bits) const = 0;
+    virtual void rangeFilter(const int16_t * values, size_t sz, int16_t low, int16_t high, uint64_t * bits) const = 0;
+    virtual void rangeFilter(const int32_t * values, size_t sz, int32_t low, int32_t high, uint64_t * bits) const = 0;
+    virtual void rangeFilter(const int64_t * values, size_t sz, int64_t low, int64_t high, uint64_t * bits) const = 0;
+    virtual void rangeFilter(const float * values, size_t sz, float low, float high, uint64_t * bits) const = 0;
+    virtual void rangeFilter(const double * values, size_t sz, double low, double high, uint64_t * bits) const = 0;
 
     static IAccelrated::UP getAccelrator() __attribute__((noinline));
 };
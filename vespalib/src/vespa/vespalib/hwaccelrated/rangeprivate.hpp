@@ -0,0 +1,48 @@
+// Copyright 2019 Oath Inc. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace vespalib::hwaccelrated::range {
+
+namespace {
+
+/**
+ * Sets bit i in bits if low <= values[i] <= high. Written to let the
+ * compiler vectorize the comparisons with the instruction set selected
+ * for the including translation unit, hence the anonymous namespace.
+ */
+template <typename T>
+void
+computeRangeFilter(const T * values, size_t sz, T low, T high, uint64_t * bits)
+{
+    uint8_t matches[64];
+    for (size_t i(0); i < sz; i += 64) {
+        const size_t chunk((sz - i < 64) ? (sz - i) : 64);
+        const T * v(values + i);
+        if (chunk == 64) {
+            for (size_t j(0); j < 64; j++) {
+                matches[j] = (low <= v[j]) & (v[j] <= high);
+            }
+        } else {
+            memset(matches, 0, sizeof(matches));
+            for (size_t j(0); j < chunk; j++) {
+                matches[j] = (low <= v[j]) & (v[j] <= high);
+            }
+        }
+        uint64_t word(0);
+        for (size_t j(0); j < 8; j++) {
+            uint64_t bytes;
+            memcpy(&bytes, matches + j * 8, sizeof(bytes));
+            // Gather the lowest bit of each byte into the top byte
+            word |= ((bytes * 0x0102040810204080ul) >> 56) << (j * 8);
+        }
+        bits[i / 64] = word;
+    }
+}
+
+}
+
+}
@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <vespa/fastos/file.h>
 #include <unistd.h>
+#include <fcntl.h>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".vespalib.alloc");
@@ -145,6 +146,7 @@ public:
     size_t resize_inplace(PtrAndSize current, size_t newSize) const override;
     static size_t sresize_inplace(PtrAndSize current, size_t newSize);
     static PtrAndSize salloc(size_t sz, void * wantedAddress);
+    static PtrAndSize sallocFile(const char *fileName, size_t fileOffset, size_t fileBytes, size_t sz);
     static void sfree(PtrAndSize alloc);
     static MemoryAllocator & getDefault();
 private:
@@ -366,6 +368,52 @@ MMapAllocator::salloc(size_t sz, void * wantedAddress)
     return PtrAndSize(buf, sz);
 }
 
+MemoryAllocator::PtrAndSize
+MMapAllocator::sallocFile(const char *fileName, size_t fileOffset, size_t fileBytes, size_t sz)
+{
+    if ((fileOffset % _G_pageSize) != 0) {
+        throw IllegalArgumentException(make_string("File offset %zu for '%s' is not page aligned", fileOffset, fileName));
+    }
+    sz = roundUp2PageSize(std::max(sz, fileBytes));
+    if (sz == 0) {
+        return PtrAndSize(nullptr, 0);
+    }
+    // Huge pages are not used since the file is mapped on top of the anonymous mapping.
+    void *buf = mmap(nullptr, sz, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    if (buf == MAP_FAILED) {
+        throw OOMException(make_string("Failed mmaping anonymous of size %zu errno(%d)", sz, errno));
+    }
+    if (fileBytes > 0) {
+        int fd = open(fileName, O_RDONLY);
+        if (fd < 0) {
+            munmap(buf, sz);
+            throw IllegalStateException(make_string("Failed opening '%s' for mmap errno(%d)", fileName, errno));
+        }
+        void *fileBuf = mmap(buf, fileBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, fileOffset);
+        int mapErrno = errno;
+        close(fd);
+        if (fileBuf == MAP_FAILED) {
+            munmap(buf, sz);
+            throw IllegalStateException(make_string("Failed mmaping '%s' of size %zu at offset %zu errno(%d)",
+                                                    fileName, fileBytes, fileOffset, mapErrno));
+        }
+    }
+    if (sz >= _G_MMapNoCoreLimit) {
+        if (madvise(buf, sz, MADV_DONTDUMP) != 0) {
+            LOG(warning, "Failed madvise(%p, %ld, MADV_DONTDUMP) = '%s'", buf, sz, FastOS_FileInterface::getLastErrorString().c_str());
+        }
+    }
+    if (sz >= _G_MMapLogLimit) {
+        size_t mmapId = std::atomic_fetch_add(&_G_mmapCount, 1ul);
+        string stackTrace = getStackTrace(1);
+        LOG(info, "mmap %ld of size %ld from file '%s' from %s", mmapId, sz, fileName, stackTrace.c_str());
+        LockGuard guard(_G_lock);
+        _G_HugeMappings[buf] = MMapInfo(mmapId, sz, stackTrace);
+        LOG(info, "%ld mappings of accumulated size %ld", _G_HugeMappings.size(), sum(_G_HugeMappings));
+    }
+    return PtrAndSize(buf, sz);
+}
+
 size_t
 MMapAllocator::sresize_inplace(PtrAndSize current, size_t newSize) {
     newSize = roundUp2PageSize(newSize);
@@ -490,6 +538,12 @@ Alloc::allocMMap(size_t sz)
     return Alloc(&MMapAllocator::getDefault(), sz);
 }
 
+Alloc
+Alloc::allocMMapFile(const char *fileName, size_t fileOffset, size_t fileBytes, size_t sz)
+{
+    return Alloc(&MMapAllocator::getDefault(), MMapAllocator::sallocFile(fileName, fileOffset, fileBytes, sz));
+}
+
 Alloc
 Alloc::alloc()
 {
@@ -94,6 +94,15 @@ public:
     static Alloc allocAlignedHeap(size_t sz, size_t alignment);
     static Alloc allocHeap(size_t sz=0);
     static Alloc allocMMap(size_t sz=0);
+    /**
+     * Map fileBytes of the given file, starting at fileOffset, copy-on-write
+     * into the start of an anonymous mapping of sz bytes. Pages are read from
+     * the file on first access and modified pages become private anonymous
+     * memory; the file itself is never written. fileOffset must be a multiple
+     * of the page size. Allocations created from this one are ordinary
+     * anonymous mappings.
+     */
+    static Alloc allocMMapFile(const char *fileName, size_t fileOffset, size_t fileBytes, size_t sz);
     /**
      * Optional alignment is assumed to be <= system page size, since mmap
      * is always used when size is above limit.
@@ -103,6 +112,7 @@ public:
 private:
     Alloc(const MemoryAllocator * allocator, size_t sz) : _alloc(allocator->alloc(sz)), _allocator(allocator) { }
     Alloc(const MemoryAllocator * allocator) : _alloc(nullptr, 0), _allocator(allocator) { }
+    Alloc(const MemoryAllocator * allocator, PtrAndSize alloc) : _alloc(alloc), _allocator(allocator) { }
     void clear() {
         _alloc.first = nullptr;
         _alloc.second = 0;